@@ -112,13 +112,31 @@ typedef struct EbSvtAv1DecConfiguration
     uint32_t                 asm_type;
     // Application Specific parameters
 
-    /* Number of threads used by decoder.
+    /* Number of threads used by decoder. The tiles of a tile group are
+    * parsed and decoded in parallel. With fewer tiles than threads, each
+    * tile is parsed on one thread while its superblock rows are decoded
+    * in a wavefront on all threads. The output does not depend on it.
     *
-    * 0 = System default.
+    * 0 = System default, one thread per logical processor.
     * 1 = Single thread decoding.
     *
-    * Default is 0. */
+    * Default is 1. */
     uint32_t                 threads;
+
+    /* Maximum number of frames decoded in parallel, the threads are shared
+    * among them. Intra frames are decoded along with the frames before
+    * them, the other frames wait until those are decoded. The pictures
+    * are output max_frame_delay - 1 decode calls later : calling
+    * eb_svt_decode_frame() with a data_size of 0 at the end of the stream
+    * flushes them. Each picture output must be taken with
+    * eb_svt_dec_get_picture() before the next frame is sent, otherwise
+    * eb_svt_decode_frame() returns EB_ErrorInsufficientResources and the
+    * frame must be sent again.
+    *
+    * 1 = One frame at a time, no output delay.
+    *
+    * Default is 1. */
+    uint32_t                 max_frame_delay;
     // Application Specific parameters
 
     /* ID assigned to each channel when multiple instances are running within the
@@ -193,6 +211,8 @@ typedef struct EbSvtAv1DecConfiguration
 
     /*!\brief STEP 5-alt-1: Decodes a frame with associated data. The data in *data
      * should belong to one frame, possibly with sequence header and metadata.
+     * A data_size of 0 signals the end of the stream, the frames still
+     * being decoded are then returned by eb_svt_dec_get_picture().
      *
      * Parameter:
      * @ *svt_dec_component     Decoder handle
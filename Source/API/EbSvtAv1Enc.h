@@ -12,6 +12,7 @@ extern "C" {
 
 #include "stdint.h"
 #include "EbSvtAv1.h"
+#include "EbSvtAv1ExtFrameBuf.h"
 
 #define TILES    1
 #define ALT_REF_OVERLAY_APP                         1
@@ -80,6 +81,10 @@ typedef struct EbSvtAv1EncConfiguration
      * In Random Access structure, the B/b pictures can refer to reference pictures
      * from both directions (past and future).
      *
+     * Low Delay is coded with a flat structure, without look ahead, scene change
+     * detection or alt-refs, and every picture is output as soon as it is coded.
+     * It is only supported with rate_control_mode 0.
+     *
      * Default is 2. */
     uint8_t                  pred_structure;
     /* Decides whether to use B picture or P picture in the base layer.
@@ -196,6 +201,14 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is 0. */
     EbBool                   disable_dlf_flag;
 
+    /* Flag to run the CDEF and the Loop Restoration of each SB row right
+     * behind its Deblocking, in the Deblocking tasks. The CDEF strengths are
+     * then derived from the qindex and the restoration units are decided row
+     * by row, so the output differs from the default picture level passes.
+     *
+     * Default is 0. */
+    EbBool                   enable_fused_loop_filter;
+
     /* Denoise the input picture when noise levels are too high
     * Flag to enable the denoising
     *
@@ -256,6 +269,9 @@ typedef struct EbSvtAv1EncConfiguration
      *
      * 0 = Constant QP.
      * 1 = Average BitRate.
+     * 4 = Constant rate factor (CRF), the pictures get the constant quality
+     *     QP of rate control mode 0 for the qp setting, capped by the VBV
+     *     buffer model when vbv_max_rate is set.
      *
      * Default is 0. */
     uint32_t                 rate_control_mode;
@@ -285,16 +301,55 @@ typedef struct EbSvtAv1EncConfiguration
      *
      * Default is 0. */
     uint32_t                 min_qp_allowed;
+    /* Two pass encoding.
+     *
+     * 0 = Single pass.
+     * 1 = First pass, encodes as fast as possible in constant QP to collect
+     *     the statistics of the pictures, given by
+     *     eb_svt_enc_get_first_pass_stats.
+     * 2 = Second pass, rate control mode 1 spreads target_bit_rate over the
+     *     whole clip from the statistics given to
+     *     eb_svt_enc_set_first_pass_stats.
+     *
+     * The first and the second pass need frames_to_be_encoded.
+     *
+     * Default is 0. */
+    uint32_t                 pass;
+    /* Rate in bits/second at which the VBV (video buffering verifier) buffer
+     * of the decoder fills, only applicable when rate control mode is set to
+     * 4. The QP is raised as the buffer empties below half, and so that the
+     * predicted size of each picture leaves a fifth of the buffer. The sizes
+     * are predicted in a single pass, content much harder to code than the
+     * pictures before it may still underflow the buffer.
+     *
+     * Default is 0, no buffer model. */
+    uint32_t                 vbv_max_rate;
+    /* Size of the VBV buffer in bits, only applicable when vbv_max_rate is
+     * set. The buffer starts 90% full.
+     *
+     * Default is 0, one second of vbv_max_rate. */
+    uint32_t                 vbv_buffer_size;
 
     /* Flag to signal the content being a screen sharing content type
     *
     * Default is 2. */
     uint32_t                 screen_content_mode;
 
-    /* Enable adaptive quantization within a frame using segmentation.
+    /* Enable adaptive quantization within a frame using segmentation, with
+     * RateControlMode 0.
      *
-     * Default is FALSE. */
-     EbBool                 enable_adaptive_quantization;
+     * 0 = OFF.
+     * 1 = The segments group the blocks of similar variance.
+     * 2 = The segments group the SBs by how much of them is referenced by the
+     *     pictures of the look ahead, as propagated backwards along the motion
+     *     estimation results. The SBs predicting many other blocks get a lower
+     *     QP than the SBs that are soon replaced. Needs look_ahead_distance.
+     *     It helps content with motion, but can lose on static or synthetic
+     *     content: in Y PSNR BD-rate against 0, -1.3% on a panning texture,
+     *     +1.0% on a static background and +1.8% on a synthetic gradient.
+     *
+     * Default is 0. */
+    uint8_t                  enable_adaptive_quantization;
 
     // Tresholds
     /* Flag to signal that the input yuv is HDR10 BT2020 using SMPTE ST2048, requires
@@ -367,6 +422,42 @@ typedef struct EbSvtAv1EncConfiguration
      * Default is -1. */
     int32_t                 target_socket;
 
+    /* Run the kernel threads of all stages on one pool of run slots sized to
+     * the logical processors in use. A stage thread gives its slot back while
+     * it waits for input, so the processors follow the busiest stage instead
+     * of being split between stages up front. The encoder still creates the
+     * threads of every stage, the pool only caps how many of them run at
+     * once. With the LOCK_FREE_FIFO build, the stage threads of the pool wait
+     * for input without spinning first, as a spinning thread keeps its slot.
+     *
+     * Default is 0. */
+    EbBool                  enable_thread_pool;
+
+    /* NUMA node to run on. The kernel threads are bound to the logical
+     * processors of the node, the first LogicalProcessorNumber of them if set,
+     * and the memory of the encoder, its picture pools included, is placed on
+     * the memory of the node. Cannot be set with TargetSocket.
+     *
+     * -1 = No binding.
+     *  N = Node N.
+     *
+     * Default is -1. */
+    int32_t                 numa_node;
+
+    // Memory management
+
+    /* Start the picture buffer pools at the size a single core pipeline needs
+     * and construct more buffers only when the pipeline stalls waiting on an
+     * exhausted pool, up to the size used when the flag is off.
+     *
+     * Default is 0. */
+    EbBool                  adaptive_pool_sizing;
+    /* Memory in MB past which adaptive pool sizing stops growing the pools.
+     * 0 = no bound. Requires adaptive_pool_sizing.
+     *
+     * Default is 0. */
+    uint32_t                memory_budget;
+
     // Debug tools
 
     /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -423,6 +514,107 @@ typedef struct EbSvtAv1EncConfiguration
     EbBool                   enable_overlays;
 } EbSvtAv1EncConfiguration;
 
+    /* Callback function to release an input picture.
+     *
+     * This function is called by the encoder, from one of its threads, once
+     * it no longer references the planes of a picture sent in zero copy mode
+     * (see eb_svt_enc_set_input_buffer_callback). The planes can then be
+     * reused or freed.
+     *
+     * Parameters:
+     * @ *p_app_private  p_app_private of the buffer header the picture was sent with.
+     * @ *priv_data      private data given with the callback. */
+    typedef void (*eb_release_input_buffer)(
+        void                *p_app_private,
+        void                *priv_data);
+
+    /* Callback function to write the motion estimation hints of a picture.
+     *
+     * This function is called by the encoder, from one of its threads, once
+     * the motion estimation and the open loop intra search of a picture are
+     * done (see eb_svt_enc_set_me_hints_callbacks). The hints of a picture
+     * are given in consecutive chunks, to be appended in order. The pictures
+     * come one after the other, not in a particular order.
+     *
+     * Parameters:
+     * @ *priv_data      private data given with the callback.
+     * @ picture_number  number of the picture in display order.
+     * @ *data           chunk of the hints.
+     * @ size            size of the chunk in bytes. */
+    typedef void (*eb_write_me_hints)(
+        void                *priv_data,
+        uint64_t             picture_number,
+        const uint8_t       *data,
+        uint32_t             size);
+
+    /* Callback function to read the motion estimation hints of a picture.
+     *
+     * This function is called by the encoder, from one of its threads,
+     * before the motion estimation of a picture. The hints of a picture are
+     * read in consecutive chunks from their start, in the order they were
+     * written.
+     *
+     * Parameters:
+     * @ *priv_data      private data given with the callback.
+     * @ picture_number  number of the picture in display order.
+     * @ *data           filled with the next chunk of the hints.
+     * @ size            size of the chunk in bytes.
+     *
+     * Returns the number of bytes read, less than size when the hints of the
+     * picture are missing or shorter. */
+    typedef uint32_t (*eb_read_me_hints)(
+        void                *priv_data,
+        uint64_t             picture_number,
+        uint8_t             *data,
+        uint32_t             size);
+
+#define EB_PIPELINE_STATS_MAX_KERNELS   16
+#define EB_PIPELINE_STATS_DEPTH_BINS    8
+
+    /* Counters of one encoder kernel (pipeline stage), summed over its
+     * threads. Times are in microseconds. */
+    typedef struct EbKernelStats
+    {
+        const char  *kernel_name;
+        uint32_t     thread_count;
+
+        // Running time, i.e. outside of the waits below
+        uint64_t     busy_time;
+        // Time blocked waiting for input, in eb_get_full_object
+        uint64_t     full_wait_time;
+        // Time blocked waiting for an output buffer, in eb_get_empty_object
+        uint64_t     empty_wait_time;
+        uint64_t     full_get_count;
+        uint64_t     empty_get_count;
+
+        // Number of objects queued in the input fifo when the kernel asks
+        // for one. Bin 0 counts the empty fifos, bin n the depths in
+        // [2^(n-1), 2^n), the last bin all the deeper ones.
+        uint64_t     fifo_depth_histogram[EB_PIPELINE_STATS_DEPTH_BINS];
+    } EbKernelStats;
+
+    typedef struct EbPipelineStats
+    {
+        // Time since the kernel threads were started
+        uint64_t        elapsed_time;
+        uint32_t        kernel_count;
+        EbKernelStats   kernels[EB_PIPELINE_STATS_MAX_KERNELS];
+    } EbPipelineStats;
+
+    /* Memory held by an encoder instance. Sizes are in bytes. */
+    typedef struct EbMemoryFootprint
+    {
+        // Sum of the sizes the library asked for
+        uint64_t        allocated_size;
+        // Memory reserved from the system to hold them
+        uint64_t        reserved_size;
+        uint32_t        allocation_count;
+        uint32_t        chunk_count;
+        uint32_t        thread_count;
+        uint32_t        semaphore_count;
+        uint32_t        mutex_count;
+    } EbMemoryFootprint;
+
     /* STEP 1: Call the library to construct a Component Handle.
      *
      * Parameter:
@@ -445,6 +637,120 @@ typedef struct EbSvtAv1EncConfiguration
         EbComponentType           *svt_enc_component,
         EbSvtAv1EncConfiguration   *pComponentParameterStructure); // pComponentParameterStructure contents will be copied to the library
 
+    /* OPTIONAL: Reference the input pictures instead of copying them, to be
+     * called before eb_init_encoder.
+     *
+     * The planes of the pictures sent are then used in place until
+     * release_buffer is called for them, which may be several frames later
+     * (look ahead, temporal filtering, motion estimation references), at the
+     * latest in eb_deinit_encoder. The
+     * encoder writes to the planes : it pads them and filters alt-ref
+     * pictures in place. Each plane needs a writable border around the
+     * picture rounded up to a multiple of 8 : 68 luma samples on the left,
+     * the right and the top and 132 at the bottom, half of it for chroma.
+     * The strides must be the same for all the pictures, with cb_stride equal
+     * to cr_stride, else eb_svt_enc_send_picture returns
+     * EB_ErrorBadParameter.
+     *
+     * Only the 8 bit and the compressed 10 bit (MSB planes) formats are
+     * referenced, other inputs are copied and released before
+     * eb_svt_enc_send_picture returns.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ release_buffer      callback function to release an input picture.
+     * @ *priv_data          private data passed back to release_buffer. */
+    EB_API EbErrorType eb_svt_enc_set_input_buffer_callback(
+        EbComponentType           *svt_enc_component,
+        eb_release_input_buffer    release_buffer,
+        void                      *priv_data);
+
+    /* OPTIONAL: Have the encoder write the output packets into buffers from
+     * the application, to be called before eb_init_encoder.
+     *
+     * allocate_buffer is called from the packetization thread, once the size
+     * of the packet is known, and the packet is written straight into the
+     * buffer it returns. The p_buffer of the packets given by
+     * eb_svt_get_packet then points to it. release_buffer is called for it in
+     * eb_svt_release_out_buffer, or at the latest in eb_deinit_encoder. The
+     * output packet pool then no longer allocates any payload.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ allocate_buffer     callback function to allocate a packet buffer,
+     *                       returns 0 on success.
+     * @ release_buffer      callback function to release a packet buffer.
+     * @ *priv_data          private data used by the allocator. */
+    EB_API EbErrorType eb_svt_enc_set_packet_buffer_callbacks(
+        EbComponentType           *svt_enc_component,
+        eb_allocate_frame_buffer   allocate_buffer,
+        eb_release_frame_buffer    release_buffer,
+        void                      *priv_data);
+
+    /* OPTIONAL: Give the statistics of the first pass to the second pass, to
+     * be called before eb_init_encoder. The statistics are copied. They may
+     * come from a first pass at another resolution, e.g. the lowest rendition
+     * of a ladder, the sizes of the pictures are then scaled by the ratio of
+     * the numbers of pixels. They are only the size, QP and type of each
+     * picture, eb_svt_enc_set_ladder_lead does not share them.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *stats              statistics given by eb_svt_enc_get_first_pass_stats.
+     * @ size                size of the statistics in bytes. */
+    EB_API EbErrorType eb_svt_enc_set_first_pass_stats(
+        EbComponentType           *svt_enc_component,
+        const uint8_t             *stats,
+        uint32_t                   size);
+
+    /* OPTIONAL: Encode the same pictures as the lead encoder of a ladder at
+     * another resolution, reusing the hierarchical motion estimation search
+     * centers of the lead. For the references both search, the hierarchical
+     * motion estimation of the encoder starts from the centers of the lead
+     * scaled to its resolution, and its widest level searches a 4x narrower
+     * area. Nothing else is shared: each encoder runs its own picture
+     * analysis, scene change detection, temporal filtering, mode decision and
+     * rate control.
+     *
+     * To be called after eb_svt_enc_set_parameter of both encoders and before
+     * any picture is sent to them. Both need the same frames_to_be_encoded and
+     * must be sent the same pictures in the same order. The lead must be sent
+     * each picture before its renditions and must not be a rendition itself.
+     * A rendition has a single lead. The lead may be deinitialized first,
+     * its renditions then stop waiting for it and search the pictures it did
+     * not analyze on their own.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler of the rendition.
+     * @ *lead_component     Encoder handler of the lead, usually the lowest
+     *                       resolution of the ladder. */
+    EB_API EbErrorType eb_svt_enc_set_ladder_lead(
+        EbComponentType           *svt_enc_component,
+        EbComponentType           *lead_component);
+
+    /* OPTIONAL: Write the motion estimation hints of the pictures, and/or
+     * read them back in another encode of the same source, to be called
+     * before eb_init_encoder.
+     *
+     * The hints of a picture are the results of its motion estimation and
+     * open loop intra search. The encoder reading them skips both searches
+     * for the pictures whose hints match its resolution, preset, prediction
+     * structure and references, e.g. when encoding the same source again at
+     * another rate. The other pictures are searched as usual. The source and
+     * the other settings, such as the temporal filtering, must be the same,
+     * the hints are otherwise used as is.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ write_hints         callback function to write the hints, or NULL.
+     * @ read_hints          callback function to read the hints, or NULL.
+     * @ *priv_data          private data passed back to the callbacks. */
+    EB_API EbErrorType eb_svt_enc_set_me_hints_callbacks(
+        EbComponentType           *svt_enc_component,
+        eb_write_me_hints          write_hints,
+        eb_read_me_hints           read_hints,
+        void                      *priv_data);
+
     /* STEP 3: Initialize encoder and allocates memory to necessary buffers.
      *
      * Parameter:
@@ -513,6 +819,40 @@ typedef struct EbSvtAv1EncConfiguration
         EbComponentType      *svt_enc_component,
         EbBufferHeaderType   *p_buffer);
 
+    /* OPTIONAL: Get the statistics of the first pass, once the packet with
+     * EB_BUFFERFLAG_EOS is received. The buffer is held by the encoder until
+     * eb_deinit_encoder.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ **stats             Set to the statistics.
+     * @ *size               Set to the size of the statistics in bytes. */
+    EB_API EbErrorType eb_svt_enc_get_first_pass_stats(
+        EbComponentType      *svt_enc_component,
+        const uint8_t       **stats,
+        uint32_t             *size);
+
+    /* OPTIONAL: Get the per kernel pipeline counters, at any time between
+     * eb_init_encoder and eb_deinit_encoder. They are only collected when
+     * the library is built with PIPELINE_STATS, kernel_count is 0 otherwise.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *stats              Filled with the counters. */
+    EB_API EbErrorType eb_svt_enc_get_pipeline_stats(
+        EbComponentType      *svt_enc_component,
+        EbPipelineStats      *stats);
+
+    /* OPTIONAL: Get the memory held by the encoder instance, at any time
+     * between eb_init_handle and eb_deinit_encoder.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *footprint          Filled with the sizes and counts. */
+    EB_API EbErrorType eb_svt_enc_get_memory_footprint(
+        EbComponentType      *svt_enc_component,
+        EbMemoryFootprint    *footprint);
+
     /* STEP 6: Deinitialize encoder library.
      *
      * Parameter:
@@ -14,7 +14,8 @@ extern "C" {
 
 /*!\brief External frame buffer
  *
- * This structure holds allocated frame buffers used by the decoder.
+ * This structure holds allocated frame buffers used by the decoder, and
+ * the payload of the output packets of the encoder.
  */
 typedef struct EbExtFrameBuf {
    /* Pointer to the memory allocates externally for the codec
@@ -32,7 +33,8 @@ typedef struct EbExtFrameBuf {
 /* Callback function to allocate frame buffer.
  *
  * This function is called by the decoder to allocate the
- * data for the frame buffer.
+ * data for the frame buffer, and by the encoder to allocate the
+ * payload of an output packet.
  * Parameters:
  * @  *frame_buf pointer to the frame buffer structure to be allocated
  * @  min_size  requested data size in bytes.
@@ -46,7 +48,8 @@ typedef int (*eb_allocate_frame_buffer)(
  *
  * This function is called by the decoder to release the
  * data for the frame buffer. THe buffer should not be used
- * by the decoder.
+ * by the decoder. The encoder calls it when the packet is
+ * released with eb_svt_release_out_buffer.
  *
  * Parameters:
  * @  *frame_buf pointer to the frame buffer structure to be allocated
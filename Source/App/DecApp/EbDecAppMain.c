@@ -207,6 +207,15 @@ int32_t main(int32_t argc, char* argv[])
                 else break;
             }
 
+            /* Output the frames still in flight */
+            return_error |= eb_svt_decode_frame(p_handle, NULL, 0);
+            while (eb_svt_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) != EB_DecNoOutputPicture) {
+                if (enable_md5)
+                    write_md5(recon_buffer, &cli, &md5_ctx);
+                else
+                    write_frame(recon_buffer, &cli);
+            }
+
             if (enable_md5) {
                 md5_final(md5_digest, &md5_ctx);
                 print_md5(md5_digest);
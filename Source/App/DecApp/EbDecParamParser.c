@@ -27,6 +27,8 @@ static void set_bit_depth(const char *value, EbSvtAv1DecConfiguration *cfg) { cf
 static void set_pic_width(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_picture_width = strtoul(value, NULL, 0); };
 static void set_pic_height(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_picture_height = strtoul(value, NULL, 0); };
 static void set_colour_space(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_color_format = parse_name(value, csp_names); };
+static void set_num_thread(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->threads = strtoul(value, NULL, 0); };
+static void set_frame_delay(const char *value, EbSvtAv1DecConfiguration *cfg) { cfg->max_frame_delay = strtoul(value, NULL, 0); };
 
  /**********************************
   * Config Entry Array
@@ -35,6 +37,8 @@ ConfigEntry config_entry[] = {
     // Decoder settings
     { SKIP_FRAME_TOKEN, "SkipFrame", 1, set_skip_frame },
     { LIMIT_FRAME_TOKEN, "LimitFrame", 1, set_limit_frame },
+    { THREADS_TOKEN, "ThreadCount", 1, set_num_thread },
+    { FRAME_DELAY_TOKEN, "FrameDelay", 1, set_frame_delay },
     // Picture properties
     { BIT_DEPTH_TOKEN,"InputBitDepth", 1, set_bit_depth },
     { PIC_WIDTH_TOKEN, "PictureWidth", 1, set_pic_width},
@@ -58,6 +62,8 @@ static void showHelp()
     H0( " -h <arg>                  Input picture height \n");
     H0( " -colour-space <arg>       Input picture colour space. [400, 420, 422, 444]\n");
     H0( " -md5                      MD5 support flag \n");
+    H0( " -threads <arg>            Number of tile decode threads, 0 : one per logical processor [default 1]\n");
+    H0( " -frame-delay <arg>        Maximum number of frames decoded in parallel [default 1]\n");
 
     exit(1);
 }
@@ -10,6 +10,7 @@
 #include "EbAppString.h"
 #include "EbAppConfig.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
 
 #ifdef _WIN32
 #else
@@ -29,14 +30,20 @@
 #define ERROR_FILE_TOKEN                "-errlog"
 #define QP_FILE_TOKEN                   "-qp-file"
 #define STAT_FILE_TOKEN                 "-stat-file"
+#define INPUT_STAT_FILE_TOKEN           "-input-stat-file"
+#define OUTPUT_STAT_FILE_TOKEN          "-output-stat-file"
+#define INPUT_ME_HINTS_FILE_TOKEN       "-input-me-hints-file"
+#define OUTPUT_ME_HINTS_FILE_TOKEN      "-output-me-hints-file"
 #define WIDTH_TOKEN                     "-w"
 #define HEIGHT_TOKEN                    "-h"
 #define NUMBER_OF_PICTURES_TOKEN        "-n"
 #define BUFFERED_INPUT_TOKEN            "-nb"
+#define READ_AHEAD_TOKEN                "-read-ahead"
 #define BASE_LAYER_SWITCH_MODE_TOKEN    "-base-layer-switch-mode" // no Eval
 #define QP_TOKEN                        "-q"
 #define USE_QP_FILE_TOKEN               "-use-q-file"
 #define STAT_REPORT_TOKEN               "-stat-report"
+#define PIPELINE_STATS_TOKEN            "-pipeline-stats"
 #define FRAME_RATE_TOKEN                "-fps"
 #define FRAME_RATE_NUMERATOR_TOKEN      "-fps-num"
 #define FRAME_RATE_DENOMINATOR_TOKEN    "-fps-denom"
@@ -56,6 +63,7 @@
 #define SEPERATE_FILDS_TOKEN            "-separate-fields"
 #define INTRA_REFRESH_TYPE_TOKEN        "-irefresh-type" // no Eval
 #define LOOP_FILTER_DISABLE_TOKEN       "-dlf"
+#define FUSED_LOOP_FILTER_TOKEN         "-fused-lf"
 #define LOCAL_WARPED_ENABLE_TOKEN       "-local-warp"
 #define USE_DEFAULT_ME_HME_TOKEN        "-use-default-me-hme"
 #define HME_ENABLE_TOKEN                "-hme"
@@ -90,6 +98,10 @@
 #define TARGET_BIT_RATE_TOKEN           "-tbr"
 #define MAX_QP_TOKEN                    "-max-qp"
 #define MIN_QP_TOKEN                    "-min-qp"
+#define PASS_TOKEN                      "-pass"
+#define VBV_MAX_RATE_TOKEN              "-vbv-maxrate"
+#define VBV_BUFFER_SIZE_TOKEN           "-vbv-bufsize"
+#define LADDER_LEAD_TOKEN               "-ladder-lead"
 #define ADAPTIVE_QP_ENABLE_TOKEN        "-adaptive-quantization"
 #define LOOK_AHEAD_DIST_TOKEN           "-lad"
 #define SUPER_BLOCK_SIZE_TOKEN          "-sb-size"
@@ -103,6 +115,10 @@
 #define ASM_TYPE_TOKEN                  "-asm"
 #define THREAD_MGMNT                    "-lp"
 #define TARGET_SOCKET                   "-ss"
+#define THREAD_POOL_TOKEN               "-thread-pool"
+#define NUMA_NODE_TOKEN                 "-numa-node"
+#define ADAPTIVE_POOLS_TOKEN            "-adaptive-pools"
+#define MEMORY_BUDGET_TOKEN             "-mem-budget"
 #define CONFIG_FILE_COMMENT_CHAR    '#'
 #define CONFIG_FILE_NEWLINE_CHAR    '\n'
 #define CONFIG_FILE_RETURN_CHAR     '\r'
@@ -164,12 +180,34 @@ static void SetCfgStatFile(const char *value, EbConfig *cfg)
     if (cfg->stat_file) { fclose(cfg->stat_file); }
     FOPEN(cfg->stat_file, value, "wb");
 };
+static void SetCfgInputStatFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->input_stat_file) { fclose(cfg->input_stat_file); }
+    FOPEN(cfg->input_stat_file, value, "rb");
+};
+static void SetCfgOutputStatFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->output_stat_file) { fclose(cfg->output_stat_file); }
+    FOPEN(cfg->output_stat_file, value, "wb");
+};
+static void SetCfgInputMeHintsFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->input_me_hints_file) { fclose(cfg->input_me_hints_file); }
+    FOPEN(cfg->input_me_hints_file, value, "rb");
+};
+static void SetCfgOutputMeHintsFile(const char *value, EbConfig *cfg)
+{
+    if (cfg->output_me_hints_file) { fclose(cfg->output_me_hints_file); }
+    FOPEN(cfg->output_me_hints_file, value, "wb");
+};
+static void SetPipelineStats                    (const char *value, EbConfig *cfg) {cfg->pipeline_stats = (uint8_t) strtoul(value, NULL, 0);};
 static void SetStatReport                       (const char *value, EbConfig *cfg) {cfg->stat_report = (uint8_t) strtoul(value, NULL, 0);};
 static void SetCfgSourceWidth                   (const char *value, EbConfig *cfg) {cfg->source_width = strtoul(value, NULL, 0);};
 static void SetInterlacedVideo                  (const char *value, EbConfig *cfg) {cfg->interlaced_video  = (EbBool) strtoul(value, NULL, 0);};
 static void SetSeperateFields                   (const char *value, EbConfig *cfg) {cfg->separate_fields = (EbBool) strtoul(value, NULL, 0);};
 static void SetCfgSourceHeight                  (const char *value, EbConfig *cfg) {cfg->source_height = strtoul(value, NULL, 0) >> cfg->separate_fields;};
 static void SetCfgFramesToBeEncoded             (const char *value, EbConfig *cfg) {cfg->frames_to_be_encoded = strtol(value,  NULL, 0) << cfg->separate_fields;};
+static void SetReadAhead                        (const char *value, EbConfig *cfg) {cfg->read_ahead = strtol(value, NULL, 0);};
 static void SetBufferedInput                    (const char *value, EbConfig *cfg) {cfg->buffered_input = (strtol(value, NULL, 0) != -1 && cfg->separate_fields) ? strtol(value, NULL, 0) << cfg->separate_fields : strtol(value, NULL, 0);};
 static void SetFrameRate                        (const char *value, EbConfig *cfg) {
     cfg->frame_rate = strtoul(value, NULL, 0);
@@ -194,6 +232,7 @@ static void SetCfgQp                            (const char *value, EbConfig *cf
 static void SetCfgUseQpFile                     (const char *value, EbConfig *cfg) {cfg->use_qp_file = (EbBool)strtol(value, NULL, 0); };
 static void SetCfgFilmGrain                     (const char *value, EbConfig *cfg) { cfg->film_grain_denoise_strength = strtol(value, NULL, 0); };  //not bool to enable possible algorithm extension in the future
 static void SetDisableDlfFlag                   (const char *value, EbConfig *cfg) {cfg->disable_dlf_flag = (EbBool)strtoul(value, NULL, 0);};
+static void SetEnableFusedLoopFilter            (const char *value, EbConfig *cfg) {cfg->enable_fused_loop_filter = (EbBool)strtoul(value, NULL, 0);};
 static void SetEnableLocalWarpedMotionFlag      (const char *value, EbConfig *cfg) {cfg->enable_warped_motion = (EbBool)strtoul(value, NULL, 0);};
 static void SetEnableHmeFlag                    (const char *value, EbConfig *cfg) {cfg->enable_hme_flag = (EbBool)strtoul(value, NULL, 0);};
 static void SetEnableHmeLevel0Flag              (const char *value, EbConfig *cfg) {cfg->enable_hme_level0_flag = (EbBool)strtoul(value, NULL, 0);};
@@ -206,7 +245,11 @@ static void SetRateControlMode                  (const char *value, EbConfig *cf
 static void SetTargetBitRate                    (const char *value, EbConfig *cfg) {cfg->target_bit_rate = strtoul(value, NULL, 0);};
 static void SetMaxQpAllowed                     (const char *value, EbConfig *cfg) {cfg->max_qp_allowed = strtoul(value, NULL, 0);};
 static void SetMinQpAllowed                     (const char *value, EbConfig *cfg) {cfg->min_qp_allowed = strtoul(value, NULL, 0);};
-static void SetAdaptiveQuantization             (const char *value, EbConfig *cfg) {cfg->enable_adaptive_quantization = (EbBool)strtol(value,  NULL, 0);};
+static void SetPass                             (const char *value, EbConfig *cfg) {cfg->pass = strtoul(value, NULL, 0);};
+static void SetVbvMaxRate                       (const char *value, EbConfig *cfg) {cfg->vbv_max_rate = strtoul(value, NULL, 0);};
+static void SetVbvBufferSize                    (const char *value, EbConfig *cfg) {cfg->vbv_buffer_size = strtoul(value, NULL, 0);};
+static void SetLadderLead                       (const char *value, EbConfig *cfg) {cfg->ladder_lead = strtoul(value, NULL, 0);};
+static void SetAdaptiveQuantization             (const char *value, EbConfig *cfg) {cfg->enable_adaptive_quantization = (uint8_t)strtol(value,  NULL, 0);};
 static void SetEnableHmeLevel1Flag              (const char *value, EbConfig *cfg) {cfg->enable_hme_level1_flag  = (EbBool)strtoul(value, NULL, 0);};
 static void SetEnableHmeLevel2Flag              (const char *value, EbConfig *cfg) {cfg->enable_hme_level2_flag  = (EbBool)strtoul(value, NULL, 0);};
 static void SetCfgSearchAreaWidth               (const char *value, EbConfig *cfg) {cfg->search_area_width = strtoul(value, NULL, 0);};
@@ -256,6 +299,10 @@ static void SetLatencyMode                      (const char *value, EbConfig *cf
 static void SetAsmType                          (const char *value, EbConfig *cfg)  {cfg->asm_type                   = (uint32_t)strtoul(value, NULL, 0);};
 static void SetLogicalProcessors                (const char *value, EbConfig *cfg)  {cfg->logical_processors         = (uint32_t)strtoul(value, NULL, 0);};
 static void SetTargetSocket                     (const char *value, EbConfig *cfg)  {cfg->target_socket              = (int32_t)strtol(value, NULL, 0);};
+static void SetThreadPool                       (const char *value, EbConfig *cfg)  {cfg->enable_thread_pool         = (EbBool)strtol(value, NULL, 0);};
+static void SetNumaNode                         (const char *value, EbConfig *cfg)  {cfg->numa_node                  = (int32_t)strtol(value, NULL, 0);};
+static void SetAdaptivePools                    (const char *value, EbConfig *cfg)  {cfg->adaptive_pool_sizing       = (EbBool)strtol(value, NULL, 0);};
+static void SetMemoryBudget                     (const char *value, EbConfig *cfg)  {cfg->memory_budget              = (uint32_t)strtoul(value, NULL, 0);};
 
 enum cfg_type{
     SINGLE_INPUT,   // Configuration parameters that have only 1 value input
@@ -283,6 +330,10 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, OUTPUT_RECON_TOKEN, "ReconFile", SetCfgReconFile },
     { SINGLE_INPUT, QP_FILE_TOKEN, "QpFile", SetCfgQpFile },
     { SINGLE_INPUT, STAT_FILE_TOKEN, "StatFile", SetCfgStatFile },
+    { SINGLE_INPUT, INPUT_STAT_FILE_TOKEN, "InputStatFile", SetCfgInputStatFile },
+    { SINGLE_INPUT, OUTPUT_STAT_FILE_TOKEN, "OutputStatFile", SetCfgOutputStatFile },
+    { SINGLE_INPUT, INPUT_ME_HINTS_FILE_TOKEN, "InputMeHintsFile", SetCfgInputMeHintsFile },
+    { SINGLE_INPUT, OUTPUT_ME_HINTS_FILE_TOKEN, "OutputMeHintsFile", SetCfgOutputMeHintsFile },
 
     // Interlaced Video
     { SINGLE_INPUT, INTERLACED_VIDEO_TOKEN , "InterlacedVideo" , SetInterlacedVideo },
@@ -293,6 +344,7 @@ config_entry_t config_entry[] = {
     // Prediction Structure
     { SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", SetCfgFramesToBeEncoded },
     { SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", SetBufferedInput },
+    { SINGLE_INPUT, READ_AHEAD_TOKEN, "ReadAhead", SetReadAhead },
     { SINGLE_INPUT, BASE_LAYER_SWITCH_MODE_TOKEN, "BaseLayerSwitchMode", SetBaseLayerSwitchMode },
     { SINGLE_INPUT, ENCMODE_TOKEN, "EncoderMode", SetencMode},
     { SINGLE_INPUT, INTRA_PERIOD_TOKEN, "IntraPeriod", SetCfgIntraPeriod },
@@ -312,15 +364,21 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, QP_TOKEN, "QP", SetCfgQp },
     { SINGLE_INPUT, USE_QP_FILE_TOKEN, "UseQpFile", SetCfgUseQpFile },
     { SINGLE_INPUT, STAT_REPORT_TOKEN, "StatReport", SetStatReport },
+    { SINGLE_INPUT, PIPELINE_STATS_TOKEN, "PipelineStats", SetPipelineStats },
     { SINGLE_INPUT, RATE_CONTROL_ENABLE_TOKEN, "RateControlMode", SetRateControlMode },
     { SINGLE_INPUT, LOOK_AHEAD_DIST_TOKEN, "LookAheadDistance",                             SetLookAheadDistance},
     { SINGLE_INPUT, TARGET_BIT_RATE_TOKEN, "TargetBitRate", SetTargetBitRate },
     { SINGLE_INPUT, MAX_QP_TOKEN, "MaxQpAllowed", SetMaxQpAllowed },
     { SINGLE_INPUT, MIN_QP_TOKEN, "MinQpAllowed", SetMinQpAllowed },
+    { SINGLE_INPUT, PASS_TOKEN, "Pass", SetPass },
+    { SINGLE_INPUT, VBV_MAX_RATE_TOKEN, "VbvMaxRate", SetVbvMaxRate },
+    { SINGLE_INPUT, VBV_BUFFER_SIZE_TOKEN, "VbvBufferSize", SetVbvBufferSize },
+    { SINGLE_INPUT, LADDER_LEAD_TOKEN, "LadderLead", SetLadderLead },
     { SINGLE_INPUT, ADAPTIVE_QP_ENABLE_TOKEN, "AdaptiveQuantization", SetAdaptiveQuantization },
 
     // DLF
     { SINGLE_INPUT, LOOP_FILTER_DISABLE_TOKEN, "LoopFilterDisable", SetDisableDlfFlag },
+    { SINGLE_INPUT, FUSED_LOOP_FILTER_TOKEN, "FusedLoopFilter", SetEnableFusedLoopFilter },
     // LOCAL WARPED MOTION
     { SINGLE_INPUT, LOCAL_WARPED_ENABLE_TOKEN, "LocalWarpedMotion", SetEnableLocalWarpedMotionFlag },
     // ME Tools
@@ -345,6 +403,11 @@ config_entry_t config_entry[] = {
     // Thread Management
     { SINGLE_INPUT, THREAD_MGMNT, "logicalProcessors", SetLogicalProcessors },
     { SINGLE_INPUT, TARGET_SOCKET, "TargetSocket", SetTargetSocket },
+    { SINGLE_INPUT, THREAD_POOL_TOKEN, "ThreadPool", SetThreadPool },
+    { SINGLE_INPUT, NUMA_NODE_TOKEN, "NumaNode", SetNumaNode },
+    // Memory Management
+    { SINGLE_INPUT, ADAPTIVE_POOLS_TOKEN, "AdaptivePools", SetAdaptivePools },
+    { SINGLE_INPUT, MEMORY_BUDGET_TOKEN, "MemoryBudget", SetMemoryBudget },
     // Optional Features
 
 //    { SINGLE_INPUT, BITRATE_REDUCTION_TOKEN, "bit_rate_reduction", SetBitRateReduction },
@@ -392,6 +455,10 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->error_log_file                         = stderr;
     config_ptr->qp_file                               = NULL;
     config_ptr->stat_file                             = NULL;
+    config_ptr->input_stat_file                       = NULL;
+    config_ptr->output_stat_file                      = NULL;
+    config_ptr->input_me_hints_file                   = NULL;
+    config_ptr->output_me_hints_file                  = NULL;
 
     config_ptr->frame_rate                            = 30 << 16;
     config_ptr->frame_rate_numerator                   = 0;
@@ -406,6 +473,8 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->frames_to_be_encoded                 = 0;
     config_ptr->buffered_input                        = -1;
     config_ptr->sequence_buffer                       = 0;
+    config_ptr->read_ahead                            = 0;
+    config_ptr->input_reader                          = NULL;
     config_ptr->latency_mode                          = 0;
 
     // Interlaced Video
@@ -414,6 +483,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->qp                                   = 50;
     config_ptr->use_qp_file                          = EB_FALSE;
     config_ptr->stat_report                          = 0;
+    config_ptr->pipeline_stats                       = 0;
 
     config_ptr->scene_change_detection               = 0;
     config_ptr->rate_control_mode                      = 0;
@@ -421,8 +491,12 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->target_bit_rate                        = 7000000;
     config_ptr->max_qp_allowed                       = 63;
     config_ptr->min_qp_allowed                       = 10;
+    config_ptr->pass                                 = 0;
+    config_ptr->vbv_max_rate                         = 0;
+    config_ptr->vbv_buffer_size                      = 0;
+    config_ptr->ladder_lead                          = 0;
 
-    config_ptr->enable_adaptive_quantization         = EB_FALSE;
+    config_ptr->enable_adaptive_quantization         = 0;
     config_ptr->base_layer_switch_mode               = 0;
     config_ptr->enc_mode                              = MAX_ENC_PRESET;
     config_ptr->intra_period                          = -2;
@@ -430,6 +504,7 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->hierarchical_levels                   = 4;
     config_ptr->pred_structure                        = 2;
     config_ptr->disable_dlf_flag                     = EB_FALSE;
+    config_ptr->enable_fused_loop_filter             = EB_FALSE;
     config_ptr->enable_warped_motion                 = EB_FALSE;
     config_ptr->ext_block_flag                       = EB_FALSE;
     config_ptr->in_loop_me_flag                      = EB_TRUE;
@@ -512,6 +587,10 @@ void eb_config_ctor(EbConfig *config_ptr)
     config_ptr->stop_encoder                          = 0;
     config_ptr->logical_processors                    = 0;
     config_ptr->target_socket                         = -1;
+    config_ptr->enable_thread_pool                    = EB_FALSE;
+    config_ptr->numa_node                             = -1;
+    config_ptr->adaptive_pool_sizing                  = EB_FALSE;
+    config_ptr->memory_budget                         = 0;
     config_ptr->processed_frame_count                  = 0;
     config_ptr->processed_byte_count                   = 0;
     config_ptr->tile_rows                            = 0;
@@ -541,6 +620,12 @@ void eb_config_dtor(EbConfig *config_ptr)
         config_ptr->config_file = (FILE *) NULL;
     }
 
+    // The reader thread reads the input file
+    if (config_ptr->input_reader) {
+        input_reader_dtor(config_ptr->input_reader);
+        config_ptr->input_reader = NULL;
+    }
+
     if (config_ptr->input_file) {
         if (config_ptr->input_file != stdin) fclose(config_ptr->input_file);
         config_ptr->input_file = (FILE *) NULL;
@@ -570,6 +655,26 @@ void eb_config_dtor(EbConfig *config_ptr)
         fclose(config_ptr->stat_file);
         config_ptr->stat_file = (FILE *) NULL;
     }
+
+    if (config_ptr->input_stat_file) {
+        fclose(config_ptr->input_stat_file);
+        config_ptr->input_stat_file = (FILE *) NULL;
+    }
+
+    if (config_ptr->output_stat_file) {
+        fclose(config_ptr->output_stat_file);
+        config_ptr->output_stat_file = (FILE *) NULL;
+    }
+
+    if (config_ptr->input_me_hints_file) {
+        fclose(config_ptr->input_me_hints_file);
+        config_ptr->input_me_hints_file = (FILE *) NULL;
+    }
+
+    if (config_ptr->output_me_hints_file) {
+        fclose(config_ptr->output_me_hints_file);
+        config_ptr->output_me_hints_file = (FILE *) NULL;
+    }
     return;
 }
 
@@ -801,11 +906,36 @@ static EbErrorType VerifySettings(EbConfig *config, uint32_t channelNumber)
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->read_ahead < 0) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid read_ahead. read_ahead must be greater or equal to 0\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->read_ahead > 0 && (config->buffered_input != -1 || config->separate_fields)) {
+        fprintf(config->error_log_file, "Error instance %u: read_ahead is not supported with buffered_input or separate fields\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->use_qp_file == EB_TRUE && config->qp_file == NULL) {
         fprintf(config->error_log_file, "Error instance %u: Could not find QP file, UseQpFile is set to 1\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->pass == 1 && config->output_stat_file == NULL) {
+        fprintf(config->error_log_file, "Error instance %u: The first pass needs an OutputStatFile\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->pass == 2 && config->input_stat_file == NULL) {
+        fprintf(config->error_log_file, "Error instance %u: Could not find the InputStatFile of the second pass\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->ladder_lead > channelNumber) {
+        fprintf(config->error_log_file, "Error instance %u: The LadderLead must be an instance before this one\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->separate_fields > 1) {
         fprintf(config->error_log_file, "Error Instance %u: Invalid SeperateFields Input\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -842,6 +972,40 @@ static EbErrorType VerifySettings(EbConfig *config, uint32_t channelNumber)
         return_error = EB_ErrorBadParameter;
     }
 
+    // thread pool
+    if (config->enable_thread_pool != 0 && config->enable_thread_pool != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid thread pool flag [0 - 1], your input: %d\n", channelNumber + 1, config->enable_thread_pool);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    // fused loop filter
+    if (config->enable_fused_loop_filter != 0 && config->enable_fused_loop_filter != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid fused loop filter flag [0 - 1], your input: %d\n", channelNumber + 1, config->enable_fused_loop_filter);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    // numa node
+    if (config->numa_node < -1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid numa node [-1 or a node], your input: %d\n", channelNumber + 1, config->numa_node);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->numa_node != -1 && config->target_socket != -1) {
+        fprintf(config->error_log_file, "Error instance %u: numa node and target socket cannot be both set\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    // adaptive pools
+    if (config->adaptive_pool_sizing != 0 && config->adaptive_pool_sizing != 1) {
+        fprintf(config->error_log_file, "Error instance %u: Invalid adaptive pools flag [0 - 1], your input: %d\n", channelNumber + 1, config->adaptive_pool_sizing);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->memory_budget != 0 && config->adaptive_pool_sizing == 0) {
+        fprintf(config->error_log_file, "Error instance %u: memory budget requires adaptive pools\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // Local Warped Motion
     if (config->enable_warped_motion != 0 && config->enable_warped_motion != 1) {
         fprintf(config->error_log_file, "Error instance %u: Invalid warped motion flag [0 - 1], your input: %d\n", channelNumber + 1, config->target_socket);
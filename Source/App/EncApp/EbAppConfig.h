@@ -171,6 +171,10 @@ typedef struct EbConfig
     FILE                    *recon_file;
     FILE                    *error_log_file;
     FILE                    *stat_file;
+    FILE                    *input_stat_file;
+    FILE                    *output_stat_file;
+    FILE                    *input_me_hints_file;
+    FILE                    *output_me_hints_file;
     FILE                    *buffer_file;
 
     FILE                    *qp_file;
@@ -180,6 +184,7 @@ typedef struct EbConfig
 
     EbBool                  use_qp_file;
     uint8_t                  stat_report;
+    uint8_t                  pipeline_stats;
 
     uint32_t                 frame_rate;
     uint32_t                 frame_rate_numerator;
@@ -200,6 +205,8 @@ typedef struct EbConfig
     int32_t                  frames_encoded;
     int32_t                  buffered_input;
     uint8_t                **sequence_buffer;
+    int32_t                  read_ahead;
+    struct EbInputReader    *input_reader;
 
     uint8_t                  latency_mode;
 
@@ -232,6 +239,7 @@ typedef struct EbConfig
      * DLF
      ****************************************/
     EbBool                  disable_dlf_flag;
+    EbBool                  enable_fused_loop_filter;
 
     /****************************************
      * Local Warped Motion
@@ -292,8 +300,13 @@ typedef struct EbConfig
     uint32_t                 target_bit_rate;
     uint32_t                 max_qp_allowed;
     uint32_t                 min_qp_allowed;
+    uint32_t                 pass;
+    uint32_t                 vbv_max_rate;
+    uint32_t                 vbv_buffer_size;
+    // Instance, from 1, whose analysis this instance reuses, 0 for none
+    uint32_t                 ladder_lead;
 
-    EbBool                 enable_adaptive_quantization;
+    uint8_t                enable_adaptive_quantization;
 
     /****************************************
      * Optional Features
@@ -332,6 +345,10 @@ typedef struct EbConfig
     uint32_t                active_channel_count;
     uint32_t                logical_processors;
     int32_t                 target_socket;
+    EbBool                  enable_thread_pool;
+    int32_t                 numa_node;
+    EbBool                  adaptive_pool_sizing;
+    uint32_t                memory_budget;
     EbBool                  stop_encoder;         // to signal CTRL+C Event, need to stop encoding.
 
     uint64_t                processed_frame_count;
@@ -8,17 +8,20 @@
  ***************************************/
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
+#include "EbAppInputReader.h"
 
 #define INPUT_SIZE_576p_TH                0x90000        // 0.58 Million
 #define INPUT_SIZE_1080i_TH                0xB71B0        // 0.75 Million
 #define INPUT_SIZE_1080p_TH                0x1AB3F0    // 1.75 Million
 #define INPUT_SIZE_4K_TH                0x29F630    // 2.75 Million
+#define INPUT_SIZE_8K_TH                0xA7D8C0    // 11 Million
 
 #define IS_16_BIT(bit_depth) (bit_depth==10?1:0)
-#define EB_OUTPUTSTREAMBUFFERSIZE_MACRO(ResolutionSize)                ((ResolutionSize) < (INPUT_SIZE_1080i_TH) ? 0x1E8480 : (ResolutionSize) < (INPUT_SIZE_1080p_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_4K_TH) ? 0x2DC6C0 : 0x2DC6C0  )
+#define EB_OUTPUTSTREAMBUFFERSIZE_MACRO(ResolutionSize)                ((ResolutionSize) < (INPUT_SIZE_1080i_TH) ? 0x1E8480 : (ResolutionSize) < (INPUT_SIZE_1080p_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_4K_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_8K_TH) ? 0x2DC6C0 : 0xB71B00  )
 
  /***************************************
  * Variables Defining a memory table
@@ -91,12 +94,12 @@ void ProcessInputFieldBufferingMode(
     ebInputPtr = lumaInputPtr;
     // Skip 1 luma row if bottom field (point to the bottom field)
     if (processed_frame_count % 2 != 0)
-        fseeko64(input_file, (long)sourceLumaRowSize, SEEK_CUR);
+        fseeko64(input_file, (int64_t)sourceLumaRowSize, SEEK_CUR);
 
     for (inputRowIndex = 0; inputRowIndex < input_padded_height; inputRowIndex++) {
         *filledLen += (uint32_t)fread(ebInputPtr, 1, sourceLumaRowSize, input_file);
         // Skip 1 luma row (only fields)
-        fseeko64(input_file, (long)sourceLumaRowSize, SEEK_CUR);
+        fseeko64(input_file, (int64_t)sourceLumaRowSize, SEEK_CUR);
         ebInputPtr += sourceLumaRowSize;
     }
 
@@ -104,14 +107,14 @@ void ProcessInputFieldBufferingMode(
     ebInputPtr = cbInputPtr;
     // Step back 1 luma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field)
     if (processed_frame_count % 2 != 0) {
-        fseeko64(input_file, -(long)sourceLumaRowSize, SEEK_CUR);
-        fseeko64(input_file, (long)sourceChromaRowSize, SEEK_CUR);
+        fseeko64(input_file, -(int64_t)sourceLumaRowSize, SEEK_CUR);
+        fseeko64(input_file, (int64_t)sourceChromaRowSize, SEEK_CUR);
     }
 
     for (inputRowIndex = 0; inputRowIndex < input_padded_height >> 1; inputRowIndex++) {
         *filledLen += (uint32_t)fread(ebInputPtr, 1, sourceChromaRowSize, input_file);
         // Skip 1 chroma row (only fields)
-        fseeko64(input_file, (long)sourceChromaRowSize, SEEK_CUR);
+        fseeko64(input_file, (int64_t)sourceChromaRowSize, SEEK_CUR);
         ebInputPtr += sourceChromaRowSize;
     }
 
@@ -123,13 +126,13 @@ void ProcessInputFieldBufferingMode(
     for (inputRowIndex = 0; inputRowIndex < input_padded_height >> 1; inputRowIndex++) {
         *filledLen += (uint32_t)fread(ebInputPtr, 1, sourceChromaRowSize, input_file);
         // Skip 1 chroma row (only fields)
-        fseeko64(input_file, (long)sourceChromaRowSize, SEEK_CUR);
+        fseeko64(input_file, (int64_t)sourceChromaRowSize, SEEK_CUR);
         ebInputPtr += sourceChromaRowSize;
     }
 
     // Step back 1 chroma row if bottom field (undo the previous jump)
     if (processed_frame_count % 2 != 0)
-        fseeko64(input_file, -(long)sourceChromaRowSize, SEEK_CUR);
+        fseeko64(input_file, -(int64_t)sourceChromaRowSize, SEEK_CUR);
 }
 
 /***********************************************
@@ -173,11 +176,15 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.target_bit_rate = config->target_bit_rate;
     callback_data->eb_enc_parameters.max_qp_allowed = config->max_qp_allowed;
     callback_data->eb_enc_parameters.min_qp_allowed = config->min_qp_allowed;
-    callback_data->eb_enc_parameters.enable_adaptive_quantization = (EbBool)config->enable_adaptive_quantization;
+    callback_data->eb_enc_parameters.pass = config->pass;
+    callback_data->eb_enc_parameters.vbv_max_rate = config->vbv_max_rate;
+    callback_data->eb_enc_parameters.vbv_buffer_size = config->vbv_buffer_size;
+    callback_data->eb_enc_parameters.enable_adaptive_quantization = config->enable_adaptive_quantization;
     callback_data->eb_enc_parameters.qp = config->qp;
     callback_data->eb_enc_parameters.use_qp_file = (EbBool)config->use_qp_file;
     callback_data->eb_enc_parameters.stat_report = (EbBool)config->stat_report;
     callback_data->eb_enc_parameters.disable_dlf_flag = (EbBool)config->disable_dlf_flag;
+    callback_data->eb_enc_parameters.enable_fused_loop_filter = (EbBool)config->enable_fused_loop_filter;
     callback_data->eb_enc_parameters.enable_warped_motion = (EbBool)config->enable_warped_motion;
     callback_data->eb_enc_parameters.use_default_me_hme = (EbBool)config->use_default_me_hme;
     callback_data->eb_enc_parameters.enable_hme_flag = (EbBool)config->enable_hme_flag;
@@ -208,6 +215,10 @@ EbErrorType CopyConfigurationParameters(
     callback_data->eb_enc_parameters.asm_type = config->asm_type;
     callback_data->eb_enc_parameters.logical_processors = config->logical_processors;
     callback_data->eb_enc_parameters.target_socket = config->target_socket;
+    callback_data->eb_enc_parameters.enable_thread_pool = config->enable_thread_pool;
+    callback_data->eb_enc_parameters.numa_node = config->numa_node;
+    callback_data->eb_enc_parameters.adaptive_pool_sizing = config->adaptive_pool_sizing;
+    callback_data->eb_enc_parameters.memory_budget = config->memory_budget;
     callback_data->eb_enc_parameters.recon_enabled = config->recon_file ? EB_TRUE : EB_FALSE;
     // --- start: ALTREF_FILTERING_SUPPORT
     callback_data->eb_enc_parameters.enable_altrefs  = (EbBool)config->enable_altrefs;
@@ -303,7 +314,8 @@ EbErrorType AllocateInputBuffers(
 
         EB_APP_MALLOC(uint8_t*, callback_data->input_buffer_pool->p_buffer, sizeof(EbSvtIOFormat), EB_N_PTR, EB_ErrorInsufficientResources);
 
-        if (config->buffered_input == -1) {
+        // With read ahead the planes point to the frames of the reader
+        if (config->buffered_input == -1 && config->read_ahead == 0) {
             // Allocate frame buffer for the p_buffer
             AllocateFrameBuffer(
                     config,
@@ -523,6 +535,157 @@ EbErrorType PreloadFramesIntoRam(
     return return_error;
 }
 
+/***********************************
+ * Give the statistics of the first
+ * pass to the second pass
+ ***********************************/
+static EbErrorType SetFirstPassStats(
+    EbConfig              *config,
+    EbAppContext          *callback_data)
+{
+    EbErrorType   return_error = EB_ErrorNone;
+    uint8_t      *stats;
+    long          size;
+
+    fseek(config->input_stat_file, 0, SEEK_END);
+    size = ftell(config->input_stat_file);
+    fseek(config->input_stat_file, 0, SEEK_SET);
+    if (size <= 0)
+        return EB_ErrorBadParameter;
+
+    stats = (uint8_t*)malloc(size);
+    if (stats == NULL)
+        return EB_ErrorInsufficientResources;
+    if (fread(stats, 1, size, config->input_stat_file) != (size_t)size)
+        return_error = EB_ErrorBadParameter;
+    else
+        return_error = eb_svt_enc_set_first_pass_stats(
+            callback_data->svt_encoder_handle,
+            stats,
+            (uint32_t)size);
+    free(stats);
+
+    return return_error;
+}
+
+/***********************************
+ * Set the size of the motion
+ * estimation hints record written last
+ ***********************************/
+static void FinishMeHintsRecord(
+    AppMeHints            *hints)
+{
+    int64_t end_offset;
+
+    if (hints->write_record_offset < 0)
+        return;
+
+    end_offset = ftello64(hints->output_file);
+    fseeko64(hints->output_file, hints->write_record_offset + (int64_t)sizeof(uint64_t), SEEK_SET);
+    fwrite(&hints->write_record_size, 1, sizeof(uint32_t), hints->output_file);
+    fseeko64(hints->output_file, end_offset, SEEK_SET);
+    hints->write_record_offset = -1;
+}
+
+/***********************************
+ * Append the motion estimation hints
+ * of a picture, called by the encoder
+ ***********************************/
+static void WriteMeHints(
+    void                  *priv_data,
+    uint64_t               picture_number,
+    const uint8_t         *data,
+    uint32_t               size)
+{
+    AppMeHints *hints = (AppMeHints*)priv_data;
+
+    // The chunks of a picture are consecutive, a new picture starts a record
+    if (hints->write_record_offset < 0 || picture_number != hints->write_picture_number) {
+        FinishMeHintsRecord(hints);
+        hints->write_picture_number = picture_number;
+        hints->write_record_offset = ftello64(hints->output_file);
+        hints->write_record_size = 0;
+        fwrite(&picture_number, 1, sizeof(uint64_t), hints->output_file);
+        fwrite(&hints->write_record_size, 1, sizeof(uint32_t), hints->output_file);
+    }
+    hints->write_record_size += (uint32_t)fwrite(data, 1, size, hints->output_file);
+}
+
+/***********************************
+ * Read the motion estimation hints
+ * of a picture, called by the encoder
+ ***********************************/
+static uint32_t ReadMeHints(
+    void                  *priv_data,
+    uint64_t               picture_number,
+    uint8_t               *data,
+    uint32_t               size)
+{
+    AppMeHints *hints = (AppMeHints*)priv_data;
+
+    // A new picture is read from the start of its record
+    if (picture_number != hints->read_picture_number) {
+        hints->read_picture_number = picture_number;
+        hints->read_size = 0;
+        if (picture_number < hints->picture_count && hints->picture_offset[picture_number] >= 0) {
+            fseeko64(hints->input_file, hints->picture_offset[picture_number], SEEK_SET);
+            hints->read_size = hints->picture_size[picture_number];
+        }
+    }
+    size = size < hints->read_size ? size : hints->read_size;
+    size = (uint32_t)fread(data, 1, size, hints->input_file);
+    hints->read_size -= size;
+
+    return size;
+}
+
+/***********************************
+ * Index the motion estimation hints
+ * read and give the callbacks to the
+ * encoder
+ ***********************************/
+static EbErrorType SetMeHints(
+    EbConfig              *config,
+    EbAppContext          *callback_data)
+{
+    AppMeHints *hints = &callback_data->me_hints;
+    uint64_t    picture_number;
+    uint32_t    size;
+
+    hints->output_file = config->output_me_hints_file;
+    hints->input_file = config->input_me_hints_file;
+
+    while (hints->input_file &&
+        fread(&picture_number, 1, sizeof(uint64_t), hints->input_file) == sizeof(uint64_t) &&
+        fread(&size, 1, sizeof(uint32_t), hints->input_file) == sizeof(uint32_t)) {
+        if (picture_number >= hints->picture_count) {
+            uint64_t picture_count = picture_number + 1 > 2 * hints->picture_count ? picture_number + 1 : 2 * hints->picture_count;
+            int64_t  *picture_offset = (int64_t*)realloc(hints->picture_offset, (size_t)picture_count * sizeof(int64_t));
+            uint32_t *picture_size;
+
+            if (picture_offset == NULL)
+                return EB_ErrorInsufficientResources;
+            hints->picture_offset = picture_offset;
+            picture_size = (uint32_t*)realloc(hints->picture_size, (size_t)picture_count * sizeof(uint32_t));
+            if (picture_size == NULL)
+                return EB_ErrorInsufficientResources;
+            hints->picture_size = picture_size;
+            while (hints->picture_count < picture_count)
+                hints->picture_offset[hints->picture_count++] = -1;
+        }
+        hints->picture_offset[picture_number] = ftello64(hints->input_file);
+        hints->picture_size[picture_number] = size;
+        if (fseeko64(hints->input_file, (int64_t)size, SEEK_CUR) != 0)
+            break;
+    }
+
+    return eb_svt_enc_set_me_hints_callbacks(
+        callback_data->svt_encoder_handle,
+        hints->output_file ? WriteMeHints : NULL,
+        hints->input_file ? ReadMeHints : NULL,
+        hints);
+}
+
 /***************************************
 * Functions Implementation
 ***************************************/
@@ -539,6 +702,9 @@ EbErrorType init_encoder(
 
     // Allocate a memory table hosting all allocated pointers
     AllocateMemoryTable(instance_idx);
+    memset(&callback_data->me_hints, 0, sizeof(AppMeHints));
+    callback_data->me_hints.write_record_offset = -1;
+    callback_data->me_hints.read_picture_number = (uint64_t)~0;
 
     ///************************* LIBRARY INIT [START] *********************///
     // STEP 1: Call the library to construct a Component Handle
@@ -562,6 +728,24 @@ EbErrorType init_encoder(
 
     if (return_error != EB_ErrorNone)
         return return_error;
+    // Second pass : the library copies the statistics of the first pass
+    if (config->pass == 2) {
+        return_error = SetFirstPassStats(
+            config,
+            callback_data);
+        if (return_error != EB_ErrorNone) {
+            fprintf(config->error_log_file, "Error instance %u: Could not read the InputStatFile\n", instance_idx + 1);
+            return return_error;
+        }
+    }
+    // Motion estimation hints written for, or read from, another encode
+    if (config->input_me_hints_file || config->output_me_hints_file) {
+        return_error = SetMeHints(
+            config,
+            callback_data);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
     // STEP 5: Init Encoder
     return_error = eb_init_encoder(callback_data->svt_encoder_handle);
     if (return_error != EB_ErrorNone) { return return_error; }
@@ -599,6 +783,20 @@ EbErrorType init_encoder(
     }
     else
         config->sequence_buffer = 0;
+
+    // Start reading the frames ahead of the encoder loop
+    if (config->buffered_input == -1 && config->read_ahead > 0) {
+        uint32_t frameSize = config->input_padded_width * config->input_padded_height; //Luma
+        frameSize += 2 * (frameSize >> (3 - config->encoder_color_format)); // Add Chroma
+        if (config->encoder_bit_depth == 10 && config->compressed_ten_bit_format == 1)
+            frameSize += frameSize / 4;
+        else
+            frameSize *= (config->encoder_bit_depth > 8 ? 2 : 1); //10 bit
+        return_error = input_reader_ctor(
+            &config->input_reader,
+            config,
+            frameSize);
+    }
     if (return_error != EB_ErrorNone)
         return return_error;
     ///********************** APPLICATION INIT [END] ******************////////
@@ -619,6 +817,10 @@ EbErrorType de_init_encoder(
 
     if (((EbComponentType*)(callback_data_ptr->svt_encoder_handle)) != NULL)
             return_error = eb_deinit_encoder(callback_data_ptr->svt_encoder_handle);
+    // The encoder no longer writes hints
+    FinishMeHintsRecord(&callback_data_ptr->me_hints);
+    free(callback_data_ptr->me_hints.picture_offset);
+    free(callback_data_ptr->me_hints.picture_size);
     // Destruct the buffer memory pool
     if (return_error != EB_ErrorNone)
         return return_error;
@@ -9,6 +9,27 @@
 #include "EbSvtAv1Enc.h"
 #include "EbAppConfig.h"
 
+/***************************************
+ * Motion estimation hints files
+ *   records of the picture number, the size
+ *   and the hints of each picture
+ ***************************************/
+typedef struct AppMeHints {
+    // Written hints, the size of the record of a picture is set once complete
+    FILE                              *output_file;
+    uint64_t                           write_picture_number;
+    int64_t                            write_record_offset;  // -1 when no record is open
+    uint32_t                           write_record_size;
+
+    // Read hints, indexed by picture number when the encoder starts
+    FILE                              *input_file;
+    uint64_t                           read_picture_number;
+    uint32_t                           read_size;            // left to read for read_picture_number
+    uint64_t                           picture_count;
+    int64_t                           *picture_offset;       // -1 when the picture has no hints
+    uint32_t                          *picture_size;
+} AppMeHints;
+
 /***************************************
 
  * App Callback data struct
@@ -29,6 +50,9 @@ typedef struct EbAppContext {
 
     // Instance Index
     uint8_t                            instance_idx;
+
+    // Motion estimation hints files
+    AppMeHints                         me_hints;
 } EbAppContext;
 
 /********************************
@@ -0,0 +1,374 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbAppInputReader.h"
+#include "EbAppInputy4m.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define YUV4MPEG2_IND_SIZE 9
+// Step of the page faulting of the mapped frames
+#define READ_AHEAD_PAGE_SIZE    4096
+
+struct EbInputReader
+{
+    EbConfig                *config;
+    FILE                    *input_file;
+    uint32_t                 frame_size;
+    uint64_t                 first_frame_offset;
+    uint64_t                 read_offset;
+    uint64_t                 read_frame_count;
+
+    // Memory mapped input file, NULL when it is read with fread
+    uint8_t                 *map;
+    uint64_t                 map_size;
+#ifdef _WIN32
+    HANDLE                   map_handle;
+#endif
+
+    // Ring of frames read ahead. ready_count frames from get_index are read,
+    // the first one may be in use by the encoder loop.
+    uint32_t                 ring_size;
+    uint8_t                **frames;
+    uint32_t                *filled_len;
+    uint8_t                 *frame_buffers;
+    uint32_t                 read_index;
+    uint32_t                 get_index;
+    uint32_t                 ready_count;
+    EbBool                   stop;
+    volatile uint8_t         page_sink;
+
+#ifdef _WIN32
+    CRITICAL_SECTION         lock;
+    CONDITION_VARIABLE       cond;
+    HANDLE                   thread_handle;
+#else
+    pthread_mutex_t          lock;
+    pthread_cond_t           cond;
+    pthread_t                thread_handle;
+#endif
+};
+
+#ifdef _WIN32
+#define READER_LOCK(r)      EnterCriticalSection(&(r)->lock)
+#define READER_UNLOCK(r)    LeaveCriticalSection(&(r)->lock)
+#define READER_WAIT(r)      SleepConditionVariableCS(&(r)->cond, &(r)->lock, INFINITE)
+#define READER_SIGNAL(r)    WakeAllConditionVariable(&(r)->cond)
+#else
+#define READER_LOCK(r)      pthread_mutex_lock(&(r)->lock)
+#define READER_UNLOCK(r)    pthread_mutex_unlock(&(r)->lock)
+#define READER_WAIT(r)      pthread_cond_wait(&(r)->cond, &(r)->lock)
+#define READER_SIGNAL(r)    pthread_cond_broadcast(&(r)->cond)
+#endif
+
+/***************************************
+ * Maps the input file, if it is a regular file holding at least a frame
+ ***************************************/
+static void map_input_file(EbInputReader *reader)
+{
+    reader->map = NULL;
+    reader->map_size = 0;
+    if (reader->input_file == stdin)
+        return;
+#ifdef _WIN32
+    {
+        HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(reader->input_file));
+        LARGE_INTEGER file_size;
+
+        reader->map_handle = NULL;
+        if (file_handle == INVALID_HANDLE_VALUE || GetFileType(file_handle) != FILE_TYPE_DISK ||
+            !GetFileSizeEx(file_handle, &file_size))
+            return;
+        if ((uint64_t)file_size.QuadPart < reader->first_frame_offset + reader->frame_size ||
+            (uint64_t)file_size.QuadPart > (uint64_t)(SIZE_T)-1)
+            return;
+        reader->map_handle = CreateFileMapping(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (reader->map_handle == NULL)
+            return;
+        reader->map = (uint8_t*)MapViewOfFile(reader->map_handle, FILE_MAP_READ, 0, 0, 0);
+        if (reader->map == NULL) {
+            CloseHandle(reader->map_handle);
+            reader->map_handle = NULL;
+            return;
+        }
+        reader->map_size = (uint64_t)file_size.QuadPart;
+    }
+#else
+    {
+        struct stat file_stat;
+        void *map;
+
+        if (fstat(fileno(reader->input_file), &file_stat) != 0 || !S_ISREG(file_stat.st_mode))
+            return;
+        if ((uint64_t)file_stat.st_size < reader->first_frame_offset + reader->frame_size ||
+            (uint64_t)file_stat.st_size > (uint64_t)(size_t)-1)
+            return;
+        map = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fileno(reader->input_file), 0);
+        if (map == MAP_FAILED)
+            return;
+        // The frames are read in order, let the kernel read ahead and drop behind
+        madvise(map, (size_t)file_stat.st_size, MADV_SEQUENTIAL);
+        reader->map = (uint8_t*)map;
+        reader->map_size = (uint64_t)file_stat.st_size;
+    }
+#endif
+}
+
+static void unmap_input_file(EbInputReader *reader)
+{
+    if (reader->map == NULL)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(reader->map);
+    CloseHandle(reader->map_handle);
+#else
+    munmap(reader->map, (size_t)reader->map_size);
+#endif
+    reader->map = NULL;
+}
+
+/***************************************
+ * Skips the y4m FRAME delimiter of the mapped frame at offset, returns
+ * the offset of its data or map_size when there is no complete frame left
+ ***************************************/
+static uint64_t skip_mapped_y4m_delimiter(EbInputReader *reader, uint64_t offset)
+{
+    const uint8_t *line_end;
+
+    if (offset + 6 > reader->map_size || memcmp(reader->map + offset, "FRAME", 5) != 0)
+        return reader->map_size;
+    // The delimiter may carry parameters, up to the end of the line
+    line_end = (const uint8_t*)memchr(reader->map + offset, '\n', (size_t)(reader->map_size - offset));
+    if (line_end == NULL)
+        return reader->map_size;
+    return (uint64_t)(line_end - reader->map) + 1;
+}
+
+/***************************************
+ * Reads the next frame into the ring slot
+ ***************************************/
+static void read_mapped_frame(EbInputReader *reader, uint32_t slot)
+{
+    uint64_t frame_offset = reader->read_offset;
+    uint8_t *frame_ptr;
+    uint32_t page_sum = 0;
+
+    if (reader->config->y4m_input)
+        frame_offset = skip_mapped_y4m_delimiter(reader, frame_offset);
+    // Loop over the file at its end
+    if (frame_offset + reader->frame_size > reader->map_size) {
+        frame_offset = reader->first_frame_offset;
+        if (reader->config->y4m_input)
+            frame_offset = skip_mapped_y4m_delimiter(reader, frame_offset);
+    }
+    frame_ptr = reader->map + frame_offset;
+    reader->read_offset = frame_offset + reader->frame_size;
+
+    // Fault the pages in now, not when the encoder copies the frame
+    for (uint32_t page_offset = 0; page_offset < reader->frame_size; page_offset += READ_AHEAD_PAGE_SIZE)
+        page_sum += frame_ptr[page_offset];
+    page_sum += frame_ptr[reader->frame_size - 1];
+    reader->page_sink = (uint8_t)page_sum;
+
+    reader->frames[slot] = frame_ptr;
+    reader->filled_len[slot] = reader->frame_size;
+}
+
+static uint32_t fread_frame(EbInputReader *reader, uint8_t *frame_ptr)
+{
+    uint32_t filled_len = 0;
+
+    if (reader->config->y4m_input)
+        read_y4m_frame_delimiter(reader->config);
+    else if (reader->read_frame_count == 0 && reader->input_file == stdin) {
+        // The first bytes were read when checking for the YUV4MPEG2 string
+        memcpy(frame_ptr, reader->config->y4m_buf, YUV4MPEG2_IND_SIZE);
+        filled_len = YUV4MPEG2_IND_SIZE;
+    }
+    filled_len += (uint32_t)fread(frame_ptr + filled_len, 1, reader->frame_size - filled_len, reader->input_file);
+    return filled_len;
+}
+
+static void read_file_frame(EbInputReader *reader, uint32_t slot)
+{
+    uint8_t *frame_ptr = reader->frame_buffers + (size_t)slot * reader->frame_size;
+    uint32_t filled_len = fread_frame(reader, frame_ptr);
+
+    // Loop over the file at its end
+    if (filled_len != reader->frame_size && reader->input_file != stdin) {
+        fseeko64(reader->input_file, (int64_t)reader->first_frame_offset, SEEK_SET);
+        filled_len = fread_frame(reader, frame_ptr);
+    }
+
+    reader->frames[slot] = frame_ptr;
+    reader->filled_len[slot] = filled_len;
+}
+
+/***************************************
+ * Read ahead thread
+ ***************************************/
+#ifdef _WIN32
+static DWORD WINAPI input_reader_kernel(LPVOID input_ptr)
+#else
+static void *input_reader_kernel(void *input_ptr)
+#endif
+{
+    EbInputReader *reader = (EbInputReader*)input_ptr;
+
+    for (;;) {
+        uint32_t slot;
+
+        READER_LOCK(reader);
+        while (!reader->stop && reader->ready_count == reader->ring_size)
+            READER_WAIT(reader);
+        if (reader->stop) {
+            READER_UNLOCK(reader);
+            break;
+        }
+        slot = reader->read_index;
+        READER_UNLOCK(reader);
+
+        // The slot is neither ready nor in use, read it unlocked
+        if (reader->map)
+            read_mapped_frame(reader, slot);
+        else
+            read_file_frame(reader, slot);
+        reader->read_frame_count++;
+
+        READER_LOCK(reader);
+        reader->read_index = (reader->read_index + 1) % reader->ring_size;
+        reader->ready_count++;
+        READER_SIGNAL(reader);
+        READER_UNLOCK(reader);
+    }
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/***************************************
+ * Functions Implementation
+ ***************************************/
+EbErrorType input_reader_ctor(
+    EbInputReader **reader_dbl_ptr,
+    EbConfig       *config,
+    uint32_t        frame_size)
+{
+    EbInputReader *reader = (EbInputReader*)calloc(1, sizeof(EbInputReader));
+
+    *reader_dbl_ptr = NULL;
+    if (reader == NULL)
+        return EB_ErrorInsufficientResources;
+
+    reader->config = config;
+    reader->input_file = config->input_file;
+    reader->frame_size = frame_size;
+    reader->ring_size = (uint32_t)config->read_ahead;
+    reader->first_frame_offset = (reader->input_file == stdin) ? 0 : (uint64_t)ftello64(reader->input_file);
+    reader->read_offset = reader->first_frame_offset;
+
+    map_input_file(reader);
+
+    reader->frames = (uint8_t**)calloc(reader->ring_size, sizeof(uint8_t*));
+    reader->filled_len = (uint32_t*)calloc(reader->ring_size, sizeof(uint32_t));
+    if (reader->map == NULL)
+        reader->frame_buffers = (uint8_t*)malloc((size_t)reader->ring_size * frame_size);
+    if (reader->frames == NULL || reader->filled_len == NULL || (reader->map == NULL && reader->frame_buffers == NULL)) {
+        input_reader_dtor(reader);
+        return EB_ErrorInsufficientResources;
+    }
+
+#ifdef _WIN32
+    InitializeCriticalSection(&reader->lock);
+    InitializeConditionVariable(&reader->cond);
+    reader->thread_handle = CreateThread(NULL, 0, input_reader_kernel, reader, 0, NULL);
+    if (reader->thread_handle == NULL) {
+        DeleteCriticalSection(&reader->lock);
+#else
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->cond, NULL);
+    if (pthread_create(&reader->thread_handle, NULL, input_reader_kernel, reader) != 0) {
+        pthread_cond_destroy(&reader->cond);
+        pthread_mutex_destroy(&reader->lock);
+#endif
+        reader->ring_size = 0;
+        input_reader_dtor(reader);
+        return EB_ErrorInsufficientResources;
+    }
+
+    *reader_dbl_ptr = reader;
+    return EB_ErrorNone;
+}
+
+uint8_t *input_reader_get_frame(
+    EbInputReader  *reader,
+    uint32_t       *filled_len)
+{
+    uint8_t *frame_ptr;
+
+    READER_LOCK(reader);
+    while (reader->ready_count == 0)
+        READER_WAIT(reader);
+    frame_ptr = reader->frames[reader->get_index];
+    *filled_len = reader->filled_len[reader->get_index];
+    READER_UNLOCK(reader);
+
+    return frame_ptr;
+}
+
+void input_reader_release_frame(
+    EbInputReader  *reader)
+{
+    READER_LOCK(reader);
+    reader->get_index = (reader->get_index + 1) % reader->ring_size;
+    reader->ready_count--;
+    READER_SIGNAL(reader);
+    READER_UNLOCK(reader);
+}
+
+void input_reader_dtor(
+    EbInputReader  *reader)
+{
+    if (reader == NULL)
+        return;
+
+    // A ring_size of 0 means the thread was not started
+    if (reader->ring_size) {
+        READER_LOCK(reader);
+        reader->stop = EB_TRUE;
+        READER_SIGNAL(reader);
+        READER_UNLOCK(reader);
+#ifdef _WIN32
+        WaitForSingleObject(reader->thread_handle, INFINITE);
+        CloseHandle(reader->thread_handle);
+        DeleteCriticalSection(&reader->lock);
+#else
+        pthread_join(reader->thread_handle, NULL);
+        pthread_cond_destroy(&reader->cond);
+        pthread_mutex_destroy(&reader->lock);
+#endif
+    }
+
+    unmap_input_file(reader);
+    free(reader->frame_buffers);
+    free(reader->filled_len);
+    free(reader->frames);
+    free(reader);
+}
@@ -0,0 +1,44 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbAppInputReader_h
+#define EbAppInputReader_h
+
+#include "EbAppConfig.h"
+
+/***************************************
+ * Read ahead of the input frames
+ *
+ * A thread reads the frames ahead of the encoder loop, into a ring of
+ * read_ahead frames. Regular files are memory mapped, the frames are then
+ * handed out in place and the thread only faults in their pages. Other
+ * inputs (stdin, pipes) are read with fread into buffers of the ring.
+ * The frames are laid out as the ones of the BufferedInput mode, and the
+ * input is looped over at the end of the file the same way.
+ ***************************************/
+typedef struct EbInputReader EbInputReader;
+
+/* Starts the read ahead thread, from the current position of the input
+   file. frame_size is the size of one frame in the file, without the y4m
+   FRAME delimiter. */
+extern EbErrorType input_reader_ctor(
+    EbInputReader **reader_dbl_ptr,
+    EbConfig       *config,
+    uint32_t        frame_size);
+
+/* Returns the next frame, waiting for it if it is not read yet. It stays
+   valid until input_reader_release_frame. */
+extern uint8_t *input_reader_get_frame(
+    EbInputReader  *reader,
+    uint32_t       *filled_len);
+
+extern void input_reader_release_frame(
+    EbInputReader  *reader);
+
+/* Stops the read ahead thread and frees the reader */
+extern void input_reader_dtor(
+    EbInputReader  *reader);
+
+#endif // EbAppInputReader_h
@@ -76,6 +76,59 @@ void AssignAppThreadGroup(uint8_t target_socket) {
 #endif
 }
 
+/***************************************
+ * Print the per kernel pipeline counters
+ ***************************************/
+static void PrintPipelineStats(
+    EbComponentType *svt_encoder_handle,
+    uint32_t         channel)
+{
+    EbPipelineStats stats;
+
+    if (eb_svt_enc_get_pipeline_stats(svt_encoder_handle, &stats) != EB_ErrorNone || stats.kernel_count == 0) {
+        printf("\nChannel %u: no pipeline stats, the library is built without PIPELINE_STATS\n", channel);
+        return;
+    }
+    printf("\nChannel %u Pipeline Stats, %.0f ms\n", channel, (double)stats.elapsed_time / 1000);
+    printf("%-28s %7s %6s %10s %10s %10s %8s   %s\n",
+        "Kernel", "Threads", "Busy", "Busy ms", "In wait ms", "Out wait", "Gets", "Input fifo depth 0 1 2-3 4-7 8-15 16-31 32-63 64+ (%)");
+    for (uint32_t kernelIndex = 0; kernelIndex < stats.kernel_count; ++kernelIndex) {
+        const EbKernelStats *kernel = &stats.kernels[kernelIndex];
+        // Share of the elapsed time of all its threads the kernel was running
+        const double busyShare = kernel->thread_count && stats.elapsed_time ?
+            100.0 * kernel->busy_time / ((double)stats.elapsed_time * kernel->thread_count) : 0;
+
+        printf("%-28s %7u %5.1f%% %10.0f %10.0f %10.0f %8llu  ",
+            kernel->kernel_name,
+            kernel->thread_count,
+            busyShare,
+            (double)kernel->busy_time / 1000,
+            (double)kernel->full_wait_time / 1000,
+            (double)kernel->empty_wait_time / 1000,
+            (unsigned long long)kernel->full_get_count);
+        for (uint32_t bin = 0; bin < EB_PIPELINE_STATS_DEPTH_BINS; ++bin)
+            printf(" %3.0f", kernel->full_get_count ? 100.0 * kernel->fifo_depth_histogram[bin] / kernel->full_get_count : 0);
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+/***************************************
+ * Print the memory held by the encoder
+ ***************************************/
+static void PrintMemoryFootprint(
+    EbComponentType *svt_encoder_handle)
+{
+    EbMemoryFootprint footprint;
+
+    if (eb_svt_enc_get_memory_footprint(svt_encoder_handle, &footprint) != EB_ErrorNone)
+        return;
+    printf("Library Memory:		%.1f MB in %u chunks, %u allocations\n",
+        (double)footprint.reserved_size / (1 << 20),
+        footprint.chunk_count,
+        footprint.allocation_count);
+}
+
 /***************************************
  * Encoder App Main
  ***************************************/
@@ -159,6 +212,22 @@ int32_t main(int32_t argc, char* argv[])
                     channelActive[instanceCount] = EB_FALSE;
             }
 
+            // Link the renditions of a ladder to their lead, an earlier
+            // channel, so the lead gets each picture first
+            for (instanceCount = 0; instanceCount < num_channels; ++instanceCount) {
+                uint32_t lead = configs[instanceCount]->ladder_lead;
+
+                if (lead && return_errors[instanceCount] == EB_ErrorNone) {
+                    if (return_errors[lead - 1] != EB_ErrorNone)
+                        return_errors[instanceCount] = EB_ErrorBadParameter;
+                    else
+                        return_errors[instanceCount] = eb_svt_enc_set_ladder_lead(
+                            appCallbacks[instanceCount]->svt_encoder_handle,
+                            appCallbacks[lead - 1]->svt_encoder_handle);
+                    return_error = (EbErrorType)(return_error | return_errors[instanceCount]);
+                }
+            }
+
             {
                 // Start the Encoder
                 for (instanceCount = 0; instanceCount < num_channels; ++instanceCount) {
@@ -309,6 +378,9 @@ int32_t main(int32_t argc, char* argv[])
                     }
                     else
                         printf("\nChannel %u Encoding Interrupted\n", (uint32_t)(instanceCount + 1));
+                    PrintMemoryFootprint(appCallbacks[instanceCount]->svt_encoder_handle);
+                    if (configs[instanceCount]->pipeline_stats)
+                        PrintPipelineStats(appCallbacks[instanceCount]->svt_encoder_handle, instanceCount + 1);
                 }
                 else if (return_errors[instanceCount] == EB_ErrorInsufficientResources)
                     printf("Could not allocate enough memory for channel %u\n", instanceCount + 1);
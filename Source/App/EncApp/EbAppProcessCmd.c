@@ -14,6 +14,7 @@
 #include "EbAppConfig.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
 
 #include "EbTime.h"
 
@@ -418,6 +419,9 @@ void LogErrorOutput(
     case EB_ENC_PACKETIZATION_ERROR5:
         fprintf(error_log_file, "Error: Stream Fifo is starving..deadlock, increase EB_outputStreamBufferFifoInitCount APP_ENCODERSTREAMBUFFERCOUNT \n");
         break;
+    case EB_ENC_PACKETIZATION_ERROR6:
+        fprintf(error_log_file, "Error: PacketizationProcess: Packet buffer allocation failed!\n");
+        break;
 
         // EB_ENC_PM_ERRORS:
     case EB_ENC_PM_ERROR0:
@@ -634,12 +638,12 @@ void ProcessInputFieldStandardMode(
     ebInputPtr = lumaInputPtr;
     // Skip 1 luma row if bottom field (point to the bottom field)
     if (config->processed_frame_count % 2 != 0)
-        fseeko64(input_file, (long)source_luma_row_size, SEEK_CUR);
+        fseeko64(input_file, (int64_t)source_luma_row_size, SEEK_CUR);
 
     for (inputRowIndex = 0; inputRowIndex < input_padded_height; inputRowIndex++) {
         headerPtr->n_filled_len += (uint32_t)fread(ebInputPtr, 1, source_luma_row_size, input_file);
         // Skip 1 luma row (only fields)
-        fseeko64(input_file, (long)source_luma_row_size, SEEK_CUR);
+        fseeko64(input_file, (int64_t)source_luma_row_size, SEEK_CUR);
         ebInputPtr += source_luma_row_size;
     }
 
@@ -647,14 +651,14 @@ void ProcessInputFieldStandardMode(
     ebInputPtr = cbInputPtr;
     // Step back 1 luma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field)
     if (config->processed_frame_count % 2 != 0) {
-        fseeko64(input_file, -(long)source_luma_row_size, SEEK_CUR);
-        fseeko64(input_file, (long)source_chroma_row_size, SEEK_CUR);
+        fseeko64(input_file, -(int64_t)source_luma_row_size, SEEK_CUR);
+        fseeko64(input_file, (int64_t)source_chroma_row_size, SEEK_CUR);
     }
 
     for (inputRowIndex = 0; inputRowIndex < input_padded_height >> subsampling_y; inputRowIndex++) {
         headerPtr->n_filled_len += (uint32_t)fread(ebInputPtr, 1, source_chroma_row_size, input_file);
         // Skip 1 chroma row (only fields)
-        fseeko64(input_file, (long)source_chroma_row_size, SEEK_CUR);
+        fseeko64(input_file, (int64_t)source_chroma_row_size, SEEK_CUR);
         ebInputPtr += source_chroma_row_size;
     }
 
@@ -666,13 +670,13 @@ void ProcessInputFieldStandardMode(
     for (inputRowIndex = 0; inputRowIndex < input_padded_height >> subsampling_y; inputRowIndex++) {
         headerPtr->n_filled_len += (uint32_t)fread(ebInputPtr, 1, source_chroma_row_size, input_file);
         // Skip 1 chroma row (only fields)
-        fseeko64(input_file, (long)source_chroma_row_size, SEEK_CUR);
+        fseeko64(input_file, (int64_t)source_chroma_row_size, SEEK_CUR);
         ebInputPtr += source_chroma_row_size;
     }
 
     // Step back 1 chroma row if bottom field (undo the previous jump)
     if (config->processed_frame_count % 2 != 0)
-        fseeko64(input_file, -(long)source_chroma_row_size, SEEK_CUR);
+        fseeko64(input_file, -(int64_t)source_chroma_row_size, SEEK_CUR);
 }
 
 //************************************/
@@ -743,6 +747,47 @@ int32_t GetNextQpFromQpFile(
     return qp;
 }
 
+/* Points the planes of the input picture to a frame laid out as in the
+   input file, returns the size of the frame */
+static uint32_t SetInputFramePlanes(
+    EbConfig                  *config,
+    uint8_t                    is16bit,
+    EbSvtIOFormat             *inputPtr,
+    uint8_t                   *frame_ptr)
+{
+    const uint32_t  input_padded_width = config->input_padded_width;
+    const uint32_t  input_padded_height = config->input_padded_height;
+    const uint8_t color_format = config->encoder_color_format;
+
+    if (is16bit && config->compressed_ten_bit_format == 1) {
+        // Determine size of each plane
+        const size_t luma8bitSize = input_padded_width * input_padded_height;
+        const size_t chroma8bitSize = luma8bitSize >> (3 - color_format);
+        const size_t luma2bitSize = luma8bitSize / 4; //4-2bit pixels into 1 byte
+        const size_t chroma2bitSize = luma2bitSize >> (3 - color_format);
+
+        inputPtr->luma = frame_ptr;
+        inputPtr->cb = frame_ptr + luma8bitSize;
+        inputPtr->cr = frame_ptr + luma8bitSize + chroma8bitSize;
+
+        inputPtr->luma_ext = frame_ptr + luma8bitSize + 2 * chroma8bitSize;
+        inputPtr->cb_ext = frame_ptr + luma8bitSize + 2 * chroma8bitSize + luma2bitSize;
+        inputPtr->cr_ext = frame_ptr + luma8bitSize + 2 * chroma8bitSize + luma2bitSize + chroma2bitSize;
+
+        return (uint32_t)(luma8bitSize + luma2bitSize + 2 * (chroma8bitSize + chroma2bitSize));
+    } else {
+        //Normal unpacked mode:yuv420p10le yuv422p10le yuv444p10le
+        const size_t lumaSize = (input_padded_width * input_padded_height) << is16bit;
+        const size_t chromaSize = lumaSize >> (3 - color_format);
+
+        inputPtr->luma = frame_ptr;
+        inputPtr->cb = frame_ptr + lumaSize;
+        inputPtr->cr = frame_ptr + lumaSize + chromaSize;
+
+        return (uint32_t)(lumaSize + 2 * chromaSize);
+    }
+}
+
 void ReadInputFrames(
     EbConfig                  *config,
     uint8_t                      is16bit,
@@ -762,6 +807,15 @@ void ReadInputFrames(
     inputPtr->cr_stride = input_padded_width >> subsampling_x;
     inputPtr->cb_stride = input_padded_width >> subsampling_x;
 
+    // Frame read ahead by the reader thread, used in place
+    if (config->input_reader) {
+        uint32_t filled_len;
+        uint8_t *frame_ptr = input_reader_get_frame(config->input_reader, &filled_len);
+        SetInputFramePlanes(config, is16bit, inputPtr, frame_ptr);
+        headerPtr->n_filled_len = filled_len;
+        return;
+    }
+
     if (config->buffered_input == -1) {
         if (is16bit == 0 || (is16bit == 1 && config->compressed_ten_bit_format == 0)) {
             readSize = (uint64_t)SIZE_OF_ONE_FRAME_IN_BYTES(input_padded_width, input_padded_height, color_format, is16bit);
@@ -854,44 +908,11 @@ void ReadInputFrames(
             }
         }
     } else {
-        if (is16bit && config->compressed_ten_bit_format == 1) {
-            // Determine size of each plane
-            const size_t luma8bitSize = input_padded_width * input_padded_height;
-            const size_t chroma8bitSize = luma8bitSize >> (3 - color_format);
-            const size_t luma2bitSize = luma8bitSize / 4; //4-2bit pixels into 1 byte
-            const size_t chroma2bitSize = luma2bitSize >> (3 - color_format);
-
-            EbSvtIOFormat* inputPtr = (EbSvtIOFormat*)headerPtr->p_buffer;
-            inputPtr->y_stride = input_padded_width;
-            inputPtr->cr_stride = input_padded_width >> subsampling_x;
-            inputPtr->cb_stride = input_padded_width >> subsampling_x;
-
-            inputPtr->luma = config->sequence_buffer[config->processed_frame_count % config->buffered_input];
-            inputPtr->cb = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + luma8bitSize;
-            inputPtr->cr = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + luma8bitSize + chroma8bitSize;
-
-            inputPtr->luma_ext = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + luma8bitSize + 2 * chroma8bitSize;
-            inputPtr->cb_ext = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + luma8bitSize + 2 * chroma8bitSize + luma2bitSize;
-            inputPtr->cr_ext = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + luma8bitSize + 2 * chroma8bitSize + luma2bitSize + chroma2bitSize;
-
-            headerPtr->n_filled_len = (uint32_t)(luma8bitSize + luma2bitSize + 2 * (chroma8bitSize + chroma2bitSize));
-        } else {
-            //Normal unpacked mode:yuv420p10le yuv422p10le yuv444p10le
-            const size_t lumaSize = (input_padded_width * input_padded_height) << is16bit;
-            const size_t chromaSize = lumaSize >> (3 - color_format);
-
-            EbSvtIOFormat* inputPtr = (EbSvtIOFormat*)headerPtr->p_buffer;
-
-            inputPtr->y_stride = input_padded_width;
-            inputPtr->cr_stride = input_padded_width >> subsampling_x;
-            inputPtr->cb_stride = input_padded_width >> subsampling_x;
-
-            inputPtr->luma = config->sequence_buffer[config->processed_frame_count % config->buffered_input];
-            inputPtr->cb = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + lumaSize;
-            inputPtr->cr = config->sequence_buffer[config->processed_frame_count % config->buffered_input] + lumaSize+ chromaSize;
-
-            headerPtr->n_filled_len = (uint32_t)(lumaSize + 2 * chromaSize);
-        }
+        headerPtr->n_filled_len = SetInputFramePlanes(
+            config,
+            is16bit,
+            inputPtr,
+            config->sequence_buffer[config->processed_frame_count % config->buffered_input]);
     }
 
     // If we reached the end of file, loop over again
@@ -998,6 +1019,10 @@ AppExitConditionType ProcessInputBuffer(
         // Send the picture
         eb_svt_enc_send_picture(componentHandle, headerPtr);
 
+        // The picture is copied by the encoder, the frame can be read over
+        if (config->input_reader)
+            input_reader_release_frame(config->input_reader);
+
         if ((config->processed_frame_count == (uint64_t)config->frames_to_be_encoded) || config->stop_encoder) {
             headerPtr->n_alloc_len    = 0;
             headerPtr->n_filled_len   = 0;
@@ -1288,6 +1313,14 @@ AppExitConditionType ProcessOutputStreamBuffer(
             if (config->stat_report && !(headerPtr->flags & EB_BUFFERFLAG_IS_ALT_REF))
                 process_output_statistics_buffer(headerPtr, config);
 
+            // First pass : the statistics are complete with the last packet
+            if (config->pass == 1 && (headerPtr->flags & EB_BUFFERFLAG_EOS)) {
+                const uint8_t *stats;
+                uint32_t       stats_size;
+                if (eb_svt_enc_get_first_pass_stats(componentHandle, &stats, &stats_size) == EB_ErrorNone)
+                    fwrite(stats, 1, stats_size, config->output_stat_file);
+            }
+
             // Update Output Port Activity State
             *portState = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_PortInactive : *portState;
             return_value = (headerPtr->flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
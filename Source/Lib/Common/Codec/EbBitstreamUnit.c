@@ -92,12 +92,13 @@ EbErrorType output_bitstream_rbsp_to_payload(
     *output_buffer_index += 12;
 #endif
     //frame_count++;
-    while ((read_location < buffer_written_bytes_count)) {
-        if ((*output_buffer_index) < (*output_buffer_size)) {
-            write_byte_ptr[write_location++] = read_byte_ptr[read_location];
-            *output_buffer_index += 1;
-        }
-        read_location++;
+    // Copy what fits in the output buffer
+    if (read_location < buffer_written_bytes_count && (*output_buffer_index) < (*output_buffer_size)) {
+        uint32_t copy_bytes_count = buffer_written_bytes_count - read_location;
+        if (copy_bytes_count > (*output_buffer_size) - (*output_buffer_index))
+            copy_bytes_count = (*output_buffer_size) - (*output_buffer_index);
+        memcpy(&write_byte_ptr[write_location], &read_byte_ptr[read_location], copy_bytes_count);
+        *output_buffer_index += copy_bytes_count;
     }
 
     return return_error;
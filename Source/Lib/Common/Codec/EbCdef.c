@@ -453,12 +453,42 @@ static INLINE void copy_rect(uint16_t *dst, int32_t dstride, const uint16_t *src
     }
 }
 
-void av1_cdef_frame(
-    EncDecContext                *context_ptr,
-    SequenceControlSet           *sequence_control_set_ptr,
-    PictureControlSet            *pCs){
-    (void)context_ptr;
+// The line and column buffers CDEF carries from one filter block row to the
+// next, allocated per picture
+void av1_cdef_row_state_alloc(
+    const Av1Common              *cm,
+    CdefRowState                 *state){
+    const int32_t nhfb = (cm->mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t stride = (cm->mi_cols << MI_SIZE_LOG2) + 2 * CDEF_HBORDER;
 
+    state->row_cdef = (uint8_t *)aom_malloc(sizeof(*state->row_cdef) * (nhfb + 2) * 2);
+    assert(state->row_cdef != NULL);
+    memset(state->row_cdef, 1, sizeof(*state->row_cdef) * (nhfb + 2) * 2);
+    state->prev_row_cdef = state->row_cdef + 1;
+    state->curr_row_cdef = state->prev_row_cdef + nhfb + 2;
+    for (int32_t pli = 0; pli < 3; pli++) {
+        const int32_t mi_high_l2 = MI_SIZE_LOG2 - (pli ? 1 : 0);
+        state->linebuf[pli] = (uint16_t *)aom_malloc(sizeof(*state->linebuf) * CDEF_VBORDER * stride);
+        state->colbuf[pli] = (uint16_t *)aom_malloc(sizeof(*state->colbuf)  * ((CDEF_BLOCKSIZE << mi_high_l2) + 2 * CDEF_VBORDER) * CDEF_HBORDER);
+    }
+}
+
+void av1_cdef_row_state_free(
+    CdefRowState                 *state){
+    aom_free(state->row_cdef);
+    for (int32_t pli = 0; pli < 3; pli++) {
+        aom_free(state->linebuf[pli]);
+        aom_free(state->colbuf[pli]);
+    }
+}
+
+// Apply CDEF to the 64x64 filter block row fbr, the rows above it must
+// have been done in order with the same state
+void av1_cdef_fb_row(
+    SequenceControlSet           *sequence_control_set_ptr,
+    PictureControlSet            *pCs,
+    CdefRowState                 *state,
+    int32_t                       fbr){
     struct PictureParentControlSet     *pPcs = pCs->parent_pcs_ptr;
     Av1Common*   cm = pPcs->av1_cm;
 
@@ -475,10 +505,11 @@ void av1_cdef_frame(
 
     const int32_t num_planes = 3;// av1_num_planes(cm);
     DECLARE_ALIGNED(16, uint16_t, src[CDEF_INBUF_SIZE]);
-    uint16_t *linebuf[3];
-    uint16_t *colbuf[3];
+    uint16_t **linebuf = state->linebuf;
+    uint16_t **colbuf = state->colbuf;
     cdef_list dlist[MI_SIZE_64X64 * MI_SIZE_64X64];
-    uint8_t *row_cdef, *prev_row_cdef, *curr_row_cdef;
+    uint8_t *prev_row_cdef = state->prev_row_cdef;
+    uint8_t *curr_row_cdef = state->curr_row_cdef;
     int32_t cdef_count;
     int32_t dir[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
     int32_t var[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
@@ -489,12 +520,6 @@ void av1_cdef_frame(
     int32_t coeff_shift = AOMMAX(sequence_control_set_ptr->static_config.encoder_bit_depth/*cm->bit_depth*/ - 8, 0);
     const int32_t nvfb = (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
     const int32_t nhfb = (cm->mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
-    //av1_setup_dst_planes(xd->plane, cm->seq_params.sb_size, frame, 0, 0, 0, num_planes);
-    row_cdef = (uint8_t *)aom_malloc(sizeof(*row_cdef) * (nhfb + 2) * 2);
-    assert(row_cdef != NULL);
-    memset(row_cdef, 1, sizeof(*row_cdef) * (nhfb + 2) * 2);
-    prev_row_cdef = row_cdef + 1;
-    curr_row_cdef = prev_row_cdef + nhfb + 2;
     for (int32_t pli = 0; pli < num_planes; pli++) {
         int32_t subsampling_x = (pli == 0) ? 0 : 1;
         int32_t subsampling_y = (pli == 0) ? 0 : 1;
@@ -506,273 +531,274 @@ void av1_cdef_frame(
     }
 
     const int32_t stride = (cm->mi_cols << MI_SIZE_LOG2) + 2 * CDEF_HBORDER;
+
     for (int32_t pli = 0; pli < num_planes; pli++) {
-        linebuf[pli] = (uint16_t *)aom_malloc(sizeof(*linebuf) * CDEF_VBORDER * stride);
-        colbuf[pli] = (uint16_t *)aom_malloc(sizeof(*colbuf)  * ((CDEF_BLOCKSIZE << mi_high_l2[pli]) + 2 * CDEF_VBORDER) * CDEF_HBORDER);
+        const int32_t block_height =
+            (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
+        fill_rect(colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
+            CDEF_VERY_LARGE);
     }
 
-    for (int32_t fbr = 0; fbr < nvfb; fbr++) {
-        for (int32_t pli = 0; pli < num_planes; pli++) {
-            const int32_t block_height =
-                (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
-            fill_rect(colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
-                CDEF_VERY_LARGE);
+    int32_t cdef_left = 1;
+    for (int32_t fbc = 0; fbc < nhfb; fbc++) {
+        int32_t level, sec_strength;
+        int32_t uv_level, uv_sec_strength;
+        int32_t nhb, nvb;
+        int32_t cstart = 0;
+        curr_row_cdef[fbc] = 0;
+
+        //WAHT IS THIS  ?? CHKN -->for
+        if (pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc] == NULL ||
+            pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength == -1) {
+            cdef_left = 0;
+            printf("\n\n\nCDEF ERROR: Skipping Current FB\n\n\n");
+            continue;
         }
 
-        int32_t cdef_left = 1;
-        for (int32_t fbc = 0; fbc < nhfb; fbc++) {
-            int32_t level, sec_strength;
-            int32_t uv_level, uv_sec_strength;
-            int32_t nhb, nvb;
-            int32_t cstart = 0;
-            curr_row_cdef[fbc] = 0;
-
-            //WAHT IS THIS  ?? CHKN -->for
-            if (pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc] == NULL ||
-                pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength == -1) {
-                cdef_left = 0;
-                printf("\n\n\nCDEF ERROR: Skipping Current FB\n\n\n");
-                continue;
-            }
+        if (!cdef_left) cstart = -CDEF_HBORDER;  //CHKN if the left block has not been filtered, then we can use samples on the left as input.
+
+        nhb = AOMMIN(MI_SIZE_64X64, cm->mi_cols - MI_SIZE_64X64 * fbc);
+        nvb = AOMMIN(MI_SIZE_64X64, cm->mi_rows - MI_SIZE_64X64 * fbr);
+        int32_t frame_top, frame_left, frame_bottom, frame_right;
+
+        int32_t mi_row = MI_SIZE_64X64 * fbr;
+        int32_t mi_col = MI_SIZE_64X64 * fbc;
+        // for the current filter block, it's top left corner mi structure (mi_tl)
+        // is first accessed to check whether the top and left boundaries are
+        // frame boundaries. Then bottom-left and top-right mi structures are
+        // accessed to check whether the bottom and right boundaries
+        // (respectively) are frame boundaries.
+        //
+        // Note that we can't just check the bottom-right mi structure - eg. if
+        // we're at the right-hand edge of the frame but not the bottom, then
+        // the bottom-right mi is NULL but the bottom-left is not.
+        frame_top = (mi_row == 0) ? 1 : 0;
+        frame_left = (mi_col == 0) ? 1 : 0;
+
+        if (fbr != nvfb - 1)
+            frame_bottom = (mi_row + MI_SIZE_64X64 == cm->mi_rows) ? 1 : 0;
+        else
+            frame_bottom = 1;
+
+        if (fbc != nhfb - 1)
+            frame_right = (mi_col + MI_SIZE_64X64 == cm->mi_cols) ? 1 : 0;
+        else
+            frame_right = 1;
+
+        const int32_t mbmi_cdef_strength = pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength;
+        level = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
+        sec_strength = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
+        sec_strength += sec_strength == 3;
+        uv_level = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
+        uv_sec_strength = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
+        uv_sec_strength += uv_sec_strength == 3;
+        if ((level == 0 && sec_strength == 0 && uv_level == 0 && uv_sec_strength == 0) ||
+            (cdef_count = sb_compute_cdef_list(pCs, cm, fbr * MI_SIZE_64X64, fbc * MI_SIZE_64X64, dlist, BLOCK_64X64)) == 0) {
+            cdef_left = 0;
+            continue;
+        }
 
-            if (!cdef_left) cstart = -CDEF_HBORDER;  //CHKN if the left block has not been filtered, then we can use samples on the left as input.
+        curr_row_cdef[fbc] = 1;
+        for (int32_t pli = 0; pli < num_planes; pli++) {
+            int32_t coffset;
+            int32_t rend, cend;
+            int32_t pri_damping = pCs->parent_pcs_ptr->cdef_pri_damping;
+            int32_t sec_damping = pCs->parent_pcs_ptr->cdef_sec_damping;
+            int32_t hsize = nhb << mi_wide_l2[pli];
+            int32_t vsize = nvb << mi_high_l2[pli];
+
+            if (pli) {
+                level = uv_level;
+                sec_strength = uv_sec_strength;
+            }
 
-            nhb = AOMMIN(MI_SIZE_64X64, cm->mi_cols - MI_SIZE_64X64 * fbc);
-            nvb = AOMMIN(MI_SIZE_64X64, cm->mi_rows - MI_SIZE_64X64 * fbr);
-            int32_t frame_top, frame_left, frame_bottom, frame_right;
-
-            int32_t mi_row = MI_SIZE_64X64 * fbr;
-            int32_t mi_col = MI_SIZE_64X64 * fbc;
-            // for the current filter block, it's top left corner mi structure (mi_tl)
-            // is first accessed to check whether the top and left boundaries are
-            // frame boundaries. Then bottom-left and top-right mi structures are
-            // accessed to check whether the bottom and right boundaries
-            // (respectively) are frame boundaries.
-            //
-            // Note that we can't just check the bottom-right mi structure - eg. if
-            // we're at the right-hand edge of the frame but not the bottom, then
-            // the bottom-right mi is NULL but the bottom-left is not.
-            frame_top = (mi_row == 0) ? 1 : 0;
-            frame_left = (mi_col == 0) ? 1 : 0;
-
-            if (fbr != nvfb - 1)
-                frame_bottom = (mi_row + MI_SIZE_64X64 == cm->mi_rows) ? 1 : 0;
+            if (fbc == nhfb - 1)
+                cend = hsize;
             else
-                frame_bottom = 1;
+                cend = hsize + CDEF_HBORDER;
 
-            if (fbc != nhfb - 1)
-                frame_right = (mi_col + MI_SIZE_64X64 == cm->mi_cols) ? 1 : 0;
+            if (fbr == nvfb - 1)
+                rend = vsize;
             else
-                frame_right = 1;
-
-            const int32_t mbmi_cdef_strength = pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength;
-            level = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
-            sec_strength = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
-            sec_strength += sec_strength == 3;
-            uv_level = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
-            uv_sec_strength = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
-            uv_sec_strength += uv_sec_strength == 3;
-            if ((level == 0 && sec_strength == 0 && uv_level == 0 && uv_sec_strength == 0) ||
-                (cdef_count = sb_compute_cdef_list(pCs, cm, fbr * MI_SIZE_64X64, fbc * MI_SIZE_64X64, dlist, BLOCK_64X64)) == 0) {
-                cdef_left = 0;
-                continue;
+                rend = vsize + CDEF_VBORDER;
+
+            coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
+            if (fbc == nhfb - 1) {
+                /* On the last superblock column, fill in the right border with
+                   CDEF_VERY_LARGE to avoid filtering with the outside. */
+                fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
+                    CDEF_VERY_LARGE);
+            }
+            if (fbr == nvfb - 1) {
+                /* On the last superblock row, fill in the bottom border with
+                   CDEF_VERY_LARGE to avoid filtering with the outside. */
+                fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
             }
 
-            curr_row_cdef[fbc] = 1;
-            for (int32_t pli = 0; pli < num_planes; pli++) {
-                int32_t coffset;
-                int32_t rend, cend;
-                int32_t pri_damping = pCs->parent_pcs_ptr->cdef_pri_damping;
-                int32_t sec_damping = pCs->parent_pcs_ptr->cdef_sec_damping;
-                int32_t hsize = nhb << mi_wide_l2[pli];
-                int32_t vsize = nvb << mi_high_l2[pli];
-
-                if (pli) {
-                    level = uv_level;
-                    sec_strength = uv_sec_strength;
-                }
+            uint8_t* recBuff = 0;
+            uint32_t recStride = 0;
+
+            switch (pli) {
+            case 0:
+                recBuff = reconBufferY;
+                recStride = recon_picture_ptr->stride_y;
+                break;
+            case 1:
+                recBuff = reconBufferCb;
+                recStride = recon_picture_ptr->stride_cb;
+
+                break;
+            case 2:
+                recBuff = reconBufferCr;
+                recStride = recon_picture_ptr->stride_cr;
+                break;
+            }
 
-                if (fbc == nhfb - 1)
-                    cend = hsize;
-                else
-                    cend = hsize + CDEF_HBORDER;
-
-                if (fbr == nvfb - 1)
-                    rend = vsize;
-                else
-                    rend = vsize + CDEF_VBORDER;
-
-                coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
-                if (fbc == nhfb - 1) {
-                    /* On the last superblock column, fill in the right border with
-                       CDEF_VERY_LARGE to avoid filtering with the outside. */
-                    fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
-                        rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
-                        CDEF_VERY_LARGE);
-                }
-                if (fbr == nvfb - 1) {
-                    /* On the last superblock row, fill in the bottom border with
-                       CDEF_VERY_LARGE to avoid filtering with the outside. */
-                    fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
-                        CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+            /* Copy in the pixels we need from the current superblock for
+               deringing.*/
+            copy_sb8_16(//cm,
+                &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
+                CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
+                (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr, coffset + cstart,
+                recStride/*xd->plane[pli].dst.stride*/, rend, cend - cstart);
+            if (!prev_row_cdef[fbc]) {
+                copy_sb8_16(//cm,
+                    &src[CDEF_HBORDER], CDEF_BSTRIDE,
+                    recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
+            }
+            else if (fbr > 0) {
+                copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, &linebuf[pli][coffset],
+                    stride, CDEF_VBORDER, hsize);
+            }
+            else {
+                fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
+                    CDEF_VERY_LARGE);
+            }
 
-                uint8_t* recBuff = 0;
-                uint32_t recStride = 0;
-
-                switch (pli) {
-                case 0:
-                    recBuff = reconBufferY;
-                    recStride = recon_picture_ptr->stride_y;
-                    break;
-                case 1:
-                    recBuff = reconBufferCb;
-                    recStride = recon_picture_ptr->stride_cb;
-
-                    break;
-                case 2:
-                    recBuff = reconBufferCr;
-                    recStride = recon_picture_ptr->stride_cr;
-                    break;
-                }
+            if (!prev_row_cdef[fbc - 1]) {
+                copy_sb8_16(//cm,
+                    src, CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset - CDEF_HBORDER, recStride/*xd->plane[pli].dst.stride*/,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            }
+            else if (fbr > 0 && fbc > 0) {
+                copy_rect(src, CDEF_BSTRIDE, &linebuf[pli][coffset - CDEF_HBORDER],
+                    stride, CDEF_VBORDER, CDEF_HBORDER);
+            }
+            else {
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
 
-                /* Copy in the pixels we need from the current superblock for
-                   deringing.*/
+            if (!prev_row_cdef[fbc + 1]) {
                 copy_sb8_16(//cm,
-                    &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
+                    &src[CDEF_HBORDER + (nhb << mi_wide_l2[pli])],
                     CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr, coffset + cstart,
-                    recStride/*xd->plane[pli].dst.stride*/, rend, cend - cstart);
-                if (!prev_row_cdef[fbc]) {
-                    copy_sb8_16(//cm,
-                        &src[CDEF_HBORDER], CDEF_BSTRIDE,
-                        recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
-                }
-                else if (fbr > 0) {
-                    copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, &linebuf[pli][coffset],
-                        stride, CDEF_VBORDER, hsize);
-                }
-                else {
-                    fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
-                        CDEF_VERY_LARGE);
-                }
-
-                if (!prev_row_cdef[fbc - 1]) {
-                    copy_sb8_16(//cm,
-                        src, CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset - CDEF_HBORDER, recStride/*xd->plane[pli].dst.stride*/,
-                        CDEF_VBORDER, CDEF_HBORDER);
-                }
-                else if (fbr > 0 && fbc > 0) {
-                    copy_rect(src, CDEF_BSTRIDE, &linebuf[pli][coffset - CDEF_HBORDER],
-                        stride, CDEF_VBORDER, CDEF_HBORDER);
-                }
-                else {
-                    fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
-
-                if (!prev_row_cdef[fbc + 1]) {
-                    copy_sb8_16(//cm,
-                        &src[CDEF_HBORDER + (nhb << mi_wide_l2[pli])],
-                        CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset + hsize, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER,
-                        CDEF_HBORDER);
-                }
-                else if (fbr > 0 && fbc < nhfb - 1) {
-                    copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
-                        &linebuf[pli][coffset + hsize], stride, CDEF_VBORDER,
-                        CDEF_HBORDER);
-                }
-                else {
-                    fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER,
-                        CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset + hsize, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER,
+                    CDEF_HBORDER);
+            }
+            else if (fbr > 0 && fbc < nhfb - 1) {
+                copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    &linebuf[pli][coffset + hsize], stride, CDEF_VBORDER,
+                    CDEF_HBORDER);
+            }
+            else {
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER,
+                    CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
 
-                if (cdef_left) {
-                    /* If we deringed the superblock on the left then we need to copy in
-                       saved pixels. */
-                    copy_rect(src, CDEF_BSTRIDE, colbuf[pli], CDEF_HBORDER,
-                        rend + CDEF_VBORDER, CDEF_HBORDER);
-                }
+            if (cdef_left) {
+                /* If we deringed the superblock on the left then we need to copy in
+                   saved pixels. */
+                copy_rect(src, CDEF_BSTRIDE, colbuf[pli], CDEF_HBORDER,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+            }
 
-                /* Saving pixels in case we need to dering the superblock on the
-                    right. */
-                if (fbc < nhfb - 1)
-                    copy_rect(colbuf[pli], CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
-                        rend + CDEF_VBORDER, CDEF_HBORDER);
-
-                if (fbr < nvfb - 1)
-                    copy_sb8_16(
-                        //cm,
-                        &linebuf[pli][coffset], stride, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * (fbr + 1) - CDEF_VBORDER,
-                        coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
-
-                if (frame_top) {
-                    fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
-                if (frame_left) {
-                    fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER, CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
-                if (frame_bottom) {
-                    fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
-                        CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
-                if (frame_right) {
-                    fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
-                        vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+            /* Saving pixels in case we need to dering the superblock on the
+                right. */
+            if (fbc < nhfb - 1)
+                copy_rect(colbuf[pli], CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+
+            if (fbr < nvfb - 1)
+                copy_sb8_16(
+                    //cm,
+                    &linebuf[pli][coffset], stride, recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * (fbr + 1) - CDEF_VBORDER,
+                    coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
+
+            if (frame_top) {
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
+            if (frame_left) {
+                fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
+            if (frame_bottom) {
+                fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
+            if (frame_right) {
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
 
-                //if (cm->use_highbitdepth) {
-                //  cdef_filter_fb(
-                //      NULL,
-                //      &CONVERT_TO_SHORTPTR(
-                //          xd->plane[pli]
-                //              .dst.buf)[xd->plane[pli].dst.stride *
-                //                            (MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +
-                //                        (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                //      xd->plane[pli].dst.stride,
-                //      &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
-                //      ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
-                //      sec_strength, pri_damping, sec_damping, coeff_shift);
-                //} else
-                {
-                    cdef_filter_fb(
-                        &recBuff[recStride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) + (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                        //&xd->plane[pli].dst.buf[xd->plane[pli].dst.stride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +(fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                        NULL, recStride/*xd->plane[pli].dst.stride*/,
-                        &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
-                        ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
-                        sec_strength, pri_damping, sec_damping, coeff_shift);
-                }
+            //if (cm->use_highbitdepth) {
+            //  cdef_filter_fb(
+            //      NULL,
+            //      &CONVERT_TO_SHORTPTR(
+            //          xd->plane[pli]
+            //              .dst.buf)[xd->plane[pli].dst.stride *
+            //                            (MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +
+            //                        (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+            //      xd->plane[pli].dst.stride,
+            //      &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
+            //      ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
+            //      sec_strength, pri_damping, sec_damping, coeff_shift);
+            //} else
+            {
+                cdef_filter_fb(
+                    &recBuff[recStride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) + (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+                    //&xd->plane[pli].dst.buf[xd->plane[pli].dst.stride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +(fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+                    NULL, recStride/*xd->plane[pli].dst.stride*/,
+                    &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
+                    ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
+                    sec_strength, pri_damping, sec_damping, coeff_shift);
             }
-            cdef_left = 1;  //CHKN filtered data is written back directy to recFrame.
-        }
-        {
-            uint8_t *tmp = prev_row_cdef;
-            prev_row_cdef = curr_row_cdef;
-            curr_row_cdef = tmp;
         }
+        cdef_left = 1;  //CHKN filtered data is written back directy to recFrame.
     }
-    aom_free(row_cdef);
-    for (int32_t pli = 0; pli < num_planes; pli++) {
-        aom_free(linebuf[pli]);
-        aom_free(colbuf[pli]);
-    }
+    state->prev_row_cdef = curr_row_cdef;
+    state->curr_row_cdef = prev_row_cdef;
 }
 
-void av1_cdef_frame16bit(
+void av1_cdef_frame(
     EncDecContext                *context_ptr,
     SequenceControlSet           *sequence_control_set_ptr,
     PictureControlSet            *pCs){
     (void)context_ptr;
+    Av1Common*   cm = pCs->parent_pcs_ptr->av1_cm;
+    const int32_t nvfb = (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    CdefRowState state;
+
+    av1_cdef_row_state_alloc(cm, &state);
+    for (int32_t fbr = 0; fbr < nvfb; fbr++)
+        av1_cdef_fb_row(sequence_control_set_ptr, pCs, &state, fbr);
+    av1_cdef_row_state_free(&state);
+}
+
+void av1_cdef_fb_row16bit(
+    SequenceControlSet           *sequence_control_set_ptr,
+    PictureControlSet            *pCs,
+    CdefRowState                 *state,
+    int32_t                       fbr){
     struct PictureParentControlSet     *pPcs = pCs->parent_pcs_ptr;
     Av1Common*   cm = pPcs->av1_cm;
 
@@ -790,10 +816,11 @@ void av1_cdef_frame16bit(
 
     const int32_t num_planes = 3;// av1_num_planes(cm);
     DECLARE_ALIGNED(16, uint16_t, src[CDEF_INBUF_SIZE]);
-    uint16_t *linebuf[3];
-    uint16_t *colbuf[3];
+    uint16_t **linebuf = state->linebuf;
+    uint16_t **colbuf = state->colbuf;
     cdef_list dlist[MI_SIZE_64X64 * MI_SIZE_64X64];
-    uint8_t *row_cdef, *prev_row_cdef, *curr_row_cdef;
+    uint8_t *prev_row_cdef = state->prev_row_cdef;
+    uint8_t *curr_row_cdef = state->curr_row_cdef;
     int32_t cdef_count;
     int32_t dir[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
     int32_t var[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
@@ -804,12 +831,6 @@ void av1_cdef_frame16bit(
     int32_t coeff_shift = AOMMAX(sequence_control_set_ptr->static_config.encoder_bit_depth/*cm->bit_depth*/ - 8, 0);
     const int32_t nvfb = (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
     const int32_t nhfb = (cm->mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
-    //av1_setup_dst_planes(xd->plane, cm->seq_params.sb_size, frame, 0, 0, 0, num_planes);
-    row_cdef = (uint8_t *)aom_malloc(sizeof(*row_cdef) * (nhfb + 2) * 2);
-    assert(row_cdef);
-    memset(row_cdef, 1, sizeof(*row_cdef) * (nhfb + 2) * 2);
-    prev_row_cdef = row_cdef + 1;
-    curr_row_cdef = prev_row_cdef + nhfb + 2;
     for (int32_t pli = 0; pli < num_planes; pli++) {
         int32_t subsampling_x = (pli == 0) ? 0 : 1;
         int32_t subsampling_y = (pli == 0) ? 0 : 1;
@@ -821,268 +842,269 @@ void av1_cdef_frame16bit(
     }
 
     const int32_t stride = (cm->mi_cols << MI_SIZE_LOG2) + 2 * CDEF_HBORDER;
+
     for (int32_t pli = 0; pli < num_planes; pli++) {
-        linebuf[pli] = (uint16_t *)aom_malloc(sizeof(*linebuf) * CDEF_VBORDER * stride);
-        colbuf[pli] = (uint16_t *)aom_malloc(sizeof(*colbuf)  * ((CDEF_BLOCKSIZE << mi_high_l2[pli]) + 2 * CDEF_VBORDER) * CDEF_HBORDER);
+        const int32_t block_height =
+            (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
+        fill_rect(colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
+            CDEF_VERY_LARGE);
     }
 
-    for (int32_t fbr = 0; fbr < nvfb; fbr++) {
-        for (int32_t pli = 0; pli < num_planes; pli++) {
-            const int32_t block_height =
-                (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
-            fill_rect(colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
-                CDEF_VERY_LARGE);
+    int32_t cdef_left = 1;
+    for (int32_t fbc = 0; fbc < nhfb; fbc++) {
+        int32_t level, sec_strength;
+        int32_t uv_level, uv_sec_strength;
+        int32_t nhb, nvb;
+        int32_t cstart = 0;
+        curr_row_cdef[fbc] = 0;
+
+        //WAHT IS THIS  ?? CHKN -->for
+        if (pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc] == NULL ||
+            pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength == -1) {
+            cdef_left = 0;
+            printf("\n\n\nCDEF ERROR: Skipping Current FB\n\n\n");
+            continue;
         }
 
-        int32_t cdef_left = 1;
-        for (int32_t fbc = 0; fbc < nhfb; fbc++) {
-            int32_t level, sec_strength;
-            int32_t uv_level, uv_sec_strength;
-            int32_t nhb, nvb;
-            int32_t cstart = 0;
-            curr_row_cdef[fbc] = 0;
-
-            //WAHT IS THIS  ?? CHKN -->for
-            if (pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc] == NULL ||
-                pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength == -1) {
-                cdef_left = 0;
-                printf("\n\n\nCDEF ERROR: Skipping Current FB\n\n\n");
-                continue;
-            }
+        if (!cdef_left) cstart = -CDEF_HBORDER;  //CHKN if the left block has not been filtered, then we can use samples on the left as input.
+
+        nhb = AOMMIN(MI_SIZE_64X64, cm->mi_cols - MI_SIZE_64X64 * fbc);
+        nvb = AOMMIN(MI_SIZE_64X64, cm->mi_rows - MI_SIZE_64X64 * fbr);
+        int32_t frame_top, frame_left, frame_bottom, frame_right;
+
+        int32_t mi_row = MI_SIZE_64X64 * fbr;
+        int32_t mi_col = MI_SIZE_64X64 * fbc;
+        // for the current filter block, it's top left corner mi structure (mi_tl)
+        // is first accessed to check whether the top and left boundaries are
+        // frame boundaries. Then bottom-left and top-right mi structures are
+        // accessed to check whether the bottom and right boundaries
+        // (respectively) are frame boundaries.
+        //
+        // Note that we can't just check the bottom-right mi structure - eg. if
+        // we're at the right-hand edge of the frame but not the bottom, then
+        // the bottom-right mi is NULL but the bottom-left is not.
+        frame_top = (mi_row == 0) ? 1 : 0;
+        frame_left = (mi_col == 0) ? 1 : 0;
+
+        if (fbr != nvfb - 1)
+            frame_bottom = (mi_row + MI_SIZE_64X64 == cm->mi_rows) ? 1 : 0;
+        else
+            frame_bottom = 1;
 
-            if (!cdef_left) cstart = -CDEF_HBORDER;  //CHKN if the left block has not been filtered, then we can use samples on the left as input.
+        if (fbc != nhfb - 1)
+            frame_right = (mi_col + MI_SIZE_64X64 == cm->mi_cols) ? 1 : 0;
+        else
+            frame_right = 1;
+
+        const int32_t mbmi_cdef_strength = pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength;
+        level = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
+        sec_strength = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
+        sec_strength += sec_strength == 3;
+        uv_level = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
+        uv_sec_strength = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
+        uv_sec_strength += uv_sec_strength == 3;
+        if ((level == 0 && sec_strength == 0 && uv_level == 0 && uv_sec_strength == 0) ||
+            (cdef_count = sb_compute_cdef_list(pCs, cm, fbr * MI_SIZE_64X64, fbc * MI_SIZE_64X64, dlist, BLOCK_64X64)) == 0) {
+            cdef_left = 0;
+            continue;
+        }
 
-            nhb = AOMMIN(MI_SIZE_64X64, cm->mi_cols - MI_SIZE_64X64 * fbc);
-            nvb = AOMMIN(MI_SIZE_64X64, cm->mi_rows - MI_SIZE_64X64 * fbr);
-            int32_t frame_top, frame_left, frame_bottom, frame_right;
-
-            int32_t mi_row = MI_SIZE_64X64 * fbr;
-            int32_t mi_col = MI_SIZE_64X64 * fbc;
-            // for the current filter block, it's top left corner mi structure (mi_tl)
-            // is first accessed to check whether the top and left boundaries are
-            // frame boundaries. Then bottom-left and top-right mi structures are
-            // accessed to check whether the bottom and right boundaries
-            // (respectively) are frame boundaries.
-            //
-            // Note that we can't just check the bottom-right mi structure - eg. if
-            // we're at the right-hand edge of the frame but not the bottom, then
-            // the bottom-right mi is NULL but the bottom-left is not.
-            frame_top = (mi_row == 0) ? 1 : 0;
-            frame_left = (mi_col == 0) ? 1 : 0;
-
-            if (fbr != nvfb - 1)
-                frame_bottom = (mi_row + MI_SIZE_64X64 == cm->mi_rows) ? 1 : 0;
+        curr_row_cdef[fbc] = 1;
+        for (int32_t pli = 0; pli < num_planes; pli++) {
+            int32_t coffset;
+            int32_t rend, cend;
+            int32_t pri_damping = pCs->parent_pcs_ptr->cdef_pri_damping;
+            int32_t sec_damping = pCs->parent_pcs_ptr->cdef_sec_damping;
+            int32_t hsize = nhb << mi_wide_l2[pli];
+            int32_t vsize = nvb << mi_high_l2[pli];
+
+            if (pli) {
+                level = uv_level;
+                sec_strength = uv_sec_strength;
+            }
+
+            if (fbc == nhfb - 1)
+                cend = hsize;
             else
-                frame_bottom = 1;
+                cend = hsize + CDEF_HBORDER;
 
-            if (fbc != nhfb - 1)
-                frame_right = (mi_col + MI_SIZE_64X64 == cm->mi_cols) ? 1 : 0;
+            if (fbr == nvfb - 1)
+                rend = vsize;
             else
-                frame_right = 1;
-
-            const int32_t mbmi_cdef_strength = pCs->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength;
-            level = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
-            sec_strength = pCs->parent_pcs_ptr->cdef_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
-            sec_strength += sec_strength == 3;
-            uv_level = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] / CDEF_SEC_STRENGTHS;
-            uv_sec_strength = pCs->parent_pcs_ptr->cdef_uv_strengths[mbmi_cdef_strength] % CDEF_SEC_STRENGTHS;
-            uv_sec_strength += uv_sec_strength == 3;
-            if ((level == 0 && sec_strength == 0 && uv_level == 0 && uv_sec_strength == 0) ||
-                (cdef_count = sb_compute_cdef_list(pCs, cm, fbr * MI_SIZE_64X64, fbc * MI_SIZE_64X64, dlist, BLOCK_64X64)) == 0) {
-                cdef_left = 0;
-                continue;
+                rend = vsize + CDEF_VBORDER;
+
+            coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
+            if (fbc == nhfb - 1) {
+                /* On the last superblock column, fill in the right border with
+                CDEF_VERY_LARGE to avoid filtering with the outside. */
+                fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
+                    CDEF_VERY_LARGE);
+            }
+            if (fbr == nvfb - 1) {
+                /* On the last superblock row, fill in the bottom border with
+                CDEF_VERY_LARGE to avoid filtering with the outside. */
+                fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
             }
 
-            curr_row_cdef[fbc] = 1;
-            for (int32_t pli = 0; pli < num_planes; pli++) {
-                int32_t coffset;
-                int32_t rend, cend;
-                int32_t pri_damping = pCs->parent_pcs_ptr->cdef_pri_damping;
-                int32_t sec_damping = pCs->parent_pcs_ptr->cdef_sec_damping;
-                int32_t hsize = nhb << mi_wide_l2[pli];
-                int32_t vsize = nvb << mi_high_l2[pli];
-
-                if (pli) {
-                    level = uv_level;
-                    sec_strength = uv_sec_strength;
-                }
-
-                if (fbc == nhfb - 1)
-                    cend = hsize;
-                else
-                    cend = hsize + CDEF_HBORDER;
-
-                if (fbr == nvfb - 1)
-                    rend = vsize;
-                else
-                    rend = vsize + CDEF_VBORDER;
-
-                coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
-                if (fbc == nhfb - 1) {
-                    /* On the last superblock column, fill in the right border with
-                    CDEF_VERY_LARGE to avoid filtering with the outside. */
-                    fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
-                        rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
-                        CDEF_VERY_LARGE);
-                }
-                if (fbr == nvfb - 1) {
-                    /* On the last superblock row, fill in the bottom border with
-                    CDEF_VERY_LARGE to avoid filtering with the outside. */
-                    fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
-                        CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+            uint16_t* recBuff = 0;
+            uint32_t recStride = 0;
+
+            switch (pli) {
+            case 0:
+                recBuff = reconBufferY;
+                recStride = recon_picture_ptr->stride_y;
+                break;
+            case 1:
+                recBuff = reconBufferCb;
+                recStride = recon_picture_ptr->stride_cb;
+
+                break;
+            case 2:
+                recBuff = reconBufferCr;
+                recStride = recon_picture_ptr->stride_cr;
+                break;
+            }
 
-                uint16_t* recBuff = 0;
-                uint32_t recStride = 0;
-
-                switch (pli) {
-                case 0:
-                    recBuff = reconBufferY;
-                    recStride = recon_picture_ptr->stride_y;
-                    break;
-                case 1:
-                    recBuff = reconBufferCb;
-                    recStride = recon_picture_ptr->stride_cb;
-
-                    break;
-                case 2:
-                    recBuff = reconBufferCr;
-                    recStride = recon_picture_ptr->stride_cr;
-                    break;
-                }
+            //--ok
+                            /* Copy in the pixels we need from the current superblock for
+                            deringing.*/
 
-                //--ok
-                                /* Copy in the pixels we need from the current superblock for
-                                deringing.*/
+            copy_sb16_16(//cm,
+                &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
+                CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
+                (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr, coffset + cstart,
+                recStride/*xd->plane[pli].dst.stride*/, rend, cend - cstart);
 
+            if (!prev_row_cdef[fbc]) {
                 copy_sb16_16(//cm,
-                    &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
-                    CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr, coffset + cstart,
-                    recStride/*xd->plane[pli].dst.stride*/, rend, cend - cstart);
-
-                if (!prev_row_cdef[fbc]) {
-                    copy_sb16_16(//cm,
-                        &src[CDEF_HBORDER], CDEF_BSTRIDE,
-                        recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
-                }
-                else if (fbr > 0) {
-                    copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, &linebuf[pli][coffset],
-                        stride, CDEF_VBORDER, hsize);
-                }
-                else {
-                    fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
-                        CDEF_VERY_LARGE);
-                }
+                    &src[CDEF_HBORDER], CDEF_BSTRIDE,
+                    recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
+            }
+            else if (fbr > 0) {
+                copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, &linebuf[pli][coffset],
+                    stride, CDEF_VBORDER, hsize);
+            }
+            else {
+                fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
+                    CDEF_VERY_LARGE);
+            }
 
-                if (!prev_row_cdef[fbc - 1]) {
-                    copy_sb16_16(//cm,
-                        src, CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset - CDEF_HBORDER, recStride/*xd->plane[pli].dst.stride*/,
-                        CDEF_VBORDER, CDEF_HBORDER);
-                }
-                else if (fbr > 0 && fbc > 0) {
-                    copy_rect(src, CDEF_BSTRIDE, &linebuf[pli][coffset - CDEF_HBORDER],
-                        stride, CDEF_VBORDER, CDEF_HBORDER);
-                }
-                else {
-                    fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
+            if (!prev_row_cdef[fbc - 1]) {
+                copy_sb16_16(//cm,
+                    src, CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset - CDEF_HBORDER, recStride/*xd->plane[pli].dst.stride*/,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            }
+            else if (fbr > 0 && fbc > 0) {
+                copy_rect(src, CDEF_BSTRIDE, &linebuf[pli][coffset - CDEF_HBORDER],
+                    stride, CDEF_VBORDER, CDEF_HBORDER);
+            }
+            else {
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
 
-                if (!prev_row_cdef[fbc + 1]) {
-                    copy_sb16_16(//cm,
-                        &src[CDEF_HBORDER + (nhb << mi_wide_l2[pli])],
-                        CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
-                        coffset + hsize, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER,
-                        CDEF_HBORDER);
-                }
-                else if (fbr > 0 && fbc < nhfb - 1) {
-                    copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
-                        &linebuf[pli][coffset + hsize], stride, CDEF_VBORDER,
-                        CDEF_HBORDER);
-                }
-                else {
-                    fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER,
-                        CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+            if (!prev_row_cdef[fbc + 1]) {
+                copy_sb16_16(//cm,
+                    &src[CDEF_HBORDER + (nhb << mi_wide_l2[pli])],
+                    CDEF_BSTRIDE, recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr - CDEF_VBORDER,
+                    coffset + hsize, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER,
+                    CDEF_HBORDER);
+            }
+            else if (fbr > 0 && fbc < nhfb - 1) {
+                copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    &linebuf[pli][coffset + hsize], stride, CDEF_VBORDER,
+                    CDEF_HBORDER);
+            }
+            else {
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER,
+                    CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
 
-                if (cdef_left) {
-                    /* If we deringed the superblock on the left then we need to copy in
-                    saved pixels. */
-                    copy_rect(src, CDEF_BSTRIDE, colbuf[pli], CDEF_HBORDER,
-                        rend + CDEF_VBORDER, CDEF_HBORDER);
-                }
+            if (cdef_left) {
+                /* If we deringed the superblock on the left then we need to copy in
+                saved pixels. */
+                copy_rect(src, CDEF_BSTRIDE, colbuf[pli], CDEF_HBORDER,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+            }
 
-                /* Saving pixels in case we need to dering the superblock on the
-                right. */
-                if (fbc < nhfb - 1)
-                    copy_rect(colbuf[pli], CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
-                        rend + CDEF_VBORDER, CDEF_HBORDER);
-                if (fbr < nvfb - 1)
-                    copy_sb16_16(
-                        //cm,
-                        &linebuf[pli][coffset], stride, recBuff/*xd->plane[pli].dst.buf*/,
-                        (MI_SIZE_64X64 << mi_high_l2[pli]) * (fbr + 1) - CDEF_VBORDER,
-                        coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
-                if (frame_top) {
-                    fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
-                if (frame_left) {
-                    fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER, CDEF_HBORDER,
-                        CDEF_VERY_LARGE);
-                }
-                if (frame_bottom) {
-                    fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
-                        CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
-                if (frame_right) {
-                    fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
-                        vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
-                }
+            /* Saving pixels in case we need to dering the superblock on the
+            right. */
+            if (fbc < nhfb - 1)
+                copy_rect(colbuf[pli], CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+            if (fbr < nvfb - 1)
+                copy_sb16_16(
+                    //cm,
+                    &linebuf[pli][coffset], stride, recBuff/*xd->plane[pli].dst.buf*/,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * (fbr + 1) - CDEF_VBORDER,
+                    coffset, recStride/*xd->plane[pli].dst.stride*/, CDEF_VBORDER, hsize);
+            if (frame_top) {
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
+            if (frame_left) {
+                fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
+            if (frame_bottom) {
+                fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE], CDEF_BSTRIDE,
+                    CDEF_VBORDER, hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
+            if (frame_right) {
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
+            }
 
-                //if (cm->use_highbitdepth) {
-                //  cdef_filter_fb(
-                //      NULL,
-                //      &CONVERT_TO_SHORTPTR(
-                //          xd->plane[pli]
-                //              .dst.buf)[xd->plane[pli].dst.stride *
-                //                            (MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +
-                //                        (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                //      xd->plane[pli].dst.stride,
-                //      &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
-                //      ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
-                //      sec_strength, pri_damping, sec_damping, coeff_shift);
-                //} else
-                {
-                    cdef_filter_fb(
-                        NULL,
-                        &recBuff[recStride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) + (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                        //&xd->plane[pli].dst.buf[xd->plane[pli].dst.stride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +(fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
-                        recStride/*xd->plane[pli].dst.stride*/,
-                        &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
-                        ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
-                        sec_strength, pri_damping, sec_damping, coeff_shift);
-                }
+            //if (cm->use_highbitdepth) {
+            //  cdef_filter_fb(
+            //      NULL,
+            //      &CONVERT_TO_SHORTPTR(
+            //          xd->plane[pli]
+            //              .dst.buf)[xd->plane[pli].dst.stride *
+            //                            (MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +
+            //                        (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+            //      xd->plane[pli].dst.stride,
+            //      &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
+            //      ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
+            //      sec_strength, pri_damping, sec_damping, coeff_shift);
+            //} else
+            {
+                cdef_filter_fb(
+                    NULL,
+                    &recBuff[recStride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) + (fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+                    //&xd->plane[pli].dst.buf[xd->plane[pli].dst.stride *(MI_SIZE_64X64 * fbr << mi_high_l2[pli]) +(fbc * MI_SIZE_64X64 << mi_wide_l2[pli])],
+                    recStride/*xd->plane[pli].dst.stride*/,
+                    &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER], xdec[pli],
+                    ydec[pli], dir, NULL, var, pli, dlist, cdef_count, level,
+                    sec_strength, pri_damping, sec_damping, coeff_shift);
             }
-            cdef_left = 1;  //CHKN filtered data is written back directy to recFrame.
-        }
-        {
-            uint8_t *tmp = prev_row_cdef;
-            prev_row_cdef = curr_row_cdef;
-            curr_row_cdef = tmp;
         }
+        cdef_left = 1;  //CHKN filtered data is written back directy to recFrame.
     }
-    aom_free(row_cdef);
-    for (int32_t pli = 0; pli < num_planes; pli++) {
-        aom_free(linebuf[pli]);
-        aom_free(colbuf[pli]);
-    }
+    state->prev_row_cdef = curr_row_cdef;
+    state->curr_row_cdef = prev_row_cdef;
+}
+
+void av1_cdef_frame16bit(
+    EncDecContext                *context_ptr,
+    SequenceControlSet           *sequence_control_set_ptr,
+    PictureControlSet            *pCs){
+    (void)context_ptr;
+    Av1Common*   cm = pCs->parent_pcs_ptr->av1_cm;
+    const int32_t nvfb = (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    CdefRowState state;
+
+    av1_cdef_row_state_alloc(cm, &state);
+    for (int32_t fbr = 0; fbr < nvfb; fbr++)
+        av1_cdef_fb_row16bit(sequence_control_set_ptr, pCs, &state, fbr);
+    av1_cdef_row_state_free(&state);
 }
 
 ///-------search
@@ -1502,6 +1524,59 @@ void finish_cdef_search(
     free(selected_strength);
 }
 
+// Predict a CDEF strength from the quantizer, q is the ac quantizer of the
+// frame in 8 bit precision and c the quadratic model of the strength
+static int32_t cdef_strength_from_q(double q, const double c[3], int32_t max)
+{
+    const int32_t strength = (int32_t)floor(q * q * c[0] + q * c[1] + c[2] + 0.5);
+    return AOMMAX(0, AOMMIN(strength, max));
+}
+
+/* Pick a single CDEF strength per plane from the quantizer instead of
+   searching the picture, for pictures whose CDEF runs behind the deblocking
+   of each SB row. The model is the one libaom uses for its real time modes.
+*/
+void av1_pick_cdef_from_q(
+    SequenceControlSet           *sequence_control_set_ptr,
+    PictureControlSet            *picture_control_set_ptr)
+{
+    static const double inter_y_f1[3] = { -0.0000023593946, 0.0068615186, 0.02709886 };
+    static const double inter_y_f2[3] = { -0.00000057629734, 0.0013993345, 0.03831067 };
+    static const double inter_uv_f1[3] = { -0.0000007095069, 0.0034628846, 0.00887099 };
+    static const double inter_uv_f2[3] = { 0.00000023874085, 0.00028223585, 0.05576307 };
+    static const double intra_y_f1[3] = { 0.0000033731974, 0.008070594, 0.0187634 };
+    static const double intra_y_f2[3] = { 0.0000029167343, 0.0027798624, 0.0079405 };
+    static const double intra_uv_f1[3] = { -0.0000130790995, 0.012892405, -0.00748388 };
+    static const double intra_uv_f2[3] = { 0.0000032651783, 0.00035520183, 0.00228092 };
+
+    struct PictureParentControlSet     *pPcs = picture_control_set_ptr->parent_pcs_ptr;
+    Av1Common*   cm = pPcs->av1_cm;
+    const int32_t bit_depth = sequence_control_set_ptr->static_config.encoder_bit_depth;
+    const double q = av1_ac_quant_Q3(pPcs->base_qindex, 0, (AomBitDepth)bit_depth) >> (bit_depth - 8);
+    const EbBool is_intra = (EbBool)(pPcs->slice_type == I_SLICE);
+    const int32_t nvfb = (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t nhfb = (cm->mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+
+    aom_clear_system_state();
+
+    pPcs->cdef_strengths[0] =
+        cdef_strength_from_q(q, is_intra ? intra_y_f1 : inter_y_f1, CDEF_PRI_STRENGTHS - 1) * CDEF_SEC_STRENGTHS +
+        cdef_strength_from_q(q, is_intra ? intra_y_f2 : inter_y_f2, CDEF_SEC_STRENGTHS - 1);
+    pPcs->cdef_uv_strengths[0] =
+        cdef_strength_from_q(q, is_intra ? intra_uv_f1 : inter_uv_f1, CDEF_PRI_STRENGTHS - 1) * CDEF_SEC_STRENGTHS +
+        cdef_strength_from_q(q, is_intra ? intra_uv_f2 : inter_uv_f2, CDEF_SEC_STRENGTHS - 1);
+    pPcs->cdef_bits = 0;
+    pPcs->nb_cdef_strengths = 1;
+    pPcs->cdef_pri_damping = 3 + (pPcs->base_qindex >> 6);
+    pPcs->cdef_sec_damping = 3 + (pPcs->base_qindex >> 6);
+    pPcs->cdef_frame_strength = 4;
+
+    for (int32_t fbr = 0; fbr < nvfb; ++fbr) {
+        for (int32_t fbc = 0; fbc < nhfb; ++fbc)
+            picture_control_set_ptr->mi_grid_base[MI_SIZE_64X64 * fbr * cm->mi_stride + MI_SIZE_64X64 * fbc]->mbmi.cdef_strength = 0;
+    }
+}
+
 void av1_cdef_search(
     EncDecContext                *context_ptr,
     SequenceControlSet           *sequence_control_set_ptr,
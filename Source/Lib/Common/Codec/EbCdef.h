@@ -40,6 +40,16 @@ extern "C" {
 #define CDEF_INBUF_SIZE \
   (CDEF_BSTRIDE * ((1 << MAX_SB_SIZE_LOG2) + 2 * CDEF_VBORDER))
 
+    /* The line buffers above the next filter block row, the column buffers
+       of the current one and which filter blocks of the previous row were
+       filtered, carried from one filter block row to the next. */
+    typedef struct CdefRowState {
+        uint16_t *linebuf[3];
+        uint16_t *colbuf[3];
+        uint8_t  *row_cdef;
+        uint8_t  *prev_row_cdef;
+        uint8_t  *curr_row_cdef;
+    } CdefRowState;
     extern const int32_t cdef_pri_taps[2][2];
     extern const int32_t cdef_sec_taps[2][2];
     DECLARE_ALIGNED(16, extern const int32_t, cdef_directions[8][2]);
@@ -438,7 +438,7 @@ void* cdef_kernel(void *input_ptr)
 
         int32_t selected_strength_cnt[64] = { 0 };
 
-        if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode)
+        if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode && !picture_control_set_ptr->fused_loop_filter)
         {
             if (is16bit)
                 cdef_seg_search16bit(
@@ -460,6 +460,9 @@ void* cdef_kernel(void *input_ptr)
         {
            // printf("    CDEF all seg here  %i\n", picture_control_set_ptr->picture_number);
         if (sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode) {
+            // The fused loop filter picked the strengths and filtered the
+            // picture behind the deblocking
+            if (!picture_control_set_ptr->fused_loop_filter) {
                 finish_cdef_search(
                     0,
                     sequence_control_set_ptr,
@@ -478,6 +481,7 @@ void* cdef_kernel(void *input_ptr)
                             sequence_control_set_ptr,
                             picture_control_set_ptr);
                 }
+            }
         }
         else {
             picture_control_set_ptr->parent_pcs_ptr->cdef_bits = 0;
@@ -488,7 +492,7 @@ void* cdef_kernel(void *input_ptr)
 
         //restoration prep
 
-        if (sequence_control_set_ptr->seq_header.enable_restoration)
+        if (sequence_control_set_ptr->seq_header.enable_restoration && !picture_control_set_ptr->fused_loop_filter)
         {
             av1_loop_restoration_save_boundary_lines(
                 cm->frame_to_show,
@@ -506,7 +510,7 @@ void* cdef_kernel(void *input_ptr)
 
         picture_control_set_ptr->rest_segments_column_count = sequence_control_set_ptr->rest_segment_column_count;
         picture_control_set_ptr->rest_segments_row_count =   sequence_control_set_ptr->rest_segment_row_count;
-        picture_control_set_ptr->rest_segments_total_count = (uint16_t)(picture_control_set_ptr->rest_segments_column_count  * picture_control_set_ptr->rest_segments_row_count);
+        picture_control_set_ptr->rest_segments_total_count = picture_control_set_ptr->fused_loop_filter ? 1 : (uint16_t)(picture_control_set_ptr->rest_segments_column_count  * picture_control_set_ptr->rest_segments_row_count);
         picture_control_set_ptr->tot_seg_searched_rest = 0;
         uint32_t segment_index;
         for (segment_index = 0; segment_index < picture_control_set_ptr->rest_segments_total_count; ++segment_index)
@@ -23,6 +23,7 @@
 #include "EbSequenceControlSet.h"
 #include "EbReferenceObject.h"
 #include "EbDeblockingFilter.h"
+#include "EbThreads.h"
 
 #define   convertToChromaQp(iQpY)  ( ((iQpY) < 0) ? (iQpY) : (((iQpY) > 57) ? ((iQpY)-6) : (int32_t)(map_chroma_qp((uint32_t)iQpY))) )
 
@@ -1366,6 +1367,44 @@ void av1_loop_filter_frame(
         }
     }
 }
+
+/* Filters the SB row y_lcu_index of the frame. An SB is filtered once the
+   row above is two SBs ahead, as its horizontal edges read the bottom of
+   the above row, whose right neighbor vertical edges are filtered first in
+   raster order. So several threads may filter the rows of a frame, taking
+   them in order, waiting on sb_row_cond_var for the row above.
+   av1_loop_filter_frame_init must have been called. */
+void av1_loop_filter_sb_row(
+    EbPictureBufferDesc *frame_buffer,
+    PictureControlSet *picture_control_set_ptr,
+    int32_t plane_start, int32_t plane_end,
+    uint32_t y_lcu_index,
+    volatile uint32_t *sb_row_progress,
+    EbHandle sb_row_cond_var) {
+    SequenceControlSet *scs_ptr = (SequenceControlSet*)picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    uint8_t   sb_size_Log2 = (uint8_t)Log2f(scs_ptr->sb_size_pix);
+    uint32_t  x_lcu_index;
+
+    uint32_t picture_width_in_sb = (scs_ptr->seq_header.max_frame_width + scs_ptr->sb_size_pix - 1) / scs_ptr->sb_size_pix;
+
+    for (x_lcu_index = 0; x_lcu_index < picture_width_in_sb; ++x_lcu_index) {
+        if (y_lcu_index)
+            eb_wait_cond_var(sb_row_cond_var, &sb_row_progress[y_lcu_index - 1], AOMMIN(x_lcu_index + 2, picture_width_in_sb), NULL);
+
+        loop_filter_sb(
+            frame_buffer,
+            picture_control_set_ptr,
+            NULL,
+            (y_lcu_index << sb_size_Log2) >> 2,
+            (x_lcu_index << sb_size_Log2) >> 2,
+            plane_start,
+            plane_end,
+            (x_lcu_index == picture_width_in_sb - 1) ? EB_TRUE : EB_FALSE);
+
+        eb_atomic_store_u32(&sb_row_progress[y_lcu_index], x_lcu_index + 1);
+        eb_signal_cond_var(sb_row_cond_var);
+    }
+}
 extern int16_t av1_ac_quant_Q3(int32_t qindex, int32_t delta, AomBitDepth bit_depth);
 
 void EbCopyBuffer(
@@ -94,6 +94,14 @@ extern "C" {
         /*MacroBlockD *xd,*/ int32_t plane_start, int32_t plane_end/*,
         int32_t partial_frame*/);
 
+    void av1_loop_filter_sb_row(
+        EbPictureBufferDesc *frame_buffer,
+        PictureControlSet *pcs_ptr,
+        int32_t plane_start, int32_t plane_end,
+        uint32_t y_lcu_index,
+        volatile uint32_t *sb_row_progress,
+        EbHandle sb_row_cond_var);
+
     void av1_pick_filter_level(
         DlfContext            *context_ptr,
         EbPictureBufferDesc   *srcBuffer, // source input
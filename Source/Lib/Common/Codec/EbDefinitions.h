@@ -46,6 +46,9 @@ extern "C" {
 #define CDEF_AVX_OPT                      1
 #define MR_MODE                           0
 #define EIGTH_PEL_MV                      0
+#ifndef LOCK_FREE_FIFO
+#define LOCK_FREE_FIFO                    0 // Lock-free MPMC ring buffers with spin-then-park waiting for the inter-process fifos (CMake option LOCK_FREE_FIFO)
+#endif
 
 //FOR DEBUGGING - Do not remove
 #define NO_ENCDEC                         0 // bypass encDec to test cmpliance of MD. complained achieved when skip_flag is OFF. Port sample code from VCI-SW_AV1_Candidate1 branch
@@ -2171,7 +2174,8 @@ typedef enum EbPtrType
     EB_A_PTR        = 1,     // malloc'd pointer aligned
     EB_MUTEX        = 2,     // mutex
     EB_SEMAPHORE    = 3,     // semaphore
-    EB_THREAD       = 4      // thread handle
+    EB_THREAD       = 4,     // thread handle
+    EB_COND_VAR     = 5      // condition variable
 } EbPtrType;
 
 typedef struct EbMemoryMapEntry
@@ -2197,14 +2201,9 @@ extern    EbMemoryMapEntry          *app_memory_map;            // App Memory ta
 extern    uint32_t                  *app_memory_map_index;       // App Memory index
 extern    uint64_t                  *total_app_memory;          // App Memory malloc'd
 
-extern    EbMemoryMapEntry          *memory_map;               // library Memory table
-extern    uint32_t                  *memory_map_index;          // library memory index
-extern    uint64_t                  *total_lib_memory;          // library Memory malloc'd
-
-extern    uint32_t                   lib_malloc_count;
-extern    uint32_t                   lib_thread_count;
-extern    uint32_t                   lib_semaphore_count;
-extern    uint32_t                   lib_mutex_count;
+// Allocations from the memory arena of the calling thread, see EbMemoryArena.h
+extern    EbPtr                      eb_memory_arena_alloc(size_t size, size_t alignment, EbBool zero);
+extern    EbErrorType                eb_memory_arena_add_object(EbPtr object_ptr, EbPtrType ptr_type);
 
 extern    uint32_t                   app_malloc_count;
 
@@ -2234,59 +2233,49 @@ extern    uint32_t                   app_malloc_count;
     EB_ADD_APP_MEM(pointer, n_elements, pointer_class, app_malloc_count, return_type);
 
 #define ALVALUE 32
-#define EB_ADD_MEM(pointer, size, pointer_class, count, release) \
+#define EB_ADD_MEM(pointer, pointer_class, release) \
     do { \
-        EbMemoryMapEntry *node; \
         if (!pointer) return EB_ErrorInsufficientResources; \
-        node = malloc(sizeof(EbMemoryMapEntry)); \
-        if (!node) { \
+        if (eb_memory_arena_add_object((EbPtr)pointer, pointer_class) != EB_ErrorNone) { \
             release(pointer); \
             return EB_ErrorInsufficientResources; \
         } \
-        node->ptr_type         = pointer_class; \
-        node->ptr              = (EbPtr)pointer;\
-        node->prev_entry       = (EbPtr)memory_map;   \
-        memory_map             = node;          \
-        (*memory_map_index)++; \
-        *total_lib_memory += (size + 7) / 8 + sizeof(EbMemoryMapEntry); \
-        count++; \
     } while (0)
 
-#ifdef _MSC_VER
-#define EB_ALLIGN_MALLOC(type, pointer, n_elements, pointer_class) \
-pointer = (type) _aligned_malloc(n_elements,ALVALUE); \
-EB_ADD_MEM(pointer, n_elements, pointer_class, lib_malloc_count, _aligned_free);
-
-#else
 #define EB_ALLIGN_MALLOC(type, pointer, n_elements, pointer_class) \
-if (posix_memalign((void**)(&(pointer)), ALVALUE, n_elements) != 0) { \
-    return EB_ErrorInsufficientResources; \
-} \
-EB_ADD_MEM(pointer, n_elements, pointer_class, lib_malloc_count, free);
-#endif
+pointer = (type) eb_memory_arena_alloc(n_elements, ALVALUE, EB_FALSE); \
+if (!pointer) return EB_ErrorInsufficientResources;
 
 #define EB_MALLOC(type, pointer, n_elements, pointer_class) \
-pointer = (type) malloc(n_elements); \
-EB_ADD_MEM(pointer, n_elements, pointer_class, lib_malloc_count, free);
+pointer = (type) eb_memory_arena_alloc(n_elements, 2 * sizeof(EbPtr), EB_FALSE); \
+if (!pointer) return EB_ErrorInsufficientResources;
 
 #define EB_CALLOC(type, pointer, count, size, pointer_class) \
-pointer = (type) calloc(count, size); \
-EB_ADD_MEM(pointer, (count)*(size), pointer_class, lib_malloc_count, free);
+pointer = (type) eb_memory_arena_alloc((size_t)(count)*(size), 2 * sizeof(EbPtr), EB_TRUE); \
+if (!pointer) return EB_ErrorInsufficientResources;
 
 #define EB_CREATESEMAPHORE(type, pointer, n_elements, pointer_class, initial_count, max_count) \
 pointer = eb_create_semaphore(initial_count, max_count); \
-EB_ADD_MEM(pointer, n_elements, pointer_class, lib_semaphore_count, eb_destroy_semaphore);
+EB_ADD_MEM(pointer, pointer_class, eb_destroy_semaphore);
 
 #define EB_CREATEMUTEX(type, pointer, n_elements, pointer_class) \
 pointer = eb_create_mutex(); \
-EB_ADD_MEM(pointer, n_elements, pointer_class, lib_mutex_count, eb_destroy_mutex);
+EB_ADD_MEM(pointer, pointer_class, eb_destroy_mutex);
+
+#define EB_CREATECONDVAR(type, pointer, n_elements, pointer_class) \
+pointer = eb_create_cond_var(); \
+EB_ADD_MEM(pointer, pointer_class, eb_destroy_cond_var);
 
 #define EB_MEMORY() \
-printf("Total Number of Mallocs in Library: %d\n", lib_malloc_count); \
-printf("Total Number of Threads in Library: %d\n", lib_thread_count); \
-printf("Total Number of Semaphore in Library: %d\n", lib_semaphore_count); \
-printf("Total Number of Mutex in Library: %d\n", lib_mutex_count); \
-printf("Total Library Memory: %.2lf KB\n\n",*total_lib_memory/(double)1024);
+do { \
+    EbMemoryFootprint footprint; \
+    eb_memory_arena_get_footprint(eb_memory_arena_get_current(), &footprint); \
+    printf("Total Number of Mallocs in Library: %u\n", footprint.allocation_count); \
+    printf("Total Number of Threads in Library: %u\n", footprint.thread_count); \
+    printf("Total Number of Semaphore in Library: %u\n", footprint.semaphore_count); \
+    printf("Total Number of Mutex in Library: %u\n", footprint.mutex_count); \
+    printf("Total Library Memory: %.2lf KB in %u chunks\n\n", footprint.reserved_size/(double)1024, footprint.chunk_count); \
+} while (0)
 
 #define EB_APP_MEMORY() \
 printf("Total Number of Mallocs in App: %d\n", app_malloc_count); \
@@ -2346,10 +2335,10 @@ void(*ErrorHandler)(
 #define TOTAL_LEVEL_COUNT                           13
 
 //***Encoding Parameters***
-#define MAX_PICTURE_WIDTH_SIZE                      4672u
-#define MAX_PICTURE_HEIGHT_SIZE                     2560u
-#define MAX_PICTURE_WIDTH_SIZE_CH                   2336u
-#define MAX_PICTURE_HEIGHT_SIZE_CH                  1280u
+// Largest source accepted (AV1 level 6). The per picture arrays are sized
+// from the source dimensions, not from these.
+#define MAX_PICTURE_WIDTH_SIZE                      8192u
+#define MAX_PICTURE_HEIGHT_SIZE                     4352u
 #define INTERNAL_BIT_DEPTH                          8 // to be modified
 #define MAX_SAMPLE_VALUE                            ((1 << INTERNAL_BIT_DEPTH) - 1)
 #define MAX_SAMPLE_VALUE_10BIT                      0x3FF
@@ -2374,10 +2363,6 @@ void(*ErrorHandler)(
 #define MIN_CU_BLK_COUNT                            ((BLOCK_SIZE_64 / MIN_BLOCK_SIZE) * (BLOCK_SIZE_64 / MIN_BLOCK_SIZE))
 #define MAX_NUM_OF_TU_PER_CU                        21
 #define MIN_NUM_OF_TU_PER_CU                        5
-#define MAX_LCU_ROWS                                ((MAX_PICTURE_HEIGHT_SIZE) / (BLOCK_SIZE_64))
-
-#define MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE       ((MAX_PICTURE_WIDTH_SIZE + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64) * \
-                                                ((MAX_PICTURE_HEIGHT_SIZE + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64)
 
 //***Prediction Structure***
 #define REF_LIST_MAX_DEPTH                          4 // NM - To be specified
@@ -24,6 +24,18 @@
 #include "EbDeblockingFilter.h"
 
 void av1_loop_restoration_save_boundary_lines(const Yv12BufferConfig *frame, Av1Common *cm, int32_t after_cdef);
+void av1_loop_restoration_save_fb_row_boundary_lines(const Yv12BufferConfig *frame, Av1Common *cm, int32_t fb_row, int32_t after_cdef);
+void av1_loop_restoration_filter_rows_init(Yv12BufferConfig *frame, Av1Common *cm);
+void av1_loop_restoration_filter_unit_row(Yv12BufferConfig *frame, Av1Common *cm, int32_t plane, int32_t unit_row);
+void av1_rest_unit_row_limits(const Av1Common *cm, int32_t plane, int32_t unit_row, int32_t *v_start, int32_t *v_end);
+void restoration_unit_row_search_init(Av1Common *const cm);
+void restoration_unit_row_search(int32_t *tmpbuf, const Yv12BufferConfig *src, Yv12BufferConfig *trial_frame_rst, PictureControlSet *pcs_ptr, int32_t plane, int32_t unit_row);
+void restoration_unit_row_search_finish(Av1Common *const cm);
+void av1_pick_cdef_from_q(SequenceControlSet *sequence_control_set_ptr, PictureControlSet *picture_control_set_ptr);
+void av1_cdef_row_state_alloc(const Av1Common *cm, CdefRowState *state);
+void av1_cdef_row_state_free(CdefRowState *state);
+void av1_cdef_fb_row(SequenceControlSet *sequence_control_set_ptr, PictureControlSet *pCs, CdefRowState *state, int32_t fbr);
+void av1_cdef_fb_row16bit(SequenceControlSet *sequence_control_set_ptr, PictureControlSet *pCs, CdefRowState *state, int32_t fbr);
 
 /******************************************************
  * Dlf Context Constructor
@@ -35,7 +47,8 @@ EbErrorType dlf_context_ctor(
     EbBool                  is16bit,
     EbColorFormat           color_format,
     uint32_t                max_input_luma_width,
-    uint32_t                max_input_luma_height
+    uint32_t                max_input_luma_height,
+    EbBool                  fused_loop_filter
    )
 {
     EbErrorType return_error = EB_ErrorNone;
@@ -74,10 +87,274 @@ EbErrorType dlf_context_ctor(
             (EbPtr*)&(context_ptr->temp_lf_recon_picture_ptr),
             (EbPtr)&temp_lf_recon_desc_init_data);
     }
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+
+    context_ptr->trial_frame_rst = (EbPictureBufferDesc *)EB_NULL;
+    context_ptr->rst_tmpbuf = (int32_t *)EB_NULL;
+    if (fused_loop_filter) {
+        EbPictureBufferDescInitData initData;
+
+        initData.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+        initData.max_width = (uint16_t)max_input_luma_width;
+        initData.max_height = (uint16_t)max_input_luma_height;
+        initData.bit_depth = is16bit ? EB_16BIT : EB_8BIT;
+        initData.color_format = color_format;
+        initData.left_padding = AOM_BORDER_IN_PIXELS;
+        initData.right_padding = AOM_BORDER_IN_PIXELS;
+        initData.top_padding = AOM_BORDER_IN_PIXELS;
+        initData.bot_padding = AOM_BORDER_IN_PIXELS;
+        initData.split_mode = EB_FALSE;
+
+        return_error = eb_picture_buffer_desc_ctor(
+            (EbPtr*)&context_ptr->trial_frame_rst,
+            (EbPtr)&initData);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+
+        EB_MALLOC(int32_t *, context_ptr->rst_tmpbuf, RESTORATION_TMPBUF_SIZE, EB_N_PTR);
+    }
 
     return return_error;
 }
 
+/******************************************************
+ * CDEF Search Copy SB Rows
+ *
+ * Copies the recon and the source of the SB rows
+ *   [sb_row_start, sb_row_end) into the 16 bit buffers
+ *   of the 8 bit CDEF search.
+ ******************************************************/
+static void cdef_search_copy_sb_rows(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    EbPictureBufferDesc   *recon_picture_ptr,
+    uint32_t               sb_row_start,
+    uint32_t               sb_row_end)
+{
+    const int32_t frame_width = sequence_control_set_ptr->seq_header.max_frame_width;
+    const int32_t frame_height = sequence_control_set_ptr->seq_header.max_frame_height;
+    const int32_t sb_size = sequence_control_set_ptr->sb_size_pix;
+
+    EbByte  rec_ptr = &((recon_picture_ptr->buffer_y)[recon_picture_ptr->origin_x + recon_picture_ptr->origin_y * recon_picture_ptr->stride_y]);
+    EbByte  rec_ptr_cb = &((recon_picture_ptr->buffer_cb)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->stride_cb]);
+    EbByte  rec_ptr_cr = &((recon_picture_ptr->buffer_cr)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->stride_cr]);
+
+    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+    EbByte  enh_ptr = &((input_picture_ptr->buffer_y)[input_picture_ptr->origin_x + input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
+    EbByte  enh_ptr_cb = &((input_picture_ptr->buffer_cb)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
+    EbByte  enh_ptr_cr = &((input_picture_ptr->buffer_cr)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
+
+    const int32_t luma_row_end = AOMMIN((int32_t)sb_row_end * sb_size, frame_height);
+    for (int32_t r = sb_row_start * sb_size; r < luma_row_end; ++r) {
+        for (int32_t c = 0; c < frame_width; ++c) {
+            picture_control_set_ptr->src[0][r * frame_width + c] = rec_ptr[r * recon_picture_ptr->stride_y + c];
+            picture_control_set_ptr->ref_coeff[0][r * frame_width + c] = enh_ptr[r * input_picture_ptr->stride_y + c];
+        }
+    }
+
+    const int32_t chroma_row_end = AOMMIN((int32_t)sb_row_end * sb_size / 2, frame_height / 2);
+    for (int32_t r = sb_row_start * sb_size / 2; r < chroma_row_end; ++r) {
+        for (int32_t c = 0; c < frame_width / 2; ++c) {
+            picture_control_set_ptr->src[1][r * frame_width / 2 + c] = rec_ptr_cb[r * recon_picture_ptr->stride_cb + c];
+            picture_control_set_ptr->ref_coeff[1][r * frame_width / 2 + c] = enh_ptr_cb[r * input_picture_ptr->stride_cb + c];
+            picture_control_set_ptr->src[2][r * frame_width / 2 + c] = rec_ptr_cr[r * recon_picture_ptr->stride_cr + c];
+            picture_control_set_ptr->ref_coeff[2][r * frame_width / 2 + c] = enh_ptr_cr[r * input_picture_ptr->stride_cr + c];
+        }
+    }
+}
+
+/******************************************************
+ * Fused Loop Filter
+ *
+ * Runs the CDEF and the Loop Restoration of the 64x64
+ *   filter block rows right behind the Deblocking of
+ *   their SB rows, in the DLF tasks, while the rows are
+ *   still cached. The CDEF strengths come from the
+ *   qindex and the restoration units are decided one
+ *   unit row at a time, so the CDEF and Rest processes
+ *   only pass the picture on.
+ ******************************************************/
+static EbBool fused_loop_filter_cdef(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr)
+{
+    return (EbBool)(sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode);
+}
+
+static EbBool fused_loop_filter_rest(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr)
+{
+    return (EbBool)(sequence_control_set_ptr->seq_header.enable_restoration && picture_control_set_ptr->parent_pcs_ptr->allow_intrabc == 0);
+}
+
+// Same condition as the CDEF process, the filtered picture is only needed
+// for the restoration, the references and the recon output
+static EbBool fused_loop_filter_cdef_apply(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr)
+{
+    return (EbBool)(fused_loop_filter_cdef(sequence_control_set_ptr, picture_control_set_ptr) &&
+        (sequence_control_set_ptr->seq_header.enable_restoration != 0 || picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag || sequence_control_set_ptr->static_config.recon_enabled));
+}
+
+static EbBool fused_loop_filter_enabled(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr)
+{
+    return (EbBool)(sequence_control_set_ptr->static_config.enable_fused_loop_filter &&
+        (fused_loop_filter_cdef(sequence_control_set_ptr, picture_control_set_ptr) || fused_loop_filter_rest(sequence_control_set_ptr, picture_control_set_ptr)));
+}
+
+static void fused_loop_filter_init(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    EbPictureBufferDesc   *recon_picture_ptr)
+{
+    Av1Common *cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+
+    link_eb_to_aom_buffer_desc(
+        recon_picture_ptr,
+        cm->frame_to_show);
+
+    if (fused_loop_filter_cdef(sequence_control_set_ptr, picture_control_set_ptr))
+        av1_pick_cdef_from_q(sequence_control_set_ptr, picture_control_set_ptr);
+    if (fused_loop_filter_cdef_apply(sequence_control_set_ptr, picture_control_set_ptr))
+        av1_cdef_row_state_alloc(cm, &picture_control_set_ptr->fused_cdef_state);
+    if (fused_loop_filter_rest(sequence_control_set_ptr, picture_control_set_ptr)) {
+        av1_loop_restoration_filter_rows_init(cm->frame_to_show, cm);
+        restoration_unit_row_search_init(cm);
+    }
+
+    picture_control_set_ptr->fused_fb_row_count = 0;
+    memset(picture_control_set_ptr->fused_rest_unit_row, 0, sizeof(picture_control_set_ptr->fused_rest_unit_row));
+}
+
+// Filter the filter block rows [fb_row_start, fb_row_end), whose deblocking
+// is final. They are taken in order, after the rows above them.
+static void fused_loop_filter_fb_rows(
+    DlfContext            *context_ptr,
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    uint32_t               fb_row_start,
+    uint32_t               fb_row_end)
+{
+    Av1Common *cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    Yv12BufferConfig *frame = cm->frame_to_show;
+    const EbBool is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
+    const EbBool cdef_apply = fused_loop_filter_cdef_apply(sequence_control_set_ptr, picture_control_set_ptr);
+    const EbBool rest = fused_loop_filter_rest(sequence_control_set_ptr, picture_control_set_ptr);
+    Yv12BufferConfig cpi_source;
+    Yv12BufferConfig trial_frame_rst;
+
+    if (fb_row_start == fb_row_end)
+        return;
+
+    if (rest) {
+        link_eb_to_aom_buffer_desc(
+            is16bit ? picture_control_set_ptr->input_frame16bit : picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+            &cpi_source);
+        link_eb_to_aom_buffer_desc(
+            context_ptr->trial_frame_rst,
+            &trial_frame_rst);
+    }
+
+    eb_wait_cond_var(picture_control_set_ptr->dlf_sb_row_cond_var, &picture_control_set_ptr->fused_fb_row_count, fb_row_start, NULL);
+
+    for (uint32_t fb_row = fb_row_start; fb_row < fb_row_end; ++fb_row) {
+        if (rest)
+            av1_loop_restoration_save_fb_row_boundary_lines(frame, cm, fb_row, 0);
+
+        if (cdef_apply) {
+            if (is16bit)
+                av1_cdef_fb_row16bit(sequence_control_set_ptr, picture_control_set_ptr, &picture_control_set_ptr->fused_cdef_state, fb_row);
+            else
+                av1_cdef_fb_row(sequence_control_set_ptr, picture_control_set_ptr, &picture_control_set_ptr->fused_cdef_state, fb_row);
+        }
+
+        if (rest) {
+            av1_loop_restoration_save_fb_row_boundary_lines(frame, cm, fb_row, 1);
+
+            for (int32_t plane = 0; plane < 3; ++plane) {
+                const int32_t is_uv = plane > 0;
+                const int32_t ss_y = is_uv && cm->subsampling_y;
+                const int32_t plane_height = frame->crop_heights[is_uv];
+                const int32_t row_end = AOMMIN((int32_t)((fb_row + 1) << CDEF_BLOCKSIZE_LOG2) >> ss_y, plane_height);
+                int32_t v_start, v_end;
+
+                extend_frame_rows(frame->buffers[plane], frame->crop_widths[is_uv], plane_height,
+                    frame->strides[is_uv], RESTORATION_BORDER, RESTORATION_BORDER,
+                    (int32_t)(fb_row << CDEF_BLOCKSIZE_LOG2) >> ss_y, row_end, is16bit);
+
+                // A unit row is ready once the rows its filter reads below it are
+                while (picture_control_set_ptr->fused_rest_unit_row[plane] < cm->rst_info[plane].vert_units_per_tile) {
+                    const int32_t unit_row = picture_control_set_ptr->fused_rest_unit_row[plane];
+
+                    av1_rest_unit_row_limits(cm, plane, unit_row, &v_start, &v_end);
+                    if (v_end == plane_height ? row_end != plane_height : v_end + RESTORATION_BORDER > row_end)
+                        break;
+
+                    restoration_unit_row_search(
+                        context_ptr->rst_tmpbuf,
+                        &cpi_source,
+                        &trial_frame_rst,
+                        picture_control_set_ptr,
+                        plane,
+                        unit_row);
+                    av1_loop_restoration_filter_unit_row(frame, cm, plane, unit_row);
+                    ++picture_control_set_ptr->fused_rest_unit_row[plane];
+                }
+            }
+        }
+
+        eb_atomic_store_u32(&picture_control_set_ptr->fused_fb_row_count, fb_row + 1);
+        eb_signal_cond_var(picture_control_set_ptr->dlf_sb_row_cond_var);
+    }
+}
+
+// The filter block rows final once the SB row is deblocked, the deblocking
+// of the next SB row still changes the bottom lines of this one
+static uint32_t fused_loop_filter_fb_row_end(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    uint32_t               sb_row,
+    uint32_t               picture_height_in_sb)
+{
+    const Av1Common *cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+
+    if (sb_row == picture_height_in_sb - 1)
+        return (cm->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    return (((sb_row + 1) * sequence_control_set_ptr->sb_size_pix) >> CDEF_BLOCKSIZE_LOG2) - 1;
+}
+
+static void fused_loop_filter_finish(
+    SequenceControlSet    *sequence_control_set_ptr,
+    PictureControlSet     *picture_control_set_ptr)
+{
+    if (fused_loop_filter_rest(sequence_control_set_ptr, picture_control_set_ptr))
+        restoration_unit_row_search_finish(picture_control_set_ptr->parent_pcs_ptr->av1_cm);
+    if (fused_loop_filter_cdef_apply(sequence_control_set_ptr, picture_control_set_ptr))
+        av1_cdef_row_state_free(&picture_control_set_ptr->fused_cdef_state);
+}
+
+/******************************************************
+ * Dlf Task Count
+ *
+ * The SB rows of a filtered picture are shared by
+ *   up to one task per DLF thread.
+ ******************************************************/
+uint16_t get_dlf_task_count(
+    PictureControlSet     *picture_control_set_ptr)
+{
+    SequenceControlSet *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    const uint32_t picture_height_in_sb = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) / sequence_control_set_ptr->sb_size_pix;
+
+    if (picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode < 2)
+        return 1;
+    return (uint16_t)MIN(sequence_control_set_ptr->dlf_process_init_count, picture_height_in_sb);
+}
+
 /******************************************************
  * Dlf Kernel
  ******************************************************/
@@ -110,8 +387,16 @@ void* dlf_kernel(void *input_ptr)
         EbBool is16bit       = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
 
         EbBool dlfEnableFlag = (EbBool) picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode;
+        const uint16_t dlf_task_count = get_dlf_task_count(picture_control_set_ptr);
+        const uint32_t picture_height_in_sb = (sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) / sequence_control_set_ptr->sb_size_pix;
+        const EbBool fused_loop_filter = fused_loop_filter_enabled(sequence_control_set_ptr, picture_control_set_ptr);
+        // The 8 bit CDEF search works on 16 bit copies of the recon and the source
+        const EbBool cdef_search_copy = (EbBool)(!is16bit && !fused_loop_filter && sequence_control_set_ptr->seq_header.enable_cdef && picture_control_set_ptr->parent_pcs_ptr->cdef_filter_mode);
+        EbBool cdef_search_copy_done = EB_FALSE;
+        EbBool last_task;
         if (dlfEnableFlag && picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode >= 2) {
             EbPictureBufferDesc  *recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
+            EbBool first_task;
 
             if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
                 //get the 16bit form of the input LCU
@@ -122,38 +407,127 @@ void* dlf_kernel(void *input_ptr)
             else  // non ref pictures
                 recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
 
-            av1_loop_filter_init(picture_control_set_ptr);
+            // The first task of the picture picks the filter levels, the
+            // others wait for them and then all share the SB rows
+            eb_block_on_mutex(picture_control_set_ptr->dlf_mutex);
+            first_task = (EbBool)(++picture_control_set_ptr->dlf_task_arrived_count == 1);
+            eb_release_mutex(picture_control_set_ptr->dlf_mutex);
+
+            if (first_task) {
+                uint16_t task_index;
+
+                av1_loop_filter_init(picture_control_set_ptr);
+
+                if (picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode == 2) {
+                    av1_pick_filter_level(
+                        context_ptr,
+                        (EbPictureBufferDesc*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
+                        picture_control_set_ptr,
+                        LPF_PICK_FROM_Q);
+                }
 
-            if (picture_control_set_ptr->parent_pcs_ptr->loop_filter_mode == 2) {
                 av1_pick_filter_level(
                     context_ptr,
                     (EbPictureBufferDesc*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
                     picture_control_set_ptr,
-                    LPF_PICK_FROM_Q);
-            }
-
-            av1_pick_filter_level(
-                context_ptr,
-                (EbPictureBufferDesc*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr,
-                picture_control_set_ptr,
-                LPF_PICK_FROM_FULL_IMAGE);
+                    LPF_PICK_FROM_FULL_IMAGE);
 
 #if NO_ENCDEC
-            //NO DLF
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_u = 0;
-            picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_v = 0;
+                //NO DLF
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[0] = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level[1] = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_u = 0;
+                picture_control_set_ptr->parent_pcs_ptr->lf.filter_level_v = 0;
 #endif
-                av1_loop_filter_frame(
+                av1_loop_filter_frame_init(picture_control_set_ptr, 0, 3);
+                if (fused_loop_filter)
+                    fused_loop_filter_init(sequence_control_set_ptr, picture_control_set_ptr, recon_buffer);
+                picture_control_set_ptr->dlf_next_sb_row = 0;
+                memset(picture_control_set_ptr->dlf_sb_row_progress, 0, sizeof(uint32_t) * picture_height_in_sb);
+
+                for (task_index = 1; task_index < dlf_task_count; ++task_index)
+                    eb_post_semaphore(picture_control_set_ptr->dlf_ready_semaphore);
+            }
+            else
+                eb_block_on_semaphore(picture_control_set_ptr->dlf_ready_semaphore);
+
+            // SB rows are taken in order. Once a row is deblocked, the row above
+            // it is final and is copied for the CDEF search while still cached.
+            uint32_t y_lcu_index;
+            while ((y_lcu_index = eb_atomic_fetch_add_u32(&picture_control_set_ptr->dlf_next_sb_row, 1)) < picture_height_in_sb) {
+                av1_loop_filter_sb_row(
                     recon_buffer,
                     picture_control_set_ptr,
                     0,
-                    3);
+                    3,
+                    y_lcu_index,
+                    picture_control_set_ptr->dlf_sb_row_progress,
+                    picture_control_set_ptr->dlf_sb_row_cond_var);
+
+                if (fused_loop_filter)
+                    fused_loop_filter_fb_rows(
+                        context_ptr,
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr,
+                        y_lcu_index ? fused_loop_filter_fb_row_end(sequence_control_set_ptr, picture_control_set_ptr, y_lcu_index - 1, picture_height_in_sb) : 0,
+                        fused_loop_filter_fb_row_end(sequence_control_set_ptr, picture_control_set_ptr, y_lcu_index, picture_height_in_sb));
+                else if (cdef_search_copy) {
+                    if (y_lcu_index)
+                        cdef_search_copy_sb_rows(
+                            sequence_control_set_ptr,
+                            picture_control_set_ptr,
+                            recon_buffer,
+                            y_lcu_index - 1,
+                            y_lcu_index);
+                    if (y_lcu_index == picture_height_in_sb - 1)
+                        cdef_search_copy_sb_rows(
+                            sequence_control_set_ptr,
+                            picture_control_set_ptr,
+                            recon_buffer,
+                            y_lcu_index,
+                            picture_height_in_sb);
+                }
             }
+            cdef_search_copy_done = cdef_search_copy;
+        }
+        else if (fused_loop_filter) {
+            // A single task, the SB rows are already deblocked
+            EbPictureBufferDesc  *recon_buffer = is16bit ? picture_control_set_ptr->recon_picture16bit_ptr : picture_control_set_ptr->recon_picture_ptr;
+
+            if (picture_control_set_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
+                recon_buffer = is16bit ?
+                    ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->reference_picture16bit :
+                    ((EbReferenceObject*)picture_control_set_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->reference_picture;
+
+            fused_loop_filter_init(sequence_control_set_ptr, picture_control_set_ptr, recon_buffer);
+            fused_loop_filter_fb_rows(
+                context_ptr,
+                sequence_control_set_ptr,
+                picture_control_set_ptr,
+                0,
+                fused_loop_filter_fb_row_end(sequence_control_set_ptr, picture_control_set_ptr, picture_height_in_sb - 1, picture_height_in_sb));
+        }
 
+        // The last task of the picture to complete sends it to CDEF
+        eb_block_on_mutex(picture_control_set_ptr->dlf_mutex);
+        last_task = (EbBool)(++picture_control_set_ptr->dlf_task_done_count == dlf_task_count);
+        if (last_task) {
+            picture_control_set_ptr->dlf_task_arrived_count = 0;
+            picture_control_set_ptr->dlf_task_done_count = 0;
+        }
+        eb_release_mutex(picture_control_set_ptr->dlf_mutex);
+
+        if (last_task == EB_FALSE) {
+            // Release EncDec Results
+            eb_release_object(enc_dec_results_wrapper_ptr);
+            continue;
+        }
+
+        picture_control_set_ptr->fused_loop_filter = fused_loop_filter;
+        if (fused_loop_filter)
+            fused_loop_filter_finish(sequence_control_set_ptr, picture_control_set_ptr);
         //pre-cdef prep
-        {
+        else {
             Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
             EbPictureBufferDesc  * recon_picture_ptr;
             if (is16bit) {
@@ -188,40 +562,20 @@ void* dlf_kernel(void *input_ptr)
                     picture_control_set_ptr->ref_coeff[1] = (uint16_t*)input_picture_ptr->buffer_cb + (input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb);
                     picture_control_set_ptr->ref_coeff[2] = (uint16_t*)input_picture_ptr->buffer_cr + (input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr);
                 }
-                else
-                {
-                    //these copies should go!
-                    EbByte  rec_ptr = &((recon_picture_ptr->buffer_y)[recon_picture_ptr->origin_x + recon_picture_ptr->origin_y * recon_picture_ptr->stride_y]);
-                    EbByte  rec_ptr_cb = &((recon_picture_ptr->buffer_cb)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->stride_cb]);
-                    EbByte  rec_ptr_cr = &((recon_picture_ptr->buffer_cr)[recon_picture_ptr->origin_x / 2 + recon_picture_ptr->origin_y / 2 * recon_picture_ptr->stride_cr]);
-
-                    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)picture_control_set_ptr->parent_pcs_ptr->enhanced_picture_ptr;
-                    EbByte  enh_ptr = &((input_picture_ptr->buffer_y)[input_picture_ptr->origin_x + input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-                    EbByte  enh_ptr_cb = &((input_picture_ptr->buffer_cb)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-                    EbByte  enh_ptr_cr = &((input_picture_ptr->buffer_cr)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-
-                    for (int r = 0; r < sequence_control_set_ptr->seq_header.max_frame_height; ++r) {
-                        for (int c = 0; c < sequence_control_set_ptr->seq_header.max_frame_width; ++c) {
-                        picture_control_set_ptr->src[0]      [r * sequence_control_set_ptr->seq_header.max_frame_width + c] = rec_ptr[r * recon_picture_ptr->stride_y + c];
-                        picture_control_set_ptr->ref_coeff[0][r * sequence_control_set_ptr->seq_header.max_frame_width + c] = enh_ptr[r * input_picture_ptr->stride_y + c];
-                        }
-                    }
-
-                for (int r = 0; r < sequence_control_set_ptr->seq_header.max_frame_height/2; ++r) {
-                    for (int c = 0; c < sequence_control_set_ptr->seq_header.max_frame_width /2; ++c) {
-                        picture_control_set_ptr->src[1][r * sequence_control_set_ptr->seq_header.max_frame_width /2 + c] = rec_ptr_cb[r * recon_picture_ptr->stride_cb + c];
-                        picture_control_set_ptr->ref_coeff[1][r * sequence_control_set_ptr->seq_header.max_frame_width /2 + c] = enh_ptr_cb[r * input_picture_ptr->stride_cb + c];
-                            picture_control_set_ptr->src[2][r * sequence_control_set_ptr->seq_header.max_frame_width / 2 + c] = rec_ptr_cr[r * recon_picture_ptr->stride_cr + c];
-                            picture_control_set_ptr->ref_coeff[2][r * sequence_control_set_ptr->seq_header.max_frame_width / 2 + c] = enh_ptr_cr[r * input_picture_ptr->stride_cr + c];
-                        }
-                    }
-                }
+                else if (cdef_search_copy_done == EB_FALSE)
+                    cdef_search_copy_sb_rows(
+                        sequence_control_set_ptr,
+                        picture_control_set_ptr,
+                        recon_picture_ptr,
+                        0,
+                        picture_height_in_sb);
             }
         }
 
         picture_control_set_ptr->cdef_segments_column_count =  sequence_control_set_ptr->cdef_segment_column_count;
         picture_control_set_ptr->cdef_segments_row_count    = sequence_control_set_ptr->cdef_segment_row_count;
-        picture_control_set_ptr->cdef_segments_total_count  = (uint16_t)(picture_control_set_ptr->cdef_segments_column_count  * picture_control_set_ptr->cdef_segments_row_count);
+        // The fused loop filter leaves nothing to search
+        picture_control_set_ptr->cdef_segments_total_count  = fused_loop_filter ? 1 : (uint16_t)(picture_control_set_ptr->cdef_segments_column_count  * picture_control_set_ptr->cdef_segments_row_count);
         picture_control_set_ptr->tot_seg_searched_cdef      = 0;
         uint32_t segment_index;
 
@@ -24,6 +24,9 @@ typedef struct DlfContext
     EbFifo              *dlf_output_fifo_ptr;
     EbPictureBufferDesc *temp_lf_recon_picture_ptr;
     EbPictureBufferDesc *temp_lf_recon_picture16bit_ptr;
+    // Loop restoration search of the fused loop filter
+    EbPictureBufferDesc *trial_frame_rst;
+    int32_t             *rst_tmpbuf;
 } DlfContext;
 
 /**************************************
@@ -36,9 +39,13 @@ extern EbErrorType dlf_context_ctor(
     EbBool                  is16bit,
     EbColorFormat           color_format,
     uint32_t                max_input_luma_width,
-    uint32_t                max_input_luma_height
+    uint32_t                max_input_luma_height,
+    EbBool                  fused_loop_filter
    );
 
+extern uint16_t get_dlf_task_count(
+    PictureControlSet     *picture_control_set_ptr);
+
 extern void* dlf_kernel(void *input_ptr);
 
 #endif // EbEntropyCodingProcess_h
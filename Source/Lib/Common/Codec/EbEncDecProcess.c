@@ -18,11 +18,13 @@
 
 #include "EbEncDecTasks.h"
 #include "EbEncDecResults.h"
+#include "EbDlfProcess.h"
 #include "EbDefinitions.h"
 #include "EbCodingLoop.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbUtility.h"
 #include "grainSynthesis.h"
+#include "EbSegmentation.h"
 
 void av1_cdef_search(
     EncDecContext                *context_ptr,
@@ -87,8 +89,6 @@ EbErrorType enc_dec_context_ctor(
     EbColorFormat           color_format,
     uint32_t                max_input_luma_width,
     uint32_t                max_input_luma_height){
-    (void)max_input_luma_width;
-    (void)max_input_luma_height;
     EbErrorType return_error = EB_ErrorNone;
     EncDecContext *context_ptr;
     EB_MALLOC(EncDecContext*, context_ptr, sizeof(EncDecContext), EB_N_PTR);
@@ -96,6 +96,9 @@ EbErrorType enc_dec_context_ctor(
 
     context_ptr->is16bit = is16bit;
     context_ptr->color_format = color_format;
+    EB_MALLOC(uint8_t*, context_ptr->intra_coded_area_sb, sizeof(uint8_t) *
+        ((max_input_luma_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64) *
+        ((max_input_luma_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64), EB_N_PTR);
 
     // Input/Output System Resource Manager FIFOs
     context_ptr->mode_decision_input_fifo_ptr = mode_decision_configuration_input_fifo_ptr;
@@ -293,7 +296,7 @@ static void EncDecConfigureLcu(
     uint8_t                    sb_qp)
 {
     //RC is off
-    if (sequence_control_set_ptr->static_config.rate_control_mode == 0 && sequence_control_set_ptr->static_config.improve_sharpness == 0)
+    if (rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->static_config.improve_sharpness == 0)
         context_ptr->qp = picture_qp;
     //RC is on
     else
@@ -301,8 +304,11 @@ static void EncDecConfigureLcu(
     // Asuming cb and cr offset to be the same for chroma QP in both slice and pps for lambda computation
     context_ptr->chroma_qp = context_ptr->qp;
     /* Note(CHKN) : when Qp modulation varies QP on a sub-LCU(CU) basis,  Lamda has to change based on Cu->QP , and then this code has to move inside the CU loop in MD */
-    (void)sb_ptr;
     context_ptr->qp_index = (uint8_t)picture_control_set_ptr->parent_pcs_ptr->base_qindex;
+    // The blocks of the SB are coded at the QP of the segment of the SB
+    if (picture_control_set_ptr->parent_pcs_ptr->segmentation_params.segmentation_enabled &&
+        sequence_control_set_ptr->static_config.enable_adaptive_quantization == 2)
+        context_ptr->qp_index += picture_control_set_ptr->parent_pcs_ptr->segmentation_params.feature_data[get_sb_segment_id(picture_control_set_ptr->parent_pcs_ptr, sb_ptr->index)][SEG_LVL_ALT_Q];
     (*av1_lambda_assignment_function_table[picture_control_set_ptr->parent_pcs_ptr->pred_structure])(
         &context_ptr->fast_lambda,
         &context_ptr->full_lambda,
@@ -1030,36 +1036,30 @@ void PadRefAndSetFlags(
             refPic16BitPtr->origin_x,
             refPic16BitPtr->origin_y >> 1);
 
-        // Hsan: unpack ref samples (to be used @ MD)
-        un_pack2d(
+        // 8 msb of the ref samples (to be used @ MD)
+        extract_8bit_data(
             (uint16_t*) refPic16BitPtr->buffer_y,
             refPic16BitPtr->stride_y,
             refPicPtr->buffer_y,
             refPicPtr->stride_y,
-            refPicPtr->buffer_bit_inc_y,
-            refPicPtr->stride_bit_inc_y,
             refPic16BitPtr->width  + (refPicPtr->origin_x << 1),
             refPic16BitPtr->height + (refPicPtr->origin_y << 1),
             sequence_control_set_ptr->static_config.asm_type);
 
-        un_pack2d(
+        extract_8bit_data(
             (uint16_t*)refPic16BitPtr->buffer_cb,
             refPic16BitPtr->stride_cb,
             refPicPtr->buffer_cb,
             refPicPtr->stride_cb,
-            refPicPtr->buffer_bit_inc_cb,
-            refPicPtr->stride_bit_inc_cb,
             (refPic16BitPtr->width + (refPicPtr->origin_x << 1)) >> 1,
             (refPic16BitPtr->height + (refPicPtr->origin_y << 1)) >> 1,
             sequence_control_set_ptr->static_config.asm_type);
 
-        un_pack2d(
+        extract_8bit_data(
             (uint16_t*)refPic16BitPtr->buffer_cr,
             refPic16BitPtr->stride_cr,
             refPicPtr->buffer_cr,
             refPicPtr->stride_cr,
-            refPicPtr->buffer_bit_inc_cr,
-            refPicPtr->stride_bit_inc_cr,
             (refPic16BitPtr->width + (refPicPtr->origin_x << 1)) >> 1,
             (refPic16BitPtr->height + (refPicPtr->origin_y << 1)) >> 1,
             sequence_control_set_ptr->static_config.asm_type);
@@ -1640,17 +1640,21 @@ void* enc_dec_kernel(void *input_ptr)
 
         if (lastLcuFlag)
         {
-            // Get Empty EncDec Results
-            eb_get_empty_object(
-                context_ptr->enc_dec_output_fifo_ptr,
-                &encDecResultsWrapperPtr);
-            encDecResultsPtr = (EncDecResults*)encDecResultsWrapperPtr->object_ptr;
-            encDecResultsPtr->picture_control_set_wrapper_ptr = encDecTasksPtr->picture_control_set_wrapper_ptr;
-            //CHKN these are not needed for DLF
-            encDecResultsPtr->completed_lcu_row_index_start = 0;
-            encDecResultsPtr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
-            // Post EncDec Results
-            eb_post_full_object(encDecResultsWrapperPtr);
+            // One result per DLF task, the DLF threads share the SB rows of the picture
+            const uint16_t dlf_task_count = get_dlf_task_count(picture_control_set_ptr);
+            for (uint16_t dlf_task_index = 0; dlf_task_index < dlf_task_count; ++dlf_task_index) {
+                // Get Empty EncDec Results
+                eb_get_empty_object(
+                    context_ptr->enc_dec_output_fifo_ptr,
+                    &encDecResultsWrapperPtr);
+                encDecResultsPtr = (EncDecResults*)encDecResultsWrapperPtr->object_ptr;
+                encDecResultsPtr->picture_control_set_wrapper_ptr = encDecTasksPtr->picture_control_set_wrapper_ptr;
+                //CHKN these are not needed for DLF
+                encDecResultsPtr->completed_lcu_row_index_start = 0;
+                encDecResultsPtr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+                // Post EncDec Results
+                eb_post_full_object(encDecResultsWrapperPtr);
+            }
         }
         // Release Mode Decision Results
         eb_release_object(encDecTasksWrapperPtr);
@@ -19,6 +19,7 @@ extern "C" {
         EbObjectWrapper *picture_control_set_wrapper_ptr;
         uint32_t         completed_lcu_row_index_start;
         uint32_t         completed_lcu_row_count;
+        uint16_t         tile_index;
     } EncDecResults;
 
     typedef struct DlfResults
@@ -38,6 +39,7 @@ extern "C" {
         EbObjectWrapper *picture_control_set_wrapper_ptr;
         uint32_t         completed_lcu_row_index_start;
         uint32_t         completed_lcu_row_count;
+        uint16_t         tile_index;
     } RestResults;
 
     typedef struct EncDecResultsInitData {
@@ -43,6 +43,14 @@ EbErrorType encode_context_ctor(
     encode_context_ptr->reference_picture_pool_fifo_ptr = (EbFifo*)EB_NULL;
     encode_context_ptr->pa_reference_picture_pool_fifo_ptr = (EbFifo*)EB_NULL;
     encode_context_ptr->overlay_input_picture_pool_fifo_ptr = (EbFifo*)EB_NULL;
+    encode_context_ptr->zero_copy_input = EB_FALSE;
+    encode_context_ptr->packet_alloc_cb = NULL;
+    encode_context_ptr->packet_buf_priv_ptr = EB_NULL;
+    encode_context_ptr->first_pass_stats = (uint8_t*)EB_NULL;
+    encode_context_ptr->first_pass_stats_size = 0;
+    encode_context_ptr->ladder_analysis = (LadderAnalysis*)EB_NULL;
+    encode_context_ptr->ladder_lead = EB_FALSE;
+    encode_context_ptr->me_hints = (struct MeHints*)EB_NULL;
     // Picture Decision Reordering Queue
     encode_context_ptr->picture_decision_reorder_queue_head_index = 0;
     EB_MALLOC(PictureDecisionReorderEntry**, encode_context_ptr->picture_decision_reorder_queue, sizeof(PictureDecisionReorderEntry*) * PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH, EB_N_PTR);
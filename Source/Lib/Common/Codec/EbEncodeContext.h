@@ -21,6 +21,7 @@
 #include "EbMdRateEstimation.h"
 #include "EbPredictionStructure.h"
 #include "EbRateControlTables.h"
+#include "EbLadderAnalysis.h"
 
 // *Note - the queues are small for testing purposes.  They should be increased when they are done.
 #define PRE_ASSIGNMENT_MAX_DEPTH                            128     // should be large enough to hold an entire prediction period
@@ -51,6 +52,19 @@ typedef struct EncodeContext
 
     // Overlay input picture fifo
     EbFifo                                          *overlay_input_picture_pool_fifo_ptr;
+    // Input pictures reference the application planes
+    EbBool                                           zero_copy_input;
+    // Output packet allocator of the application, NULL to use the pool buffers
+    eb_allocate_frame_buffer                         packet_alloc_cb;
+    EbPtr                                            packet_buf_priv_ptr;
+    // Statistics written by the first pass, or read by the second pass
+    uint8_t                                         *first_pass_stats;
+    uint32_t                                         first_pass_stats_size;
+    // HME search centers of the lead of a ladder, written by the lead and read by its renditions
+    LadderAnalysis                                  *ladder_analysis;
+    EbBool                                           ladder_lead;
+    // Motion estimation hints written for or read from another encode, NULL when not used
+    struct MeHints                                  *me_hints;
     // Output Buffer Fifos
     EbFifo                                        *stream_output_fifo_ptr;
     EbFifo                                        *recon_output_fifo_ptr;
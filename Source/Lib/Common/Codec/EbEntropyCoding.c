@@ -4332,19 +4332,13 @@ static void WriteUncompressedHeaderObu(SequenceControlSet *scs_ptr/*Av1Comp *cpi
         if (pcs_ptr->delta_q_present_flag) {
 #if ADD_DELTA_QP_SUPPORT //PART 0
             aom_wb_write_literal(wb, OD_ILOG_NZ(pcs_ptr->delta_q_res) - 1, 2);
-            pcs_ptr->prev_qindex = pcs_ptr->base_qindex;
             if (pcs_ptr->allow_intrabc)
                 assert(pcs_ptr->delta_lf_present_flag == 0);
             else
                 aom_wb_write_bit(wb, pcs_ptr->delta_lf_present_flag);
             if (pcs_ptr->delta_lf_present_flag) {
                 aom_wb_write_literal(wb, OD_ILOG_NZ(pcs_ptr->delta_lf_res) - 1, 2);
-                pcs_ptr->prev_delta_lf_from_base = 0;
                 aom_wb_write_bit(wb, pcs_ptr->delta_lf_multi);
-                const int32_t frame_lf_count =
-                    pcs_ptr->monochrome == 0 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-                for (int32_t lf_id = 0; lf_id < frame_lf_count; ++lf_id)
-                    pcs_ptr->prev_delta_lf[lf_id] = 0;
             }
 #else
             printf("ERROR[AN]: delta_q_present_flag not supported yet\n");
@@ -4732,6 +4726,7 @@ static void Av1writeDeltaQindex(
 static void write_cdef(
     SequenceControlSet     *seqCSetPtr,
     PictureControlSet     *p_pcs_ptr,
+    uint16_t               tile_idx,
     //Av1Common *cm,
     MacroBlockD *const xd,
     AomWriter *w,
@@ -4753,12 +4748,12 @@ static void write_cdef(
     const ModeInfo *mi =
         p_pcs_ptr->mi_grid_base[(mi_row & m) * cm->mi_stride + (mi_col & m)];
     //cm->mi_grid_visible[(mi_row & m) * cm->mi_stride + (mi_col & m)];
+    int32_t *cdef_preset = p_pcs_ptr->entropy_coding_info[tile_idx]->cdef_preset;
 
 // Initialise when at top left part of the superblock
     if (!(mi_row & (seqCSetPtr->seq_header.sb_mi_size - 1)) &&
         !(mi_col & (seqCSetPtr->seq_header.sb_mi_size - 1))) {  // Top left?
-        p_pcs_ptr->cdef_preset[0] = p_pcs_ptr->cdef_preset[1] = p_pcs_ptr->cdef_preset[2] =
-            p_pcs_ptr->cdef_preset[3] = -1;
+        cdef_preset[0] = cdef_preset[1] = cdef_preset[2] = cdef_preset[3] = -1;
     }
 
     // Emit CDEF param at first non-skip coding block
@@ -4767,16 +4762,16 @@ static void write_cdef(
         ? !!(mi_col & mask) + 2 * !!(mi_row & mask)
         : 0;
 
-    if (p_pcs_ptr->cdef_preset[index] == -1 && !skip) {
+    if (cdef_preset[index] == -1 && !skip) {
         aom_write_literal(w, mi->mbmi.cdef_strength, p_pcs_ptr->parent_pcs_ptr->cdef_bits);
-        p_pcs_ptr->cdef_preset[index] = mi->mbmi.cdef_strength;
+        cdef_preset[index] = mi->mbmi.cdef_strength;
     }
 }
 
-void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr) {
+void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr, uint16_t tile_idx) {
     for (int32_t p = 0; p < 3; ++p) {
-        set_default_wiener(piCSetPtr->wiener_info + p);
-        set_default_sgrproj(piCSetPtr->sgrproj_info + p);
+        set_default_wiener(piCSetPtr->entropy_coding_info[tile_idx]->wiener_info + p);
+        set_default_sgrproj(piCSetPtr->entropy_coding_info[tile_idx]->sgrproj_info + p);
     }
 }
 static void write_wiener_filter(int32_t wiener_win, const WienerInfo *wiener_info,
@@ -4854,7 +4849,7 @@ static void write_sgrproj_filter(const SgrprojInfo *sgrproj_info,
 
     memcpy(ref_sgrproj_info, sgrproj_info, sizeof(*sgrproj_info));
 }
-static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
+static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, uint16_t tile_idx, FRAME_CONTEXT           *frameContext, const Av1Common *const cm,
     //MacroBlockD *xd,
     const RestorationUnitInfo *rui,
     AomWriter *const w, int32_t plane/*,
@@ -4868,8 +4863,8 @@ static void loop_restoration_write_sb_coeffs(PictureControlSet     *piCSetPtr, F
 //    assert(!cm->all_lossless);
 
     const int32_t wiener_win = (plane > 0) ? WIENER_WIN_CHROMA : WIENER_WIN;
-    WienerInfo *wiener_info = piCSetPtr->wiener_info + plane;
-    SgrprojInfo *sgrproj_info = piCSetPtr->sgrproj_info + plane;
+    WienerInfo *wiener_info = piCSetPtr->entropy_coding_info[tile_idx]->wiener_info + plane;
+    SgrprojInfo *sgrproj_info = piCSetPtr->entropy_coding_info[tile_idx]->sgrproj_info + plane;
     RestorationType unit_rtype = rui->restoration_type;
 
     assert(unit_rtype < CDF_SIZE(RESTORE_SWITCHABLE_TYPES));
@@ -4932,16 +4927,16 @@ EbErrorType ec_update_neighbors(
 {
     UNUSED(coeff_ptr);
     EbErrorType return_error = EB_ErrorNone;
-    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
-    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *inter_pred_dir_neighbor_array = picture_control_set_ptr->inter_pred_dir_neighbor_array;
-    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
+    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->mode_type_neighbor_array;
+    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->partition_context_neighbor_array;
+    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->skip_flag_neighbor_array;
+    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->skip_coeff_neighbor_array;
+    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->luma_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->cr_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->cb_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *inter_pred_dir_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->inter_pred_dir_neighbor_array;
+    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->ref_frame_type_neighbor_array;
+    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->interpolation_type_neighbor_array;
     const BlockGeom         *blk_geom = get_blk_geom_mds(cu_ptr->mds_idx);
     EbBool                   skipCoeff = EB_FALSE;
     PartitionContext         partition;
@@ -5811,16 +5806,16 @@ EbErrorType write_modes_b(
     AomWriter              *ec_writer = &entropy_coder_ptr->ec_writer;
     SequenceControlSet     *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
 
-    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->mode_type_neighbor_array;
-    NeighborArrayUnit     *intra_luma_mode_neighbor_array = picture_control_set_ptr->intra_luma_mode_neighbor_array;
-    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->skip_flag_neighbor_array;
-    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->skip_coeff_neighbor_array;
-    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array;
-    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->ref_frame_type_neighbor_array;
-    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->interpolation_type_neighbor_array;
-    NeighborArrayUnit     *txfm_context_array = picture_control_set_ptr->txfm_context_array;
+    NeighborArrayUnit     *mode_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->mode_type_neighbor_array;
+    NeighborArrayUnit     *intra_luma_mode_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->intra_luma_mode_neighbor_array;
+    NeighborArrayUnit     *skip_flag_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->skip_flag_neighbor_array;
+    NeighborArrayUnit     *skip_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->skip_coeff_neighbor_array;
+    NeighborArrayUnit     *luma_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->luma_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cr_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->cr_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *cb_dc_sign_level_coeff_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->cb_dc_sign_level_coeff_neighbor_array;
+    NeighborArrayUnit     *ref_frame_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->ref_frame_type_neighbor_array;
+    NeighborArrayUnit32   *interpolation_type_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->interpolation_type_neighbor_array;
+    NeighborArrayUnit     *txfm_context_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->txfm_context_array;
     const BlockGeom          *blk_geom = get_blk_geom_mds(cu_ptr->mds_idx);
     uint32_t blkOriginX = context_ptr->sb_origin_x + blk_geom->origin_x;
     uint32_t blkOriginY = context_ptr->sb_origin_y + blk_geom->origin_y;
@@ -5870,6 +5865,7 @@ assert(bsize < BlockSizeS_ALL);
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr,
+            context_ptr->tile_idx,
             cu_ptr->av1xd,
             ec_writer,
             skipCoeff,
@@ -5888,7 +5884,7 @@ assert(bsize < BlockSizeS_ALL);
                 bsize = BLOCK_4X4;
             if ((bsize != sequence_control_set_ptr->sb_size || skipCoeff == 0) && super_block_upper_left) {
                 assert(current_q_index > 0);
-                int32_t reduced_delta_qindex = (current_q_index - picture_control_set_ptr->parent_pcs_ptr->prev_qindex) / picture_control_set_ptr->parent_pcs_ptr->delta_q_res;
+                int32_t reduced_delta_qindex = (current_q_index - picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->prev_qindex) / picture_control_set_ptr->parent_pcs_ptr->delta_q_res;
 
                 //write_delta_qindex(xd, reduced_delta_qindex, w);
                 Av1writeDeltaQindex(
@@ -5900,9 +5896,9 @@ assert(bsize < BlockSizeS_ALL);
                 blkOriginX,
                 blkOriginY,
                 current_q_index,
-                picture_control_set_ptr->parent_pcs_ptr->prev_qindex);
+                picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->prev_qindex);
                 }*/
-                picture_control_set_ptr->parent_pcs_ptr->prev_qindex = current_q_index;
+                picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->prev_qindex = current_q_index;
             }
         }
 #endif
@@ -6017,6 +6013,7 @@ assert(bsize < BlockSizeS_ALL);
         write_cdef(
             sequence_control_set_ptr,
             picture_control_set_ptr, /*cm,*/
+            context_ptr->tile_idx,
             cu_ptr->av1xd,
             ec_writer,
             cu_ptr->skip_flag ? 1 : skipCoeff,
@@ -6035,7 +6032,7 @@ assert(bsize < BlockSizeS_ALL);
             if ((bsize != sequence_control_set_ptr->sb_size || skipCoeff == 0) && super_block_upper_left) {
                 assert(current_q_index > 0);
 
-                int32_t reduced_delta_qindex = (current_q_index - picture_control_set_ptr->parent_pcs_ptr->prev_qindex) / picture_control_set_ptr->parent_pcs_ptr->delta_q_res;
+                int32_t reduced_delta_qindex = (current_q_index - picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->prev_qindex) / picture_control_set_ptr->parent_pcs_ptr->delta_q_res;
 
                 //write_delta_qindex(xd, reduced_delta_qindex, w);
 
@@ -6044,7 +6041,7 @@ assert(bsize < BlockSizeS_ALL);
                     reduced_delta_qindex,
                     ec_writer);
 
-                picture_control_set_ptr->parent_pcs_ptr->prev_qindex = current_q_index;
+                picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->prev_qindex = current_q_index;
             }
         }
 
@@ -6295,7 +6292,7 @@ EB_EXTERN EbErrorType write_sb(
     FRAME_CONTEXT           *frameContext = entropy_coder_ptr->fc;
     AomWriter              *ec_writer = &entropy_coder_ptr->ec_writer;
     SequenceControlSet     *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->partition_context_neighbor_array;
+    NeighborArrayUnit     *partition_context_neighbor_array = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->partition_context_neighbor_array;
 
     // CU Varaiables
     const BlockGeom          *blk_geom;
@@ -6362,7 +6359,7 @@ EB_EXTERN EbErrorType write_sb(
                                 const int32_t runit_idx = tile_tl_idx + rcol + rrow * rstride;
                                 const RestorationUnitInfo *rui =
                                     &cm->rst_info[plane].unit_info[runit_idx];
-                                loop_restoration_write_sb_coeffs(picture_control_set_ptr, frameContext, cm, /*xd,*/ rui, ec_writer, plane);
+                                loop_restoration_write_sb_coeffs(picture_control_set_ptr, context_ptr->tile_idx, frameContext, cm, /*xd,*/ rui, ec_writer, plane);
                             }
                         }
                     }
@@ -22,7 +22,7 @@
 #include "EbRateControlTasks.h"
 
 #define  AV1_MIN_TILE_SIZE_BYTES 1
-void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr);
+void av1_reset_loop_restoration(PictureControlSet     *piCSetPtr, uint16_t tile_idx);
 void av1_tile_set_col(TileInfo *tile, PictureParentControlSet * pcs_ptr, int col);
 void av1_tile_set_row(TileInfo *tile, PictureParentControlSet * pcs_ptr, int row);
 
@@ -53,25 +53,29 @@ EbErrorType entropy_coding_context_ctor(
 /***********************************************
  * Entropy Coding Reset Neighbor Arrays
  ***********************************************/
-static void EntropyCodingResetNeighborArrays(PictureControlSet *picture_control_set_ptr)
+static void EntropyCodingResetNeighborArrays(PictureControlSet *picture_control_set_ptr, uint16_t tile_idx)
 {
-    neighbor_array_unit_reset(picture_control_set_ptr->mode_type_neighbor_array);
+    EntropyTileInfo *tile_info_ptr = picture_control_set_ptr->entropy_coding_info[tile_idx];
 
-    neighbor_array_unit_reset(picture_control_set_ptr->partition_context_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->mode_type_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->skip_flag_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->partition_context_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->skip_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->luma_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->cb_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->cr_dc_sign_level_coeff_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->inter_pred_dir_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->ref_frame_type_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->skip_flag_neighbor_array);
 
-    neighbor_array_unit_reset(picture_control_set_ptr->intra_luma_mode_neighbor_array);
-    neighbor_array_unit_reset32(picture_control_set_ptr->interpolation_type_neighbor_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->txfm_context_array);
-    neighbor_array_unit_reset(picture_control_set_ptr->segmentation_id_pred_array);
+    neighbor_array_unit_reset(tile_info_ptr->skip_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->luma_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->cb_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->cr_dc_sign_level_coeff_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->inter_pred_dir_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->ref_frame_type_neighbor_array);
+
+    neighbor_array_unit_reset(tile_info_ptr->intra_luma_mode_neighbor_array);
+    neighbor_array_unit_reset32(tile_info_ptr->interpolation_type_neighbor_array);
+    neighbor_array_unit_reset(tile_info_ptr->txfm_context_array);
+    // Picture level, only used when the tiles are coded one after the other
+    if (tile_idx == 0)
+        neighbor_array_unit_reset(picture_control_set_ptr->segmentation_id_pred_array);
     return;
 }
 
@@ -162,6 +166,32 @@ void av1_build_nmv_cost_table(int32_t *mvjoint, int32_t *mvcost[2],
     build_nmv_component_cost_table(mvcost[1], &ctx->comps[1], precision);
 }
 
+/**************************************************
+ * Reset the state coded relative to the previous
+ * SB, kept per tile as tiles are coded concurrently
+ **************************************************/
+static void reset_ec_tile_state(
+    PictureControlSet     *picture_control_set_ptr,
+    uint16_t               tile_idx)
+{
+    EntropyTileInfo *tile_info = picture_control_set_ptr->entropy_coding_info[tile_idx];
+
+    tile_info->cdef_preset[0] = tile_info->cdef_preset[1] = tile_info->cdef_preset[2] =
+        tile_info->cdef_preset[3] = -1;
+#if ADD_DELTA_QP_SUPPORT //PART 0
+    tile_info->prev_qindex = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
+    if (picture_control_set_ptr->parent_pcs_ptr->allow_intrabc)
+        assert(picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag == 0);
+    if (picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag) {
+        tile_info->prev_delta_lf_from_base = 0;
+        const int32_t frame_lf_count =
+            picture_control_set_ptr->parent_pcs_ptr->monochrome == 0 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
+        for (int32_t lf_id = 0; lf_id < frame_lf_count; ++lf_id)
+            tile_info->prev_delta_lf[lf_id] = 0;
+    }
+#endif
+}
+
 /**************************************************
  * Reset Entropy Coding Picture
  **************************************************/
@@ -195,22 +225,7 @@ static void ResetEntropyCodingPicture(
     picture_control_set_ptr->prev_coded_qp = picture_control_set_ptr->picture_qp;
     picture_control_set_ptr->prev_quant_group_coded_qp = picture_control_set_ptr->picture_qp;
 
-#if ADD_DELTA_QP_SUPPORT //PART 0
-    picture_control_set_ptr->parent_pcs_ptr->prev_qindex = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
-    if (picture_control_set_ptr->parent_pcs_ptr->allow_intrabc)
-        assert(picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag == 0);
-    /*else
-        aom_wb_write_bit(wb, pcs_ptr->delta_lf_present_flag);*/
-    if (picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag) {
-        //aom_wb_write_literal(wb, OD_ILOG_NZ(pcs_ptr->delta_lf_res) - 1, 2);
-        picture_control_set_ptr->parent_pcs_ptr->prev_delta_lf_from_base = 0;
-        //aom_wb_write_bit(wb, pcs_ptr->delta_lf_multi);
-        const int32_t frame_lf_count =
-            picture_control_set_ptr->parent_pcs_ptr->monochrome == 0 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-        for (int32_t lf_id = 0; lf_id < frame_lf_count; ++lf_id)
-            picture_control_set_ptr->parent_pcs_ptr->prev_delta_lf[lf_id] = 0;
-    }
-#endif
+    reset_ec_tile_state(picture_control_set_ptr, 0);
 
     // pass the ent
     OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
@@ -230,19 +245,19 @@ static void ResetEntropyCodingPicture(
         entropyCodingQp,
         picture_control_set_ptr->slice_type);
 
-    EntropyCodingResetNeighborArrays(picture_control_set_ptr);
+    EntropyCodingResetNeighborArrays(picture_control_set_ptr, 0);
 
     return;
 }
 
 static void reset_ec_tile(
-    uint32_t  total_size,
-    uint32_t  is_last_tile_in_tg,
+    uint8_t               *data,
     EntropyCodingContext  *context_ptr,
     PictureControlSet     *picture_control_set_ptr,
     SequenceControlSet    *sequence_control_set_ptr)
 {
-    reset_bitstream(entropy_coder_get_bitstream_ptr(picture_control_set_ptr->entropy_coder_ptr));
+    EntropyCoder *entropy_coder_ptr = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->entropy_coder_ptr;
+    reset_bitstream(entropy_coder_get_bitstream_ptr(entropy_coder_ptr));
 
     uint32_t                       entropy_coding_qp;
 
@@ -263,50 +278,24 @@ static void reset_ec_tile(
     else
         entropy_coding_qp = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
     // Reset CABAC Contexts
-    // Reset QP Assignement
-    picture_control_set_ptr->prev_coded_qp = picture_control_set_ptr->picture_qp;
-    picture_control_set_ptr->prev_quant_group_coded_qp = picture_control_set_ptr->picture_qp;
+    // The QP assignment of the picture is not reset here, the tiles may be
+    // coded concurrently and only reset their own state
+    reset_ec_tile_state(picture_control_set_ptr, context_ptr->tile_idx);
 
-#if ADD_DELTA_QP_SUPPORT //PART 0
-    picture_control_set_ptr->parent_pcs_ptr->prev_qindex = picture_control_set_ptr->parent_pcs_ptr->base_qindex;
-    if (picture_control_set_ptr->parent_pcs_ptr->allow_intrabc)
-        assert(picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag == 0);
-    /*else
-        aom_wb_write_bit(wb, pcs_ptr->delta_lf_present_flag);*/
-    if (picture_control_set_ptr->parent_pcs_ptr->delta_lf_present_flag) {
-        //aom_wb_write_literal(wb, OD_ILOG_NZ(pcs_ptr->delta_lf_res) - 1, 2);
-        picture_control_set_ptr->parent_pcs_ptr->prev_delta_lf_from_base = 0;
-        //aom_wb_write_bit(wb, pcs_ptr->delta_lf_multi);
-        const int32_t frame_lf_count =
-            picture_control_set_ptr->parent_pcs_ptr->monochrome == 0 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-        for (int32_t lf_id = 0; lf_id < frame_lf_count; ++lf_id)
-            picture_control_set_ptr->parent_pcs_ptr->prev_delta_lf[lf_id] = 0;
-    }
-#endif
+    entropy_coder_ptr->ec_writer.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
+    entropy_coder_ptr->ec_writer.allow_update_cdf =
+        entropy_coder_ptr->ec_writer.allow_update_cdf && !picture_control_set_ptr->parent_pcs_ptr->disable_cdf_update;
 
-    // pass the ent
-    OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
-    //****************************************************************//
-
-    uint8_t *data = output_bitstream_ptr->buffer_av1 + total_size;
-    picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf = !picture_control_set_ptr->parent_pcs_ptr->large_scale_tile;
-    picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf =
-        picture_control_set_ptr->entropy_coder_ptr->ec_writer.allow_update_cdf && !picture_control_set_ptr->parent_pcs_ptr->disable_cdf_update;
-
-    //if not last tile, advance buffer by 4B to leave space for tile Size
-    if (is_last_tile_in_tg == 0)
-        data += 4;
-
-    aom_start_encode(&picture_control_set_ptr->entropy_coder_ptr->ec_writer, data);
+    aom_start_encode(&entropy_coder_ptr->ec_writer, data);
 
     //reset probabilities
     reset_entropy_coder(
         sequence_control_set_ptr->encode_context_ptr,
-        picture_control_set_ptr->entropy_coder_ptr,
+        entropy_coder_ptr,
         entropy_coding_qp,
         picture_control_set_ptr->slice_type);
 
-    EntropyCodingResetNeighborArrays(picture_control_set_ptr);
+    EntropyCodingResetNeighborArrays(picture_control_set_ptr, context_ptr->tile_idx);
 
     return;
 }
@@ -419,6 +408,133 @@ static EbBool UpdateEntropyCodingRows(
     return processNextRow;
 }
 
+/******************************************************
+ * Entropy Coding Tile Task Count
+ *
+ * The tiles of a picture are entropy coded concurrently,
+ *   one task per tile, each in the coder of its tile info.
+ *   A single task codes all the tiles one after the other
+ *   when there are more tiles than tile infos, or when
+ *   segmentation is on, as its spatial prediction reads
+ *   across the tile boundaries.
+ ******************************************************/
+uint16_t get_entropy_coding_tile_task_count(
+    PictureControlSet     *picture_control_set_ptr)
+{
+    Av1Common *const cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    const uint16_t tile_count = (uint16_t)(cm->tile_cols * cm->tile_rows);
+
+    if (tile_count > picture_control_set_ptr->entropy_coding_tile_count ||
+        picture_control_set_ptr->parent_pcs_ptr->segmentation_params.segmentation_enabled)
+        return 1;
+    return tile_count;
+}
+
+/******************************************************
+ * Entropy Code Tile
+ *
+ * Codes the SBs of one tile in the coder of the
+ *   context tile info, starting at data. Returns the
+ *   tile size in bytes.
+ ******************************************************/
+static uint32_t entropy_code_tile(
+    EntropyCodingContext  *context_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    SequenceControlSet    *sequence_control_set_ptr,
+    int                    tile_row,
+    int                    tile_col,
+    uint8_t               *data,
+    uint64_t              *tile_bits)
+{
+    Av1Common *const cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+    EntropyCoder *entropy_coder_ptr = picture_control_set_ptr->entropy_coding_info[context_ptr->tile_idx]->entropy_coder_ptr;
+    const uint8_t lcuSizeLog2 = (uint8_t)Log2f(context_ptr->sb_sz);
+    const uint32_t picture_width_in_sb = (sequence_control_set_ptr->seq_header.max_frame_width + context_ptr->sb_sz - 1) >> lcuSizeLog2;
+    uint32_t x_lcu_index;
+    uint32_t y_lcu_index;
+
+    reset_ec_tile(
+        data,
+        context_ptr,
+        picture_control_set_ptr,
+        sequence_control_set_ptr);
+
+    av1_reset_loop_restoration(picture_control_set_ptr, context_ptr->tile_idx);
+
+    for (y_lcu_index = cm->tile_row_start_sb[tile_row]; y_lcu_index < (uint32_t)cm->tile_row_start_sb[tile_row + 1]; ++y_lcu_index)
+    {
+        for (x_lcu_index = cm->tile_col_start_sb[tile_col]; x_lcu_index < (uint32_t)cm->tile_col_start_sb[tile_col + 1]; ++x_lcu_index)
+        {
+            int sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
+            LargestCodingUnit *sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
+            context_ptr->sb_origin_x = x_lcu_index << lcuSizeLog2;
+            context_ptr->sb_origin_y = y_lcu_index << lcuSizeLog2;
+            // Configure the LCU
+            EntropyCodingConfigureLcu(
+                context_ptr,
+                sb_ptr,
+                picture_control_set_ptr);
+            sb_ptr->total_bits = 0;
+            uint32_t prev_pos = sb_index ? entropy_coder_ptr->ec_writer.ec.offs : 0;//residual_bc.pos
+            EbPictureBufferDesc *coeff_picture_ptr = sb_ptr->quantized_coeff;
+            write_sb(
+                context_ptr,
+                sb_ptr,
+                picture_control_set_ptr,
+                entropy_coder_ptr,
+                coeff_picture_ptr);
+            sb_ptr->total_bits = (entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
+            *tile_bits += sb_ptr->total_bits;
+        }
+    }
+
+    encode_slice_finish(entropy_coder_ptr);
+
+    assert(entropy_coder_ptr->ec_writer.pos >= AV1_MIN_TILE_SIZE_BYTES);
+    return entropy_coder_ptr->ec_writer.pos;
+}
+
+/******************************************************
+ * Entropy Coding Picture Done
+ *
+ * Releases the references of a picture whose tiles are
+ *   all coded and sends it to packetization.
+ ******************************************************/
+static void entropy_coding_picture_done(
+    EntropyCodingContext  *context_ptr,
+    PictureControlSet     *picture_control_set_ptr,
+    EbObjectWrapper       *picture_control_set_wrapper_ptr,
+    uint32_t               total_size)
+{
+    EbObjectWrapper      *entropyCodingResultsWrapperPtr;
+    EntropyCodingResults *entropyCodingResultsPtr;
+    uint32_t              ref_idx;
+
+    picture_control_set_ptr->entropy_coder_ptr->ec_frame_size = total_size;
+
+    // Release the List 0 Reference Pictures
+    for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
+        if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL)
+            eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
+    }
+
+    // Release the List 1 Reference Pictures
+    for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
+        if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
+            eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
+    }
+
+    // Get Empty Entropy Coding Results
+    eb_get_empty_object(
+        context_ptr->entropy_coding_output_fifo_ptr,
+        &entropyCodingResultsWrapperPtr);
+    entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
+    entropyCodingResultsPtr->picture_control_set_wrapper_ptr = picture_control_set_wrapper_ptr;
+
+    // Post EntropyCoding Results
+    eb_post_full_object(entropyCodingResultsWrapperPtr);
+}
+
 /******************************************************
  * Entropy Coding Kernel
  ******************************************************/
@@ -467,6 +583,7 @@ void* entropy_coding_kernel(void *input_ptr)
         if(picture_control_set_ptr->parent_pcs_ptr->av1_cm->tile_cols * picture_control_set_ptr->parent_pcs_ptr->av1_cm->tile_rows == 1)
 
         {
+            context_ptr->tile_idx = 0;
             initialProcessCall = EB_TRUE;
             y_lcu_index = encDecResultsPtr->completed_lcu_row_index_start;
 
@@ -493,7 +610,7 @@ void* entropy_coding_kernel(void *input_ptr)
                     context_ptr->sb_origin_x = sb_origin_x;
                     context_ptr->sb_origin_y = sb_origin_y;
                     if (sb_index == 0)
-                        av1_reset_loop_restoration(picture_control_set_ptr);
+                        av1_reset_loop_restoration(picture_control_set_ptr, 0);
                     // Configure the LCU
                     EntropyCodingConfigureLcu(
                         context_ptr,
@@ -574,115 +691,109 @@ void* entropy_coding_kernel(void *input_ptr)
                 eb_release_mutex(picture_control_set_ptr->entropy_coding_mutex);
             }
         }
+        else if (get_entropy_coding_tile_task_count(picture_control_set_ptr) == 1)
+        {
+            Av1Common *const cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+            OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
+            uint64_t tile_bits = 0;
+            uint32_t total_size = 0;
+            int tile_row, tile_col;
+
+            // All the tiles are coded one after the other in the picture coder
+            context_ptr->tile_idx = 0;
+
+            //Entropy Tile Loop
+            for (tile_row = 0; tile_row < cm->tile_rows; tile_row++)
+            {
+                for (tile_col = 0; tile_col < cm->tile_cols; tile_col++)
+                {
+                    const int tile_idx = tile_row * cm->tile_cols + tile_col;
+                    const uint32_t is_last_tile_in_tg = (tile_idx == (cm->tile_cols * cm->tile_rows - 1)) ? 1 : 0;
+                    uint8_t *buf_data = output_bitstream_ptr->buffer_av1 + total_size;
+
+                    //if not last tile, leave space for tile Size
+                    const uint32_t tile_size = entropy_code_tile(
+                        context_ptr,
+                        picture_control_set_ptr,
+                        sequence_control_set_ptr,
+                        tile_row,
+                        tile_col,
+                        is_last_tile_in_tg ? buf_data : buf_data + 4,
+                        &tile_bits);
+
+                    if (!is_last_tile_in_tg) {
+                        mem_put_le32(buf_data, tile_size - AV1_MIN_TILE_SIZE_BYTES);
+                        total_size += 4;
+                    }
+                    total_size += tile_size;
+                }
+            }
+            picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += tile_bits;
+
+            //the picture is complete, terminate the slice
+            entropy_coding_picture_done(
+                context_ptr,
+                picture_control_set_ptr,
+                encDecResultsPtr->picture_control_set_wrapper_ptr,
+                total_size);
+        }
         else
         {
-             struct PictureParentControlSet     *ppcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
-             Av1Common *const cm = ppcs_ptr->av1_cm;
-             uint32_t total_size = 0;
-             int tile_row, tile_col;
-             const int tile_cols = ppcs_ptr->av1_cm->tile_cols;
-             const int tile_rows = ppcs_ptr->av1_cm->tile_rows;
-
-             //Entropy Tile Loop
-             for (tile_row = 0; tile_row < tile_rows; tile_row++)
-             {
-                 TileInfo tile_info;
-                 av1_tile_set_row(&tile_info, ppcs_ptr, tile_row);
-
-                 for (tile_col = 0; tile_col < tile_cols; tile_col++)
-                 {
-                     const int tile_idx = tile_row * tile_cols + tile_col;
-                     uint32_t is_last_tile_in_tg = 0;
-
-                     if ( tile_idx == (tile_cols * tile_rows - 1))
-                         is_last_tile_in_tg = 1;
-                     else
-                         is_last_tile_in_tg = 0;
-                     reset_ec_tile(
-                         total_size,
-                         is_last_tile_in_tg,
-                         context_ptr,
-                         picture_control_set_ptr,
-                         sequence_control_set_ptr);
-
-                     av1_tile_set_col(&tile_info, ppcs_ptr, tile_col);
-
-                     av1_reset_loop_restoration(picture_control_set_ptr);
-
-                     for (y_lcu_index = cm->tile_row_start_sb[tile_row]; y_lcu_index < (uint32_t)cm->tile_row_start_sb[tile_row + 1]; ++y_lcu_index)
-                     {
-                         for (x_lcu_index = cm->tile_col_start_sb[tile_col]; x_lcu_index < (uint32_t)cm->tile_col_start_sb[tile_col + 1]; ++x_lcu_index)
-                         {
-                             int sb_index = (uint16_t)(x_lcu_index + y_lcu_index * picture_width_in_sb);
-                             sb_ptr = picture_control_set_ptr->sb_ptr_array[sb_index];
-                             sb_origin_x = x_lcu_index << lcuSizeLog2;
-                             sb_origin_y = y_lcu_index << lcuSizeLog2;
-                             context_ptr->sb_origin_x = sb_origin_x;
-                             context_ptr->sb_origin_y = sb_origin_y;
-                             // Configure the LCU
-                             EntropyCodingConfigureLcu(
-                                 context_ptr,
-                                 sb_ptr,
-                                 picture_control_set_ptr);
-                             sb_ptr->total_bits = 0;
-                             uint32_t prev_pos = sb_index ? picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs : 0;//residual_bc.pos
-                             EbPictureBufferDesc *coeff_picture_ptr = sb_ptr->quantized_coeff;
-                             write_sb(
-                                 context_ptr,
-                                 sb_ptr,
-                                 picture_control_set_ptr,
-                                 picture_control_set_ptr->entropy_coder_ptr,
-                                 coeff_picture_ptr);
-                             sb_ptr->total_bits = (picture_control_set_ptr->entropy_coder_ptr->ec_writer.ec.offs - prev_pos) << 3;
-                             picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += sb_ptr->total_bits;
-                         }
-                     }
-
-                     encode_slice_finish(picture_control_set_ptr->entropy_coder_ptr);
-
-                     int tile_size = picture_control_set_ptr->entropy_coder_ptr->ec_writer.pos;
-                     assert(tile_size >= AV1_MIN_TILE_SIZE_BYTES);
-
-                     if (!is_last_tile_in_tg) {
-                         OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)(picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr);
-                         uint8_t *buf_data = output_bitstream_ptr->buffer_av1 + total_size;
-                         mem_put_le32(buf_data, tile_size - AV1_MIN_TILE_SIZE_BYTES);
-                     }
-
-                     if (is_last_tile_in_tg==0)
-                         total_size += 4;
-
-                     total_size += tile_size;
-                 }
-             }
-
-             //the picture is complete, terminate the slice
-             {
-                 uint32_t ref_idx;
-                 picture_control_set_ptr->entropy_coder_ptr->ec_frame_size = total_size;
-
-                 // Release the List 0 Reference Pictures
-                 for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list0_count; ++ref_idx) {
-                     if (picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx] != EB_NULL)
-                         eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[0][ref_idx]);
-                 }
-
-                 // Release the List 1 Reference Pictures
-                 for (ref_idx = 0; ref_idx < picture_control_set_ptr->parent_pcs_ptr->ref_list1_count; ++ref_idx) {
-                     if (picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx] != EB_NULL)
-                         eb_release_object(picture_control_set_ptr->ref_pic_ptr_array[1][ref_idx]);
-                 }
-
-                 // Get Empty Entropy Coding Results
-                 eb_get_empty_object(
-                     context_ptr->entropy_coding_output_fifo_ptr,
-                     &entropyCodingResultsWrapperPtr);
-                 entropyCodingResultsPtr = (EntropyCodingResults*)entropyCodingResultsWrapperPtr->object_ptr;
-                 entropyCodingResultsPtr->picture_control_set_wrapper_ptr = encDecResultsPtr->picture_control_set_wrapper_ptr;
-
-                 // Post EntropyCoding Results
-                 eb_post_full_object(entropyCodingResultsWrapperPtr);
-             }
+            // One tile per task, each in the coder of its tile info. The first tile
+            // codes in the picture coder after the space for its size, the task
+            // completing the picture appends the other tiles after it.
+            Av1Common *const cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
+            const uint16_t tile_count = (uint16_t)(cm->tile_cols * cm->tile_rows);
+            const uint16_t tile_idx = encDecResultsPtr->tile_index;
+            uint64_t tile_bits = 0;
+            EbBool picture_done = EB_FALSE;
+
+            context_ptr->tile_idx = tile_idx;
+            entropy_code_tile(
+                context_ptr,
+                picture_control_set_ptr,
+                sequence_control_set_ptr,
+                tile_idx / cm->tile_cols,
+                tile_idx % cm->tile_cols,
+                ((OutputBitstreamUnit*)picture_control_set_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_output_bitstream_ptr)->buffer_av1 + (tile_idx == 0 ? 4 : 0),
+                &tile_bits);
+
+            eb_block_on_mutex(picture_control_set_ptr->entropy_coding_mutex);
+            picture_control_set_ptr->parent_pcs_ptr->quantized_coeff_num_bits += tile_bits;
+            if (++picture_control_set_ptr->entropy_coding_tile_done_count == tile_count) {
+                picture_control_set_ptr->entropy_coding_tile_done_count = 0;
+                picture_done = EB_TRUE;
+            }
+            eb_release_mutex(picture_control_set_ptr->entropy_coding_mutex);
+
+            if (picture_done) {
+                uint8_t *frame_data = ((OutputBitstreamUnit*)picture_control_set_ptr->entropy_coder_ptr->ec_output_bitstream_ptr)->buffer_av1;
+                uint32_t total_size = 0;
+                uint16_t tile_index;
+
+                for (tile_index = 0; tile_index < tile_count; ++tile_index) {
+                    EntropyCoder *tile_coder_ptr = picture_control_set_ptr->entropy_coding_info[tile_index]->entropy_coder_ptr;
+                    const uint32_t tile_size = tile_coder_ptr->ec_writer.pos;
+                    const uint32_t is_last_tile_in_tg = (tile_index == tile_count - 1) ? 1 : 0;
+
+                    if (tile_index)
+                        EB_MEMCPY(
+                            frame_data + total_size + (is_last_tile_in_tg ? 0 : 4),
+                            ((OutputBitstreamUnit*)tile_coder_ptr->ec_output_bitstream_ptr)->buffer_av1,
+                            tile_size);
+                    if (!is_last_tile_in_tg) {
+                        mem_put_le32(frame_data + total_size, tile_size - AV1_MIN_TILE_SIZE_BYTES);
+                        total_size += 4;
+                    }
+                    total_size += tile_size;
+                }
+
+                entropy_coding_picture_done(
+                    context_ptr,
+                    picture_control_set_ptr,
+                    encDecResultsPtr->picture_control_set_wrapper_ptr,
+                    total_size);
+            }
         }
 
         // Release Mode Decision Results
@@ -52,6 +52,7 @@ typedef struct EntropyCodingContext
     uint32_t                          cu_origin_y;
     uint32_t                          sb_origin_x;
     uint32_t                          sb_origin_y;
+    uint16_t                          tile_idx;        // Tile being coded, selects the entropy tile info
     uint32_t                          pu_itr;
     PredictionUnit                 *pu_ptr;
     const PredictionUnitStats      *pu_stats;
@@ -83,6 +84,9 @@ extern EbErrorType entropy_coding_context_ctor(
     EbFifo                *rate_control_output_fifo_ptr,
     EbBool                   is16bit);
 
+extern uint16_t get_entropy_coding_tile_task_count(
+    PictureControlSet     *picture_control_set_ptr);
+
 extern void* entropy_coding_kernel(void *input_ptr);
 
 #endif // EbEntropyCodingProcess_h
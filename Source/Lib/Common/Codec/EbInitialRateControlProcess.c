@@ -4,6 +4,7 @@
 */
 
 #include <stdlib.h>
+#include <math.h>
 
 #include "EbDefinitions.h"
 #include "EbSystemResourceManager.h"
@@ -16,6 +17,7 @@
 #include "EbMotionEstimationContext.h"
 #include "EbUtility.h"
 #include "EbReferenceObject.h"
+#include "EbMeHints.h"
 
 /**************************************
 * Macros
@@ -357,6 +359,7 @@ EbErrorType initial_rate_control_context_ctor(
     *context_dbl_ptr = context_ptr;
     context_ptr->motion_estimation_results_input_fifo_ptr = motion_estimation_results_input_fifo_ptr;
     context_ptr->initialrate_control_results_output_fifo_ptr = initialrate_control_results_output_fifo_ptr;
+    context_ptr->tpl_next_picture_number = 0;
 
     return EB_ErrorNone;
 }
@@ -947,6 +950,226 @@ void UpdateMotionFieldUniformityOverTime(
         picture_control_set_ptr->sb_total_count);
     return;
 }
+
+/************************************************
+* Temporal Dependency Model
+** Propagate backwards along the ME results how much
+** of each 16x16 block the pictures of the look ahead
+** predict, as in the macroblock tree of x264
+** LAD Window: sliding window size
+************************************************/
+// Fraction of 16x16 * standard deviation taken as the SAD of the intra prediction of a block
+#define TPL_INTRA_SAD_NUMERATOR     3
+#define TPL_INTRA_SAD_DENOMINATOR   4
+// Lowest intra cost of a 16x16 block, the noise of a flat block
+#define TPL_MIN_INTRA_COST          (16 * 16)
+
+static uint32_t tpl_intra_cost(
+    PictureParentControlSet         *picture_control_set_ptr,
+    uint32_t                         sb_index,
+    uint32_t                         block_index)
+{
+    const uint16_t variance = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_16x16_0 + block_index];
+    const uint32_t intra_cost = (uint32_t)(16 * 16 * TPL_INTRA_SAD_NUMERATOR * sqrt((double)variance)) / TPL_INTRA_SAD_DENOMINATOR;
+
+    return MAX(intra_cost, TPL_MIN_INTRA_COST);
+}
+
+/*
+ * Add the cost propagated through a 16x16 block displaced by mv to the
+ * blocks of the reference it overlaps, in proportion of the overlapped area
+ */
+static void tpl_propagate_to_reference(
+    SequenceControlSet              *sequence_control_set_ptr,
+    PictureParentControlSet         *ref_picture_control_set_ptr,
+    int32_t                          block_origin_x,
+    int32_t                          block_origin_y,
+    const MvCandidate               *mv,
+    uint64_t                         propagate_amount)
+{
+    const int32_t picture_width = sequence_control_set_ptr->seq_header.max_frame_width;
+    const int32_t picture_height = sequence_control_set_ptr->seq_header.max_frame_height;
+    // Full pel position of the reference block, the ME vectors are in quarter pel
+    const int32_t ref_x = block_origin_x + ((mv->x_mv + 2) >> 2);
+    const int32_t ref_y = block_origin_y + ((mv->y_mv + 2) >> 2);
+    const int32_t grid_x = ref_x >> 4;
+    const int32_t grid_y = ref_y >> 4;
+    const int32_t offset_x = ref_x - (grid_x << 4);
+    const int32_t offset_y = ref_y - (grid_y << 4);
+    const int32_t overlap_width[2] = { 16 - offset_x, offset_x };
+    const int32_t overlap_height[2] = { 16 - offset_y, offset_y };
+
+    for (int32_t j = 0; j < 2; j++) {
+        const int32_t y = grid_y + j;
+        if (!overlap_height[j] || y < 0 || (y << 4) >= picture_height)
+            continue;
+        for (int32_t i = 0; i < 2; i++) {
+            const int32_t x = grid_x + i;
+            if (!overlap_width[i] || x < 0 || (x << 4) >= picture_width)
+                continue;
+            const uint32_t sb_index = (y >> 2) * sequence_control_set_ptr->picture_width_in_sb + (x >> 2);
+            const uint32_t block_index = ((y & 3) << 2) + (x & 3);
+            ref_picture_control_set_ptr->tpl_propagate_cost[sb_index * TPL_BLOCK_COUNT_PER_SB + block_index] +=
+                (propagate_amount * (uint64_t)(overlap_width[i] * overlap_height[j])) >> 8;
+        }
+    }
+}
+
+/*
+ * Set the importance of each SB, (intra cost + propagate cost) / intra cost,
+ * from the costs propagated to the picture
+ */
+static void tpl_set_importance(
+    SequenceControlSet              *sequence_control_set_ptr,
+    PictureParentControlSet         *picture_control_set_ptr)
+{
+    const uint32_t picture_width = sequence_control_set_ptr->seq_header.max_frame_width;
+    const uint32_t picture_height = sequence_control_set_ptr->seq_header.max_frame_height;
+    uint64_t frame_intra_cost = 0;
+    uint64_t frame_propagate_cost = 0;
+
+    for (uint32_t sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        SbParams *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+        uint64_t sb_intra_cost = 0;
+        uint64_t sb_propagate_cost = 0;
+        for (uint32_t block_index = 0; block_index < TPL_BLOCK_COUNT_PER_SB; ++block_index) {
+            if (sb_params->origin_x + ((block_index & 3) << 4) >= picture_width ||
+                sb_params->origin_y + ((block_index >> 2) << 4) >= picture_height)
+                continue;
+            sb_intra_cost += tpl_intra_cost(picture_control_set_ptr, sb_index, block_index);
+            sb_propagate_cost += picture_control_set_ptr->tpl_propagate_cost[sb_index * TPL_BLOCK_COUNT_PER_SB + block_index];
+        }
+        picture_control_set_ptr->tpl_sb_importance[sb_index] = (uint32_t)(((sb_intra_cost + sb_propagate_cost) << TPL_IMPORTANCE_PRECISION) / sb_intra_cost);
+        frame_intra_cost += sb_intra_cost;
+        frame_propagate_cost += sb_propagate_cost;
+    }
+    picture_control_set_ptr->tpl_frame_importance = (uint32_t)(((frame_intra_cost + frame_propagate_cost) << TPL_IMPORTANCE_PRECISION) / frame_intra_cost);
+}
+
+/*
+ * Give the same importance to all the SBs of a picture left out of the
+ * model, e.g. an overlay
+ */
+static void tpl_reset_importance(
+    PictureParentControlSet         *picture_control_set_ptr)
+{
+    for (uint32_t sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index)
+        picture_control_set_ptr->tpl_sb_importance[sb_index] = 1 << TPL_IMPORTANCE_PRECISION;
+    picture_control_set_ptr->tpl_frame_importance = 1 << TPL_IMPORTANCE_PRECISION;
+}
+
+/*
+ * Run the model over the sliding window when its head starts a mini GOP
+ * that has not been modeled yet, and set the importance of the pictures of
+ * the mini GOP : all of them are in the window and referenced by the pictures
+ * that follow in the window.
+ */
+void UpdateTemporalDependencyOverTime(
+    InitialRateControlContext       *context_ptr,
+    EncodeContext                   *encode_context_ptr,
+    SequenceControlSet              *sequence_control_set_ptr,
+    PictureParentControlSet         *picture_control_set_ptr)
+{
+    PictureParentControlSet          *window[MAX_LAD + 1];
+    uint32_t                          window_order[MAX_LAD + 1];
+    uint32_t                          window_size;
+    uint32_t                          inputQueueIndex;
+    uint32_t                          framesToCheckIndex;
+    const uint64_t                    head_picture_number = picture_control_set_ptr->picture_number;
+
+    if (head_picture_number < context_ptr->tpl_next_picture_number)
+        return;
+
+    // Walk the sliding window
+    window_size = MIN(MAX(picture_control_set_ptr->frames_in_sw, 1), MAX_LAD + 1);
+    inputQueueIndex = encode_context_ptr->initial_rate_control_reorder_queue_head_index;
+    for (framesToCheckIndex = 0; framesToCheckIndex < window_size; framesToCheckIndex++) {
+        window[framesToCheckIndex] = (PictureParentControlSet*)encode_context_ptr->initial_rate_control_reorder_queue[inputQueueIndex]->parent_pcs_wrapper_ptr->object_ptr;
+        EB_MEMSET(window[framesToCheckIndex]->tpl_propagate_cost, 0, sizeof(uint64_t) * window[framesToCheckIndex]->sb_total_count * TPL_BLOCK_COUNT_PER_SB);
+
+        // Sort the window in decode order
+        uint32_t sortIndex = framesToCheckIndex;
+        while (sortIndex && window[window_order[sortIndex - 1]]->decode_order > window[framesToCheckIndex]->decode_order) {
+            window_order[sortIndex] = window_order[sortIndex - 1];
+            sortIndex--;
+        }
+        window_order[sortIndex] = framesToCheckIndex;
+
+        inputQueueIndex = (inputQueueIndex == INITIAL_RATE_CONTROL_REORDER_QUEUE_MAX_DEPTH - 1) ? 0 : inputQueueIndex + 1;
+    }
+
+    // Propagate from the last picture decoded, its own cost is final
+    for (framesToCheckIndex = window_size; framesToCheckIndex-- > 0;) {
+        PictureParentControlSet *temporaryPictureControlSetPtr = window[window_order[framesToCheckIndex]];
+        if (temporaryPictureControlSetPtr->slice_type == I_SLICE)
+            continue;
+
+        for (uint32_t sb_index = 0; sb_index < temporaryPictureControlSetPtr->sb_total_count; ++sb_index) {
+            SbParams *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+            const MeLcuResults *me_results = temporaryPictureControlSetPtr->me_results[sb_index];
+            for (uint32_t block_index = 0; block_index < TPL_BLOCK_COUNT_PER_SB; ++block_index) {
+                const int32_t block_origin_x = sb_params->origin_x + ((block_index & 3) << 4);
+                const int32_t block_origin_y = sb_params->origin_y + ((block_index >> 2) << 4);
+                const uint32_t pu_index = ME_TIER_ZERO_PU_16x16_0 + block_index;
+                if (block_origin_x >= (int32_t)sequence_control_set_ptr->seq_header.max_frame_width ||
+                    block_origin_y >= (int32_t)sequence_control_set_ptr->seq_header.max_frame_height ||
+                    !me_results->total_me_candidate_index[pu_index])
+                    continue;
+
+                // Best ME candidate of the block
+                const MeCandidate *me_candidate = &me_results->me_candidate[pu_index][0];
+                for (uint32_t candidate_index = 1; candidate_index < me_results->total_me_candidate_index[pu_index]; candidate_index++) {
+                    if (me_results->me_candidate[pu_index][candidate_index].distortion < me_candidate->distortion)
+                        me_candidate = &me_results->me_candidate[pu_index][candidate_index];
+                }
+                const uint64_t intra_cost = tpl_intra_cost(temporaryPictureControlSetPtr, sb_index, block_index);
+                const uint64_t inter_cost = MIN((uint64_t)me_candidate->distortion, intra_cost);
+                const uint64_t propagate_amount = (intra_cost + temporaryPictureControlSetPtr->tpl_propagate_cost[sb_index * TPL_BLOCK_COUNT_PER_SB + block_index]) *
+                    (intra_cost - inter_cost) / intra_cost;
+                if (!propagate_amount)
+                    continue;
+
+                // References of the candidate, half of the amount to each for bi-prediction
+                uint8_t ref_list[2];
+                uint8_t ref_idx[2];
+                uint8_t ref_count = 0;
+                if (me_candidate->direction != UNI_PRED_LIST_1) {
+                    ref_list[ref_count] = me_candidate->direction == UNI_PRED_LIST_0 ? REF_LIST_0 : me_candidate->ref0_list;
+                    ref_idx[ref_count++] = me_candidate->ref_idx_l0;
+                }
+                if (me_candidate->direction != UNI_PRED_LIST_0) {
+                    ref_list[ref_count] = me_candidate->direction == UNI_PRED_LIST_1 ? REF_LIST_1 : me_candidate->ref1_list;
+                    ref_idx[ref_count++] = me_candidate->ref_idx_l1;
+                }
+                for (uint8_t ref_index = 0; ref_index < ref_count; ref_index++) {
+                    const uint64_t ref_poc = temporaryPictureControlSetPtr->ref_pic_poc_array[ref_list[ref_index]][ref_idx[ref_index]];
+                    // The references out of the window are already coded
+                    if (ref_poc < head_picture_number || ref_poc - head_picture_number >= window_size)
+                        continue;
+                    const uint32_t mv_index = ((sequence_control_set_ptr->mrp_mode == 0) ? (ref_list[ref_index] << 2) : (ref_list[ref_index] << 1)) + ref_idx[ref_index];
+                    tpl_propagate_to_reference(
+                        sequence_control_set_ptr,
+                        window[ref_poc - head_picture_number],
+                        block_origin_x,
+                        block_origin_y,
+                        &me_results->me_mv_array[pu_index][mv_index],
+                        propagate_amount / ref_count);
+                }
+            }
+        }
+    }
+
+    // Set the importance up to the end of the mini GOP, its base layer picture
+    for (framesToCheckIndex = 0; framesToCheckIndex < window_size; framesToCheckIndex++) {
+        tpl_set_importance(
+            sequence_control_set_ptr,
+            window[framesToCheckIndex]);
+        context_ptr->tpl_next_picture_number = window[framesToCheckIndex]->picture_number + 1;
+        if (window[framesToCheckIndex]->temporal_layer_index == 0)
+            break;
+    }
+}
+
 InitialRateControlReorderEntry  * DeterminePictureOffsetInQueue(
     EncodeContext                   *encode_context_ptr,
     PictureParentControlSet         *picture_control_set_ptr,
@@ -1327,6 +1550,11 @@ void* initial_rate_control_kernel(void *input_ptr)
             //reset intraCodedEstimationLcu
             MeBasedGlobalMotionDetection(
                 picture_control_set_ptr);
+            // Hand the ME and OIS results over to another encode
+            if (encode_context_ptr->me_hints && !picture_control_set_ptr->is_overlay)
+                me_hints_write(
+                    encode_context_ptr->me_hints,
+                    picture_control_set_ptr);
             // Release Pa Ref pictures when not needed
             ReleasePaReferenceObjects(
                 sequence_control_set_ptr,
@@ -1343,7 +1571,7 @@ void* initial_rate_control_kernel(void *input_ptr)
                 picture_control_set_ptr,
                 inputResultsPtr);
 
-            if (sequence_control_set_ptr->static_config.rate_control_mode)
+            if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode))
             {
                 if (sequence_control_set_ptr->static_config.look_ahead_distance != 0) {
                     // Getting the Histogram Queue Data
@@ -1506,7 +1734,7 @@ void* initial_rate_control_kernel(void *input_ptr)
                         else
                             picture_control_set_ptr->end_of_sequence_region = EB_FALSE;
 
-                        if (sequence_control_set_ptr->static_config.rate_control_mode)
+                        if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode))
                         {
                             // Determine offset from the Head Ptr for HLRC histogram queue and set the life count
                             if (sequence_control_set_ptr->static_config.look_ahead_distance != 0) {
@@ -1554,6 +1782,18 @@ void* initial_rate_control_kernel(void *input_ptr)
                                 sequence_control_set_ptr,
                                 picture_control_set_ptr);
                         }
+                        // Importance of the SBs for the adaptive quantization
+                        if (sequence_control_set_ptr->static_config.enable_adaptive_quantization == 2) {
+                            if (loop_index)
+                                tpl_reset_importance(
+                                    picture_control_set_ptr);
+                            else
+                                UpdateTemporalDependencyOverTime(
+                                    context_ptr,
+                                    encode_context_ptr,
+                                    sequence_control_set_ptr,
+                                    picture_control_set_ptr);
+                        }
                         // Derive blockinessPresentFlag
                         DeriveBlockinessPresentFlag(
                             sequence_control_set_ptr,
@@ -9,7 +9,11 @@
 #include "EbDefinitions.h"
 #include "EbSystemResourceManager.h"
 #include "EbRateControlProcess.h"
+#include "EbSequenceControlSet.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
 /**************************************
  * Context
  **************************************/
@@ -17,6 +21,8 @@ typedef struct InitialRateControlContext
 {
     EbFifo                    *motion_estimation_results_input_fifo_ptr;
     EbFifo                    *initialrate_control_results_output_fifo_ptr;
+    // First picture whose importance is not set by the temporal dependency model
+    uint64_t                   tpl_next_picture_number;
 } InitialRateControlContext;
 
 /***************************************
@@ -29,4 +35,15 @@ extern EbErrorType initial_rate_control_context_ctor(
 
 extern void* initial_rate_control_kernel(void *input_ptr);
 
+// Temporal dependency model of the sliding window, sets the importance of
+// the pictures of the mini GOP at its head
+extern void UpdateTemporalDependencyOverTime(
+    InitialRateControlContext       *context_ptr,
+    EncodeContext                   *encode_context_ptr,
+    SequenceControlSet              *sequence_control_set_ptr,
+    PictureParentControlSet         *picture_control_set_ptr);
+
+#ifdef __cplusplus
+}
+#endif
 #endif // EbInitialRateControl_h
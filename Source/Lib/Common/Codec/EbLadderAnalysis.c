@@ -0,0 +1,207 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include "EbUtility.h"
+#include "EbLadderAnalysis.h"
+
+#define LADDER_NO_REFERENCE         ((uint64_t)~0)
+#define LADDER_CENTERS_PER_SB       (MAX_NUM_OF_REF_PIC_LIST * REF_LIST_MAX_DEPTH * 2)
+
+EbErrorType ladder_analysis_ctor(
+    LadderAnalysis    **ladder_dbl_ptr,
+    uint32_t            frame_count,
+    uint16_t            width,
+    uint16_t            height,
+    uint16_t            sb_size)
+{
+    LadderAnalysis *ladder_ptr;
+    int16_t        *search_center;
+    uint32_t        sb_count;
+    uint32_t        picture_index;
+
+    *ladder_dbl_ptr = NULL;
+    ladder_ptr = (LadderAnalysis*)calloc(1, sizeof(LadderAnalysis));
+    if (ladder_ptr == NULL)
+        return EB_ErrorInsufficientResources;
+
+    ladder_ptr->frame_count = frame_count;
+    ladder_ptr->width = width;
+    ladder_ptr->height = height;
+    ladder_ptr->sb_size = sb_size;
+    ladder_ptr->picture_width_in_sb = (uint16_t)((width + sb_size - 1) / sb_size);
+    ladder_ptr->picture_height_in_sb = (uint16_t)((height + sb_size - 1) / sb_size);
+    sb_count = ladder_ptr->picture_width_in_sb * ladder_ptr->picture_height_in_sb;
+
+    ladder_ptr->pictures = (LadderPicture*)calloc(frame_count, sizeof(LadderPicture));
+    search_center = (int16_t*)calloc((size_t)frame_count * sb_count, LADDER_CENTERS_PER_SB * sizeof(int16_t));
+    ladder_ptr->ready_cond_var = eb_create_cond_var();
+    if (ladder_ptr->pictures == NULL || search_center == NULL || ladder_ptr->ready_cond_var == NULL) {
+        if (ladder_ptr->ready_cond_var)
+            eb_destroy_cond_var(ladder_ptr->ready_cond_var);
+        free(search_center);
+        free(ladder_ptr->pictures);
+        free(ladder_ptr);
+        return EB_ErrorInsufficientResources;
+    }
+
+    for (picture_index = 0; picture_index < frame_count; ++picture_index)
+        ladder_ptr->pictures[picture_index].search_center = search_center + (size_t)picture_index * sb_count * LADDER_CENTERS_PER_SB;
+    ladder_ptr->user_count = 1;
+
+    *ladder_dbl_ptr = ladder_ptr;
+    return EB_ErrorNone;
+}
+
+void ladder_analysis_add_user(
+    LadderAnalysis     *ladder_ptr)
+{
+    eb_atomic_fetch_add_u32(&ladder_ptr->user_count, 1);
+}
+
+void ladder_analysis_release(
+    LadderAnalysis     *ladder_ptr)
+{
+    if (eb_atomic_fetch_add_u32(&ladder_ptr->user_count, (uint32_t)-1) != 1)
+        return;
+
+    eb_destroy_cond_var(ladder_ptr->ready_cond_var);
+    if (ladder_ptr->frame_count)
+        free(ladder_ptr->pictures[0].search_center);
+    free(ladder_ptr->pictures);
+    free(ladder_ptr);
+}
+
+void ladder_analysis_stop(
+    LadderAnalysis     *ladder_ptr)
+{
+    eb_atomic_store_u32(&ladder_ptr->lead_stopped, 1);
+    eb_signal_cond_var(ladder_ptr->ready_cond_var);
+}
+
+void ladder_analysis_record(
+    LadderAnalysis     *ladder_ptr,
+    uint64_t            picture_number,
+    uint32_t            sb_index,
+    uint32_t            list_index,
+    uint32_t            ref_pic_index,
+    int16_t             x_search_center,
+    int16_t             y_search_center)
+{
+    int16_t *search_center;
+
+    if (picture_number >= ladder_ptr->frame_count)
+        return;
+
+    search_center = ladder_ptr->pictures[picture_number].search_center +
+        ((sb_index * MAX_NUM_OF_REF_PIC_LIST + list_index) * REF_LIST_MAX_DEPTH + ref_pic_index) * 2;
+    search_center[0] = x_search_center;
+    search_center[1] = y_search_center;
+}
+
+void ladder_analysis_publish(
+    LadderAnalysis     *ladder_ptr,
+    uint64_t            picture_number,
+    uint64_t            ref_pic_poc_array[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+    uint32_t            ref_list0_count,
+    uint32_t            ref_list1_count,
+    uint32_t            segment_total_count)
+{
+    LadderPicture *picture_ptr;
+    uint32_t       ref_pic_index;
+
+    if (picture_number >= ladder_ptr->frame_count)
+        return;
+    picture_ptr = &ladder_ptr->pictures[picture_number];
+
+    if (eb_atomic_fetch_add_u32(&picture_ptr->segment_count, 1) + 1 != segment_total_count)
+        return;
+
+    // Last segment, the search centers of all the SBs are stored
+    for (ref_pic_index = 0; ref_pic_index < REF_LIST_MAX_DEPTH; ++ref_pic_index) {
+        picture_ptr->ref_poc[REF_LIST_0][ref_pic_index] = ref_pic_index < ref_list0_count ?
+            ref_pic_poc_array[REF_LIST_0][ref_pic_index] : LADDER_NO_REFERENCE;
+        picture_ptr->ref_poc[REF_LIST_1][ref_pic_index] = ref_pic_index < ref_list1_count ?
+            ref_pic_poc_array[REF_LIST_1][ref_pic_index] : LADDER_NO_REFERENCE;
+    }
+    eb_atomic_store_u32(&picture_ptr->ready, 1);
+    eb_signal_cond_var(ladder_ptr->ready_cond_var);
+}
+
+EbBool ladder_analysis_wait(
+    LadderAnalysis     *ladder_ptr,
+    uint64_t            picture_number)
+{
+    if (picture_number >= ladder_ptr->frame_count)
+        return EB_FALSE;
+
+    return eb_wait_cond_var(ladder_ptr->ready_cond_var, &ladder_ptr->pictures[picture_number].ready, 1, &ladder_ptr->lead_stopped);
+}
+
+/************************************************
+ * Scale a full pel vector component from the
+ * lead resolution, rounded to the nearest
+ ************************************************/
+static int16_t scale_search_center(
+    int16_t             search_center,
+    uint16_t            size,
+    uint16_t            lead_size)
+{
+    int32_t scaled = search_center * (int32_t)size;
+
+    scaled = scaled >= 0 ?
+        (scaled + (lead_size >> 1)) / lead_size :
+        -((-scaled + (lead_size >> 1)) / lead_size);
+
+    return (int16_t)CLIP3(-32768, 32767, scaled);
+}
+
+EbBool ladder_analysis_get_search_center(
+    LadderAnalysis     *ladder_ptr,
+    uint64_t            picture_number,
+    uint32_t            list_index,
+    uint32_t            ref_pic_index,
+    uint64_t            ref_poc,
+    uint16_t            width,
+    uint16_t            height,
+    uint32_t            sb_origin_x,
+    uint32_t            sb_origin_y,
+    uint32_t            sb_width,
+    uint32_t            sb_height,
+    int16_t            *x_search_center,
+    int16_t            *y_search_center)
+{
+    LadderPicture *picture_ptr;
+    const int16_t *search_center;
+    uint32_t       x_lead_sb_index;
+    uint32_t       y_lead_sb_index;
+    uint32_t       sb_index;
+
+    if (picture_number >= ladder_ptr->frame_count)
+        return EB_FALSE;
+    picture_ptr = &ladder_ptr->pictures[picture_number];
+
+    // The lead stopped before publishing the picture
+    if (eb_atomic_load_u32(&picture_ptr->ready) == 0)
+        return EB_FALSE;
+
+    // The lead may have decided another prediction structure or scene cut
+    if (picture_ptr->ref_poc[list_index][ref_pic_index] != ref_poc)
+        return EB_FALSE;
+
+    // Lead SB covering the center of the SB
+    x_lead_sb_index = (uint32_t)(((uint64_t)sb_origin_x + (sb_width >> 1)) * ladder_ptr->width / width) / ladder_ptr->sb_size;
+    y_lead_sb_index = (uint32_t)(((uint64_t)sb_origin_y + (sb_height >> 1)) * ladder_ptr->height / height) / ladder_ptr->sb_size;
+    x_lead_sb_index = MIN(x_lead_sb_index, (uint32_t)ladder_ptr->picture_width_in_sb - 1);
+    y_lead_sb_index = MIN(y_lead_sb_index, (uint32_t)ladder_ptr->picture_height_in_sb - 1);
+    sb_index = x_lead_sb_index + y_lead_sb_index * ladder_ptr->picture_width_in_sb;
+
+    search_center = picture_ptr->search_center +
+        ((sb_index * MAX_NUM_OF_REF_PIC_LIST + list_index) * REF_LIST_MAX_DEPTH + ref_pic_index) * 2;
+    *x_search_center = scale_search_center(search_center[0], width, ladder_ptr->width);
+    *y_search_center = scale_search_center(search_center[1], height, ladder_ptr->height);
+
+    return EB_TRUE;
+}
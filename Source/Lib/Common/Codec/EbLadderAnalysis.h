@@ -0,0 +1,133 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbLadderAnalysis_h
+#define EbLadderAnalysis_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /************************************************
+     * Ladder Picture
+     *   Analysis of a picture of the ladder lead,
+     *   indexed by picture number
+     ************************************************/
+    typedef struct LadderPicture
+    {
+        // Number of ME segments of the lead done with the picture
+        volatile uint32_t   segment_count;
+        // Set once all the segments are done, the fields below are then read only
+        volatile uint32_t   ready;
+        // POC of the references searched by the lead, ~0 when not searched
+        uint64_t            ref_poc[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+        // Full pel search centers found by the HME of the lead,
+        // [sb_index][list][ref][x/y]
+        int16_t            *search_center;
+    } LadderPicture;
+
+    /************************************************
+     * Ladder Analysis
+     *   HME search centers of the lead of a ladder,
+     *   shared with the renditions encoding the same
+     *   pictures at other resolutions. It is not
+     *   allocated from the arena of the lead, the
+     *   last of the lead and its renditions to be
+     *   deinitialized frees it.
+     ************************************************/
+    typedef struct LadderAnalysis
+    {
+        uint32_t            frame_count;
+        uint16_t            width;
+        uint16_t            height;
+        uint16_t            sb_size;
+        uint16_t            picture_width_in_sb;
+        uint16_t            picture_height_in_sb;
+        LadderPicture      *pictures;
+        // Signaled when a picture is ready or the lead stops
+        EbHandle            ready_cond_var;
+        // Set once the lead stops, the renditions no longer wait
+        volatile uint32_t   lead_stopped;
+        // Lead and renditions using the analysis
+        volatile uint32_t   user_count;
+    } LadderAnalysis;
+
+    // Created with the lead as only user
+    extern EbErrorType ladder_analysis_ctor(
+        LadderAnalysis    **ladder_dbl_ptr,
+        uint32_t            frame_count,
+        uint16_t            width,
+        uint16_t            height,
+        uint16_t            sb_size);
+
+    extern void ladder_analysis_add_user(
+        LadderAnalysis     *ladder_ptr);
+
+    // Frees the analysis when the last user releases it, to be called once
+    // the threads of the user are stopped
+    extern void ladder_analysis_release(
+        LadderAnalysis     *ladder_ptr);
+
+    /************************************************
+     * Lead side, called by the ME kernel of the lead
+     ************************************************/
+    // Store the HME search center of an SB
+    extern void ladder_analysis_record(
+        LadderAnalysis     *ladder_ptr,
+        uint64_t            picture_number,
+        uint32_t            sb_index,
+        uint32_t            list_index,
+        uint32_t            ref_pic_index,
+        int16_t             x_search_center,
+        int16_t             y_search_center);
+
+    // Called when the lead is deinitialized, the renditions then wake up
+    // and search the pictures not published on their own
+    extern void ladder_analysis_stop(
+        LadderAnalysis     *ladder_ptr);
+
+    // Called once per ME segment, the last segment makes the picture
+    // available to the renditions
+    extern void ladder_analysis_publish(
+        LadderAnalysis     *ladder_ptr,
+        uint64_t            picture_number,
+        uint64_t            ref_pic_poc_array[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH],
+        uint32_t            ref_list0_count,
+        uint32_t            ref_list1_count,
+        uint32_t            segment_total_count);
+
+    /************************************************
+     * Rendition side, called by the ME kernel of
+     * the renditions
+     ************************************************/
+    // Wait until the lead published the picture, returns EB_FALSE if the
+    // lead stopped before
+    extern EbBool ladder_analysis_wait(
+        LadderAnalysis     *ladder_ptr,
+        uint64_t            picture_number);
+
+    // Scale the search center of the lead SB covering the center of the
+    // given rendition SB, returns EB_FALSE when the lead did not publish the
+    // picture or did not search the same reference
+    extern EbBool ladder_analysis_get_search_center(
+        LadderAnalysis     *ladder_ptr,
+        uint64_t            picture_number,
+        uint32_t            list_index,
+        uint32_t            ref_pic_index,
+        uint64_t            ref_poc,
+        uint16_t            width,
+        uint16_t            height,
+        uint32_t            sb_origin_x,
+        uint32_t            sb_origin_y,
+        uint32_t            sb_width,
+        uint32_t            sb_height,
+        int16_t            *x_search_center,
+        int16_t            *y_search_center);
+#ifdef __cplusplus
+}
+#endif
+#endif // EbLadderAnalysis_h
@@ -0,0 +1,255 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <string.h>
+
+#include "EbUtility.h"
+#include "EbMeHints.h"
+
+/*
+ * Largest results of an SB : all the PUs with the candidates and the vectors
+ * of MRP mode 0, and all the blocks with all the OIS candidates
+ */
+#define ME_HINTS_PU_MAX_SIZE    (3 + ME_RES_CAND_MRP_MODE_0 * sizeof(MeCandidate) + ME_MV_MRP_MODE_0 * sizeof(MvCandidate))
+#define ME_HINTS_BLOCK_MAX_SIZE (2 + MAX_OIS_CANDIDATES * sizeof(OisCandidate))
+#define ME_HINTS_SB_MAX_SIZE    (MAX_ME_PU_COUNT * ME_HINTS_PU_MAX_SIZE + CU_MAX_COUNT * ME_HINTS_BLOCK_MAX_SIZE)
+
+/*
+ * @private
+ * @function me_hints_set_header. Helper to describe the results of a picture
+ * @param {MeHintsPictureHeader*} header.
+ * @param {PictureParentControlSet*} picture_control_set_ptr.
+ */
+static void me_hints_set_header(MeHintsPictureHeader *header, PictureParentControlSet *picture_control_set_ptr);
+
+/*
+ * @private
+ * @function me_hints_read_sb. Helper to copy the results of an SB from its
+ * hints, returns EB_FALSE when they do not match the header
+ * @param {PictureParentControlSet*} picture_control_set_ptr.
+ * @param {uint32_t} sb_index.
+ * @param {const uint8_t*} data.
+ * @param {uint32_t} size.
+ * @param {EbBool} ois_present.
+ * @return {EbBool}.
+ */
+static EbBool me_hints_read_sb(PictureParentControlSet *picture_control_set_ptr, uint32_t sb_index,
+    const uint8_t *data, uint32_t size, EbBool ois_present);
+
+EbErrorType me_hints_ctor(
+    MeHints                   **object_dbl_ptr,
+    eb_write_me_hints           write_hints,
+    eb_read_me_hints            read_hints,
+    void                       *priv_data)
+{
+    MeHints *hints_ptr;
+
+    EB_MALLOC(MeHints*, hints_ptr, sizeof(MeHints), EB_N_PTR);
+    *object_dbl_ptr = hints_ptr;
+
+    hints_ptr->write_hints = write_hints;
+    hints_ptr->read_hints = read_hints;
+    hints_ptr->priv_data = priv_data;
+    hints_ptr->sb_max_size = (uint32_t)ME_HINTS_SB_MAX_SIZE;
+    hints_ptr->write_buffer = (uint8_t*)EB_NULL;
+    hints_ptr->read_buffer = (uint8_t*)EB_NULL;
+    if (write_hints) {
+        EB_MALLOC(uint8_t*, hints_ptr->write_buffer, sizeof(MeHintsSbHeader) + hints_ptr->sb_max_size, EB_N_PTR);
+    }
+    if (read_hints) {
+        EB_MALLOC(uint8_t*, hints_ptr->read_buffer, hints_ptr->sb_max_size, EB_N_PTR);
+    }
+
+    return EB_ErrorNone;
+}
+
+void me_hints_write(
+    MeHints                    *hints_ptr,
+    PictureParentControlSet    *picture_control_set_ptr)
+{
+    SequenceControlSet  *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    MeHintsPictureHeader header;
+    uint32_t            mv_count = sequence_control_set_ptr->mrp_mode == 0 ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1;
+    uint32_t            sb_index;
+
+    if (hints_ptr->write_hints == NULL)
+        return;
+
+    me_hints_set_header(&header, picture_control_set_ptr);
+    hints_ptr->write_hints(hints_ptr->priv_data, picture_control_set_ptr->picture_number, (const uint8_t*)&header, sizeof(header));
+
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        MeHintsSbHeader *sb_header = (MeHintsSbHeader*)hints_ptr->write_buffer;
+        uint8_t         *data = hints_ptr->write_buffer + sizeof(MeHintsSbHeader);
+        uint8_t         *data_ptr = data;
+
+        sb_header->rc_me_distortion = 0;
+        if (picture_control_set_ptr->slice_type != I_SLICE) {
+            MeLcuResults *me_results = picture_control_set_ptr->me_results[sb_index];
+            uint32_t      pu_index;
+
+            sb_header->rc_me_distortion = picture_control_set_ptr->rc_me_distortion[sb_index];
+            for (pu_index = 0; pu_index < picture_control_set_ptr->max_number_of_pus_per_sb; ++pu_index) {
+                uint8_t candidate_count = MIN(me_results->total_me_candidate_index[pu_index], picture_control_set_ptr->max_number_of_candidates_per_block);
+
+                *data_ptr++ = candidate_count;
+                *data_ptr++ = me_results->me_nsq_0[pu_index];
+                *data_ptr++ = me_results->me_nsq_1[pu_index];
+                EB_MEMCPY(data_ptr, me_results->me_candidate[pu_index], candidate_count * sizeof(MeCandidate));
+                data_ptr += candidate_count * sizeof(MeCandidate);
+                EB_MEMCPY(data_ptr, me_results->me_mv_array[pu_index], mv_count * sizeof(MvCandidate));
+                data_ptr += mv_count * sizeof(MvCandidate);
+            }
+        }
+        if (header.ois_present) {
+            SbParams     *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+            OisSbResults *ois_sb_results_ptr = picture_control_set_ptr->ois_sb_results[sb_index];
+            uint32_t      block_index;
+
+            for (block_index = 0; block_index < CU_MAX_COUNT; ++block_index) {
+                uint8_t candidate_count;
+
+                if (!sb_params->raster_scan_cu_validity[md_scan_to_raster_scan[block_index]])
+                    continue;
+                candidate_count = MIN(ois_sb_results_ptr->total_ois_intra_candidate[block_index], MAX_OIS_CANDIDATES);
+                *data_ptr++ = candidate_count;
+                *data_ptr++ = (uint8_t)ois_sb_results_ptr->best_distortion_index[block_index];
+                EB_MEMCPY(data_ptr, ois_sb_results_ptr->ois_candidate_array[block_index], candidate_count * sizeof(OisCandidate));
+                data_ptr += candidate_count * sizeof(OisCandidate);
+            }
+        }
+        sb_header->size = (uint32_t)(data_ptr - data);
+
+        hints_ptr->write_hints(hints_ptr->priv_data, picture_control_set_ptr->picture_number, hints_ptr->write_buffer, sizeof(MeHintsSbHeader) + sb_header->size);
+    }
+}
+
+void me_hints_read(
+    MeHints                    *hints_ptr,
+    PictureParentControlSet    *picture_control_set_ptr)
+{
+    MeHintsPictureHeader expected_header;
+    MeHintsPictureHeader header;
+    uint32_t            sb_index;
+
+    picture_control_set_ptr->me_hints_imported = EB_FALSE;
+    picture_control_set_ptr->ois_hints_imported = EB_FALSE;
+    if (hints_ptr->read_hints == NULL)
+        return;
+
+    // The results are only valid for the same references, the same preset
+    // and the same prediction structure
+    me_hints_set_header(&expected_header, picture_control_set_ptr);
+    if (hints_ptr->read_hints(hints_ptr->priv_data, picture_control_set_ptr->picture_number, (uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        memcmp(&header, &expected_header, sizeof(header)) != 0)
+        return;
+
+    // A picture with incomplete hints is searched again, over the partially
+    // copied results
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        MeHintsSbHeader sb_header;
+
+        if (hints_ptr->read_hints(hints_ptr->priv_data, picture_control_set_ptr->picture_number, (uint8_t*)&sb_header, sizeof(sb_header)) != sizeof(sb_header) ||
+            sb_header.size > hints_ptr->sb_max_size ||
+            hints_ptr->read_hints(hints_ptr->priv_data, picture_control_set_ptr->picture_number, hints_ptr->read_buffer, sb_header.size) != sb_header.size ||
+            !me_hints_read_sb(picture_control_set_ptr, sb_index, hints_ptr->read_buffer, sb_header.size, (EbBool)header.ois_present))
+            return;
+        if (picture_control_set_ptr->slice_type != I_SLICE)
+            picture_control_set_ptr->rc_me_distortion[sb_index] = sb_header.rc_me_distortion;
+    }
+
+    picture_control_set_ptr->me_hints_imported = EB_TRUE;
+    picture_control_set_ptr->ois_hints_imported = (EbBool)header.ois_present;
+}
+
+static void me_hints_set_header(MeHintsPictureHeader *header, PictureParentControlSet *picture_control_set_ptr) {
+    SequenceControlSet  *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    uint32_t            ref_pic_index;
+
+    EB_MEMSET(header, 0, sizeof(MeHintsPictureHeader));
+    header->magic = ME_HINTS_MAGIC;
+    header->version = ME_HINTS_VERSION;
+    header->picture_number = picture_control_set_ptr->picture_number;
+    header->width = sequence_control_set_ptr->seq_header.max_frame_width;
+    header->height = sequence_control_set_ptr->seq_header.max_frame_height;
+    header->sb_total_count = picture_control_set_ptr->sb_total_count;
+    header->slice_type = (uint8_t)picture_control_set_ptr->slice_type;
+    header->mrp_mode = sequence_control_set_ptr->mrp_mode;
+    header->enc_mode = (uint8_t)picture_control_set_ptr->enc_mode;
+    header->temporal_layer_index = picture_control_set_ptr->temporal_layer_index;
+    header->hierarchical_levels = picture_control_set_ptr->hierarchical_levels;
+    header->is_used_as_reference_flag = (uint8_t)picture_control_set_ptr->is_used_as_reference_flag;
+    header->pic_depth_mode = (uint8_t)picture_control_set_ptr->pic_depth_mode;
+    header->cu8x8_mode = (uint8_t)picture_control_set_ptr->cu8x8_mode;
+    header->nsq_search_level = picture_control_set_ptr->nsq_search_level;
+    header->max_number_of_pus_per_sb = picture_control_set_ptr->max_number_of_pus_per_sb;
+    header->max_number_of_candidates_per_block = picture_control_set_ptr->max_number_of_candidates_per_block;
+    header->ref_list0_count = picture_control_set_ptr->slice_type == I_SLICE ? 0 : picture_control_set_ptr->ref_list0_count;
+    header->ref_list1_count = picture_control_set_ptr->slice_type == B_SLICE ? picture_control_set_ptr->ref_list1_count : 0;
+    header->ois_present = picture_control_set_ptr->intra_pred_mode > 4;
+    for (ref_pic_index = 0; ref_pic_index < REF_LIST_MAX_DEPTH; ++ref_pic_index) {
+        if (ref_pic_index < header->ref_list0_count)
+            header->ref_poc[REF_LIST_0][ref_pic_index] = picture_control_set_ptr->ref_pic_poc_array[REF_LIST_0][ref_pic_index];
+        if (ref_pic_index < header->ref_list1_count)
+            header->ref_poc[REF_LIST_1][ref_pic_index] = picture_control_set_ptr->ref_pic_poc_array[REF_LIST_1][ref_pic_index];
+    }
+}
+
+static EbBool me_hints_read_sb(PictureParentControlSet *picture_control_set_ptr, uint32_t sb_index,
+    const uint8_t *data, uint32_t size, EbBool ois_present)
+{
+    SequenceControlSet  *sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
+    uint32_t            mv_count = sequence_control_set_ptr->mrp_mode == 0 ? ME_MV_MRP_MODE_0 : ME_MV_MRP_MODE_1;
+    const uint8_t      *data_end = data + size;
+
+    if (picture_control_set_ptr->slice_type != I_SLICE) {
+        MeLcuResults *me_results = picture_control_set_ptr->me_results[sb_index];
+        uint32_t      pu_index;
+
+        for (pu_index = 0; pu_index < picture_control_set_ptr->max_number_of_pus_per_sb; ++pu_index) {
+            uint8_t candidate_count;
+
+            if (data_end - data < 3)
+                return EB_FALSE;
+            candidate_count = data[0];
+            if (candidate_count > picture_control_set_ptr->max_number_of_candidates_per_block ||
+                (size_t)(data_end - data) < 3 + candidate_count * sizeof(MeCandidate) + mv_count * sizeof(MvCandidate))
+                return EB_FALSE;
+            me_results->total_me_candidate_index[pu_index] = candidate_count;
+            me_results->me_nsq_0[pu_index] = data[1];
+            me_results->me_nsq_1[pu_index] = data[2];
+            data += 3;
+            EB_MEMCPY(me_results->me_candidate[pu_index], (void*)data, candidate_count * sizeof(MeCandidate));
+            data += candidate_count * sizeof(MeCandidate);
+            EB_MEMCPY(me_results->me_mv_array[pu_index], (void*)data, mv_count * sizeof(MvCandidate));
+            data += mv_count * sizeof(MvCandidate);
+        }
+    }
+    if (ois_present) {
+        SbParams     *sb_params = &sequence_control_set_ptr->sb_params_array[sb_index];
+        OisSbResults *ois_sb_results_ptr = picture_control_set_ptr->ois_sb_results[sb_index];
+        uint32_t      block_index;
+
+        for (block_index = 0; block_index < CU_MAX_COUNT; ++block_index) {
+            uint8_t candidate_count;
+
+            if (!sb_params->raster_scan_cu_validity[md_scan_to_raster_scan[block_index]])
+                continue;
+            if (data_end - data < 2)
+                return EB_FALSE;
+            candidate_count = data[0];
+            if (candidate_count > MAX_OIS_CANDIDATES ||
+                (size_t)(data_end - data) < 2 + candidate_count * sizeof(OisCandidate))
+                return EB_FALSE;
+            ois_sb_results_ptr->total_ois_intra_candidate[block_index] = candidate_count;
+            ois_sb_results_ptr->best_distortion_index[block_index] = (int8_t)data[1];
+            data += 2;
+            EB_MEMCPY(ois_sb_results_ptr->ois_candidate_array[block_index], (void*)data, candidate_count * sizeof(OisCandidate));
+            data += candidate_count * sizeof(OisCandidate);
+        }
+    }
+
+    return (EbBool)(data == data_end);
+}
@@ -0,0 +1,136 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbMeHints_h
+#define EbMeHints_h
+
+#include "EbSvtAv1Enc.h"
+#include "EbSequenceControlSet.h"
+#include "EbPictureControlSet.h"
+
+/*
+ * Signature of the motion estimation hints of a picture, "SVMH"
+ */
+#define ME_HINTS_MAGIC      0x484D5653
+#define ME_HINTS_VERSION    1
+
+/*
+ * @struct Header of the hints of a picture, followed by sb_total_count
+ * MeHintsSbHeader, each followed by the results of the SB. All the fields are
+ * in the byte order of the host, the hints are only meant to be read by the
+ * encoder that wrote them.
+ */
+typedef struct MeHintsPictureHeader {
+    uint32_t    magic;
+    uint32_t    version;
+    uint64_t    picture_number;
+    uint16_t    width;
+    uint16_t    height;
+    uint16_t    sb_total_count;
+    uint8_t     slice_type;
+    /*
+     * @variable uint8_t. Layout of the motion estimation results, see
+     * MeLcuResults
+     */
+    uint8_t     mrp_mode;
+    uint8_t     max_number_of_pus_per_sb;
+    uint8_t     max_number_of_candidates_per_block;
+    /*
+     * @variable uint8_t. Number of references searched in each list
+     */
+    uint8_t     ref_list0_count;
+    uint8_t     ref_list1_count;
+    /*
+     * @variable uint8_t. 1 when the SBs carry open loop intra results
+     */
+    uint8_t     ois_present;
+    /*
+     * @variable uint8_t. Settings of the encoder and of the picture that
+     * select the search areas and the PUs searched
+     */
+    uint8_t     enc_mode;
+    uint8_t     temporal_layer_index;
+    uint8_t     hierarchical_levels;
+    uint8_t     is_used_as_reference_flag;
+    uint8_t     pic_depth_mode;
+    uint8_t     cu8x8_mode;
+    uint8_t     nsq_search_level;
+    uint8_t     reserved[4];
+    uint64_t    ref_poc[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+} MeHintsPictureHeader;
+
+/*
+ * @struct Header of the results of an SB. For each PU, the number of ME
+ * candidates, the NSQ of both lists, the MeCandidate and the MvCandidate of
+ * all the references follow. For each valid block, the number of OIS
+ * candidates, the index of the best and the OisCandidate then follow when
+ * ois_present is set.
+ */
+typedef struct MeHintsSbHeader {
+    uint32_t    rc_me_distortion;
+    /*
+     * @variable uint32_t. Size of the results following the header in bytes
+     */
+    uint32_t    size;
+} MeHintsSbHeader;
+
+/*
+ * @struct Hints of the encoder, written by the initial rate control once the
+ * motion estimation of a picture is complete and read by the picture decision
+ * before the motion estimation of a picture starts.
+ */
+typedef struct MeHints {
+    eb_write_me_hints   write_hints;
+    eb_read_me_hints    read_hints;
+    void               *priv_data;
+    /*
+     * @variable uint32_t. Maximum size of the results of an SB
+     */
+    uint32_t            sb_max_size;
+    /*
+     * @variable uint8_t*. Results of an SB, one buffer per thread
+     */
+    uint8_t            *write_buffer;
+    uint8_t            *read_buffer;
+} MeHints;
+
+/*
+ * @function me_hints_ctor. Allocate the hints of an encoder
+ * @param {MeHints**} object_dbl_ptr.
+ * @param {eb_write_me_hints} write_hints. NULL when the hints are not written.
+ * @param {eb_read_me_hints} read_hints. NULL when the hints are not read.
+ * @param {void*} priv_data. Given back to the callbacks.
+ * @return {EbErrorType}.
+ */
+extern EbErrorType me_hints_ctor(
+    MeHints                   **object_dbl_ptr,
+    eb_write_me_hints           write_hints,
+    eb_read_me_hints            read_hints,
+    void                       *priv_data);
+
+/*
+ * @function me_hints_write. Write the motion estimation and open loop intra
+ * results of a picture
+ * @param {MeHints*} hints_ptr.
+ * @param {PictureParentControlSet*} picture_control_set_ptr.
+ */
+extern void me_hints_write(
+    MeHints                    *hints_ptr,
+    PictureParentControlSet    *picture_control_set_ptr);
+
+/*
+ * @function me_hints_read. Read the results of a picture into its
+ * me_results, rc_me_distortion and ois_sb_results, and set
+ * me_hints_imported and ois_hints_imported. The results are not used when
+ * the hints are missing or were written for another prediction structure or
+ * another preset.
+ * @param {MeHints*} hints_ptr.
+ * @param {PictureParentControlSet*} picture_control_set_ptr.
+ */
+extern void me_hints_read(
+    MeHints                    *hints_ptr,
+    PictureParentControlSet    *picture_control_set_ptr);
+
+#endif // EbMeHints_h
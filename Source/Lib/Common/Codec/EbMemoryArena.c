@@ -0,0 +1,305 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbMemoryArena.h"
+#include "EbThreads.h"
+#include "EbUtility.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Chunks start at 1 MB and grow with the arena, up to 64 MB. Blocks larger
+// than an eighth of a chunk get a chunk of their own, so that at most an
+// eighth of a chunk is left unused at its end.
+#define MEMORY_CHUNK_MIN_SIZE       (1 << 20)
+#define MEMORY_CHUNK_MAX_SIZE       (64 << 20)
+#define MEMORY_CHUNK_ALIGN          64
+#define MEMORY_BLOCK_MAX_SIZE(c)    ((c) >> 3)
+
+// Arena of the calling thread
+static EB_THREAD_LOCAL EbMemoryArena *current_arena_ptr = NULL;
+
+#define ALIGN_PTR(ptr, align) \
+    ((uint8_t*)(((uintptr_t)(ptr) + ((align) - 1)) & ~(uintptr_t)((align) - 1)))
+
+#if defined(__linux__)
+// Mbind policy, from numaif.h which comes with libnuma
+#define MPOL_PREFERRED_POLICY       1
+#define NUMA_NODE_MASK_BITS         1024
+#endif
+
+/***************************************
+ * node_alloc
+ *   Zeroed pages preferably placed on
+ *   numa_node. They are placed when
+ *   first touched, falling back to the
+ *   other nodes when the node is full.
+ ***************************************/
+static void* node_alloc(
+    uint64_t        size,
+    int32_t         numa_node)
+{
+#ifdef _WIN32
+    return VirtualAllocExNuma(GetCurrentProcess(), NULL, (SIZE_T)size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, (DWORD)numa_node);
+#elif defined(__linux__)
+    void *ptr = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (ptr == MAP_FAILED)
+        return NULL;
+#ifdef SYS_mbind
+    if (numa_node < NUMA_NODE_MASK_BITS) {
+        unsigned long node_mask[NUMA_NODE_MASK_BITS / (8 * sizeof(unsigned long))] = { 0 };
+
+        node_mask[numa_node / (8 * sizeof(unsigned long))] = 1UL << (numa_node % (8 * sizeof(unsigned long)));
+        // Left to the default policy on failure
+        syscall(SYS_mbind, ptr, (unsigned long)size, MPOL_PREFERRED_POLICY, node_mask, (unsigned long)NUMA_NODE_MASK_BITS, 0);
+    }
+#endif
+    return ptr;
+#else
+    (void)numa_node;
+    return calloc(1, (size_t)size);
+#endif
+}
+
+static void node_free(
+    EbMemoryChunk  *chunk_ptr)
+{
+#ifdef _WIN32
+    VirtualFree(chunk_ptr, 0, MEM_RELEASE);
+#elif defined(__linux__)
+    munmap(chunk_ptr, (size_t)chunk_ptr->size);
+#else
+    free(chunk_ptr);
+#endif
+}
+
+/***************************************
+ * new_chunk
+ *   Links a chunk of size usable bytes
+ *   to the arena and returns its first
+ *   byte. Called with the mutex held.
+ ***************************************/
+static uint8_t* new_chunk(
+    EbMemoryArena  *arena_ptr,
+    uint64_t        size,
+    EbBool          zero)
+{
+    const uint64_t  total_size = sizeof(EbMemoryChunk) + MEMORY_CHUNK_ALIGN + size;
+    EbMemoryChunk  *chunk_ptr;
+
+    if (total_size != (size_t)total_size)
+        return NULL;
+    if (arena_ptr->numa_node != -1)
+        chunk_ptr = (EbMemoryChunk*)node_alloc(total_size, arena_ptr->numa_node);
+    else
+        chunk_ptr = (EbMemoryChunk*)(zero ? calloc(1, (size_t)total_size) : malloc((size_t)total_size));
+    if (chunk_ptr == NULL)
+        return NULL;
+
+    chunk_ptr->size = total_size;
+    chunk_ptr->node_mapped = arena_ptr->numa_node != -1 ? EB_TRUE : EB_FALSE;
+    chunk_ptr->prev_chunk = arena_ptr->chunk_list;
+    arena_ptr->chunk_list = chunk_ptr;
+
+    arena_ptr->footprint.reserved_size += total_size;
+    arena_ptr->footprint.chunk_count++;
+
+    return ALIGN_PTR(chunk_ptr + 1, MEMORY_CHUNK_ALIGN);
+}
+
+/***************************************
+ * eb_memory_arena_alloc
+ *   Backs EB_MALLOC, EB_CALLOC and
+ *   EB_ALLIGN_MALLOC. alignment is a
+ *   power of 2 up to 64.
+ ***************************************/
+EbPtr eb_memory_arena_alloc(
+    size_t          size,
+    size_t          alignment,
+    EbBool          zero)
+{
+    EbMemoryArena  *arena_ptr = current_arena_ptr;
+    uint8_t        *block_ptr;
+    EbBool          zeroed = EB_FALSE;
+
+    if (arena_ptr == NULL)
+        return NULL;
+
+    eb_block_on_mutex(arena_ptr->mutex);
+
+    // The alignment may take the block past the end of the chunk
+    block_ptr = ALIGN_PTR(arena_ptr->chunk_free_ptr, alignment);
+    if (arena_ptr->chunk_free_ptr == NULL || block_ptr > arena_ptr->chunk_end_ptr ||
+        size > (size_t)(arena_ptr->chunk_end_ptr - block_ptr)) {
+        if (size > MEMORY_BLOCK_MAX_SIZE(arena_ptr->chunk_size)) {
+            // Calloc leaves the zeroing of large blocks to the system, the
+            // pages of a node come zeroed
+            block_ptr = new_chunk(arena_ptr, size, zero);
+            zeroed = zero || arena_ptr->numa_node != -1;
+        }
+        else {
+            // Grow the chunks with the arena, to keep their count low
+            arena_ptr->chunk_size = MAX(arena_ptr->chunk_size, MIN(arena_ptr->footprint.reserved_size >> 2, MEMORY_CHUNK_MAX_SIZE));
+            block_ptr = new_chunk(arena_ptr, arena_ptr->chunk_size, EB_FALSE);
+            if (block_ptr) {
+                arena_ptr->chunk_end_ptr = block_ptr + arena_ptr->chunk_size;
+                arena_ptr->chunk_free_ptr = block_ptr + size;
+            }
+        }
+    }
+    else
+        arena_ptr->chunk_free_ptr = block_ptr + size;
+
+    if (block_ptr) {
+        arena_ptr->footprint.allocated_size += size;
+        arena_ptr->footprint.allocation_count++;
+    }
+
+    eb_release_mutex(arena_ptr->mutex);
+
+    if (block_ptr && zero && !zeroed)
+        memset(block_ptr, 0, size);
+    return block_ptr;
+}
+
+/***************************************
+ * eb_memory_arena_add_object
+ *   Backs EB_CREATETHREAD,
+ *   EB_CREATESEMAPHORE and
+ *   EB_CREATEMUTEX
+ ***************************************/
+EbErrorType eb_memory_arena_add_object(
+    EbPtr           object_ptr,
+    EbPtrType       ptr_type)
+{
+    EbMemoryArena    *arena_ptr = current_arena_ptr;
+    EbMemoryMapEntry *node = (EbMemoryMapEntry*)eb_memory_arena_alloc(sizeof(EbMemoryMapEntry), sizeof(EbPtr), EB_FALSE);
+
+    if (node == NULL)
+        return EB_ErrorInsufficientResources;
+    node->ptr = object_ptr;
+    node->ptr_type = ptr_type;
+
+    eb_block_on_mutex(arena_ptr->mutex);
+    node->prev_entry = arena_ptr->memory_map;
+    arena_ptr->memory_map = node;
+    if (ptr_type == EB_THREAD)
+        arena_ptr->footprint.thread_count++;
+    else if (ptr_type == EB_SEMAPHORE)
+        arena_ptr->footprint.semaphore_count++;
+    else if (ptr_type == EB_MUTEX || ptr_type == EB_COND_VAR)
+        arena_ptr->footprint.mutex_count++;
+    eb_release_mutex(arena_ptr->mutex);
+
+    return EB_ErrorNone;
+}
+
+EbErrorType eb_memory_arena_ctor(
+    EbMemoryArena **arena_dbl_ptr)
+{
+    EbMemoryArena *arena_ptr = (EbMemoryArena*)calloc(1, sizeof(EbMemoryArena));
+
+    *arena_dbl_ptr = arena_ptr;
+    if (arena_ptr == NULL)
+        return EB_ErrorInsufficientResources;
+
+    arena_ptr->mutex = eb_create_mutex();
+    if (arena_ptr->mutex == NULL) {
+        free(arena_ptr);
+        *arena_dbl_ptr = NULL;
+        return EB_ErrorInsufficientResources;
+    }
+    arena_ptr->chunk_size = MEMORY_CHUNK_MIN_SIZE;
+    arena_ptr->numa_node = -1;
+
+    return EB_ErrorNone;
+}
+
+void eb_memory_arena_dtor(
+    EbMemoryArena  *arena_ptr)
+{
+    EbMemoryMapEntry *node;
+    EbMemoryChunk    *chunk_ptr;
+
+    if (arena_ptr == NULL)
+        return;
+
+    // The threads go first, they may be using everything else
+    for (node = arena_ptr->memory_map; node; node = (EbMemoryMapEntry*)node->prev_entry) {
+        switch (node->ptr_type) {
+        case EB_THREAD:
+            eb_destroy_thread(node->ptr);
+            break;
+        case EB_SEMAPHORE:
+            eb_destroy_semaphore(node->ptr);
+            break;
+        case EB_MUTEX:
+            eb_destroy_mutex(node->ptr);
+            break;
+        case EB_COND_VAR:
+            eb_destroy_cond_var(node->ptr);
+            break;
+        default:
+            break;
+        }
+    }
+
+    chunk_ptr = arena_ptr->chunk_list;
+    while (chunk_ptr) {
+        EbMemoryChunk *prev_chunk_ptr = chunk_ptr->prev_chunk;
+        if (chunk_ptr->node_mapped)
+            node_free(chunk_ptr);
+        else
+            free(chunk_ptr);
+        chunk_ptr = prev_chunk_ptr;
+    }
+
+    if (current_arena_ptr == arena_ptr)
+        current_arena_ptr = NULL;
+    eb_destroy_mutex(arena_ptr->mutex);
+    free(arena_ptr);
+}
+
+void eb_memory_arena_set_current(
+    EbMemoryArena  *arena_ptr)
+{
+    current_arena_ptr = arena_ptr;
+}
+
+EbMemoryArena *eb_memory_arena_get_current(
+    void)
+{
+    return current_arena_ptr;
+}
+
+void eb_memory_arena_set_numa_node(
+    EbMemoryArena  *arena_ptr,
+    int32_t         numa_node)
+{
+    eb_block_on_mutex(arena_ptr->mutex);
+    arena_ptr->numa_node = numa_node;
+    // The next blocks go to a new chunk, on the node
+    arena_ptr->chunk_free_ptr = NULL;
+    arena_ptr->chunk_end_ptr = NULL;
+    eb_release_mutex(arena_ptr->mutex);
+}
+
+void eb_memory_arena_get_footprint(
+    EbMemoryArena     *arena_ptr,
+    EbMemoryFootprint *footprint_ptr)
+{
+    eb_block_on_mutex(arena_ptr->mutex);
+    *footprint_ptr = arena_ptr->footprint;
+    eb_release_mutex(arena_ptr->mutex);
+}
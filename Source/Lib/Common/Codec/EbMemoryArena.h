@@ -0,0 +1,81 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbMemoryArena_h
+#define EbMemoryArena_h
+
+#include "EbDefinitions.h"
+#include "EbSvtAv1Enc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    /**************************************
+     * Memory Arena
+     *   Owns all the memory and OS objects
+     *   of one encoder instance. The blocks
+     *   of EB_MALLOC, EB_CALLOC and
+     *   EB_ALLIGN_MALLOC are carved out of
+     *   large chunks, the threads, semaphores
+     *   and mutexes are kept in a memory map.
+     *   Nothing is freed before the arena is.
+     **************************************/
+    typedef struct EbMemoryChunk {
+        struct EbMemoryChunk *prev_chunk;
+        uint64_t              size;
+        // Pages mapped on a NUMA node, not malloc'd
+        EbBool                node_mapped;
+    } EbMemoryChunk;
+
+    typedef struct EbMemoryArena {
+        // Serializes the allocations, the kernel threads allocate while running
+        EbHandle              mutex;
+
+        // Free space of the current chunk, blocks too large for it get a chunk
+        // of their own
+        EbMemoryChunk        *chunk_list;
+        uint8_t              *chunk_free_ptr;
+        uint8_t              *chunk_end_ptr;
+        uint64_t              chunk_size;
+
+        // Node the chunks are placed on, -1 for the default policy
+        int32_t               numa_node;
+
+        // Threads, semaphores and mutexes, the newest first
+        EbMemoryMapEntry     *memory_map;
+
+        EbMemoryFootprint     footprint;
+    } EbMemoryArena;
+
+    extern EbErrorType eb_memory_arena_ctor(
+        EbMemoryArena **arena_dbl_ptr);
+
+    /* Destroys the threads, semaphores and mutexes of the arena, newest
+       first, then frees all its memory at once */
+    extern void eb_memory_arena_dtor(
+        EbMemoryArena  *arena_ptr);
+
+    /* The arena the EB_ macros of the calling thread allocate from. The
+       threads created by eb_create_thread start with the arena of their
+       creator. */
+    extern void eb_memory_arena_set_current(
+        EbMemoryArena  *arena_ptr);
+
+    extern EbMemoryArena *eb_memory_arena_get_current(
+        void);
+
+    /* Places the chunks allocated from now on on the memory of numa_node,
+       -1 going back to the default policy */
+    extern void eb_memory_arena_set_numa_node(
+        EbMemoryArena  *arena_ptr,
+        int32_t         numa_node);
+
+    extern void eb_memory_arena_get_footprint(
+        EbMemoryArena     *arena_ptr,
+        EbMemoryFootprint *footprint_ptr);
+#ifdef __cplusplus
+}
+#endif
+#endif // EbMemoryArena_h
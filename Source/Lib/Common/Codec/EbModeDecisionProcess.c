@@ -8,6 +8,7 @@
 #include "EbUtility.h"
 #include "EbModeDecisionProcess.h"
 #include "EbLambdaRateTables.h"
+#include "EbSegmentation.h"
 
 /******************************************************
  * Mode Decision Context Constructor
@@ -382,7 +383,7 @@ void mode_decision_configure_lcu(
     //Disable Lambda update per LCU
 
     //RC is off
-    if (sequence_control_set_ptr->static_config.rate_control_mode == 0 && sequence_control_set_ptr->static_config.improve_sharpness == 0) {
+    if (rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->static_config.improve_sharpness == 0) {
         context_ptr->qp = (uint8_t)picture_qp;
         sb_ptr->qp = (uint8_t)context_ptr->qp;
     }
@@ -398,6 +399,14 @@ void mode_decision_configure_lcu(
     // Lambda Assignement
     context_ptr->qp_index = (uint8_t)picture_control_set_ptr->parent_pcs_ptr->base_qindex;
 
+    // The blocks of the SB are decided at the QP of the segment of the SB
+    context_ptr->sb_segment_id = 0;
+    if (picture_control_set_ptr->parent_pcs_ptr->segmentation_params.segmentation_enabled &&
+        sequence_control_set_ptr->static_config.enable_adaptive_quantization == 2) {
+        context_ptr->sb_segment_id = get_sb_segment_id(picture_control_set_ptr->parent_pcs_ptr, sb_ptr->index);
+        context_ptr->qp_index += picture_control_set_ptr->parent_pcs_ptr->segmentation_params.feature_data[context_ptr->sb_segment_id][SEG_LVL_ALT_Q];
+    }
+
     (*av1_lambda_assignment_function_table[picture_control_set_ptr->parent_pcs_ptr->pred_structure])(
         &context_ptr->fast_lambda,
         &context_ptr->full_lambda,
@@ -163,6 +163,7 @@ extern "C" {
         uint32_t                        full_recon_search_count;
         EbBool                          cu_use_ref_src_flag;
         uint16_t                        qp_index;
+        uint8_t                         sb_segment_id; // segment of all the blocks of the SB with adaptive quantization 2
         uint64_t                        three_quad_energy;
         EbBool                          uv_search_path;
         UvPredictionMode                best_uv_mode    [UV_PAETH_PRED + 1][(MAX_ANGLE_DELTA << 1) + 1];
@@ -25,6 +25,9 @@
 #include "EbLambdaRateTables.h"
 #include "EbPictureOperators.h"
 #define OIS_TH_COUNT 4
+// Reduction of the HME level 0 search area in each direction around the
+// center found by the lead of a ladder
+#define LADDER_HME_LEVEL0_AREA_DIVISOR 4
 
 int32_t OisPointTh[3][MAX_TEMPORAL_LAYERS][OIS_TH_COUNT] = {
     {// Light OIS
@@ -13387,6 +13390,16 @@ EbErrorType motion_estimate_lcu(
     EbAsm asm_type = sequence_control_set_ptr->encode_context_ptr->asm_type;
     uint64_t i;
 
+    // Ladder analysis, recorded by a lead or seeding the HME of a rendition
+    LadderAnalysis *ladder_analysis_ptr =
+        (context_ptr->me_alt_ref == EB_TRUE || picture_control_set_ptr->is_overlay)
+            ? (LadderAnalysis *)EB_NULL
+            : sequence_control_set_ptr->encode_context_ptr->ladder_analysis;
+    EbBool ladder_lead = sequence_control_set_ptr->encode_context_ptr->ladder_lead;
+    EbBool ladder_seeded = EB_FALSE;
+    uint32_t hme_level0_area_multiplier_x;
+    uint32_t hme_level0_area_multiplier_y;
+
     int16_t hmeLevel1SearchAreaInWidth;
     int16_t hmeLevel1SearchAreaInHeight;
     // Configure HME level 0, level 1 and level 2 from static config parameters
@@ -13477,9 +13490,42 @@ EbErrorType motion_estimate_lcu(
                 (EbPictureBufferDesc*)referenceObject->sixteenth_decimated_picture_ptr;
             if (picture_control_set_ptr->temporal_layer_index > 0 ||
                 listIndex == 0) {
+                // The HME of a rendition starts from the scaled HME of the
+                // lead when it searched the same reference
+                ladder_seeded =
+                    (ladder_analysis_ptr && !ladder_lead)
+                        ? ladder_analysis_get_search_center(
+                              ladder_analysis_ptr,
+                              picture_control_set_ptr->picture_number,
+                              listIndex,
+                              ref_pic_index,
+                              picture_control_set_ptr
+                                  ->ref_pic_poc_array[listIndex][ref_pic_index],
+                              (uint16_t)picture_width,
+                              (uint16_t)picture_height,
+                              sb_origin_x,
+                              sb_origin_y,
+                              sb_width,
+                              sb_height,
+                              &x_search_center,
+                              &y_search_center)
+                        : EB_FALSE;
+                // Fall back to (0,0) when the scaled center does not fit this
+                // resolution
+                if (ladder_seeded && (x_search_center != 0 || y_search_center != 0))
+                    CheckZeroZeroCenter(refPicPtr,
+                                        context_ptr,
+                                        sb_origin_x,
+                                        sb_origin_y,
+                                        sb_width,
+                                        sb_height,
+                                        &x_search_center,
+                                        &y_search_center,
+                                        asm_type);
+
                 // A - The MV center for Tier0 search could be either (0,0), or
                 // HME A - Set HME MV Center
-                if (context_ptr->update_hme_search_center_flag)
+                if (context_ptr->update_hme_search_center_flag && !ladder_seeded)
                     hme_mv_center_check(refPicPtr,
                                         context_ptr,
                                         &x_search_center,
@@ -13490,7 +13536,7 @@ EbErrorType motion_estimate_lcu(
                                         sb_width,
                                         sb_height,
                                         asm_type);
-                else {
+                else if (!ladder_seeded) {
                     x_search_center = 0;
                     y_search_center = 0;
                 }
@@ -13534,8 +13580,18 @@ EbErrorType motion_estimate_lcu(
                         searchRegionNumberInHeight++;
                     }
 
-                    // HME: Level0 search
-
+                    // HME: Level0 search, narrowed around the center of the
+                    // lead for a rendition of a ladder
+                    hme_level0_area_multiplier_x = hme_level_0_search_area_multiplier_x
+                        [picture_control_set_ptr->hierarchical_levels]
+                        [picture_control_set_ptr->temporal_layer_index];
+                    hme_level0_area_multiplier_y = hme_level_0_search_area_multiplier_y
+                        [picture_control_set_ptr->hierarchical_levels]
+                        [picture_control_set_ptr->temporal_layer_index];
+                    if (ladder_seeded) {
+                        hme_level0_area_multiplier_x /= LADDER_HME_LEVEL0_AREA_DIVISOR;
+                        hme_level0_area_multiplier_y /= LADDER_HME_LEVEL0_AREA_DIVISOR;
+                    }
                     if (enable_hme_level0_flag) {
                         if (oneQuadrantHME && !enable_hme_level1_flag &&
                             !enable_hme_level2_flag) {
@@ -13560,16 +13616,8 @@ EbErrorType motion_estimate_lcu(
                                 &(yHmeLevel0SearchCenter
                                       [searchRegionNumberInWidth]
                                       [searchRegionNumberInHeight]),
-                                hme_level_0_search_area_multiplier_x
-                                    [picture_control_set_ptr
-                                         ->hierarchical_levels]
-                                    [picture_control_set_ptr
-                                         ->temporal_layer_index],
-                                hme_level_0_search_area_multiplier_y
-                                    [picture_control_set_ptr
-                                         ->hierarchical_levels]
-                                    [picture_control_set_ptr
-                                         ->temporal_layer_index],
+                                hme_level0_area_multiplier_x,
+                                hme_level0_area_multiplier_y,
                                 asm_type);
                         } else {
                             searchRegionNumberInHeight = 0;
@@ -13604,16 +13652,8 @@ EbErrorType motion_estimate_lcu(
                                             &(yHmeLevel0SearchCenter
                                                   [searchRegionNumberInWidth]
                                                   [searchRegionNumberInHeight]),
-                                            hme_level_0_search_area_multiplier_x
-                                                [picture_control_set_ptr
-                                                     ->hierarchical_levels]
-                                                [picture_control_set_ptr
-                                                     ->temporal_layer_index],
-                                            hme_level_0_search_area_multiplier_y
-                                                [picture_control_set_ptr
-                                                     ->hierarchical_levels]
-                                                [picture_control_set_ptr
-                                                     ->temporal_layer_index],
+                                            hme_level0_area_multiplier_x,
+                                            hme_level0_area_multiplier_y,
                                             asm_type);
 
                                         searchRegionNumberInWidth++;
@@ -13970,6 +14010,14 @@ EbErrorType motion_estimate_lcu(
                 x_search_center = 0;
                 y_search_center = 0;
             }
+            if (ladder_analysis_ptr && ladder_lead)
+                ladder_analysis_record(ladder_analysis_ptr,
+                                       picture_control_set_ptr->picture_number,
+                                       sb_index,
+                                       listIndex,
+                                       ref_pic_index,
+                                       x_search_center,
+                                       y_search_center);
             // Constrain x_ME to be a multiple of 8 (round up)
             search_area_width = (context_ptr->search_area_width + 7) & ~0x07;
             search_area_height = context_ptr->search_area_height;
@@ -587,6 +587,8 @@ void* motion_estimation_kernel(void *input_ptr)
 
     uint32_t                      intra_sad_interval_index;
 
+    LadderAnalysis               *ladder_analysis_ptr;
+
     EbAsm                      asm_type;
     MdRateEstimationContext   *md_rate_estimation_array;
 
@@ -656,7 +658,12 @@ void* motion_estimation_kernel(void *input_ptr)
             yLcuStartIndex = SEGMENT_START_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
             yLcuEndIndex = SEGMENT_END_IDX(ySegmentIndex, picture_height_in_sb, picture_control_set_ptr->me_segments_row_count);
             // *** MOTION ESTIMATION CODE ***
-            if (picture_control_set_ptr->slice_type != I_SLICE) {
+            // The renditions of a ladder start from the HME of the lead
+            ladder_analysis_ptr = picture_control_set_ptr->is_overlay ? (LadderAnalysis*)EB_NULL : sequence_control_set_ptr->encode_context_ptr->ladder_analysis;
+            if (ladder_analysis_ptr && !sequence_control_set_ptr->encode_context_ptr->ladder_lead && picture_control_set_ptr->slice_type != I_SLICE)
+                ladder_analysis_wait(ladder_analysis_ptr, picture_control_set_ptr->picture_number);
+
+            if (picture_control_set_ptr->slice_type != I_SLICE && !picture_control_set_ptr->me_hints_imported) {
                 // SB Loop
                 for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
                     for (x_lcu_index = xLcuStartIndex; x_lcu_index < xLcuEndIndex; ++x_lcu_index) {
@@ -734,7 +741,15 @@ void* motion_estimation_kernel(void *input_ptr)
                     }
                 }
             }
-        if ( picture_control_set_ptr->intra_pred_mode > 4)
+            if (ladder_analysis_ptr && sequence_control_set_ptr->encode_context_ptr->ladder_lead)
+                ladder_analysis_publish(
+                    ladder_analysis_ptr,
+                    picture_control_set_ptr->picture_number,
+                    picture_control_set_ptr->ref_pic_poc_array,
+                    picture_control_set_ptr->slice_type == I_SLICE ? 0 : picture_control_set_ptr->ref_list0_count,
+                    picture_control_set_ptr->slice_type == B_SLICE ? picture_control_set_ptr->ref_list1_count : 0,
+                    picture_control_set_ptr->me_segments_total_count);
+        if ( picture_control_set_ptr->intra_pred_mode > 4 && !picture_control_set_ptr->ois_hints_imported)
                 // *** OPEN LOOP INTRA CANDIDATE SEARCH CODE ***
             {
                 // SB Loop
@@ -779,7 +794,7 @@ void* motion_estimation_kernel(void *input_ptr)
 
             eb_block_on_mutex(picture_control_set_ptr->rc_distortion_histogram_mutex);
 
-            if (sequence_control_set_ptr->static_config.rate_control_mode) {
+            if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode)) {
                 if (picture_control_set_ptr->slice_type != I_SLICE) {
                     uint16_t sadIntervalIndex;
                     for (y_lcu_index = yLcuStartIndex; y_lcu_index < yLcuEndIndex; ++y_lcu_index) {
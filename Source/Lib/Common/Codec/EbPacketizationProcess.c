@@ -15,6 +15,8 @@
 #include "EbRateControlTasks.h"
 #include "EbTime.h"
 #include "EbModeDecisionProcess.h"
+#include "EbSvtAv1ErrorCodes.h"
+#include "RateControlTwoPass.h"
 
 #define DETAILED_FRAME_OUTPUT 0
 
@@ -82,6 +84,33 @@ static void write_td (
     }
 }
 
+// Gets the payload of the packet from the application packet allocator, with
+// room for the show existing frame header and the TDs added later on
+static void alloc_ext_packet_buffer(
+    EncodeContext        *encode_context_ptr,
+    EbBufferHeaderType   *out_str_ptr,
+    Bitstream            *bitstream_ptr,
+    EbBool                has_show_existing,
+    EbBool                has_tiles){
+    EbExtFrameBuf       *ext_buf = &((EbOutputStreamBuffer*)out_str_ptr)->ext_buf;
+    OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit*)bitstream_ptr->output_bitstream_ptr;
+    uint32_t             min_size = (uint32_t)(output_bitstream_ptr->buffer_av1 - output_bitstream_ptr->buffer_begin_av1);
+
+    if (has_show_existing)
+        min_size += has_tiles ? OBU_FRAME_HEADER_SIZE + TILES_GROUP_SIZE : OBU_FRAME_HEADER_SIZE;
+    // write_td needs one spare byte
+    min_size += 2 * TD_SIZE + 1;
+
+    CHECK_REPORT_ERROR(
+        (encode_context_ptr->packet_alloc_cb(ext_buf, min_size, encode_context_ptr->packet_buf_priv_ptr) == 0 &&
+         ext_buf->buffer != NULL && ext_buf->buffer_size >= min_size),
+        encode_context_ptr->app_callback_ptr,
+        EB_ENC_PACKETIZATION_ERROR6);
+
+    out_str_ptr->p_buffer = ext_buf->buffer;
+    out_str_ptr->n_alloc_len = ext_buf->buffer_size;
+}
+
 void update_rc_rate_tables(
     PictureControlSet            *picture_control_set_ptr,
     SequenceControlSet           *sequence_control_set_ptr) {
@@ -97,7 +126,7 @@ void update_rc_rate_tables(
     int32_t   qp_index;
 
     // LCU Loop
-    if (sequence_control_set_ptr->static_config.rate_control_mode > 0) {
+    if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode)) {
         uint64_t  sadBits[NUMBER_OF_SAD_INTERVALS] = { 0 };
         uint32_t  count[NUMBER_OF_SAD_INTERVALS] = { 0 };
 
@@ -325,6 +354,15 @@ void* packetization_kernel(void *input_ptr)
             picture_control_set_ptr,
             0);
 
+        if (encode_context_ptr->packet_alloc_cb) {
+            alloc_ext_packet_buffer(
+                encode_context_ptr,
+                output_stream_ptr,
+                picture_control_set_ptr->bitstream_ptr,
+                picture_control_set_ptr->parent_pcs_ptr->has_show_existing,
+                (EbBool)(sequence_control_set_ptr->static_config.tile_columns || sequence_control_set_ptr->static_config.tile_rows));
+        }
+
         // Copy Slice Header to the Output Bitstream
         copy_rbsp_bitstream_to_payload(
             picture_control_set_ptr->bitstream_ptr,
@@ -356,6 +394,9 @@ void* packetization_kernel(void *input_ptr)
         // Send the number of bytes per frame to RC
         picture_control_set_ptr->parent_pcs_ptr->total_num_bits = output_stream_ptr->n_filled_len << 3;
         queueEntryPtr->total_num_bits = picture_control_set_ptr->parent_pcs_ptr->total_num_bits;
+        // Keep the statistics of the picture for the second pass
+        if (sequence_control_set_ptr->static_config.pass == 1)
+            first_pass_stats_record(encode_context_ptr->first_pass_stats, picture_control_set_ptr->parent_pcs_ptr);
         // update the rate tables used in RC based on the encoded bits of each sb
         update_rc_rate_tables(
             picture_control_set_ptr,
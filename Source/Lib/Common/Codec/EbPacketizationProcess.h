@@ -7,6 +7,7 @@
 #define EbPacketization_h
 
 #include "EbDefinitions.h"
+#include "EbSvtAv1Enc.h"
 #include "EbSystemResourceManager.h"
 #ifdef __cplusplus
 extern "C" {
@@ -21,6 +22,17 @@ extern "C" {
         uint8_t constrained_flag;
     } EbPPSConfig;
 
+    /**************************************
+     * Output stream buffer
+     **************************************/
+    // The header comes first, it is what eb_svt_get_packet hands out. ext_buf
+    // holds the payload from the application packet allocator, if set.
+    typedef struct EbOutputStreamBuffer
+    {
+        EbBufferHeaderType header;
+        EbExtFrameBuf      ext_buf;
+    } EbOutputStreamBuffer;
+
     /**************************************
      * Context
      **************************************/
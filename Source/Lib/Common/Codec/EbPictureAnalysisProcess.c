@@ -3829,7 +3829,7 @@ EbErrorType QuarterSampleDenoise(
     if (denoise_flag == EB_TRUE) {
         // Turn OFF the de-noiser for Class 2 at QP=29 and lower (for Fixed_QP) and at the target rate of 14Mbps and higher (for RC=ON)
         if ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_3_1) ||
-            ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_2) && ((sequence_control_set_ptr->static_config.rate_control_mode == 0 && sequence_control_set_ptr->qp > DENOISER_QP_TH) || (sequence_control_set_ptr->static_config.rate_control_mode != 0 && sequence_control_set_ptr->static_config.target_bit_rate < DENOISER_BITRATE_TH)))) {
+            ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_2) && ((rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->qp > DENOISER_QP_TH) || (!rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->static_config.target_bit_rate < DENOISER_BITRATE_TH)))) {
             SubSampleFilterNoise(
                 sequence_control_set_ptr,
                 picture_control_set_ptr,
@@ -3889,7 +3889,7 @@ EbErrorType SubSampleDenoise(
     if (denoise_flag == EB_TRUE) {
         // Turn OFF the de-noiser for Class 2 at QP=29 and lower (for Fixed_QP) and at the target rate of 14Mbps and higher (for RC=ON)
         if ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_3_1) ||
-            ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_2) && ((sequence_control_set_ptr->static_config.rate_control_mode == 0 && sequence_control_set_ptr->qp > DENOISER_QP_TH) || (sequence_control_set_ptr->static_config.rate_control_mode != 0 && sequence_control_set_ptr->static_config.target_bit_rate < DENOISER_BITRATE_TH)))) {
+            ((picture_control_set_ptr->pic_noise_class == PIC_NOISE_CLASS_2) && ((rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->qp > DENOISER_QP_TH) || (!rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) && sequence_control_set_ptr->static_config.target_bit_rate < DENOISER_BITRATE_TH)))) {
             SubSampleFilterNoise(
                 sequence_control_set_ptr,
                 picture_control_set_ptr,
@@ -4913,13 +4913,6 @@ void* picture_analysis_kernel(void *input_ptr)
             }
             else // off / on
                 picture_control_set_ptr->sc_content_detected = sequence_control_set_ptr->static_config.screen_content_mode;
-
-            // Hold the 64x64 variance and mean in the reference frame
-            uint32_t sb_index;
-            for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
-                paReferenceObject->variance[sb_index] = picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64];
-                paReferenceObject->y_mean[sb_index] = picture_control_set_ptr->y_mean[sb_index][ME_TIER_ZERO_PU_64x64];
-            }
         }
         // Get Empty Results Object
         eb_get_empty_object(
@@ -100,6 +100,169 @@ EbErrorType me_sb_results_ctor(
     //objectPtr->lcuDistortion = 0;
     return EB_ErrorNone;
 }
+static EbErrorType entropy_tile_info_ctor(
+    EntropyTileInfo      **info_dbl_ptr,
+    EntropyCoder          *entropy_coder_ptr,
+    uint32_t               entropy_buffer_size,
+    uint32_t               neighbor_array_width,
+    uint32_t               neighbor_array_height)
+{
+    EntropyTileInfo *info_ptr;
+    EbErrorType return_error = EB_ErrorNone;
+
+    EB_MALLOC(EntropyTileInfo*, info_ptr, sizeof(EntropyTileInfo), EB_N_PTR);
+    *info_dbl_ptr = info_ptr;
+
+    // Entropy Coder, the first tile codes directly in the picture one
+    if (entropy_coder_ptr)
+        info_ptr->entropy_coder_ptr = entropy_coder_ptr;
+    else {
+        return_error = entropy_coder_ctor(
+            &info_ptr->entropy_coder_ptr,
+            entropy_buffer_size);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+
+    // Entropy Coding Neighbor Arrays
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->mode_type_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->partition_context_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(struct PartitionContext),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->skip_flag_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->skip_coeff_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    // for each 4x4
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->luma_dc_sign_level_coeff_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    // for each 4x4
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->cr_dc_sign_level_coeff_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    // for each 4x4
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->cb_dc_sign_level_coeff_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->inter_pred_dir_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->ref_frame_type_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor32(
+        &info_ptr->interpolation_type_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint32_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->intra_luma_mode_neighbor_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(uint8_t),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+
+    return_error = neighbor_array_unit_ctor(
+        &info_ptr->txfm_context_array,
+        neighbor_array_width,
+        neighbor_array_height,
+        sizeof(TXFM_CONTEXT),
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        PU_NEIGHBOR_ARRAY_GRANULARITY,
+        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+
+    return EB_ErrorNone;
+}
+
 EbErrorType picture_control_set_ctor(
     EbPtr *object_dbl_ptr,
     EbPtr object_init_data_ptr)
@@ -116,6 +279,11 @@ EbErrorType picture_control_set_ctor(
     // LCUs
     const uint16_t pictureLcuWidth = (uint16_t)((initDataPtr->picture_width + initDataPtr->sb_sz - 1) / initDataPtr->sb_sz);
     const uint16_t pictureLcuHeight = (uint16_t)((initDataPtr->picture_height + initDataPtr->sb_sz - 1) / initDataPtr->sb_sz);
+    // Neighbor arrays span the picture in whole SBs, plus one SB for the
+    // above-right and below-left samples read past its right and bottom edges
+    const uint32_t neighbor_sb_size = MAX(initDataPtr->sb_sz, initDataPtr->sb_size_pix);
+    const uint32_t neighbor_array_width = ((initDataPtr->picture_width + neighbor_sb_size - 1) / neighbor_sb_size + 1) * neighbor_sb_size;
+    const uint32_t neighbor_array_height = ((initDataPtr->picture_height + neighbor_sb_size - 1) / neighbor_sb_size + 1) * neighbor_sb_size;
     uint16_t sb_index;
     uint16_t sb_origin_x;
     uint16_t sb_origin_y;
@@ -274,6 +442,8 @@ EbErrorType picture_control_set_ctor(
         EB_MALLOC(FRAME_CONTEXT*, object_ptr->ec_ctx_array, sizeof(FRAME_CONTEXT) * all_sb, EB_N_PTR);
         EB_MALLOC(MdRateEstimationContext*, object_ptr->rate_est_array, sizeof(MdRateEstimationContext) * all_sb, EB_N_PTR);
     }
+    // Entropy coding rows, plus the one past the last row read by the row scan
+    EB_CALLOC(EbBool*, object_ptr->entropy_coding_row_array, pictureLcuHeight + 1, sizeof(EbBool), EB_N_PTR);
     // Mode Decision Control config
     EB_MALLOC(MdcLcuData*, object_ptr->mdc_sb_array, object_ptr->sb_total_count * sizeof(MdcLcuData), EB_N_PTR);
     object_ptr->qp_array_stride = (uint16_t)((initDataPtr->picture_width + MIN_BLOCK_SIZE - 1) / MIN_BLOCK_SIZE);
@@ -287,8 +457,8 @@ EbErrorType picture_control_set_ctor(
     for (depth = 0; depth < NEIGHBOR_ARRAY_TOTAL_COUNT; depth++) {
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_intra_luma_mode_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -296,8 +466,8 @@ EbErrorType picture_control_set_ctor(
 
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_intra_chroma_mode_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-            MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+            neighbor_array_width >> subsampling_x,
+            neighbor_array_height >> subsampling_y,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -307,8 +477,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_mv_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(MvUnit),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -318,8 +488,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_skip_flag_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -329,8 +499,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_mode_type_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -340,8 +510,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_leaf_depth_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -351,8 +521,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->mdleaf_partition_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(struct PartitionContext),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -362,8 +532,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_luma_recon_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -372,8 +542,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_tx_depth_1_luma_recon_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -383,8 +553,8 @@ EbErrorType picture_control_set_ctor(
 
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_cb_recon_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-            MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+            neighbor_array_width >> subsampling_x,
+            neighbor_array_height >> subsampling_y,
             sizeof(uint8_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -394,8 +564,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_cr_recon_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-            MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+            neighbor_array_width >> subsampling_x,
+            neighbor_array_height >> subsampling_y,
             sizeof(uint8_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -404,8 +574,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_skip_coeff_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -416,8 +586,8 @@ EbErrorType picture_control_set_ctor(
         // for each 4x4
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_luma_dc_sign_level_coeff_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -428,8 +598,8 @@ EbErrorType picture_control_set_ctor(
         // for each 4x4
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_tx_depth_1_luma_dc_sign_level_coeff_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -440,8 +610,8 @@ EbErrorType picture_control_set_ctor(
         // for each 4x4
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_cr_dc_sign_level_coeff_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -452,8 +622,8 @@ EbErrorType picture_control_set_ctor(
         // for each 4x4
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_cb_dc_sign_level_coeff_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -463,8 +633,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_txfm_context_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(TXFM_CONTEXT),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -475,8 +645,8 @@ EbErrorType picture_control_set_ctor(
 
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_inter_pred_dir_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -486,8 +656,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->md_ref_frame_type_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -495,8 +665,8 @@ EbErrorType picture_control_set_ctor(
 
         return_error = neighbor_array_unit_ctor32(
             &object_ptr->md_interpolation_type_neighbor_array[depth],
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint32_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -508,8 +678,8 @@ EbErrorType picture_control_set_ctor(
     // Encode Pass Neighbor Arrays
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_intra_luma_mode_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -518,8 +688,8 @@ EbErrorType picture_control_set_ctor(
     // Encode Pass Neighbor Arrays
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_intra_chroma_mode_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-        MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+        neighbor_array_width >> subsampling_x,
+        neighbor_array_height >> subsampling_y,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -529,8 +699,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_mv_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(MvUnit),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -540,8 +710,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_skip_flag_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         CU_NEIGHBOR_ARRAY_GRANULARITY,
         CU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -551,8 +721,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_mode_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -562,8 +732,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_leaf_depth_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -573,8 +743,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_luma_recon_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -584,8 +754,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_cb_recon_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-        MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+        neighbor_array_width >> subsampling_x,
+        neighbor_array_height >> subsampling_y,
         sizeof(uint8_t),
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -595,8 +765,8 @@ EbErrorType picture_control_set_ctor(
         return EB_ErrorInsufficientResources;
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_cr_recon_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-        MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+        neighbor_array_width >> subsampling_x,
+        neighbor_array_height >> subsampling_y,
         sizeof(uint8_t),
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
         SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -607,8 +777,8 @@ EbErrorType picture_control_set_ctor(
     if (is16bit) {
         return_error = neighbor_array_unit_ctor(
             &object_ptr->ep_luma_recon_neighbor_array16bit,
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint16_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -618,8 +788,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->ep_cb_recon_neighbor_array16bit,
-            MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-            MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+            neighbor_array_width >> subsampling_x,
+            neighbor_array_height >> subsampling_y,
             sizeof(uint16_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -629,8 +799,8 @@ EbErrorType picture_control_set_ctor(
             return EB_ErrorInsufficientResources;
         return_error = neighbor_array_unit_ctor(
             &object_ptr->ep_cr_recon_neighbor_array16bit,
-            MAX_PICTURE_WIDTH_SIZE >> subsampling_x,
-            MAX_PICTURE_HEIGHT_SIZE >> subsampling_y,
+            neighbor_array_width >> subsampling_x,
+            neighbor_array_height >> subsampling_y,
             sizeof(uint16_t),
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
             SAMPLE_NEIGHBOR_ARRAY_GRANULARITY,
@@ -647,8 +817,8 @@ EbErrorType picture_control_set_ctor(
     // for each 4x4
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_luma_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -659,8 +829,8 @@ EbErrorType picture_control_set_ctor(
     // for each 4x4
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_cb_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -671,78 +841,8 @@ EbErrorType picture_control_set_ctor(
     // for each 4x4
     return_error = neighbor_array_unit_ctor(
         &object_ptr->ep_cr_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-
-    // Entropy Coding Neighbor Arrays
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->mode_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->partition_context_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(struct PartitionContext),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->skip_flag_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->skip_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    // for each 4x4
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->luma_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    // for each 4x4
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->cr_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
+        neighbor_array_width,
+        neighbor_array_height,
         sizeof(uint8_t),
         PU_NEIGHBOR_ARRAY_GRANULARITY,
         PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -750,70 +850,22 @@ EbErrorType picture_control_set_ctor(
 
     if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
-    // for each 4x4
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->cb_dc_sign_level_coeff_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
 
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->inter_pred_dir_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->ref_frame_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    return_error = neighbor_array_unit_ctor32(
-        &object_ptr->interpolation_type_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint32_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->intra_luma_mode_neighbor_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(uint8_t),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
-
-    return_error = neighbor_array_unit_ctor(
-        &object_ptr->txfm_context_array,
-        MAX_PICTURE_WIDTH_SIZE,
-        MAX_PICTURE_HEIGHT_SIZE,
-        sizeof(TXFM_CONTEXT),
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        PU_NEIGHBOR_ARRAY_GRANULARITY,
-        NEIGHBOR_ARRAY_UNIT_TOP_AND_LEFT_ONLY_MASK);
-    if (return_error == EB_ErrorInsufficientResources)
-        return EB_ErrorInsufficientResources;
+    // Entropy Coding Tiles, each tile other than the first one has its own
+    // bitstream, sized for its share of the picture
+    object_ptr->entropy_coding_tile_count = (uint16_t)(initDataPtr->tile_row_count * initDataPtr->tile_column_count);
+    object_ptr->entropy_coding_tile_done_count = 0;
+    EB_MALLOC(EntropyTileInfo**, object_ptr->entropy_coding_info, sizeof(EntropyTileInfo*) * object_ptr->entropy_coding_tile_count, EB_N_PTR);
+    for (uint16_t tile_idx = 0; tile_idx < object_ptr->entropy_coding_tile_count; ++tile_idx) {
+        return_error = entropy_tile_info_ctor(
+            &object_ptr->entropy_coding_info[tile_idx],
+            tile_idx == 0 ? object_ptr->entropy_coder_ptr : (EntropyCoder*)EB_NULL,
+            SEGMENT_ENTROPY_BUFFER_SIZE / object_ptr->entropy_coding_tile_count,
+            neighbor_array_width,
+            neighbor_array_height);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
     //Segmentation neighbor arrays
     return_error = segmentation_map_ctor(
             &object_ptr->segmentation_neighbor_map,
@@ -825,8 +877,8 @@ EbErrorType picture_control_set_ctor(
 
     return_error = neighbor_array_unit_ctor(
             &object_ptr->segmentation_id_pred_array,
-            MAX_PICTURE_WIDTH_SIZE,
-            MAX_PICTURE_HEIGHT_SIZE,
+            neighbor_array_width,
+            neighbor_array_height,
             sizeof(uint8_t),
             PU_NEIGHBOR_ARRAY_GRANULARITY,
             PU_NEIGHBOR_ARRAY_GRANULARITY,
@@ -861,6 +913,17 @@ EbErrorType picture_control_set_ctor(
 
     EB_CREATEMUTEX(EbHandle, object_ptr->intra_mutex, sizeof(EbHandle), EB_MUTEX);
 
+    // Deblocking Rows
+    EB_CREATEMUTEX(EbHandle, object_ptr->dlf_mutex, sizeof(EbHandle), EB_MUTEX);
+    EB_CREATESEMAPHORE(EbHandle, object_ptr->dlf_ready_semaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, pictureLcuHeight);
+    object_ptr->dlf_task_arrived_count = 0;
+    object_ptr->dlf_task_done_count = 0;
+    object_ptr->dlf_next_sb_row = 0;
+    object_ptr->fused_loop_filter = EB_FALSE;
+    object_ptr->fused_fb_row_count = 0;
+    EB_MALLOC(uint32_t*, object_ptr->dlf_sb_row_progress, sizeof(uint32_t) * pictureLcuHeight, EB_N_PTR);
+    EB_CREATECONDVAR(EbHandle, object_ptr->dlf_sb_row_cond_var, sizeof(EbHandle), EB_COND_VAR);
+
     EB_CREATEMUTEX(EbHandle, object_ptr->cdef_search_mutex, sizeof(EbHandle), EB_MUTEX);
 
     //object_ptr->mse_seg[0] = (uint64_t(*)[64])aom_malloc(sizeof(**object_ptr->mse_seg) *  pictureLcuWidth * pictureLcuHeight);
@@ -1025,6 +1088,8 @@ EbErrorType picture_parent_control_set_ctor(
     }
 
     EB_MALLOC(uint32_t*, object_ptr->rc_me_distortion, sizeof(uint32_t) * object_ptr->sb_total_count, EB_N_PTR);
+    EB_MALLOC(uint64_t*, object_ptr->tpl_propagate_cost, sizeof(uint64_t) * object_ptr->sb_total_count * TPL_BLOCK_COUNT_PER_SB, EB_N_PTR);
+    EB_MALLOC(uint32_t*, object_ptr->tpl_sb_importance, sizeof(uint32_t) * object_ptr->sb_total_count, EB_N_PTR);
     // ME and OIS Distortion Histograms
     EB_MALLOC(uint16_t*, object_ptr->me_distortion_histogram, sizeof(uint16_t) * NUMBER_OF_SAD_INTERVALS, EB_N_PTR);
     EB_MALLOC(uint16_t*, object_ptr->ois_distortion_histogram, sizeof(uint16_t) * NUMBER_OF_INTRA_SAD_INTERVALS, EB_N_PTR);
@@ -42,6 +42,8 @@ extern "C" {
 #define MAX_NUMBER_OF_REGIONS_IN_WIDTH      4
 #define MAX_NUMBER_OF_REGIONS_IN_HEIGHT     4
 #define MAX_REF_QP_NUM                      81
+#define TPL_BLOCK_COUNT_PER_SB              16 // 16x16 blocks of the temporal dependency model in a 64x64 SB
+#define TPL_IMPORTANCE_PRECISION            8
     // Segment Macros
 #define SEGMENT_MAX_COUNT   64
 #define SEGMENT_COMPLETION_MASK_SET(mask, index)        MULTI_LINE_MACRO_BEGIN (mask) |= (((uint64_t) 1) << (index)); MULTI_LINE_MACRO_END
@@ -13695,6 +13697,38 @@ extern "C" {
         MeshPattern mesh_patterns[MAX_MESH_STEP];
     } SpeedFeatures;
 
+    // Entropy coding state of one tile. The tiles of a picture are entropy coded
+    // independently, each with its own coder, neighbor arrays and loop restoration
+    // references, so that they can be coded concurrently.
+    typedef struct EntropyTileInfo
+    {
+        EntropyCoder                       *entropy_coder_ptr;
+        // Entropy Coding Neighbor Arrays
+        NeighborArrayUnit                  *mode_type_neighbor_array;
+        NeighborArrayUnit                  *partition_context_neighbor_array;
+        NeighborArrayUnit                  *intra_luma_mode_neighbor_array;
+        NeighborArrayUnit                  *skip_flag_neighbor_array;
+        NeighborArrayUnit                  *skip_coeff_neighbor_array;
+        NeighborArrayUnit                  *luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
+        NeighborArrayUnit                  *txfm_context_array;
+        NeighborArrayUnit                  *inter_pred_dir_neighbor_array;
+        NeighborArrayUnit                  *ref_frame_type_neighbor_array;
+        NeighborArrayUnit32                *interpolation_type_neighbor_array;
+        // Loop restoration coefficients are coded relative to the previous unit of the tile
+        WienerInfo                            wiener_info[MAX_MB_PLANE];
+        SgrprojInfo                           sgrproj_info[MAX_MB_PLANE];
+        // CDEF strength coded in each 64x64 of the current SB, -1 until coded
+        int32_t                               cdef_preset[4];
+#if ADD_DELTA_QP_SUPPORT
+        // Delta q and delta lf are coded relative to the previous SB of the tile
+        int32_t                               prev_qindex;
+        int32_t                               prev_delta_lf_from_base;
+        int32_t                               prev_delta_lf[FRAME_LF_COUNT];
+#endif
+    } EntropyTileInfo;
+
     typedef struct PictureControlSet
     {
         EbObjectWrapper                    *sequence_control_set_wrapper_ptr;
@@ -13729,7 +13763,7 @@ extern "C" {
 
         // Entropy Process Rows
         int8_t                                entropy_coding_current_available_row;
-        EbBool                                entropy_coding_row_array[MAX_LCU_ROWS];
+        EbBool                               *entropy_coding_row_array;
         int8_t                                entropy_coding_current_row;
         int8_t                                entropy_coding_row_count;
         EbHandle                              entropy_coding_mutex;
@@ -13737,6 +13771,19 @@ extern "C" {
         EbBool                                entropy_coding_pic_done;
         EbHandle                              intra_mutex;
         uint32_t                              intra_coded_area;
+        // Deblocking SB Rows
+        EbHandle                              dlf_mutex;
+        EbHandle                              dlf_ready_semaphore;
+        uint16_t                              dlf_task_arrived_count;
+        uint16_t                              dlf_task_done_count;
+        uint32_t                              dlf_next_sb_row;
+        uint32_t                             *dlf_sb_row_progress;
+        EbHandle                              dlf_sb_row_cond_var;
+        // CDEF and Loop Restoration behind the Deblocking of each SB Row
+        EbBool                                fused_loop_filter;
+        uint32_t                              fused_fb_row_count;
+        uint16_t                              fused_rest_unit_row[3];
+        CdefRowState                          fused_cdef_state;
         uint32_t                              tot_seg_searched_cdef;
         EbHandle                              cdef_search_mutex;
 
@@ -13822,19 +13869,10 @@ extern "C" {
         NeighborArrayUnit                  *ep_luma_dc_sign_level_coeff_neighbor_array;
         NeighborArrayUnit                  *ep_cr_dc_sign_level_coeff_neighbor_array;
         NeighborArrayUnit                  *ep_cb_dc_sign_level_coeff_neighbor_array;
-        // Entropy Coding Neighbor Arrays
-        NeighborArrayUnit                  *mode_type_neighbor_array;
-        NeighborArrayUnit                  *partition_context_neighbor_array;
-        NeighborArrayUnit                  *intra_luma_mode_neighbor_array;
-        NeighborArrayUnit                  *skip_flag_neighbor_array;
-        NeighborArrayUnit                  *skip_coeff_neighbor_array;
-        NeighborArrayUnit                  *luma_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits (COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *cr_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *cb_dc_sign_level_coeff_neighbor_array; // Stored per 4x4. 8 bit: lower 6 bits(COEFF_CONTEXT_BITS), shows if there is at least one Coef. Top 2 bit store the sign of DC as follow: 0->0,1->-1,2-> 1
-        NeighborArrayUnit                  *txfm_context_array;
-        NeighborArrayUnit                  *inter_pred_dir_neighbor_array;
-        NeighborArrayUnit                  *ref_frame_type_neighbor_array;
-        NeighborArrayUnit32                *interpolation_type_neighbor_array;
+        // Entropy Coding Tiles, the neighbor arrays are in the tile info
+        EntropyTileInfo                   **entropy_coding_info;
+        uint16_t                              entropy_coding_tile_count;
+        uint16_t                              entropy_coding_tile_done_count;
 
         NeighborArrayUnit                  *segmentation_id_pred_array;
         SegmentationNeighborMap              *segmentation_neighbor_map;
@@ -13858,9 +13896,6 @@ extern "C" {
         EbEncMode                             enc_mode;
         EbBool                                intra_md_open_loop_flag;
         EbBool                                limit_intra;
-        int32_t                               cdef_preset[4];
-        WienerInfo                            wiener_info[MAX_MB_PLANE];
-        SgrprojInfo                           sgrproj_info[MAX_MB_PLANE];
         SpeedFeatures sf;
         SearchSiteConfig ss_cfg;//CHKN this might be a seq based
         HashTable hash_table;
@@ -13981,6 +14016,7 @@ extern "C" {
         uint64_t                              target_bits_rc;
         uint8_t                               best_pred_qp;
         uint64_t                              total_num_bits;
+        uint32_t                              vbv_mini_gop_index;       // mini GOP of the picture in the VBV of the rate control mode 4
         uint8_t                               first_frame_in_temporal_layer;
         uint8_t                               first_non_intra_frame_in_temporal_layer;
         uint64_t                              frames_in_interval[EB_MAX_TEMPORAL_LAYERS];
@@ -14085,6 +14121,13 @@ extern "C" {
 
         // Open loop Intra candidate Search Results
         OisSbResults                    **ois_sb_results;
+        // Results copied from the motion estimation hints, the searches are skipped
+        EbBool                                me_hints_imported;
+        EbBool                                ois_hints_imported;
+        // Temporal dependency model of the look ahead (adaptive quantization 2)
+        uint64_t                             *tpl_propagate_cost;       // [SB][16x16 block] cost of the look ahead pictures predicted from the block
+        uint32_t                             *tpl_sb_importance;        // (intra cost + propagate cost) / intra cost of each SB, in TPL_IMPORTANCE_PRECISION
+        uint32_t                              tpl_frame_importance;     // the same over the picture
         // Dynamic GOP
         EbPred                                pred_structure;
         uint8_t                               hierarchical_levels;
@@ -14214,14 +14257,13 @@ extern "C" {
         int32_t                               delta_lf_multi;
         int32_t                               num_tg;
         int32_t                               monochrome = 0; //NM - hadcoded to zero. to be set to one to support the coding of monochrome contents.
-        int32_t                               prev_qindex;
         // Since actual frame level loop filtering level value is not available
         // at the beginning of the tile (only available during actual filtering)
         // at encoder side.we record the delta_lf (against the frame level loop
         // filtering level) and code the delta between previous superblock's delta
         // lf and current delta lf. It is equivalent to the delta between previous
-        // superblock's actual lf and current lf.
-        int32_t                               prev_delta_lf_from_base;
+        // superblock's actual lf and current lf. The previous one is kept per
+        // tile in EntropyTileInfo.
         int32_t                               current_delta_lf_from_base;
 
         // For this experiment, we have four frame filter levels for different plane
@@ -14238,7 +14280,6 @@ extern "C" {
         // SEG_LVL_ALT_LF_U   = 3;
         // SEG_LVL_ALT_LF_V   = 4;
 //
-        int32_t                               prev_delta_lf[FRAME_LF_COUNT];
         int32_t                               curr_delta_lf[FRAME_LF_COUNT];
 #endif
         // Resolution of delta quant
@@ -14338,6 +14379,8 @@ extern "C" {
 #if INCOMPLETE_SB_FIX
         uint8_t                            over_boundary_block_mode;
 #endif
+        uint16_t                           tile_row_count;
+        uint16_t                           tile_column_count;
     } PictureControlSetInitData;
 
     typedef struct Av1Comp
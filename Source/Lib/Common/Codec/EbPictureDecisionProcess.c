@@ -22,6 +22,7 @@
 #include "EbReferenceObject.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbTemporalFiltering.h"
+#include "EbMeHints.h"
 
 /************************************************
  * Defines
@@ -742,7 +743,7 @@ EbErrorType GenerateMiniGopRps(
         for (pictureIndex = context_ptr->mini_gop_start_index[mini_gop_index]; pictureIndex <= context_ptr->mini_gop_end_index[mini_gop_index]; pictureIndex++) {
             picture_control_set_ptr = (PictureParentControlSet*)encode_context_ptr->pre_assignment_buffer[pictureIndex]->object_ptr;
             sequence_control_set_ptr = (SequenceControlSet*)picture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-            picture_control_set_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
+            picture_control_set_ptr->pred_structure = sequence_control_set_ptr->static_config.pred_structure;
             picture_control_set_ptr->hierarchical_levels = (uint8_t)context_ptr->mini_gop_hierarchical_levels[mini_gop_index];
 
             picture_control_set_ptr->pred_struct_ptr = get_prediction_structure(
@@ -2673,7 +2674,9 @@ void* picture_decision_kernel(void *input_ptr)
         queueEntryPtr = encode_context_ptr->picture_decision_reorder_queue[encode_context_ptr->picture_decision_reorder_queue_head_index];
 
         while (queueEntryPtr->parent_pcs_wrapper_ptr != EB_NULL) {
+            // Low delay : no scene change detection, the picture does not wait for the future window
             if (queueEntryPtr->picture_number == 0 ||
+                sequence_control_set_ptr->static_config.pred_structure != EB_PRED_RANDOM_ACCESS ||
                 ((PictureParentControlSet *)(queueEntryPtr->parent_pcs_wrapper_ptr->object_ptr))->end_of_sequence_flag == EB_TRUE){
                 framePasseThru = EB_TRUE;
             }
@@ -2743,7 +2746,7 @@ void* picture_decision_kernel(void *input_ptr)
                 picture_control_set_ptr->picture_number = (encode_context_ptr->current_input_poc + 1) /*& ((1 << sequence_control_set_ptr->bits_for_picture_order_count)-1)*/;
                 encode_context_ptr->current_input_poc = picture_control_set_ptr->picture_number;
 
-                picture_control_set_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
+                picture_control_set_ptr->pred_structure = sequence_control_set_ptr->static_config.pred_structure;
 
                 picture_control_set_ptr->hierarchical_layers_diff = 0;
 
@@ -2781,7 +2784,7 @@ void* picture_decision_kernel(void *input_ptr)
                 encode_context_ptr->pre_assignment_buffer_idr_count += picture_control_set_ptr->idr_flag;
                 encode_context_ptr->pre_assignment_buffer_count += 1;
 
-                if (sequence_control_set_ptr->static_config.rate_control_mode)
+                if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode))
                 {
                     // Increment the Intra Period Position
                     encode_context_ptr->intra_period_position = (encode_context_ptr->intra_period_position == (uint32_t)sequence_control_set_ptr->intra_period_length) ? 0 : encode_context_ptr->intra_period_position + 1;
@@ -3365,8 +3368,9 @@ void* picture_decision_kernel(void *input_ptr)
 
                             picture_control_set_ptr->picture_number_alt = encode_context_ptr->picture_number_alt++;
 
-                            // Set the Decode Order
-                            if ((context_ptr->mini_gop_idr_count[mini_gop_index] == 0) &&
+                            // Set the Decode Order, the display order in low delay
+                            if (picture_control_set_ptr->pred_structure == EB_PRED_RANDOM_ACCESS &&
+                                (context_ptr->mini_gop_idr_count[mini_gop_index] == 0) &&
                                 (context_ptr->mini_gop_length[mini_gop_index] == picture_control_set_ptr->pred_struct_ptr->pred_struct_period) && !picture_control_set_ptr->is_overlay){
                                 picture_control_set_ptr->decode_order = encode_context_ptr->decode_base_number + picture_control_set_ptr->pred_struct_ptr->pred_struct_entry_ptr_array[picture_control_set_ptr->pred_struct_index]->decode_order;
                             }
@@ -3499,6 +3503,15 @@ void* picture_decision_kernel(void *input_ptr)
                             picture_control_set_ptr->me_segments_total_count = (uint16_t)(picture_control_set_ptr->me_segments_column_count  * picture_control_set_ptr->me_segments_row_count);
                             picture_control_set_ptr->me_segments_completion_mask = 0;
 
+                            // Results of another encode, the lead of a ladder searches to share its own
+                            picture_control_set_ptr->me_hints_imported = EB_FALSE;
+                            picture_control_set_ptr->ois_hints_imported = EB_FALSE;
+                            if (encode_context_ptr->me_hints && !picture_control_set_ptr->is_overlay &&
+                                !(encode_context_ptr->ladder_analysis && encode_context_ptr->ladder_lead))
+                                me_hints_read(
+                                    encode_context_ptr->me_hints,
+                                    picture_control_set_ptr);
+
                             // Post the results to the ME processes
                             {
                                 uint32_t segment_index;
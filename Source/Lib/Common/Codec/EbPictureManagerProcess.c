@@ -561,7 +561,7 @@ void* picture_manager_kernel(void *input_ptr)
                                 (availabilityFlag == EB_FALSE) ? EB_FALSE :   // Don't update if already False
                                 (ref_poc > current_input_poc) ? EB_FALSE :   // The Reference has not been received as an Input Picture yet, then its availability is false
                                 (!encode_context_ptr->terminating_sequence_flag_received &&
-                                (sequence_control_set_ptr->static_config.rate_control_mode && entryPictureControlSetPtr->slice_type != I_SLICE
+                                (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode) && entryPictureControlSetPtr->slice_type != I_SLICE
                                     && entryPictureControlSetPtr->temporal_layer_index == 0 && !referenceEntryPtr->feedback_arrived)) ? EB_FALSE :
                                 (referenceEntryPtr->reference_available) ? EB_TRUE :   // The Reference has been completed
                                 EB_FALSE;     // The Reference has not been completed
@@ -602,7 +602,7 @@ void* picture_manager_kernel(void *input_ptr)
                                         (availabilityFlag == EB_FALSE) ? EB_FALSE :   // Don't update if already False
                                         (ref_poc > current_input_poc) ? EB_FALSE :   // The Reference has not been received as an Input Picture yet, then its availability is false
                                         (!encode_context_ptr->terminating_sequence_flag_received &&
-                                        (sequence_control_set_ptr->static_config.rate_control_mode && entryPictureControlSetPtr->slice_type != I_SLICE
+                                        (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode) && entryPictureControlSetPtr->slice_type != I_SLICE
                                             && entryPictureControlSetPtr->temporal_layer_index == 0 && !referenceEntryPtr->feedback_arrived)) ? EB_FALSE :
                                         (referenceEntryPtr->reference_available) ? EB_TRUE :   // The Reference has been completed
                                         EB_FALSE;     // The Reference has not been completed
@@ -664,7 +664,7 @@ void* picture_manager_kernel(void *input_ptr)
                             ChildPictureControlSetPtr->entropy_coding_row_count = picture_height_in_sb;
                             ChildPictureControlSetPtr->entropy_coding_in_progress = EB_FALSE;
 
-                            for (row_index = 0; row_index < MAX_LCU_ROWS; ++row_index)
+                            for (row_index = 0; row_index <= picture_height_in_sb; ++row_index)
                                 ChildPictureControlSetPtr->entropy_coding_row_array[row_index] = EB_FALSE;
                         }
 
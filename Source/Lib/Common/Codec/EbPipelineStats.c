@@ -0,0 +1,120 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbPipelineStats.h"
+
+#if PIPELINE_STATS
+#include "EbThreads.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Stats of the calling thread, NULL for threads not bound to stats
+static EB_THREAD_LOCAL EbThreadStats *thread_stats_ptr = NULL;
+
+/***************************************
+ * eb_pipeline_stats_time
+ *   Monotonic time in microseconds
+ ***************************************/
+uint64_t eb_pipeline_stats_time(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 +
+        (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000 / (uint64_t)frequency.QuadPart;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+#endif
+}
+
+static void* stats_thread_entry(void *input_ptr)
+{
+    thread_stats_ptr = (EbThreadStats*)input_ptr;
+    thread_stats_ptr->run_start_time = eb_pipeline_stats_time();
+
+    return thread_stats_ptr->thread_function(thread_stats_ptr->thread_context);
+}
+
+void eb_thread_stats_bind(
+    EbThreadStats  *stats_ptr,
+    void         *(**thread_function)(void *),
+    void          **thread_context)
+{
+    stats_ptr->thread_function = *thread_function;
+    stats_ptr->thread_context  = *thread_context;
+
+    *thread_function = stats_thread_entry;
+    *thread_context  = stats_ptr;
+}
+
+uint64_t eb_thread_stats_wait_begin(void)
+{
+    EbThreadStats *stats_ptr = thread_stats_ptr;
+    uint64_t       now;
+
+    if (stats_ptr == NULL)
+        return 0;
+
+    now = eb_pipeline_stats_time();
+    stats_ptr->busy_time += now - stats_ptr->run_start_time;
+    return now;
+}
+
+void eb_thread_stats_wait_end(
+    uint64_t        wait_begin_time,
+    EbBool          full_fifo,
+    uint32_t        fifo_depth)
+{
+    EbThreadStats *stats_ptr = thread_stats_ptr;
+    uint32_t       bin = 0;
+
+    if (stats_ptr == NULL)
+        return;
+
+    stats_ptr->run_start_time = eb_pipeline_stats_time();
+    if (full_fifo) {
+        stats_ptr->full_wait_time += stats_ptr->run_start_time - wait_begin_time;
+        stats_ptr->full_get_count++;
+
+        // Bin 0 counts the empty fifos, bin n the depths in [2^(n-1), 2^n)
+        while (fifo_depth && bin < EB_PIPELINE_STATS_DEPTH_BINS - 1) {
+            fifo_depth >>= 1;
+            bin++;
+        }
+        stats_ptr->fifo_depth_histogram[bin]++;
+    }
+    else {
+        stats_ptr->empty_wait_time += stats_ptr->run_start_time - wait_begin_time;
+        stats_ptr->empty_get_count++;
+    }
+}
+
+void eb_thread_stats_accumulate(
+    EbKernelStats       *kernel_stats_ptr,
+    const EbThreadStats *stats_ptr)
+{
+    // The counters are read while the thread may update them, each one is
+    // consistent on its own
+    kernel_stats_ptr->thread_count++;
+    kernel_stats_ptr->busy_time += stats_ptr->busy_time;
+    kernel_stats_ptr->full_wait_time += stats_ptr->full_wait_time;
+    kernel_stats_ptr->empty_wait_time += stats_ptr->empty_wait_time;
+    kernel_stats_ptr->full_get_count += stats_ptr->full_get_count;
+    kernel_stats_ptr->empty_get_count += stats_ptr->empty_get_count;
+    for (uint32_t bin = 0; bin < EB_PIPELINE_STATS_DEPTH_BINS; ++bin)
+        kernel_stats_ptr->fifo_depth_histogram[bin] += stats_ptr->fifo_depth_histogram[bin];
+}
+#endif
@@ -0,0 +1,67 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbPipelineStats_h
+#define EbPipelineStats_h
+
+#include "EbDefinitions.h"
+#include "EbSvtAv1Enc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if PIPELINE_STATS
+    /**************************************
+     * Thread Stats
+     *   Counters of one kernel thread, only
+     *   written by that thread. Times are in
+     *   microseconds.
+     **************************************/
+    typedef struct EbThreadStats {
+        uint32_t    kernel_index;
+        uint64_t    busy_time;
+        uint64_t    full_wait_time;
+        uint64_t    empty_wait_time;
+        uint64_t    full_get_count;
+        uint64_t    empty_get_count;
+        uint64_t    fifo_depth_histogram[EB_PIPELINE_STATS_DEPTH_BINS];
+
+        // End of the last wait, start of the running time not counted yet
+        uint64_t    run_start_time;
+
+        void     *(*thread_function)(void *);
+        void       *thread_context;
+    } EbThreadStats;
+
+    extern uint64_t eb_pipeline_stats_time(
+        void);
+
+    /* Redirects thread_function and thread_context so that the thread created
+       from them counts its times in stats_ptr */
+    extern void eb_thread_stats_bind(
+        EbThreadStats  *stats_ptr,
+        void         *(**thread_function)(void *),
+        void          **thread_context);
+
+    /* Called by eb_get_full_object and eb_get_empty_object around their wait.
+       fifo_depth is the number of objects queued when the wait begins. Nothing
+       is counted on threads not bound to stats. */
+    extern uint64_t eb_thread_stats_wait_begin(
+        void);
+
+    extern void eb_thread_stats_wait_end(
+        uint64_t        wait_begin_time,
+        EbBool          full_fifo,
+        uint32_t        fifo_depth);
+
+    /* Adds the counters of the thread to the ones of its kernel */
+    extern void eb_thread_stats_accumulate(
+        EbKernelStats       *kernel_stats_ptr,
+        const EbThreadStats *stats_ptr);
+#endif
+#ifdef __cplusplus
+}
+#endif
+#endif // EbPipelineStats_h
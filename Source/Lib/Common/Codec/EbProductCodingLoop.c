@@ -2344,7 +2344,7 @@ EbErrorType av1_intra_luma_prediction(
     if (txb_origin_x != 0)
         memcpy(leftNeighArray + 1, md_context_ptr->tx_search_luma_recon_neighbor_array->left_array + txb_origin_y, tx_height * 2);
     if (txb_origin_y != 0 && txb_origin_x != 0)
-        topNeighArray[0] = leftNeighArray[0] = md_context_ptr->tx_search_luma_recon_neighbor_array->top_left_array[MAX_PICTURE_HEIGHT_SIZE + txb_origin_x - txb_origin_y];
+        topNeighArray[0] = leftNeighArray[0] = md_context_ptr->tx_search_luma_recon_neighbor_array->top_left_array[md_context_ptr->tx_search_luma_recon_neighbor_array->left_array_size + txb_origin_x - txb_origin_y];
 
     mode = candidate_buffer_ptr->candidate_ptr->pred_mode;
     av1_predict_intra_block(
@@ -5223,6 +5223,7 @@ EB_EXTERN EbErrorType mode_decision_sb(
 
         cu_ptr->split_flag = (uint16_t)leafDataPtr->split_flag; //mdc indicates smallest or non valid CUs with split flag=
         cu_ptr->qp = context_ptr->qp;
+        cu_ptr->segment_id = context_ptr->sb_segment_id;
         cu_ptr->best_d1_blk = blk_idx_mds;
 
             if (leafDataPtr->tot_d1_blocks != 1)
@@ -14,6 +14,7 @@
 * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
 */
 #include <stdlib.h>
+#include <math.h>
 
 #include "EbDefinitions.h"
 #include "EbRateControlProcess.h"
@@ -27,6 +28,7 @@
 #include "EbRateControlResults.h"
 #include "EbRateControlTasks.h"
 #include "RateControlModel.h"
+#include "RateControlTwoPass.h"
 
 #include "EbSegmentation.h"
 
@@ -331,6 +333,13 @@ EbErrorType rate_control_context_ctor(
     context_ptr->extra_bits_gen = 0;
     context_ptr->max_rate_adjust_delta_qp = 0;
 
+    context_ptr->vbv_next_decode_order = 0;
+    for (uint32_t i = 0; i < VBV_REORDER_QUEUE_MAX_DEPTH; i++) {
+        context_ptr->vbv_picture_bits[i] = -1;
+        context_ptr->vbv_picture_coded[i] = EB_FALSE;
+        context_ptr->vbv_picture_frames[i] = 0;
+    }
+
     return EB_ErrorNone;
 }
 uint64_t predict_bits(
@@ -2836,6 +2845,378 @@ void frame_level_rc_feedback_picture_cvbr(
 #endif
 }
 
+// Share of the VBV buffer full when the encode starts, below which the q of
+// all the pictures is raised, and kept for the pictures following the one
+// being given a QP
+#define VBV_INITIAL_FULLNESS        0.9
+#define VBV_TARGET_FULLNESS         0.5
+#define VBV_MIN_FULLNESS            0.2
+// Power of the ratio of the target fullness to the fullness the q is scaled by
+#define VBV_Q_SCALE_STRENGTH        2.0
+// The size model keeps for each picture type the size per complexity at the q
+// of its last feedback, and scales it by a power of the ratio of the q. The
+// size decreases by at least the power VBV_Q_EXPONENT_RAISE of the ratio as
+// the q is raised, and increases by at most the power VBV_Q_EXPONENT_LOWER as
+// it is lowered. Until a picture of the type is fed back it is the largest
+// size measured, on noise, coeff / q ^ VBV_Q_EXPONENT at the q of the QP. The
+// feedback is followed with the weight VBV_BITS_COEFF_UPDATE_RATE. The size
+// falls much faster near the maximum q, where most blocks are skipped, so the
+// model is only used down to the q of the last feedback of the type over
+// VBV_MAX_Q_DECREASE, and a size measured at the maximum q increases by the
+// power VBV_MAX_Q_EXPONENT_LOWER. The sizes of a mini GOP, which only steer
+// its q scale to the target fullness, follow the typical power VBV_Q_EXPONENT.
+#define VBV_Q_EXPONENT_RAISE        0.5
+#define VBV_Q_EXPONENT_LOWER        2.0
+#define VBV_MAX_Q_DECREASE          2.0
+#define VBV_MAX_Q_EXPONENT_LOWER    5.0
+// The size of a picture increases about as fast as the power 4 of the ratio
+// of its q to the one of its references as it is lowered below them
+#define VBV_MAX_REFERENCE_Q_DECREASE 1.25
+#define VBV_Q_EXPONENT              0.75
+#define VBV_INTRA_BITS_COEFF        1.5
+#define VBV_INTER_BITS_COEFF        2.0
+#define VBV_BITS_COEFF_UPDATE_RATE  0.5
+
+// Complexity of a picture for the size model of the VBV: the sum of the
+// standard deviation of the pixels of the 64x64 blocks when coded intra, the
+// motion estimation distortion otherwise, plus one per pixel for the modes
+// and headers of the flat or static blocks
+static double vbv_picture_complexity(
+    PictureParentControlSet *picture_control_set_ptr,
+    EbBool                   intra)
+{
+    double   complexity = 0;
+    uint16_t sb_index;
+
+    for (sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        if (intra)
+            complexity += BLOCK_SIZE_64 * BLOCK_SIZE_64 * (1 + sqrt((double)picture_control_set_ptr->variance[sb_index][ME_TIER_ZERO_PU_64x64]));
+        else
+            complexity += BLOCK_SIZE_64 * BLOCK_SIZE_64 + picture_control_set_ptr->rc_me_distortion[sb_index];
+    }
+    return MAX(complexity, 1.0);
+}
+
+static uint32_t vbv_bits_coeff_index(
+    PictureParentControlSet *picture_control_set_ptr)
+{
+    return picture_control_set_ptr->slice_type == I_SLICE ? 0 : picture_control_set_ptr->temporal_layer_index + 1;
+}
+
+// Size of a picture at the q given the one at the reference q
+static double vbv_scale_bits(
+    double bits,
+    double reference_q,
+    double q)
+{
+    return bits * pow(reference_q / q, q > reference_q ? VBV_Q_EXPONENT_RAISE : VBV_Q_EXPONENT_LOWER);
+}
+
+// Size per complexity of a picture of the type at the q
+static double vbv_bits_ratio(
+    RateControlContext *context_ptr,
+    uint32_t            coeff_index,
+    double              q,
+    AomBitDepth         bit_depth)
+{
+    const double reference_q = context_ptr->vbv_bits_q[coeff_index];
+
+    if (q < reference_q && reference_q >= av1_convert_qindex_to_q(MAXQ, bit_depth))
+        return context_ptr->vbv_bits_ratio[coeff_index] * pow(reference_q / q, VBV_MAX_Q_EXPONENT_LOWER);
+    return vbv_scale_bits(context_ptr->vbv_bits_ratio[coeff_index], reference_q, q);
+}
+
+static double vbv_predict_bits(
+    RateControlContext *context_ptr,
+    uint32_t            coeff_index,
+    double              complexity,
+    int32_t             qindex,
+    AomBitDepth         bit_depth)
+{
+    return vbv_bits_ratio(context_ptr, coeff_index, av1_convert_qindex_to_q(qindex, bit_depth), bit_depth) * complexity;
+}
+
+// Predicted size of a picture at the q of the qindex. An inter picture the
+// motion estimation predicts badly, as at a scene cut, is coded mostly intra
+// and takes at least its intra size times the square of the share of its
+// intra complexity the motion estimation leaves.
+static double vbv_guard_bits(
+    RateControlContext *context_ptr,
+    uint32_t            coeff_index,
+    double              complexity,
+    double              intra_share,
+    double              intra_complexity,
+    int32_t             qindex,
+    AomBitDepth         bit_depth)
+{
+    const double bits = vbv_predict_bits(context_ptr, coeff_index, complexity, qindex, bit_depth);
+
+    if (coeff_index == 0)
+        return bits;
+    return MAX(bits, intra_share * intra_share * vbv_predict_bits(context_ptr, 0, intra_complexity, qindex, bit_depth));
+}
+
+// Typical size of a picture at the q of the qindex, to steer the q scale
+static double vbv_typical_bits(
+    RateControlContext *context_ptr,
+    uint32_t            coeff_index,
+    double              complexity,
+    int32_t             qindex,
+    AomBitDepth         bit_depth)
+{
+    return context_ptr->vbv_bits_ratio[coeff_index] * complexity *
+        pow(context_ptr->vbv_bits_q[coeff_index] / av1_convert_qindex_to_q(qindex, bit_depth), VBV_Q_EXPONENT);
+}
+
+// Mini GOP of a non base layer picture, the one of the first base layer
+// picture following it, or of the last base layer picture when none follows
+// it yet as in low delay
+static uint32_t vbv_find_mini_gop(
+    PictureControlSet   *picture_control_set_ptr,
+    RateControlContext  *context_ptr)
+{
+    const uint64_t   picture_number = picture_control_set_ptr->picture_number;
+    VbvMiniGopEntry *mini_gop = context_ptr->vbv_mini_gop;
+    uint32_t         mini_gop_index = context_ptr->vbv_mini_gop_index;
+
+    for (uint32_t i = 0; i < VBV_MINI_GOP_QUEUE_MAX_DEPTH; i++) {
+        if (mini_gop[i].base_picture_number > picture_number &&
+            (mini_gop[mini_gop_index].base_picture_number <= picture_number ||
+             mini_gop[i].base_picture_number < mini_gop[mini_gop_index].base_picture_number))
+            mini_gop_index = i;
+    }
+    return mini_gop_index;
+}
+
+// Size at the q scale 1 of a non base layer picture of a mini GOP, the mean
+// of the last pictures of the temporal layers, 0 when none is fed back yet
+static double vbv_non_base_bits(
+    RateControlContext  *context_ptr,
+    uint32_t             hierarchical_levels)
+{
+    double bits = 0;
+
+    if (hierarchical_levels == 0)
+        return 0;
+    for (uint32_t temporal_layer_index = 1; temporal_layer_index <= hierarchical_levels; temporal_layer_index++)
+        bits += (1 << (temporal_layer_index - 1)) * context_ptr->vbv_layer_bits[temporal_layer_index];
+    return bits / ((1 << hierarchical_levels) - 1);
+}
+
+// Predicted size of a picture not given a QP yet, a non base layer picture
+// of the mini GOP of the last base layer picture before it in decode order
+static double vbv_pending_picture_bits(
+    RateControlContext  *context_ptr,
+    uint64_t             decode_order,
+    double               non_base_bits)
+{
+    VbvMiniGopEntry *mini_gop = context_ptr->vbv_mini_gop;
+    uint32_t         mini_gop_index = context_ptr->vbv_mini_gop_index;
+
+    for (uint32_t i = 0; i < VBV_MINI_GOP_QUEUE_MAX_DEPTH; i++) {
+        if (mini_gop[i].base_decode_order < decode_order &&
+            (mini_gop[mini_gop_index].base_decode_order >= decode_order ||
+             mini_gop[i].base_decode_order > mini_gop[mini_gop_index].base_decode_order))
+            mini_gop_index = i;
+    }
+    return vbv_scale_bits(non_base_bits, 1.0, mini_gop[mini_gop_index].q_scale);
+}
+
+// Constant quality level of a picture of the rate control mode 4, the one of
+// the QP. The pictures of a mini GOP get it scaled as their base layer picture
+// was, their QP offsets are then kept.
+static int32_t vbv_cq_qindex(
+    PictureControlSet   *picture_control_set_ptr,
+    SequenceControlSet  *sequence_control_set_ptr,
+    RateControlContext  *context_ptr)
+{
+    const AomBitDepth bit_depth = (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth;
+    const int32_t     qindex = quantizer_to_qindex[(uint8_t)sequence_control_set_ptr->qp];
+    const double      q = av1_convert_qindex_to_q(qindex, bit_depth);
+    double            q_scale;
+
+    if (sequence_control_set_ptr->static_config.vbv_max_rate == 0 ||
+        picture_control_set_ptr->slice_type == I_SLICE ||
+        picture_control_set_ptr->temporal_layer_index == 0)
+        return qindex;
+    q_scale = context_ptr->vbv_mini_gop[vbv_find_mini_gop(picture_control_set_ptr, context_ptr)].q_scale;
+    if (q_scale == 1.0)
+        return qindex;
+    return MIN(qindex + av1_compute_qdelta(q, q * q_scale, bit_depth),
+        (int32_t)quantizer_to_qindex[sequence_control_set_ptr->static_config.max_qp_allowed]);
+}
+
+// Raise the QP the picture got from the constant quality of the CQP when the
+// VBV buffer is predicted to be less than VBV_TARGET_FULLNESS full once the
+// pictures before it in decode order are removed, then until the predicted
+// size of the picture leaves VBV_MIN_FULLNESS of the buffer and the q is not
+// lowered too far from the one of the size model. The pictures also keep at
+// least the ratio of the q to the constant quality level of the last reference
+// picture over VBV_MAX_REFERENCE_Q_DECREASE, the residual of a picture coded
+// at a lower q than its references holds their coding noise.
+void frame_level_rc_input_picture_crf(
+    PictureControlSet   *picture_control_set_ptr,
+    SequenceControlSet  *sequence_control_set_ptr,
+    RateControlContext  *context_ptr)
+{
+    PictureParentControlSet *parent_pcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
+    const AomBitDepth        bit_depth = (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth;
+    const int32_t            max_qindex = quantizer_to_qindex[sequence_control_set_ptr->static_config.max_qp_allowed];
+    const uint32_t           queue_index = parent_pcs_ptr->decode_order % VBV_REORDER_QUEUE_MAX_DEPTH;
+    const uint32_t           coeff_index = vbv_bits_coeff_index(parent_pcs_ptr);
+    double                   complexity;
+    double                   intra_complexity;
+    double                   intra_share;
+    double                   fullness;
+    double                   non_base_bits;
+    double                   predicted_bits;
+    int32_t                  qindex = parent_pcs_ptr->base_qindex;
+    double                   cq_q;
+
+    if (sequence_control_set_ptr->static_config.vbv_max_rate == 0)
+        return;
+
+    cq_q = av1_convert_qindex_to_q(qindex, bit_depth);
+    complexity = vbv_picture_complexity(parent_pcs_ptr, parent_pcs_ptr->slice_type == I_SLICE);
+    intra_complexity = vbv_picture_complexity(parent_pcs_ptr, EB_TRUE);
+    intra_share = MIN((complexity - parent_pcs_ptr->sb_total_count * BLOCK_SIZE_64 * BLOCK_SIZE_64) / intra_complexity, 1.0);
+    // Fullness before the picture is removed. The buffer fills for a frame
+    // once a shown picture is removed, the hidden pictures leave with the next
+    // shown one. The pictures before it in decode order not given a QP yet,
+    // mostly shown non reference pictures, are assumed to show a frame and to
+    // take at least what fills in it.
+    non_base_bits = vbv_non_base_bits(context_ptr, parent_pcs_ptr->hierarchical_levels);
+    fullness = context_ptr->vbv_fullness;
+    for (uint64_t decode_order = context_ptr->vbv_next_decode_order; decode_order < parent_pcs_ptr->decode_order; decode_order++) {
+        const uint32_t index = decode_order % VBV_REORDER_QUEUE_MAX_DEPTH;
+        double         bits = context_ptr->vbv_picture_bits[index];
+        uint32_t       frames = context_ptr->vbv_picture_frames[index];
+        if (bits < 0) {
+            bits = MAX(vbv_pending_picture_bits(context_ptr, decode_order, non_base_bits), context_ptr->vbv_bits_per_frame);
+            frames = 1;
+        }
+        fullness = MIN(context_ptr->vbv_buffer_size, fullness - bits + frames * context_ptr->vbv_bits_per_frame);
+    }
+    // The scale is set by the base layer pictures from the fullness once their
+    // mini GOP is removed, and applied to their QP. The fullness increases with
+    // the scale, the scale needed decreases with the fullness, search where
+    // they meet. The other pictures of the mini GOP are given the QP of the
+    // constant quality level scaled by vbv_cq_qindex, their size is the one of
+    // the last pictures of their temporal layer. The fullness is checked once
+    // the first shown picture and once the mini GOP is removed, a hidden base
+    // layer picture leaving with a picture of each of the other layers.
+    if (parent_pcs_ptr->slice_type == I_SLICE || parent_pcs_ptr->temporal_layer_index == 0) {
+        const uint64_t   previous_base_picture_number = context_ptr->vbv_mini_gop[context_ptr->vbv_mini_gop_index].base_picture_number;
+        const uint64_t   mini_gop_size = parent_pcs_ptr->picture_number > previous_base_picture_number ?
+            parent_pcs_ptr->picture_number - previous_base_picture_number : 1;
+        const double     base_bits = vbv_typical_bits(context_ptr, coeff_index, complexity, qindex, bit_depth);
+        const double     layer_bits = non_base_bits * (mini_gop_size - 1);
+        double           first_shown_bits = base_bits;
+        double           min_q_scale = 1.0;
+        double           max_q_scale = pow(VBV_TARGET_FULLNESS / VBV_MIN_FULLNESS, VBV_Q_SCALE_STRENGTH);
+        int32_t          iteration;
+        VbvMiniGopEntry *mini_gop;
+
+        if (!parent_pcs_ptr->show_frame) {
+            for (uint32_t temporal_layer_index = 1; temporal_layer_index <= parent_pcs_ptr->hierarchical_levels; temporal_layer_index++)
+                first_shown_bits += context_ptr->vbv_layer_bits[temporal_layer_index];
+        }
+        for (iteration = 0; iteration < 16; iteration++) {
+            const double q_scale = sqrt(min_q_scale * max_q_scale);
+            const double fullness_after = MIN(
+                fullness - first_shown_bits / pow(q_scale, VBV_Q_EXPONENT) + context_ptr->vbv_bits_per_frame,
+                fullness - (base_bits + layer_bits) / pow(q_scale, VBV_Q_EXPONENT) + mini_gop_size * context_ptr->vbv_bits_per_frame) / context_ptr->vbv_buffer_size;
+            const double needed_q_scale = fullness_after >= VBV_TARGET_FULLNESS ? 1.0 :
+                pow(VBV_TARGET_FULLNESS / MAX(fullness_after, VBV_MIN_FULLNESS), VBV_Q_SCALE_STRENGTH);
+            if (q_scale < needed_q_scale)
+                min_q_scale = q_scale;
+            else
+                max_q_scale = q_scale;
+        }
+        const double q_scale = min_q_scale == 1.0 ? 1.0 : max_q_scale;
+
+        context_ptr->vbv_mini_gop_index = (context_ptr->vbv_mini_gop_index + 1) % VBV_MINI_GOP_QUEUE_MAX_DEPTH;
+        mini_gop = &context_ptr->vbv_mini_gop[context_ptr->vbv_mini_gop_index];
+        mini_gop->base_picture_number = parent_pcs_ptr->picture_number;
+        mini_gop->base_decode_order = parent_pcs_ptr->decode_order;
+        mini_gop->q_scale = q_scale;
+        parent_pcs_ptr->vbv_mini_gop_index = context_ptr->vbv_mini_gop_index;
+        if (q_scale > 1.0) {
+            const double q = av1_convert_qindex_to_q(qindex, bit_depth);
+            qindex = MIN(qindex + av1_compute_qdelta(q, q * q_scale, bit_depth), max_qindex);
+        }
+    }
+    else
+        parent_pcs_ptr->vbv_mini_gop_index = vbv_find_mini_gop(picture_control_set_ptr, context_ptr);
+    predicted_bits = vbv_guard_bits(context_ptr, coeff_index, complexity, intra_share, intra_complexity, qindex, bit_depth);
+    while (qindex < max_qindex && (fullness - predicted_bits < context_ptr->vbv_buffer_size * VBV_MIN_FULLNESS ||
+        (context_ptr->vbv_bits_coeff_fed_back[coeff_index] &&
+         av1_convert_qindex_to_q(qindex, bit_depth) * VBV_MAX_Q_DECREASE < context_ptr->vbv_bits_q[coeff_index]) ||
+        av1_convert_qindex_to_q(qindex, bit_depth) * VBV_MAX_REFERENCE_Q_DECREASE < cq_q * context_ptr->vbv_reference_q_raise)) {
+        qindex++;
+        predicted_bits = vbv_guard_bits(context_ptr, coeff_index, complexity, intra_share, intra_complexity, qindex, bit_depth);
+    }
+
+    if (parent_pcs_ptr->is_used_as_reference_flag)
+        context_ptr->vbv_reference_q_raise = av1_convert_qindex_to_q(qindex, bit_depth) / cq_q;
+
+    parent_pcs_ptr->base_qindex = (uint8_t)qindex;
+    picture_control_set_ptr->picture_qp = (uint8_t)CLIP3(
+        (int32_t)sequence_control_set_ptr->static_config.min_qp_allowed,
+        (int32_t)sequence_control_set_ptr->static_config.max_qp_allowed,
+        qindex >> 2);
+
+    context_ptr->vbv_picture_bits[queue_index] = predicted_bits;
+    context_ptr->vbv_picture_frames[queue_index] = (parent_pcs_ptr->show_frame ? 1 : 0) + (parent_pcs_ptr->has_show_existing ? 1 : 0);
+}
+
+// Remove the picture from the VBV buffer, which then fills for the frames it
+// shows, and correct the size model of its type
+void frame_level_rc_feedback_picture_crf(
+    PictureParentControlSet *parentpicture_control_set_ptr,
+    SequenceControlSet      *sequence_control_set_ptr,
+    RateControlContext      *context_ptr)
+{
+    const AomBitDepth bit_depth = (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth;
+    const uint32_t    coeff_index = vbv_bits_coeff_index(parentpicture_control_set_ptr);
+    const double      bits = (double)parentpicture_control_set_ptr->total_num_bits;
+    const double      q = av1_convert_qindex_to_q(parentpicture_control_set_ptr->base_qindex, bit_depth);
+    const double      ratio = bits / vbv_picture_complexity(parentpicture_control_set_ptr, parentpicture_control_set_ptr->slice_type == I_SLICE);
+
+    if (sequence_control_set_ptr->static_config.vbv_max_rate == 0)
+        return;
+
+    // The actual size replaces the predicted one, the picture is removed once
+    // all the pictures before it in decode order are fed back
+    context_ptr->vbv_picture_bits[parentpicture_control_set_ptr->decode_order % VBV_REORDER_QUEUE_MAX_DEPTH] = bits;
+    context_ptr->vbv_picture_coded[parentpicture_control_set_ptr->decode_order % VBV_REORDER_QUEUE_MAX_DEPTH] = EB_TRUE;
+    while (context_ptr->vbv_picture_coded[context_ptr->vbv_next_decode_order % VBV_REORDER_QUEUE_MAX_DEPTH]) {
+        const uint32_t queue_index = context_ptr->vbv_next_decode_order % VBV_REORDER_QUEUE_MAX_DEPTH;
+        context_ptr->vbv_fullness = MIN(context_ptr->vbv_buffer_size,
+            context_ptr->vbv_fullness - context_ptr->vbv_picture_bits[queue_index] + context_ptr->vbv_picture_frames[queue_index] * context_ptr->vbv_bits_per_frame);
+        context_ptr->vbv_picture_bits[queue_index] = -1;
+        context_ptr->vbv_picture_frames[queue_index] = 0;
+        context_ptr->vbv_picture_coded[queue_index] = EB_FALSE;
+        context_ptr->vbv_next_decode_order++;
+    }
+
+    // The first feedback of a type replaces the worst case size, the next ones
+    // are weighed with the size predicted at their q
+    if (context_ptr->vbv_bits_coeff_fed_back[coeff_index]) {
+        const double predicted_ratio = vbv_bits_ratio(context_ptr, coeff_index, q, bit_depth);
+        context_ptr->vbv_bits_ratio[coeff_index] = predicted_ratio + (ratio - predicted_ratio) * VBV_BITS_COEFF_UPDATE_RATE;
+    }
+    else
+        context_ptr->vbv_bits_ratio[coeff_index] = ratio;
+    context_ptr->vbv_bits_q[coeff_index] = q;
+    context_ptr->vbv_bits_coeff_fed_back[coeff_index] = EB_TRUE;
+    if (coeff_index > 1) {
+        const double scaled_bits = bits * pow(context_ptr->vbv_mini_gop[parentpicture_control_set_ptr->vbv_mini_gop_index].q_scale, VBV_Q_EXPONENT);
+        double      *layer_bits = &context_ptr->vbv_layer_bits[coeff_index - 1];
+        *layer_bits = *layer_bits == 0 ? scaled_bits : *layer_bits + (scaled_bits - *layer_bits) * VBV_BITS_COEFF_UPDATE_RATE;
+    }
+}
+
 void high_level_rc_feed_back_picture(
     PictureParentControlSet *picture_control_set_ptr,
     SequenceControlSet      *sequence_control_set_ptr)
@@ -3008,6 +3389,32 @@ void init_rc(
         context_ptr->base_layer_frames_avg_qp = sequence_control_set_ptr->qp;
         context_ptr->base_layer_intra_frames_avg_qp = sequence_control_set_ptr->qp;
     }
+    else if (sequence_control_set_ptr->static_config.rate_control_mode == 4) {
+        const double frame_rate = sequence_control_set_ptr->frame_rate > 1000 ?
+            (double)sequence_control_set_ptr->frame_rate / (1 << RC_PRECISION) :
+            (double)sequence_control_set_ptr->frame_rate;
+        const double q = av1_convert_qindex_to_q(quantizer_to_qindex[(uint8_t)sequence_control_set_ptr->qp],
+            (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth);
+        context_ptr->vbv_buffer_size = (double)sequence_control_set_ptr->static_config.vbv_buffer_size;
+        context_ptr->vbv_bits_per_frame = (double)sequence_control_set_ptr->static_config.vbv_max_rate / frame_rate;
+        context_ptr->vbv_fullness = context_ptr->vbv_buffer_size * VBV_INITIAL_FULLNESS;
+        for (uint32_t i = 0; i < VBV_MINI_GOP_QUEUE_MAX_DEPTH; i++) {
+            context_ptr->vbv_mini_gop[i].base_picture_number = 0;
+            context_ptr->vbv_mini_gop[i].base_decode_order = 0;
+            context_ptr->vbv_mini_gop[i].q_scale = 1.0;
+        }
+        context_ptr->vbv_mini_gop_index = 0;
+        context_ptr->vbv_reference_q_raise = 1.0;
+        context_ptr->vbv_bits_ratio[0] = VBV_INTRA_BITS_COEFF / pow(q, VBV_Q_EXPONENT);
+        context_ptr->vbv_bits_q[0] = q;
+        context_ptr->vbv_bits_coeff_fed_back[0] = EB_FALSE;
+        for (uint32_t temporal_layer_index = 0; temporal_layer_index < EB_MAX_TEMPORAL_LAYERS; temporal_layer_index++) {
+            context_ptr->vbv_bits_ratio[temporal_layer_index + 1] = VBV_INTER_BITS_COEFF / pow(q, VBV_Q_EXPONENT);
+            context_ptr->vbv_bits_q[temporal_layer_index + 1] = q;
+            context_ptr->vbv_bits_coeff_fed_back[temporal_layer_index + 1] = EB_FALSE;
+            context_ptr->vbv_layer_bits[temporal_layer_index] = 0;
+        }
+    }
 
     for (uint32_t base_qp = 0; base_qp < MAX_REF_QP_NUM; base_qp++) {
         if (base_qp < 64) {
@@ -3531,9 +3938,11 @@ void* rate_control_kernel(void *input_ptr)
 
     RateControlTaskTypes               task_type;
     EbRateControlModel          *rc_model_ptr;
+    TwoPassRateControl          *two_pass_rc_ptr;
     RATE_CONTROL                 rc;
 
     rate_control_model_ctor(&rc_model_ptr);
+    two_pass_rate_control_ctor(&two_pass_rc_ptr);
 
     for (;;) {
         // Get RateControl Task
@@ -3553,6 +3962,8 @@ void* rate_control_kernel(void *input_ptr)
 
             if (picture_control_set_ptr->picture_number == 0) {
                 rate_control_model_init(rc_model_ptr, sequence_control_set_ptr);
+                if (sequence_control_set_ptr->static_config.pass == 2)
+                    two_pass_rate_control_init(two_pass_rc_ptr, sequence_control_set_ptr, sequence_control_set_ptr->encode_context_ptr->first_pass_stats);
 
                 av1_rc_init_minq_luts();
                 //init rate control parameters
@@ -3561,7 +3972,7 @@ void* rate_control_kernel(void *input_ptr)
                     picture_control_set_ptr,
                     sequence_control_set_ptr);
             }
-            if (sequence_control_set_ptr->static_config.rate_control_mode)
+            if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode))
             {
                 picture_control_set_ptr->parent_pcs_ptr->intra_selected_org_qp = 0;
                 // High level RC
@@ -3582,7 +3993,7 @@ void* rate_control_kernel(void *input_ptr)
             }
 
             // Frame level RC. Find the ParamPtr for the current GOP
-            if (sequence_control_set_ptr->intra_period_length == -1 || sequence_control_set_ptr->static_config.rate_control_mode == 0) {
+            if (sequence_control_set_ptr->intra_period_length == -1 || sequence_control_set_ptr->static_config.rate_control_mode == 1 || rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode)) {
                 rate_control_param_ptr = context_ptr->rate_control_param_queue[0];
                 prev_gop_rate_control_param_ptr = context_ptr->rate_control_param_queue[0];
                 next_gop_rate_control_param_ptr = context_ptr->rate_control_param_queue[0];
@@ -3615,13 +4026,15 @@ void* rate_control_kernel(void *input_ptr)
 
             rate_control_layer_ptr = rate_control_param_ptr->rate_control_layer_array[picture_control_set_ptr->temporal_layer_index];
 
-            if (sequence_control_set_ptr->static_config.rate_control_mode == 0) {
-                // if RC mode is 0,  fixed QP is used
+            if (rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode)) {
+                // if RC mode is 0,  fixed QP is used, the CRF of mode 4 starts from it
                 // QP scaling based on POC number for Flat IPPP structure
                 picture_control_set_ptr->parent_pcs_ptr->base_qindex = quantizer_to_qindex[picture_control_set_ptr->picture_qp];
 
                 if (sequence_control_set_ptr->static_config.enable_qp_scaling_flag && picture_control_set_ptr->parent_pcs_ptr->qp_on_the_fly == EB_FALSE) {
-                    const int32_t qindex = quantizer_to_qindex[(uint8_t)sequence_control_set_ptr->qp];
+                    const int32_t qindex = sequence_control_set_ptr->static_config.rate_control_mode == 4 ?
+                        vbv_cq_qindex(picture_control_set_ptr, sequence_control_set_ptr, context_ptr) :
+                        quantizer_to_qindex[(uint8_t)sequence_control_set_ptr->qp];
                     const double q_val = av1_convert_qindex_to_q(qindex, (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth);
                     // if there are need enough pictures in the LAD/SlidingWindow, the adaptive QP scaling is not used
                     if (picture_control_set_ptr->parent_pcs_ptr->frames_in_sw >= QPS_SW_THRESH) {
@@ -3671,6 +4084,12 @@ void* rate_control_kernel(void *input_ptr)
                     picture_control_set_ptr->parent_pcs_ptr->base_qindex = quantizer_to_qindex[picture_control_set_ptr->picture_qp];
                 }
 
+                if (sequence_control_set_ptr->static_config.rate_control_mode == 4)
+                    frame_level_rc_input_picture_crf(
+                        picture_control_set_ptr,
+                        sequence_control_set_ptr,
+                        context_ptr);
+
                 picture_control_set_ptr->parent_pcs_ptr->picture_qp = picture_control_set_ptr->picture_qp;
                 setup_segmentation(
                         picture_control_set_ptr,
@@ -3680,8 +4099,12 @@ void* rate_control_kernel(void *input_ptr)
             }
             else {
                 // ***Rate Control***
-                if (sequence_control_set_ptr->static_config.rate_control_mode == 1)
-                    picture_control_set_ptr->picture_qp = rate_control_get_quantizer(rc_model_ptr, picture_control_set_ptr->parent_pcs_ptr);
+                if (sequence_control_set_ptr->static_config.rate_control_mode == 1) {
+                    if (sequence_control_set_ptr->static_config.pass == 2)
+                        picture_control_set_ptr->picture_qp = two_pass_rate_control_get_quantizer(two_pass_rc_ptr, picture_control_set_ptr->parent_pcs_ptr);
+                    else
+                        picture_control_set_ptr->picture_qp = rate_control_get_quantizer(rc_model_ptr, picture_control_set_ptr->parent_pcs_ptr);
+                }
                 else if (sequence_control_set_ptr->static_config.rate_control_mode == 2) {
                     frame_level_rc_input_picture_vbr(
                         picture_control_set_ptr,
@@ -3777,9 +4200,13 @@ void* rate_control_kernel(void *input_ptr)
 
             parentpicture_control_set_ptr = (PictureParentControlSet  *)rate_control_tasks_ptr->picture_control_set_wrapper_ptr->object_ptr;
             sequence_control_set_ptr = (SequenceControlSet *)parentpicture_control_set_ptr->sequence_control_set_wrapper_ptr->object_ptr;
-            if (sequence_control_set_ptr->static_config.rate_control_mode) {
-                if (sequence_control_set_ptr->static_config.rate_control_mode == 1)
-                    rate_control_update_model(rc_model_ptr, parentpicture_control_set_ptr);
+            if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode)) {
+                if (sequence_control_set_ptr->static_config.rate_control_mode == 1) {
+                    if (sequence_control_set_ptr->static_config.pass == 2)
+                        two_pass_rate_control_update(two_pass_rc_ptr, parentpicture_control_set_ptr);
+                    else
+                        rate_control_update_model(rc_model_ptr, parentpicture_control_set_ptr);
+                }
                 ReferenceQueueEntry           *reference_entry_ptr;
                 uint32_t                          reference_queue_index;
                 EncodeContext             *encode_context_ptr = sequence_control_set_ptr->encode_context_ptr;
@@ -3797,7 +4224,7 @@ void* rate_control_kernel(void *input_ptr)
                 } while ((reference_queue_index != encode_context_ptr->reference_picture_queue_tail_index) && (reference_entry_ptr->picture_number != parentpicture_control_set_ptr->picture_number));
             }
             // Frame level RC
-            if (sequence_control_set_ptr->intra_period_length == -1 || sequence_control_set_ptr->static_config.rate_control_mode == 0) {
+            if (sequence_control_set_ptr->intra_period_length == -1 || sequence_control_set_ptr->static_config.rate_control_mode == 1 || rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode)) {
                 rate_control_param_ptr = context_ptr->rate_control_param_queue[0];
                 prev_gop_rate_control_param_ptr = context_ptr->rate_control_param_queue[0];
                 if (parentpicture_control_set_ptr->slice_type == I_SLICE) {
@@ -3831,7 +4258,12 @@ void* rate_control_kernel(void *input_ptr)
                     context_ptr->rate_control_param_queue[PARALLEL_GOP_MAX_NUMBER - 1] :
                     context_ptr->rate_control_param_queue[interval_index_temp - 1];
             }
-            if (sequence_control_set_ptr->static_config.rate_control_mode != 0) {
+            if (sequence_control_set_ptr->static_config.rate_control_mode == 4)
+                frame_level_rc_feedback_picture_crf(
+                    parentpicture_control_set_ptr,
+                    sequence_control_set_ptr,
+                    context_ptr);
+            else if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode)) {
                 context_ptr->previous_virtual_buffer_level = context_ptr->virtual_buffer_level;
 
                 context_ptr->virtual_buffer_level =
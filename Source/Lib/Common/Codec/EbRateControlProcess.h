@@ -31,6 +31,9 @@
 
 #define RC_QPMOD_MAXQP             54
 
+#define VBV_REORDER_QUEUE_MAX_DEPTH 2048 // Same as the reorder queue of the packetization
+#define VBV_MINI_GOP_QUEUE_MAX_DEPTH  64 // Mini GOPs given a QP at the same time
+
 static const uint32_t  rate_percentage_layer_array[EB_MAX_TEMPORAL_LAYERS][EB_MAX_TEMPORAL_LAYERS] =
 {
     {100,  0,  0,  0,  0,  0 },
@@ -89,6 +92,16 @@ typedef struct CodedFramesStatsEntry
     int64_t               frame_total_bit_actual;
     EbBool              end_of_sequence_flag;
 } CodedFramesStatsEntry;
+/**************************************
+ * VBV Mini GOP, set by the base layer
+ * picture of the mini GOP
+ **************************************/
+typedef struct VbvMiniGopEntry
+{
+    uint64_t               base_picture_number;
+    uint64_t               base_decode_order;
+    double                 q_scale;
+} VbvMiniGopEntry;
 /**************************************
  * Context
  **************************************/
@@ -239,6 +252,35 @@ typedef struct RateControlContext
 
     uint32_t                           qp_scaling_map[EB_MAX_TEMPORAL_LAYERS][MAX_REF_QP_NUM];
     uint32_t                           qp_scaling_map_I_SLICE[MAX_REF_QP_NUM];
+
+    // VBV of the rate control mode 4, in bits. The fullness is the one of the
+    // buffer of the decoder before it removes the picture of decode order
+    // vbv_next_decode_order
+    double                             vbv_buffer_size;
+    double                             vbv_bits_per_frame;
+    double                             vbv_fullness;
+    uint64_t                           vbv_next_decode_order;
+    // The pictures are given a QP and fed back in coding order but removed
+    // from the buffer in decode order. Size of the pictures not removed yet by
+    // decode order, predicted until they are fed back, -1 when not given a QP,
+    // and number of frames they show, 0 when hidden
+    double                             vbv_picture_bits[VBV_REORDER_QUEUE_MAX_DEPTH];
+    uint8_t                            vbv_picture_frames[VBV_REORDER_QUEUE_MAX_DEPTH];
+    EbBool                             vbv_picture_coded[VBV_REORDER_QUEUE_MAX_DEPTH];
+    // Mini GOPs given a QP, in parallel, the last one at vbv_mini_gop_index
+    VbvMiniGopEntry                    vbv_mini_gop[VBV_MINI_GOP_QUEUE_MAX_DEPTH];
+    uint32_t                           vbv_mini_gop_index;
+    // Size of a picture over its complexity at the q of the last feedback, for
+    // the intra pictures then for each temporal layer
+    double                             vbv_bits_ratio[EB_MAX_TEMPORAL_LAYERS + 1];
+    double                             vbv_bits_q[EB_MAX_TEMPORAL_LAYERS + 1];
+    EbBool                             vbv_bits_coeff_fed_back[EB_MAX_TEMPORAL_LAYERS + 1];
+    // Size of the last pictures of each temporal layer at the q scale 1, 0
+    // until a picture of the layer is fed back
+    double                             vbv_layer_bits[EB_MAX_TEMPORAL_LAYERS];
+    // Ratio of the q to the one of the constant quality level of the last
+    // reference picture given a QP
+    double                             vbv_reference_q_raise;
 } RateControlContext;
 /**************************************
  * Extern Function Declarations
@@ -261,4 +303,13 @@ extern EbErrorType rate_control_context_ctor(
 
 extern void* rate_control_kernel(void *input_ptr);
 
+extern double av1_convert_qindex_to_q(
+    int32_t                qindex,
+    AomBitDepth            bit_depth);
+
+extern int32_t av1_compute_qdelta(
+    double                 qstart,
+    double                 qtarget,
+    AomBitDepth            bit_depth);
+
 #endif // EbRateControl_h
@@ -135,10 +135,17 @@ EbErrorType eb_reference_object_ctor(
     EbPictureBufferDescInitData    *pictureBufferDescInitDataPtr = (EbPictureBufferDescInitData*)object_init_data_ptr;
     EbPictureBufferDescInitData    pictureBufferDescInitData16BitPtr = *pictureBufferDescInitDataPtr;
     EbErrorType return_error = EB_ErrorNone;
+    const uint32_t picture_block_count =
+        ((pictureBufferDescInitDataPtr->max_width + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64) *
+        ((pictureBufferDescInitDataPtr->max_height + BLOCK_SIZE_64 - 1) / BLOCK_SIZE_64);
     EB_MALLOC(EbReferenceObject*, referenceObject, sizeof(EbReferenceObject), EB_N_PTR);
 
     *object_dbl_ptr = (EbPtr)referenceObject;
 
+    // Per 64x64 block arrays, sized to the picture
+    EB_MALLOC(uint8_t*, referenceObject->intra_coded_area_sb, sizeof(uint8_t) * picture_block_count, EB_N_PTR);
+    EB_MALLOC(uint32_t*, referenceObject->non_moving_index_array, sizeof(uint32_t) * picture_block_count, EB_N_PTR);
+
     //TODO:12bit
     if (pictureBufferDescInitData16BitPtr.bit_depth == EB_10BIT) {
         // Hsan: set split_mode to 0 to construct the packed reference buffer (used @ EP)
@@ -152,8 +159,9 @@ EbErrorType eb_reference_object_ctor(
             &pictureBufferDescInitData16BitPtr,
             pictureBufferDescInitData16BitPtr.bit_depth);
 
-        // Hsan: set split_mode to 1 to construct the unpacked reference buffer (used @ MD)
-        pictureBufferDescInitData16BitPtr.split_mode = EB_TRUE;
+        // MD only predicts from the 8 msb of the reference, keep them alone
+        // instead of an unpacked 8 + 2 bit copy of the packed buffer
+        pictureBufferDescInitData16BitPtr.bit_depth = EB_8BIT;
         return_error = eb_picture_buffer_desc_ctor(
             (EbPtr*)&(referenceObject->reference_picture),
             (EbPtr)&pictureBufferDescInitData16BitPtr);
@@ -192,6 +200,7 @@ EbErrorType eb_pa_reference_object_ctor(
     EbErrorType return_error = EB_ErrorNone;
     EB_MALLOC(EbPaReferenceObject*, paReferenceObject, sizeof(EbPaReferenceObject), EB_N_PTR);
     *object_dbl_ptr = (EbPtr)paReferenceObject;
+    paReferenceObject->input_picture_wrapper_ptr = (EbObjectWrapper*)EB_NULL;
 
     // Reference picture constructor
     return_error = eb_picture_buffer_desc_ctor(
@@ -9,11 +9,12 @@
 #include "EbDefinitions.h"
 #include "EbDefinitions.h"
 #include "EbAdaptiveMotionVectorPrediction.h"
+#include "EbSystemResourceManager.h"
 
 typedef struct EbReferenceObject
 {
-    EbPictureBufferDesc          *reference_picture;
-    EbPictureBufferDesc          *reference_picture16bit;
+    EbPictureBufferDesc          *reference_picture;      // 8 bit samples, the 8 msb for high bit depth (used @ MD)
+    EbPictureBufferDesc          *reference_picture16bit; // packed high bit depth samples
     uint64_t                        ref_poc;
 #if ADD_DELTA_QP_SUPPORT
     uint16_t                        qp;
@@ -22,8 +23,8 @@ typedef struct EbReferenceObject
 #endif
     EB_SLICE                        slice_type;
     uint8_t                         intra_coded_area;//percentage of intra coded area 0-100%
-    uint8_t                         intra_coded_area_sb[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];//percentage of intra coded area 0-100%
-    uint32_t                        non_moving_index_array[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];//array to hold non-moving blocks in reference frames
+    uint8_t                        *intra_coded_area_sb;//percentage of intra coded area 0-100%, per 64x64 block
+    uint32_t                       *non_moving_index_array;//array to hold non-moving blocks in reference frames, per 64x64 block
     uint32_t                        picSampleValue[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT][3];// [Y U V];
     uint8_t                         tmp_layer_idx;
     EbBool                          is_scene_change;
@@ -45,10 +46,11 @@ typedef struct EbPaReferenceObject
     EbPictureBufferDesc          *sixteenth_decimated_picture_ptr;
     EbPictureBufferDesc          *quarter_filtered_picture_ptr;
     EbPictureBufferDesc          *sixteenth_filtered_picture_ptr;
-    uint16_t                      variance[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
-    uint8_t                       y_mean[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];
     EB_SLICE                      slice_type;
     uint32_t                      dependent_pictures_count; //number of pic using this reference frame
+    // Input picture whose luma input_padded_picture_ptr points to, held until
+    // the reference is released (zero copy input only)
+    EbObjectWrapper              *input_picture_wrapper_ptr;
 
 } EbPaReferenceObject;
 
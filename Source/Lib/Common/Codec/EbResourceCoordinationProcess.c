@@ -399,26 +399,31 @@ static EbErrorType copy_frame_buffer(
         uint16_t     lumaWidth = (uint16_t)(dst_picture_ptr->width - sequence_control_set_ptr->max_input_pad_right) << is16BitInput;
         uint16_t     chromaWidth = (lumaWidth >> 1) << is16BitInput;
         uint16_t     lumaHeight = (uint16_t)(dst_picture_ptr->height - sequence_control_set_ptr->max_input_pad_bottom);
+        // The source may be the application's planes (zero copy input), with its own strides
+        uint32_t     srcLumaBufferOffset = src_picture_ptr->stride_y*sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding;
+        uint32_t     srcChromaBufferOffset = src_picture_ptr->stride_cr*(sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1);
+        uint16_t     srcLumaStride = src_picture_ptr->stride_y;
+        uint16_t     srcChromaStride = src_picture_ptr->stride_cb;
 
         //uint16_t     lumaHeight  = input_picture_ptr->max_height;
         // Y
         for (inputRowIndex = 0; inputRowIndex < lumaHeight; inputRowIndex++) {
             EB_MEMCPY((dst_picture_ptr->buffer_y + lumaBufferOffset + lumaStride * inputRowIndex),
-                (src_picture_ptr->buffer_y + lumaBufferOffset + lumaStride * inputRowIndex),
+                (src_picture_ptr->buffer_y + srcLumaBufferOffset + srcLumaStride * inputRowIndex),
                 lumaWidth);
         }
 
         // U
         for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
             EB_MEMCPY((dst_picture_ptr->buffer_cb + chromaBufferOffset + chromaStride * inputRowIndex),
-                (src_picture_ptr->buffer_cb + chromaBufferOffset + chromaStride * inputRowIndex),
+                (src_picture_ptr->buffer_cb + srcChromaBufferOffset + srcChromaStride * inputRowIndex),
                 chromaWidth);
         }
 
         // V
         for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
             EB_MEMCPY((dst_picture_ptr->buffer_cr + chromaBufferOffset + chromaStride * inputRowIndex),
-                (src_picture_ptr->buffer_cr + chromaBufferOffset + chromaStride * inputRowIndex),
+                (src_picture_ptr->buffer_cr + srcChromaBufferOffset + srcChromaStride * inputRowIndex),
                 chromaWidth);
         }
     }
@@ -704,7 +709,9 @@ void* resource_coordination_kernel(void *input_ptr)
             picture_control_set_ptr->enhanced_picture_ptr = (EbPictureBufferDesc*)ebInputPtr->p_buffer;
             picture_control_set_ptr->input_ptr = ebInputPtr;
             end_of_sequence_flag = (picture_control_set_ptr->input_ptr->flags & EB_BUFFERFLAG_EOS) ? EB_TRUE : EB_FALSE;
-            EbStartTime(&picture_control_set_ptr->start_time_seconds, &picture_control_set_ptr->start_time_u_seconds);
+            // Latency is measured from eb_svt_enc_send_picture
+            picture_control_set_ptr->start_time_seconds = (uint64_t)ebInputPtr->dts / 1000000;
+            picture_control_set_ptr->start_time_u_seconds = (uint64_t)ebInputPtr->dts % 1000000;
 
             picture_control_set_ptr->sequence_control_set_wrapper_ptr = context_ptr->sequenceControlSetActiveArray[instance_index];
             picture_control_set_ptr->sequence_control_set_ptr = sequence_control_set_ptr;
@@ -769,7 +776,7 @@ void* resource_coordination_kernel(void *input_ptr)
 #endif
             // Rate Control
             // Set the ME Distortion and OIS Historgrams to zero
-            if (sequence_control_set_ptr->static_config.rate_control_mode) {
+            if (rc_uses_bitrate_queues(sequence_control_set_ptr->static_config.rate_control_mode)) {
                 EB_MEMSET(picture_control_set_ptr->me_distortion_histogram, 0, NUMBER_OF_SAD_INTERVALS * sizeof(uint16_t));
                 EB_MEMSET(picture_control_set_ptr->ois_distortion_histogram, 0, NUMBER_OF_INTRA_SAD_INTERVALS * sizeof(uint16_t));
             }
@@ -815,6 +822,15 @@ void* resource_coordination_kernel(void *input_ptr)
                     picture_control_set_ptr->pa_reference_picture_wrapper_ptr,
                     2);
             ((EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr)->input_padded_picture_ptr->buffer_y = picture_control_set_ptr->enhanced_picture_ptr->buffer_y;
+            if (sequence_control_set_ptr->encode_context_ptr->zero_copy_input) {
+                // The input planes are the application's, with its stride. The PA reference
+                // reads them after the picture is coded : it holds the input picture too
+                ((EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr)->input_padded_picture_ptr->stride_y = picture_control_set_ptr->enhanced_picture_ptr->stride_y;
+                eb_object_inc_live_count(
+                    picture_control_set_ptr->input_picture_wrapper_ptr,
+                    2);
+                ((EbPaReferenceObject*)picture_control_set_ptr->pa_reference_picture_wrapper_ptr->object_ptr)->input_picture_wrapper_ptr = picture_control_set_ptr->input_picture_wrapper_ptr;
+            }
 
             // Get Empty Output Results Object
             if (picture_control_set_ptr->picture_number > 0 && (prevPictureControlSetWrapperPtr != NULL))
@@ -18,6 +18,7 @@
 #include "EbDefinitions.h"
 #include "EbRestProcess.h"
 #include "EbEncDecResults.h"
+#include "EbEntropyCodingProcess.h"
 
 #include "EbThreads.h"
 #include "EbPictureDemuxResults.h"
@@ -222,7 +223,8 @@ void* rest_kernel(void *input_ptr)
         EbBool  is16bit = (EbBool)(sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
         Av1Common* cm = picture_control_set_ptr->parent_pcs_ptr->av1_cm;
 
-        if (sequence_control_set_ptr->seq_header.enable_restoration && picture_control_set_ptr->parent_pcs_ptr->allow_intrabc == 0)
+        // The fused loop filter searched and filtered the picture behind the deblocking
+        if (sequence_control_set_ptr->seq_header.enable_restoration && picture_control_set_ptr->parent_pcs_ptr->allow_intrabc == 0 && !picture_control_set_ptr->fused_loop_filter)
         {
             get_own_recon(sequence_control_set_ptr, picture_control_set_ptr, context_ptr, is16bit);
 
@@ -257,18 +259,20 @@ void* rest_kernel(void *input_ptr)
         if (picture_control_set_ptr->tot_seg_searched_rest == picture_control_set_ptr->rest_segments_total_count)
         {
             if (sequence_control_set_ptr->seq_header.enable_restoration && picture_control_set_ptr->parent_pcs_ptr->allow_intrabc == 0) {
-                rest_finish_search(
-                    picture_control_set_ptr->parent_pcs_ptr->av1x,
-                    picture_control_set_ptr->parent_pcs_ptr->av1_cm);
-
-                if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
-                    cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
-                {
-                    av1_loop_restoration_filter_frame(
-                        cm->frame_to_show,
-                        cm,
-                        0);
+                if (!picture_control_set_ptr->fused_loop_filter) {
+                    rest_finish_search(
+                        picture_control_set_ptr->parent_pcs_ptr->av1x,
+                        picture_control_set_ptr->parent_pcs_ptr->av1_cm);
+
+                    if (cm->rst_info[0].frame_restoration_type != RESTORE_NONE ||
+                        cm->rst_info[1].frame_restoration_type != RESTORE_NONE ||
+                        cm->rst_info[2].frame_restoration_type != RESTORE_NONE)
+                    {
+                        av1_loop_restoration_filter_frame(
+                            cm->frame_to_show,
+                            cm,
+                            0);
+                    }
                 }
             }
             else {
@@ -328,16 +332,20 @@ void* rest_kernel(void *input_ptr)
                 eb_post_full_object(picture_demux_results_wrapper_ptr);
             }
 
-            // Get Empty rest Results to EC
-            eb_get_empty_object(
-                context_ptr->rest_output_fifo_ptr,
-                &rest_results_wrapper_ptr);
-            rest_results_ptr = (struct RestResults*)rest_results_wrapper_ptr->object_ptr;
-            rest_results_ptr->picture_control_set_wrapper_ptr = cdef_results_ptr->picture_control_set_wrapper_ptr;
-            rest_results_ptr->completed_lcu_row_index_start = 0;
-            rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
-            // Post Rest Results
-            eb_post_full_object(rest_results_wrapper_ptr);
+            // Get Empty rest Results to EC, one per entropy coding tile task
+            const uint16_t tile_task_count = get_entropy_coding_tile_task_count(picture_control_set_ptr);
+            for (uint16_t tile_index = 0; tile_index < tile_task_count; ++tile_index) {
+                eb_get_empty_object(
+                    context_ptr->rest_output_fifo_ptr,
+                    &rest_results_wrapper_ptr);
+                rest_results_ptr = (struct RestResults*)rest_results_wrapper_ptr->object_ptr;
+                rest_results_ptr->picture_control_set_wrapper_ptr = cdef_results_ptr->picture_control_set_wrapper_ptr;
+                rest_results_ptr->completed_lcu_row_index_start = 0;
+                rest_results_ptr->completed_lcu_row_count = ((sequence_control_set_ptr->seq_header.max_frame_height + sequence_control_set_ptr->sb_size_pix - 1) >> lcuSizeLog2);
+                rest_results_ptr->tile_index = tile_index;
+                // Post Rest Results
+                eb_post_full_object(rest_results_wrapper_ptr);
+            }
         }
         eb_release_mutex(picture_control_set_ptr->rest_search_mutex);
 
@@ -225,50 +225,69 @@ EbErrorType av1_alloc_restoration_struct(struct Av1Common *cm, RestorationInfo *
 }
 
 static void extend_frame_lowbd(uint8_t *data, int32_t width, int32_t height, int32_t stride,
-    int32_t border_horz, int32_t border_vert) {
+    int32_t border_horz, int32_t border_vert, int32_t row_start, int32_t row_end) {
     uint8_t *data_p;
     int32_t i;
-    for (i = 0; i < height; ++i) {
+    for (i = row_start; i < row_end; ++i) {
         data_p = data + i * stride;
         memset(data_p - border_horz, data_p[0], border_horz);
         memset(data_p + width, data_p[width - 1], border_horz);
     }
     data_p = data - border_horz;
-    for (i = -border_vert; i < 0; ++i)
-        memcpy(data_p + i * stride, data_p, width + 2 * border_horz);
-    for (i = height; i < height + border_vert; ++i) {
-        memcpy(data_p + i * stride, data_p + (height - 1) * stride,
-            width + 2 * border_horz);
+    if (row_start == 0) {
+        for (i = -border_vert; i < 0; ++i)
+            memcpy(data_p + i * stride, data_p, width + 2 * border_horz);
+    }
+    if (row_end == height) {
+        for (i = height; i < height + border_vert; ++i) {
+            memcpy(data_p + i * stride, data_p + (height - 1) * stride,
+                width + 2 * border_horz);
+        }
     }
 }
 
 static void extend_frame_highbd(uint16_t *data, int32_t width, int32_t height,
-    int32_t stride, int32_t border_horz, int32_t border_vert) {
+    int32_t stride, int32_t border_horz, int32_t border_vert, int32_t row_start,
+    int32_t row_end) {
     uint16_t *data_p;
     int32_t i, j;
-    for (i = 0; i < height; ++i) {
+    for (i = row_start; i < row_end; ++i) {
         data_p = data + i * stride;
         for (j = -border_horz; j < 0; ++j) data_p[j] = data_p[0];
         for (j = width; j < width + border_horz; ++j) data_p[j] = data_p[width - 1];
     }
     data_p = data - border_horz;
-    for (i = -border_vert; i < 0; ++i) {
-        memcpy(data_p + i * stride, data_p,
-            (width + 2 * border_horz) * sizeof(uint16_t));
+    if (row_start == 0) {
+        for (i = -border_vert; i < 0; ++i) {
+            memcpy(data_p + i * stride, data_p,
+                (width + 2 * border_horz) * sizeof(uint16_t));
+        }
     }
-    for (i = height; i < height + border_vert; ++i) {
-        memcpy(data_p + i * stride, data_p + (height - 1) * stride,
-            (width + 2 * border_horz) * sizeof(uint16_t));
+    if (row_end == height) {
+        for (i = height; i < height + border_vert; ++i) {
+            memcpy(data_p + i * stride, data_p + (height - 1) * stride,
+                (width + 2 * border_horz) * sizeof(uint16_t));
+        }
     }
 }
 
-void extend_frame(uint8_t *data, int32_t width, int32_t height, int32_t stride,
-    int32_t border_horz, int32_t border_vert, int32_t highbd) {
+// Extend the rows [row_start, row_end) to the left and right, and above or
+// below the frame when the range holds its first or last row
+void extend_frame_rows(uint8_t *data, int32_t width, int32_t height, int32_t stride,
+    int32_t border_horz, int32_t border_vert, int32_t row_start, int32_t row_end,
+    int32_t highbd) {
     if (highbd)
         extend_frame_highbd(CONVERT_TO_SHORTPTR(data), width, height, stride,
-            border_horz, border_vert);
+            border_horz, border_vert, row_start, row_end);
     else
-        extend_frame_lowbd(data, width, height, stride, border_horz, border_vert);
+        extend_frame_lowbd(data, width, height, stride, border_horz, border_vert,
+            row_start, row_end);
+}
+
+void extend_frame(uint8_t *data, int32_t width, int32_t height, int32_t stride,
+    int32_t border_horz, int32_t border_vert, int32_t highbd) {
+    extend_frame_rows(data, width, height, stride, border_horz, border_vert, 0,
+        height, highbd);
 }
 
 static void copy_tile_lowbd(int32_t width, int32_t height, const uint8_t *src,
@@ -1315,8 +1334,8 @@ void av1_loop_restoration_filter_frame(Yv12BufferConfig *frame,
 static void foreach_rest_unit_in_tile(const AV1PixelRect *tile_rect,
     int32_t tile_row, int32_t tile_col, int32_t tile_cols,
     int32_t hunits_per_tile, int32_t units_per_tile,
-    int32_t unit_size, int32_t ss_y,
-    RestUnitVisitor on_rest_unit,
+    int32_t unit_size, int32_t ss_y, int32_t unit_row_start,
+    int32_t unit_row_end, RestUnitVisitor on_rest_unit,
     void *priv) {
     const int32_t tile_w = tile_rect->right - tile_rect->left;
     const int32_t tile_h = tile_rect->bottom - tile_rect->top;
@@ -1340,7 +1359,7 @@ static void foreach_rest_unit_in_tile(const AV1PixelRect *tile_rect,
         if (limits.v_end < tile_rect->bottom) limits.v_end -= voffset;
 
         int32_t x0 = 0, j = 0;
-        while (x0 < tile_w) {
+        while (i >= unit_row_start && i < unit_row_end && x0 < tile_w) {
             int32_t remaining_w = tile_w - x0;
             int32_t w = (remaining_w < ext_size) ? remaining_w : unit_size;
 
@@ -1375,8 +1394,97 @@ void av1_foreach_rest_unit_in_frame(Av1Common *cm, int32_t plane,
 
     foreach_rest_unit_in_tile(&tile_rect, 0, 0, 1, rsi->horz_units_per_tile,
         rsi->units_per_tile, rsi->restoration_unit_size,
-        ss_y, on_rest_unit, priv);
+        ss_y, 0, rsi->vert_units_per_tile, on_rest_unit, priv);
 }
+
+// Call on_rest_unit for each loop restoration unit in the unit row of the
+// plane
+void av1_foreach_rest_unit_in_row(Av1Common *cm, int32_t plane,
+    int32_t unit_row,
+    RestUnitVisitor on_rest_unit,
+    void *priv) {
+    const int32_t is_uv = plane > 0;
+    const int32_t ss_y = is_uv && cm->subsampling_y;
+
+    const RestorationInfo *rsi = &cm->rst_info[plane];
+
+    const AV1PixelRect tile_rect = whole_frame_rect(cm, is_uv);
+
+    foreach_rest_unit_in_tile(&tile_rect, 0, 0, 1, rsi->horz_units_per_tile,
+        rsi->units_per_tile, rsi->restoration_unit_size,
+        ss_y, unit_row, unit_row + 1, on_rest_unit, priv);
+}
+
+// The rows [*v_start, *v_end) of the plane covered by its unit row, as laid
+// out by foreach_rest_unit_in_tile
+void av1_rest_unit_row_limits(const Av1Common *cm, int32_t plane,
+    int32_t unit_row, int32_t *v_start, int32_t *v_end) {
+    const int32_t is_uv = plane > 0;
+    const int32_t ss_y = is_uv && cm->subsampling_y;
+    const RestorationInfo *rsi = &cm->rst_info[plane];
+    const AV1PixelRect tile_rect = whole_frame_rect(cm, is_uv);
+    const int32_t unit_size = rsi->restoration_unit_size;
+    const int32_t voffset = RESTORATION_UNIT_OFFSET >> ss_y;
+    const int32_t y0 = unit_row * unit_size;
+    const int32_t bottom =
+        (unit_row == rsi->vert_units_per_tile - 1) ? tile_rect.bottom : tile_rect.top + y0 + unit_size;
+
+    *v_start = AOMMAX(tile_rect.top, tile_rect.top + y0 - voffset);
+    *v_end = (bottom < tile_rect.bottom) ? bottom - voffset : bottom;
+}
+// Allocate the restoration output of a frame filtered one unit row at a
+// time by av1_loop_restoration_filter_unit_row
+void av1_loop_restoration_filter_rows_init(Yv12BufferConfig *frame,
+    Av1Common *cm) {
+    if (aom_realloc_frame_buffer(&cm->rst_frame, frame->crop_widths[0],
+        frame->crop_heights[0], cm->subsampling_x, cm->subsampling_y,
+        cm->use_highbitdepth, AOM_BORDER_IN_PIXELS,
+        cm->byte_alignment, NULL, NULL, NULL) < 0)
+        printf("Failed to allocate restoration dst buffer\n");
+}
+
+// Filter the units of a unit row of the plane and copy them back to the
+// frame. A unit row only reads its own rows, the stripe boundaries come from
+// the saved lines, so the rows below must be final but the ones above may
+// already be restored.
+void av1_loop_restoration_filter_unit_row(Yv12BufferConfig *frame,
+    Av1Common *cm, int32_t plane, int32_t unit_row) {
+    RestorationInfo *rsi = &cm->rst_info[plane];
+    Yv12BufferConfig *dst = &cm->rst_frame;
+    RestorationLineBuffers rlbs;
+    const int32_t is_uv = plane > 0;
+    const int32_t highbd = cm->use_highbitdepth;
+    int32_t v_start, v_end;
+
+    if (rsi->frame_restoration_type == RESTORE_NONE)
+        return;
+    rsi->optimized_lr = 0;
+
+    FilterFrameCtxt ctxt;
+    ctxt.rsi = rsi;
+    ctxt.rlbs = &rlbs;
+    ctxt.cm = cm;
+    ctxt.tile_stripe0 = 0;
+    ctxt.ss_x = is_uv && cm->subsampling_x;
+    ctxt.ss_y = is_uv && cm->subsampling_y;
+    ctxt.highbd = highbd;
+    ctxt.bit_depth = cm->bit_depth;
+    ctxt.data8 = frame->buffers[plane];
+    ctxt.dst8 = dst->buffers[plane];
+    ctxt.data_stride = frame->strides[is_uv];
+    ctxt.dst_stride = dst->strides[is_uv];
+    ctxt.tmpbuf = cm->rst_tmpbuf;
+
+    av1_foreach_rest_unit_in_row(cm, plane, unit_row, filter_frame_on_unit, &ctxt);
+
+    av1_rest_unit_row_limits(cm, plane, unit_row, &v_start, &v_end);
+    copy_tile(frame->crop_widths[is_uv], v_end - v_start,
+        dst->buffers[plane] + v_start * dst->strides[is_uv],
+        dst->strides[is_uv],
+        frame->buffers[plane] + v_start * frame->strides[is_uv],
+        frame->strides[is_uv], highbd);
+}
+
 static void foreach_rest_unit_in_tile_seg(const AV1PixelRect *tile_rect,
     int32_t tile_row, int32_t tile_col, int32_t tile_cols,
     int32_t hunits_per_tile, int32_t units_per_tile,
@@ -1645,9 +1753,17 @@ static void save_cdef_boundary_lines(const Yv12BufferConfig *frame,
         RESTORATION_EXTRA_HORZ, use_highbd);
 }
 
+// Whether the lines saved at a plane row lie in the 64x64 filter block row
+// fb_row, -1 standing for all of them
+static INLINE int32_t in_fb_row(int32_t row, int32_t ss_y, int32_t fb_row) {
+    return fb_row < 0 || ((row << ss_y) >> CDEF_BLOCKSIZE_LOG2) == fb_row;
+}
+
+// fb_row restricts the saving to the lines lying in that 64x64 filter block
+// row, -1 saves them all
 static void save_tile_row_boundary_lines(const Yv12BufferConfig *frame,
     int32_t use_highbd, int32_t plane,
-    Av1Common *cm, int32_t after_cdef) {
+    Av1Common *cm, int32_t after_cdef, int32_t fb_row) {
     const int32_t is_uv = plane > 0;
     const int32_t ss_y = is_uv && cm->subsampling_y;
     const int32_t stripe_height = RESTORATION_PROC_UNIT_SIZE >> ss_y;
@@ -1682,11 +1798,11 @@ static void save_tile_row_boundary_lines(const Yv12BufferConfig *frame,
 
         if (!after_cdef) {
             // Save deblocked context where needed.
-            if (use_deblock_above) {
+            if (use_deblock_above && in_fb_row(y0 - RESTORATION_CTX_VERT, ss_y, fb_row)) {
                 save_deblock_boundary_lines(frame, cm, plane, y0 - RESTORATION_CTX_VERT,
                     frame_stripe, use_highbd, 1, boundaries);
             }
-            if (use_deblock_below) {
+            if (use_deblock_below && in_fb_row(y1, ss_y, fb_row)) {
                 save_deblock_boundary_lines(frame, cm, plane, y1, frame_stripe,
                     use_highbd, 0, boundaries);
             }
@@ -1698,11 +1814,11 @@ static void save_tile_row_boundary_lines(const Yv12BufferConfig *frame,
             //
             // In addition, we need to save copies of the outermost line within
             // the tile, rather than using data from outside the tile.
-            if (!use_deblock_above) {
+            if (!use_deblock_above && in_fb_row(y0, ss_y, fb_row)) {
                 save_cdef_boundary_lines(frame, cm, plane, y0, frame_stripe, use_highbd,
                     1, boundaries);
             }
-            if (!use_deblock_below) {
+            if (!use_deblock_below && in_fb_row(y1 - 1, ss_y, fb_row)) {
                 save_cdef_boundary_lines(frame, cm, plane, y1 - 1, frame_stripe,
                     use_highbd, 0, boundaries);
             }
@@ -1718,7 +1834,17 @@ void av1_loop_restoration_save_boundary_lines(const Yv12BufferConfig *frame,
     const int32_t num_planes = 3;// av1_num_planes(cm);
     const int32_t use_highbd = cm->use_highbitdepth;
     for (int32_t p = 0; p < num_planes; ++p)
-        save_tile_row_boundary_lines(frame, use_highbd, p, cm, after_cdef);
+        save_tile_row_boundary_lines(frame, use_highbd, p, cm, after_cdef, -1);
+}
+
+// Same for the lines lying in the 64x64 filter block row fb_row only, for a
+// frame whose loop filters run one filter block row at a time
+void av1_loop_restoration_save_fb_row_boundary_lines(const Yv12BufferConfig *frame,
+    Av1Common *cm, int32_t fb_row, int32_t after_cdef) {
+    const int32_t num_planes = 3;// av1_num_planes(cm);
+    const int32_t use_highbd = cm->use_highbitdepth;
+    for (int32_t p = 0; p < num_planes; ++p)
+        save_tile_row_boundary_lines(frame, use_highbd, p, cm, after_cdef, fb_row);
 }
 
 // Assumes cm->rst_info[p].restoration_unit_size is already initialized
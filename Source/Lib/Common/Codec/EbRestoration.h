@@ -277,6 +277,9 @@ extern "C" {
     //                                  int32_t is_uv);
     void extend_frame(uint8_t *data, int32_t width, int32_t height, int32_t stride,
         int32_t border_horz, int32_t border_vert, int32_t highbd);
+    void extend_frame_rows(uint8_t *data, int32_t width, int32_t height, int32_t stride,
+        int32_t border_horz, int32_t border_vert, int32_t row_start, int32_t row_end,
+        int32_t highbd);
     void decode_xq(const int32_t *xqd, int32_t *xq, const SgrParamsType *params);
 
     // Filter a single loop restoration unit.
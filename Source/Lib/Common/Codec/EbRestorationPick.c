@@ -1976,3 +1976,101 @@ void rest_finish_search(Macroblock *x, Av1Common *const cm)
 
     aom_free(rusi);
 }
+
+void av1_foreach_rest_unit_in_row(Av1Common *cm, int32_t plane,
+    int32_t unit_row,
+    RestUnitVisitor on_rest_unit,
+    void *priv);
+
+// Start the reference filters of a unit row from the last ones its plane
+// picked before it
+static void rsc_on_unit_row(RestSearchCtxt *rsc, int32_t unit_idx0) {
+    const RestorationUnitInfo *unit_info = rsc->cm->rst_info[rsc->plane].unit_info;
+    int32_t wiener_found = 0;
+    int32_t sgrproj_found = 0;
+
+    reset_rsc(rsc);
+    set_default_sgrproj(&rsc->sgrproj);
+    set_default_wiener(&rsc->wiener);
+    for (int32_t u = unit_idx0 - 1; u >= 0 && !(wiener_found && sgrproj_found); --u) {
+        if (!wiener_found && unit_info[u].restoration_type == RESTORE_WIENER) {
+            rsc->wiener = unit_info[u].wiener_info;
+            wiener_found = 1;
+        }
+        if (!sgrproj_found && unit_info[u].restoration_type == RESTORE_SGRPROJ) {
+            rsc->sgrproj = unit_info[u].sgrproj_info;
+            sgrproj_found = 1;
+        }
+    }
+}
+
+// Start the restoration search of a frame searched one unit row at a time.
+// Its units are decided as their rows get ready, so the restoration type of
+// each plane is fixed upfront instead of being compared over the frame.
+void restoration_unit_row_search_init(Av1Common *const cm)
+{
+    for (int32_t plane = AOM_PLANE_Y; plane <= AOM_PLANE_V; ++plane)
+        cm->rst_info[plane].frame_restoration_type =
+            cm->wn_filter_mode ? RESTORE_SWITCHABLE : RESTORE_SGRPROJ;
+}
+
+// Search and decide the restoration units of a unit row of the plane, the
+// rows of the frame below it must be final
+void restoration_unit_row_search(
+    int32_t                *tmpbuf,
+    const Yv12BufferConfig *src,
+    Yv12BufferConfig       *trial_frame_rst,
+    PictureControlSet      *pcs_ptr,
+    int32_t                 plane,
+    int32_t                 unit_row)
+{
+    Av1Common *const cm = pcs_ptr->parent_pcs_ptr->av1_cm;
+    RestorationInfo *rsi = &cm->rst_info[plane];
+    RestUnitSearchInfo *rusi = pcs_ptr->parent_pcs_ptr->rusi_picture[plane];
+    const int32_t unit_idx0 = unit_row * rsi->horz_units_per_tile;
+    RestSearchCtxt rsc;
+
+    init_rsc_seg(cm->frame_to_show, src, cm, pcs_ptr->parent_pcs_ptr->av1x, plane, rusi, trial_frame_rst, &rsc);
+    rsc.rusi_pic = rusi;
+    rsc.pic_num = (uint32_t)pcs_ptr->picture_number;
+    rsc.tmpbuf = tmpbuf;
+    rsc.tile_stripe0 = 0;
+
+    av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_norestore_seg, &rsc);
+    if (cm->wn_filter_mode)
+        av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_wiener_seg, &rsc);
+    av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_sgrproj_seg, &rsc);
+
+    // Each type is first weighed against no restoration, as in the frame
+    // search, before the switchable pick
+    if (rsi->frame_restoration_type == RESTORE_SWITCHABLE) {
+        rsc_on_unit_row(&rsc, unit_idx0);
+        av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_wiener_finish, &rsc);
+    }
+    rsc_on_unit_row(&rsc, unit_idx0);
+    av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_sgrproj_finish, &rsc);
+    if (rsi->frame_restoration_type == RESTORE_SWITCHABLE) {
+        rsc_on_unit_row(&rsc, unit_idx0);
+        av1_foreach_rest_unit_in_row(cm, plane, unit_row, search_switchable, &rsc);
+    }
+
+    for (int32_t u = unit_idx0; u < unit_idx0 + rsi->horz_units_per_tile; ++u)
+        copy_unit_info(rsi->frame_restoration_type, &rusi[u], &rsi->unit_info[u]);
+}
+
+// Finish a frame searched one unit row at a time, the planes none of whose
+// units are filtered do not signal restoration at all
+void restoration_unit_row_search_finish(Av1Common *const cm)
+{
+    for (int32_t plane = AOM_PLANE_Y; plane <= AOM_PLANE_V; ++plane) {
+        RestorationInfo *rsi = &cm->rst_info[plane];
+        int32_t u;
+
+        for (u = 0; u < rsi->units_per_tile; ++u) {
+            if (rsi->unit_info[u].restoration_type != RESTORE_NONE)
+                break;
+        }
+        if (u == rsi->units_per_tile)
+            rsi->frame_restoration_type = RESTORE_NONE;
+    }
+}
@@ -14,9 +14,12 @@
 * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
 */
 
+#include <math.h>
+
 #include "EbSegmentation.h"
 #include "EbSegmentationParams.h"
 #include "EbMotionEstimationContext.h"
+#include "EbModeDecisionProcess.h"
 
 const int segmentation_feature_signed[SEG_LVL_MAX] = {
         1, 1, 1, 1, 1, 0, 0, 0
@@ -117,6 +120,17 @@ uint16_t get_variance_for_cu(const BlockGeom *blk_geom,
 
 }
 
+uint8_t get_sb_segment_id(
+        PictureParentControlSet *parent_pcs_ptr,
+        uint32_t sb_index) {
+    SegmentationParams *segmentation_params = &parent_pcs_ptr->segmentation_params;
+    uint32_t importance = parent_pcs_ptr->tpl_sb_importance[sb_index];
+    uint8_t segment_id = 0;
+    while (segment_id < MAX_SEGMENTS - 1 && importance > segmentation_params->importance_bin_edge[segment_id])
+        segment_id++;
+    return segment_id;
+}
+
 void apply_segmentation_based_quantization(
         const BlockGeom *blk_geom,
         PictureControlSet *picture_control_set_ptr,
@@ -124,11 +138,15 @@ void apply_segmentation_based_quantization(
         CodingUnit *cu_ptr) {
     uint16_t *variance_ptr = picture_control_set_ptr->parent_pcs_ptr->variance[sb_ptr->index];
     SegmentationParams *segmentation_params = &picture_control_set_ptr->parent_pcs_ptr->segmentation_params;
-    uint16_t variance = get_variance_for_cu(blk_geom, variance_ptr);
-    for (int i = 0; i < MAX_SEGMENTS; i++) {
-        if (variance <= segmentation_params->variance_bin_edge[i]) {
-            cu_ptr->segment_id = i;
-            break;
+    if (picture_control_set_ptr->parent_pcs_ptr->sequence_control_set_ptr->static_config.enable_adaptive_quantization == 2)
+        cu_ptr->segment_id = get_sb_segment_id(picture_control_set_ptr->parent_pcs_ptr, sb_ptr->index);
+    else {
+        uint16_t variance = get_variance_for_cu(blk_geom, variance_ptr);
+        for (int i = 0; i < MAX_SEGMENTS; i++) {
+            if (variance <= segmentation_params->variance_bin_edge[i]) {
+                cu_ptr->segment_id = i;
+                break;
+            }
         }
     }
     int32_t q_index = picture_control_set_ptr->parent_pcs_ptr->base_qindex +
@@ -146,14 +164,24 @@ void setup_segmentation(
     segmentation_params->segmentation_enabled = (EbBool) sequence_control_set_ptr->static_config.enable_adaptive_quantization;
     if (segmentation_params->segmentation_enabled) {
         int32_t segment_qps[MAX_SEGMENTS];
+        uint8_t segment_count = MAX_SEGMENTS;
         segmentation_params->segmentation_update_data = 1; //always updating for now. Need to set this based on actual deltas
         segmentation_params->segmentation_update_map = 1;
         segmentation_params->segmentation_temporal_update = EB_FALSE; //!(picture_control_set_ptr->parent_pcs_ptr->av1FrameType == KEY_FRAME || picture_control_set_ptr->parent_pcs_ptr->av1FrameType == INTRA_ONLY_FRAME);
-        find_segment_qps(segmentation_params, picture_control_set_ptr);
+        if (sequence_control_set_ptr->static_config.enable_adaptive_quantization == 2) {
+            segment_count = find_segment_qps_tpl(segmentation_params, picture_control_set_ptr, sequence_control_set_ptr);
+            // a single QP is cheaper without the segment map
+            if (segment_count == 1) {
+                segmentation_params->segmentation_enabled = EB_FALSE;
+                return;
+            }
+        }
+        else
+            find_segment_qps(segmentation_params, picture_control_set_ptr);
         temporally_update_qps(segment_qps, rateControlLayerPtr->prev_segment_qps,
                               segmentation_params->segmentation_temporal_update);
         for (int i = 0; i < MAX_SEGMENTS; i++)
-            segmentation_params->feature_enabled[i][SEG_LVL_ALT_Q] = 1;
+            segmentation_params->feature_enabled[i][SEG_LVL_ALT_Q] = i < segment_count;
 
         calculate_segmentation_data(segmentation_params);
     }
@@ -214,6 +242,45 @@ void find_segment_qps(
 
 }
 
+uint8_t find_segment_qps_tpl(
+        SegmentationParams *segmentation_params,
+        PictureControlSet *picture_control_set_ptr,
+        SequenceControlSet *sequence_control_set_ptr) {
+    PictureParentControlSet *parent_pcs_ptr = picture_control_set_ptr->parent_pcs_ptr;
+    const AomBitDepth bit_depth = (AomBitDepth)sequence_control_set_ptr->static_config.encoder_bit_depth;
+    const double frame_importance = (double)parent_pcs_ptr->tpl_frame_importance;
+    double min_log = TPL_MAX_LOG_IMPORTANCE, max_log = -TPL_MAX_LOG_IMPORTANCE;
+    uint8_t segment_count = 0;
+
+    // get range of the importance relative to the picture, in log2
+    for (uint32_t sb_index = 0; sb_index < picture_control_set_ptr->sb_total_count; ++sb_index) {
+        double sb_log = log2(parent_pcs_ptr->tpl_sb_importance[sb_index] / frame_importance);
+        min_log = MIN(min_log, sb_log);
+        max_log = MAX(max_log, sb_log);
+    }
+    min_log = MAX(min_log, -TPL_MAX_LOG_IMPORTANCE);
+    max_log = MIN(max_log, TPL_MAX_LOG_IMPORTANCE);
+
+    //get importance bin edges & QPs, the q of a bin is scaled by importance ^ (-1 / TPL_QP_STRENGTH).
+    //Neighbour bins of the same QP share a segment.
+    const double step_size = MAX(max_log - min_log, 0) / MAX_SEGMENTS;
+    const double q = av1_convert_qindex_to_q(parent_pcs_ptr->base_qindex, bit_depth);
+    const int32_t min_qindex = MAX(quantizer_to_qindex[sequence_control_set_ptr->static_config.min_qp_allowed], 1);
+    const int32_t max_qindex = quantizer_to_qindex[sequence_control_set_ptr->static_config.max_qp_allowed];
+    for (int i = 0; i < MAX_SEGMENTS; i++) {
+        double bin_center = min_log + step_size * (i + 0.5);
+        int32_t delta_qindex = av1_compute_qdelta(q, q * pow(2.0, -bin_center / TPL_QP_STRENGTH), bit_depth);
+        int16_t segment_qp = (int16_t)(CLIP3(min_qindex, max_qindex,
+            (int32_t)parent_pcs_ptr->base_qindex + delta_qindex) - (int32_t)parent_pcs_ptr->base_qindex);
+        if (!segment_count || segment_qp != segmentation_params->feature_data[segment_count - 1][SEG_LVL_ALT_Q])
+            segmentation_params->feature_data[segment_count++][SEG_LVL_ALT_Q] = segment_qp;
+        segmentation_params->importance_bin_edge[segment_count - 1] = (i == MAX_SEGMENTS - 1) ? (uint32_t)~0 :
+            (uint32_t)(frame_importance * pow(2.0, min_log + step_size * (i + 1)));
+    }
+
+    return segment_count;
+}
+
 void temporally_update_qps(
         int32_t *segment_qp_ptr,
         int32_t *prev_segment_qp_ptr,
@@ -23,6 +23,20 @@
 #include "EbSequenceControlSet.h"
 #include "EbRateControlProcess.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Largest importance of an SB relative to its picture, in log2, given its own QP
+#define TPL_MAX_LOG_IMPORTANCE 2.0
+// The q of an SB is scaled by its importance ^ (-1 / TPL_QP_STRENGTH), as x264 does with its default qcompress
+#define TPL_QP_STRENGTH 3.0
+
+
+uint8_t get_sb_segment_id(
+        PictureParentControlSet *parent_pcs_ptr,
+        uint32_t sb_index
+);
 
 void apply_segmentation_based_quantization(
         const BlockGeom *blk_geom,
@@ -42,6 +56,12 @@ void find_segment_qps(
         PictureControlSet *picture_control_set_ptr
 );
 
+uint8_t find_segment_qps_tpl(
+        SegmentationParams *segmentation_params,
+        PictureControlSet *picture_control_set_ptr,
+        SequenceControlSet *sequence_control_set_ptr
+);
+
 void temporally_update_qps(
         int32_t *segment_qp_ptr,
         int32_t *prev_segment_qp_ptr,
@@ -52,6 +72,9 @@ void calculate_segmentation_data(
         SegmentationParams *segmentation_params
 );
 
+#ifdef __cplusplus
+}
+#endif
 #endif //SVT_AV1_EBSEGMENTATIONS_H
 
 
@@ -75,6 +75,8 @@ typedef struct {
 
     //qp-binning related
     int16_t variance_bin_edge[MAX_SEGMENTS];
+    // importance of the temporal dependency model, adaptive quantization 2
+    uint32_t importance_bin_edge[MAX_SEGMENTS];
 
 } SegmentationParams;
 
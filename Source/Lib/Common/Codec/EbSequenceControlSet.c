@@ -124,10 +124,6 @@ EbErrorType eb_sequence_control_set_ctor(
     // mv merge
     sequence_control_set_ptr->mv_merge_total_count = 5;
 
-    // Initialize SB params
-    sb_params_ctor(
-        sequence_control_set_ptr);
-
     sequence_control_set_ptr->seq_header.frame_width_bits = 16;
     sequence_control_set_ptr->seq_header.frame_height_bits = 16;
     sequence_control_set_ptr->seq_header.frame_id_numbers_present_flag = 0;
@@ -309,12 +305,18 @@ EbErrorType copy_sequence_control_set(
     dst->mode_decision_configuration_fifo_init_count = src->mode_decision_configuration_fifo_init_count; writeCount += sizeof(int32_t);
     dst->enc_dec_fifo_init_count = src->enc_dec_fifo_init_count; writeCount += sizeof(int32_t);
     dst->entropy_coding_fifo_init_count = src->entropy_coding_fifo_init_count; writeCount += sizeof(int32_t);
+    dst->picture_control_set_pool_start_count = src->picture_control_set_pool_start_count; writeCount += sizeof(int32_t);
+    dst->pa_reference_picture_buffer_start_count = src->pa_reference_picture_buffer_start_count; writeCount += sizeof(int32_t);
+    dst->reference_picture_buffer_start_count = src->reference_picture_buffer_start_count; writeCount += sizeof(int32_t);
+    dst->input_buffer_fifo_start_count = src->input_buffer_fifo_start_count; writeCount += sizeof(int32_t);
+    dst->output_stream_buffer_fifo_start_count = src->output_stream_buffer_fifo_start_count; writeCount += sizeof(int32_t);
     dst->picture_analysis_process_init_count = src->picture_analysis_process_init_count; writeCount += sizeof(int32_t);
     dst->motion_estimation_process_init_count = src->motion_estimation_process_init_count; writeCount += sizeof(int32_t);
     dst->source_based_operations_process_init_count = src->source_based_operations_process_init_count; writeCount += sizeof(int32_t);
     dst->mode_decision_configuration_process_init_count = src->mode_decision_configuration_process_init_count; writeCount += sizeof(int32_t);
     dst->enc_dec_process_init_count = src->enc_dec_process_init_count; writeCount += sizeof(int32_t);
     dst->entropy_coding_process_init_count = src->entropy_coding_process_init_count; writeCount += sizeof(int32_t);
+    dst->dlf_process_init_count = src->dlf_process_init_count; writeCount += sizeof(int32_t);
     dst->total_process_init_count = src->total_process_init_count; writeCount += sizeof(int32_t);
     dst->left_padding = src->left_padding; writeCount += sizeof(int16_t);
     dst->right_padding = src->right_padding; writeCount += sizeof(int16_t);
@@ -389,14 +391,6 @@ EbErrorType eb_sequence_control_set_instance_ctor(
     return EB_ErrorNone;
 }
 
-extern EbErrorType sb_params_ctor(
-    SequenceControlSet *sequence_control_set_ptr) {
-    EbErrorType return_error = EB_ErrorNone;
-
-    EB_MALLOC(SbParams*, sequence_control_set_ptr->sb_params_array, sizeof(SbParams) * ((MAX_PICTURE_WIDTH_SIZE + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz) * ((MAX_PICTURE_HEIGHT_SIZE + sequence_control_set_ptr->sb_sz - 1) / sequence_control_set_ptr->sb_sz), EB_N_PTR);
-    return return_error;
-}
-
 extern EbErrorType sb_params_init(
     SequenceControlSet *sequence_control_set_ptr) {
     EbErrorType return_error = EB_ErrorNone;
@@ -154,6 +154,12 @@ extern "C" {
         uint32_t                                dlf_fifo_init_count;
         uint32_t                                cdef_fifo_init_count;
         uint32_t                                rest_fifo_init_count;
+        // Starting sizes of the pools grown by adaptive pool sizing
+        uint32_t                                picture_control_set_pool_start_count;
+        uint32_t                                pa_reference_picture_buffer_start_count;
+        uint32_t                                reference_picture_buffer_start_count;
+        uint32_t                                input_buffer_fifo_start_count;
+        uint32_t                                output_stream_buffer_fifo_start_count;
 
         uint32_t                                picture_analysis_process_init_count;
         uint32_t                                motion_estimation_process_init_count;
@@ -165,6 +171,7 @@ extern "C" {
         uint32_t                                cdef_process_init_count;
         uint32_t                                rest_process_init_count;
         uint32_t                                total_process_init_count;
+        uint32_t                                core_count; // logical processors the encoder threads run on
 
         uint16_t                                film_grain_random_seed;
         SbParams                               *sb_params_array;
@@ -236,6 +243,23 @@ extern "C" {
         EbHandle                    config_mutex;
     } EbSequenceControlSetInstance;
 
+    /**************************************
+     * Rate Control Mode
+     **************************************/
+    // CQP (0) and CRF (4) derive the picture QP from the qp setting
+    static INLINE EbBool rc_is_qp_based(uint32_t rate_control_mode)
+    {
+        return (EbBool)(rate_control_mode == 0 || rate_control_mode == 4);
+    }
+
+    // The bit rate modes (1 - 3) fill the distortion histogram queues, use the
+    // rate control parameter queues and wait for the packetization feedback of
+    // the reference pictures
+    static INLINE EbBool rc_uses_bitrate_queues(uint32_t rate_control_mode)
+    {
+        return (EbBool)!rc_is_qp_based(rate_control_mode);
+    }
+
     /**************************************
      * Extern Function Declarations
      **************************************/
@@ -250,9 +274,6 @@ extern "C" {
     extern EbErrorType eb_sequence_control_set_instance_ctor(
         EbSequenceControlSetInstance **object_dbl_ptr);
 
-    extern EbErrorType sb_params_ctor(
-        SequenceControlSet *sequence_control_set_ptr);
-
     extern EbErrorType sb_params_init(
         SequenceControlSet *sequence_control_set_ptr);
 
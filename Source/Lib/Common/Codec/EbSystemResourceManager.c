@@ -4,8 +4,12 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "EbSystemResourceManager.h"
+#include "EbMemoryArena.h"
+#include "EbPipelineStats.h"
+#include "EbUtility.h"
 
 /**************************************
  * EbFifoCtor
@@ -18,11 +22,20 @@ static EbErrorType EbFifoCtor(
     EbObjectWrapper  *lastWrapperPtr,
     EbMuxingQueue    *queue_ptr)
 {
+#if LOCK_FREE_FIFO
+    // Objects live in the MuxingQueue ring, the Fifo only keeps the spin state
+    (void)initial_count;
+    (void)max_count;
+    fifoPtr->counting_semaphore = (EbHandle)EB_NULL;
+    fifoPtr->lockout_mutex = (EbHandle)EB_NULL;
+    fifoPtr->spin_count = EB_FIFO_SPIN_COUNT_MAX;
+#else
     // Create Counting Semaphore
     EB_CREATESEMAPHORE(EbHandle, fifoPtr->counting_semaphore, sizeof(EbHandle), EB_SEMAPHORE, initial_count, max_count);
 
     // Create Buffer Pool Mutex
     EB_CREATEMUTEX(EbHandle, fifoPtr->lockout_mutex, sizeof(EbHandle), EB_MUTEX);
+#endif
 
     // Initialize Fifo First & Last ptrs
     fifoPtr->first_ptr = firstWrapperPtr;
@@ -34,6 +47,7 @@ static EbErrorType EbFifoCtor(
     return EB_ErrorNone;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
  * EbFifoPushBack
  **************************************/
@@ -179,6 +193,180 @@ static EbErrorType EbCircularBufferPushFront(
 
     return return_error;
 }
+#else
+/**************************************
+ * EbRingBufferCtor
+ *   Bounded MPMC ring (one sequence number per cell). The ring is
+ *   sized to hold every object of the SystemResource, so a push can
+ *   never find it full.
+ **************************************/
+static EbErrorType EbRingBufferCtor(
+    EbMuxingQueue    *queue_ptr,
+    uint32_t          object_total_count,
+    uint32_t          process_total_count)
+{
+    uint32_t cellIndex;
+    uint32_t ringSize = 2;
+
+    // Round up to a power of two so positions can be masked
+    while (ringSize < object_total_count)
+        ringSize <<= 1;
+
+    EB_MALLOC(EbRingCell*, queue_ptr->ring_ptr, sizeof(EbRingCell) * ringSize, EB_N_PTR);
+
+    for (cellIndex = 0; cellIndex < ringSize; ++cellIndex) {
+        queue_ptr->ring_ptr[cellIndex].sequence = cellIndex;
+        queue_ptr->ring_ptr[cellIndex].wrapper_ptr = (EbObjectWrapper*)EB_NULL;
+    }
+    queue_ptr->ring_mask = ringSize - 1;
+    queue_ptr->enqueue_pos = 0;
+    queue_ptr->dequeue_pos = 0;
+    queue_ptr->waiter_count = 0;
+
+    // At most one pending post per parked process
+    EB_CREATESEMAPHORE(EbHandle, queue_ptr->park_semaphore, sizeof(EbHandle), EB_SEMAPHORE, 0, object_total_count + process_total_count);
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * EbRingBufferTryPush
+ **************************************/
+static EbBool EbRingBufferTryPush(
+    EbMuxingQueue    *queue_ptr,
+    EbObjectWrapper  *wrapper_ptr)
+{
+    EbRingCell *cellPtr;
+    uint32_t    pos = eb_atomic_load_u32(&queue_ptr->enqueue_pos);
+
+    for (;;) {
+        cellPtr = &queue_ptr->ring_ptr[pos & queue_ptr->ring_mask];
+        int32_t dif = (int32_t)(eb_atomic_load_u32(&cellPtr->sequence) - pos);
+
+        if (dif == 0) {
+            if (eb_atomic_cas_u32(&queue_ptr->enqueue_pos, pos, pos + 1))
+                break;
+        }
+        else if (dif < 0)
+            return EB_FALSE;
+        pos = eb_atomic_load_u32(&queue_ptr->enqueue_pos);
+    }
+
+    cellPtr->wrapper_ptr = wrapper_ptr;
+    eb_atomic_store_u32(&cellPtr->sequence, pos + 1);
+
+    return EB_TRUE;
+}
+
+/**************************************
+ * EbRingBufferTryPop
+ **************************************/
+static EbBool EbRingBufferTryPop(
+    EbMuxingQueue    *queue_ptr,
+    EbObjectWrapper **wrapper_dbl_ptr)
+{
+    EbRingCell *cellPtr;
+    uint32_t    pos = eb_atomic_load_u32(&queue_ptr->dequeue_pos);
+
+    for (;;) {
+        cellPtr = &queue_ptr->ring_ptr[pos & queue_ptr->ring_mask];
+        int32_t dif = (int32_t)(eb_atomic_load_u32(&cellPtr->sequence) - (pos + 1));
+
+        if (dif == 0) {
+            if (eb_atomic_cas_u32(&queue_ptr->dequeue_pos, pos, pos + 1))
+                break;
+        }
+        else if (dif < 0)
+            return EB_FALSE;
+        pos = eb_atomic_load_u32(&queue_ptr->dequeue_pos);
+    }
+
+    *wrapper_dbl_ptr = cellPtr->wrapper_ptr;
+    eb_atomic_store_u32(&cellPtr->sequence, pos + queue_ptr->ring_mask + 1);
+
+    return EB_TRUE;
+}
+
+/**************************************
+ * EbRingBufferPush
+ *   Pushes the object then wakes one parked
+ *   process, if any.
+ **************************************/
+static void EbRingBufferPush(
+    EbMuxingQueue    *queue_ptr,
+    EbObjectWrapper  *wrapper_ptr)
+{
+    uint32_t waiterCount;
+
+    while (EbRingBufferTryPush(queue_ptr, wrapper_ptr) == EB_FALSE)
+        eb_cpu_pause();
+
+    // Every decrement of waiter_count done here is matched by exactly one post
+    while ((waiterCount = eb_atomic_load_u32(&queue_ptr->waiter_count)) > 0) {
+        if (eb_atomic_cas_u32(&queue_ptr->waiter_count, waiterCount, waiterCount - 1)) {
+            eb_post_semaphore(queue_ptr->park_semaphore);
+            break;
+        }
+    }
+}
+
+/**************************************
+ * EbRingBufferPop
+ *   Spins on the ring for fifoPtr->spin_count
+ *   polls, then registers as a waiter and parks
+ *   on the queue semaphore. The spin length
+ *   grows when spinning succeeds and shrinks
+ *   when the process has to park. A thread
+ *   pool process parks right away, it would
+ *   spin on its run slot while the producer
+ *   may be waiting for one.
+ **************************************/
+static void EbRingBufferPop(
+    EbFifo           *fifoPtr,
+    EbObjectWrapper **wrapper_dbl_ptr)
+{
+    EbMuxingQueue *queue_ptr = fifoPtr->queue_ptr;
+    const EbBool poolThread = eb_thread_pool_is_current();
+    uint32_t spinCount;
+    uint32_t spinIndex;
+    uint32_t waiterCount;
+
+    for (;;) {
+        spinCount = poolThread ? 0 : fifoPtr->spin_count;
+        for (spinIndex = 0; spinIndex < spinCount; ++spinIndex) {
+            if (EbRingBufferTryPop(queue_ptr, wrapper_dbl_ptr)) {
+                fifoPtr->spin_count = MIN(fifoPtr->spin_count << 1, EB_FIFO_SPIN_COUNT_MAX);
+                return;
+            }
+            // Give the CPU away now and then in case the producer is not running
+            if ((spinIndex & (EB_FIFO_SPIN_YIELD_PERIOD - 1)) == EB_FIFO_SPIN_YIELD_PERIOD - 1)
+                eb_yield_thread();
+            else
+                eb_cpu_pause();
+        }
+        fifoPtr->spin_count = MAX(fifoPtr->spin_count >> 1, EB_FIFO_SPIN_COUNT_MIN);
+
+        // Register before the last check so a concurrent push cannot be missed
+        eb_atomic_fetch_add_u32(&queue_ptr->waiter_count, 1);
+
+        if (EbRingBufferTryPop(queue_ptr, wrapper_dbl_ptr)) {
+            // Withdraw the registration. If a producer already took it, absorb its post.
+            for (;;) {
+                waiterCount = eb_atomic_load_u32(&queue_ptr->waiter_count);
+                if (waiterCount == 0) {
+                    eb_block_on_semaphore(queue_ptr->park_semaphore);
+                    break;
+                }
+                if (eb_atomic_cas_u32(&queue_ptr->waiter_count, waiterCount, waiterCount - 1))
+                    break;
+            }
+            return;
+        }
+
+        eb_block_on_semaphore(queue_ptr->park_semaphore);
+    }
+}
+#endif
 
 /**************************************
  * EbMuxingQueueCtor
@@ -197,7 +385,24 @@ static EbErrorType EbMuxingQueueCtor(
     *queueDblPtr = queue_ptr;
 
     queue_ptr->process_total_count = process_total_count;
-
+    queue_ptr->system_resource_ptr = (struct EbSystemResource*)EB_NULL;
+#if PIPELINE_STATS
+    queue_ptr->object_count = 0;
+#endif
+
+#if LOCK_FREE_FIFO
+    queue_ptr->lockout_mutex = (EbHandle)EB_NULL;
+    queue_ptr->object_queue = (EbCircularBuffer*)EB_NULL;
+    queue_ptr->process_queue = (EbCircularBuffer*)EB_NULL;
+
+    // Construct the shared Object Ring
+    return_error = EbRingBufferCtor(
+        queue_ptr,
+        object_total_count,
+        queue_ptr->process_total_count);
+    if (return_error == EB_ErrorInsufficientResources)
+        return EB_ErrorInsufficientResources;
+#else
     // Lockout Mutex
     EB_CREATEMUTEX(EbHandle, queue_ptr->lockout_mutex, sizeof(EbHandle), EB_MUTEX);
 
@@ -213,6 +418,7 @@ static EbErrorType EbMuxingQueueCtor(
         queue_ptr->process_total_count);
     if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
+#endif
     // Construct the Process Fifos
     EB_MALLOC(EbFifo**, queue_ptr->process_fifo_ptr_array, sizeof(EbFifo*) * queue_ptr->process_total_count, EB_N_PTR);
 
@@ -234,6 +440,7 @@ static EbErrorType EbMuxingQueueCtor(
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
  * EbMuxingQueueAssignation
  **************************************/
@@ -274,6 +481,7 @@ static EbErrorType EbMuxingQueueAssignation(
 
     return return_error;
 }
+#endif
 
 /**************************************
  * EbMuxingQueueObjectPushBack
@@ -284,11 +492,22 @@ static EbErrorType EbMuxingQueueObjectPushBack(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if PIPELINE_STATS
+    // Counted before the push, so that a pop never sees it negative
+    eb_atomic_fetch_add_u32(&queue_ptr->object_count, 1);
+#endif
+
+#if LOCK_FREE_FIFO
+    EbRingBufferPush(
+        queue_ptr,
+        object_ptr);
+#else
     EbCircularBufferPushBack(
         queue_ptr->object_queue,
         object_ptr);
 
     EbMuxingQueueAssignation(queue_ptr);
+#endif
 
     return return_error;
 }
@@ -302,11 +521,23 @@ static EbErrorType EbMuxingQueueObjectPushFront(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if PIPELINE_STATS
+    // Counted before the push, so that a pop never sees it negative
+    eb_atomic_fetch_add_u32(&queue_ptr->object_count, 1);
+#endif
+
+#if LOCK_FREE_FIFO
+    // The ring has no front, released objects simply go to the back
+    EbRingBufferPush(
+        queue_ptr,
+        object_ptr);
+#else
     EbCircularBufferPushFront(
         queue_ptr->object_queue,
         object_ptr);
 
     EbMuxingQueueAssignation(queue_ptr);
+#endif
 
     return return_error;
 }
@@ -330,11 +561,15 @@ EbErrorType eb_object_release_enable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->release_enable = EB_TRUE;
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->release_enable = EB_TRUE;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -358,11 +593,15 @@ EbErrorType eb_object_release_disable(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    wrapper_ptr->release_enable = EB_FALSE;
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->release_enable = EB_FALSE;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -387,11 +626,15 @@ EbErrorType eb_object_inc_live_count(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    eb_atomic_fetch_add_u32(&wrapper_ptr->live_count, increment_number);
+#else
     eb_block_on_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     wrapper_ptr->live_count += increment_number;
 
     eb_release_mutex(wrapper_ptr->system_resource_ptr->empty_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -434,9 +677,74 @@ EbErrorType eb_system_resource_ctor(
     EbBool              full_fifo_enabled,
     EbCtor              object_ctor,
     EbPtr               object_init_data_ptr)
+{
+    return eb_system_resource_growable_ctor(
+        resource_dbl_ptr,
+        object_total_count,
+        object_total_count,
+        producer_process_total_count,
+        consumer_process_total_count,
+        producer_fifo_ptr_array_ptr,
+        consumer_fifo_ptr_array_ptr,
+        full_fifo_enabled,
+        object_ctor,
+        object_init_data_ptr,
+        0,
+        0);
+}
+
+/*********************************************************************
+ * EbSystemResourceAddObject
+ *   Constructs the next object of the SystemResource and its wrapper.
+ *********************************************************************/
+static EbErrorType EbSystemResourceAddObject(
+    EbSystemResource  *resource_ptr,
+    EbObjectWrapper  **wrapper_dbl_ptr)
+{
+    EbObjectWrapper *wrapper_ptr;
+    EbErrorType return_error = EB_ErrorNone;
+
+    EB_MALLOC(EbObjectWrapper*, wrapper_ptr, sizeof(EbObjectWrapper), EB_N_PTR);
+    wrapper_ptr->live_count = 0;
+    wrapper_ptr->release_enable = EB_TRUE;
+    wrapper_ptr->system_resource_ptr = resource_ptr;
+
+    // Call the Constructor for each element
+    if (resource_ptr->object_ctor) {
+        return_error = resource_ptr->object_ctor(
+            &wrapper_ptr->object_ptr,
+            resource_ptr->object_init_data_ptr);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+
+    resource_ptr->wrapper_ptr_pool[resource_ptr->object_count++] = wrapper_ptr;
+    *wrapper_dbl_ptr = wrapper_ptr;
+
+    return return_error;
+}
+
+/*********************************************************************
+ * eb_system_resource_growable_ctor
+ *********************************************************************/
+EbErrorType eb_system_resource_growable_ctor(
+    EbSystemResource **resource_dbl_ptr,
+    uint32_t               object_init_count,
+    uint32_t               object_total_count,
+    uint32_t               producer_process_total_count,
+    uint32_t               consumer_process_total_count,
+    EbFifo          ***producer_fifo_ptr_array_ptr,
+    EbFifo          ***consumer_fifo_ptr_array_ptr,
+    EbBool              full_fifo_enabled,
+    EbCtor              object_ctor,
+    EbPtr               object_init_data_ptr,
+    uint32_t            object_init_data_size,
+    uint64_t            memory_budget)
 {
     uint32_t wrapperIndex;
     EbErrorType return_error = EB_ErrorNone;
+    EbObjectWrapper *wrapper_ptr;
+    EbMemoryFootprint footprint;
     // Allocate the System Resource
     EbSystemResource *resource_ptr;
 
@@ -444,24 +752,48 @@ EbErrorType eb_system_resource_ctor(
     *resource_dbl_ptr = resource_ptr;
 
     resource_ptr->object_total_count = object_total_count;
+    resource_ptr->object_count = 0;
+    resource_ptr->object_release_cb = NULL;
+    resource_ptr->release_data_ptr = EB_NULL;
+    resource_ptr->growable = (EbBool)(object_init_count < object_total_count);
+    resource_ptr->empty_object_count = 0;
+    resource_ptr->grow_mutex = (EbHandle)EB_NULL;
+    resource_ptr->object_ctor = object_ctor;
+    resource_ptr->object_init_data_ptr = object_init_data_ptr;
+    resource_ptr->object_size = 0;
+    resource_ptr->memory_budget = memory_budget;
+    resource_ptr->arena_ptr = eb_memory_arena_get_current();
+
+    if (resource_ptr->growable) {
+        EB_CREATEMUTEX(EbHandle, resource_ptr->grow_mutex, sizeof(EbHandle), EB_MUTEX);
+
+        // The init data usually lives on the stack of the caller
+        if (object_init_data_size) {
+            EB_MALLOC(EbPtr, resource_ptr->object_init_data_ptr, object_init_data_size, EB_N_PTR);
+            memcpy(resource_ptr->object_init_data_ptr, object_init_data_ptr, object_init_data_size);
+        }
+    }
 
     // Allocate array for wrapper pointers
     EB_MALLOC(EbObjectWrapper**, resource_ptr->wrapper_ptr_pool, sizeof(EbObjectWrapper*) * resource_ptr->object_total_count, EB_N_PTR);
 
+    if (resource_ptr->growable) {
+        eb_memory_arena_get_footprint(resource_ptr->arena_ptr, &footprint);
+        resource_ptr->object_size = footprint.allocated_size;
+    }
+
     // Initialize each wrapper
-    for (wrapperIndex = 0; wrapperIndex < resource_ptr->object_total_count; ++wrapperIndex) {
-        EB_MALLOC(EbObjectWrapper*, resource_ptr->wrapper_ptr_pool[wrapperIndex], sizeof(EbObjectWrapper), EB_N_PTR);
-        resource_ptr->wrapper_ptr_pool[wrapperIndex]->live_count = 0;
-        resource_ptr->wrapper_ptr_pool[wrapperIndex]->release_enable = EB_TRUE;
-        resource_ptr->wrapper_ptr_pool[wrapperIndex]->system_resource_ptr = resource_ptr;
-
-        // Call the Constructor for each element
-        if (object_ctor) {
-            return_error = object_ctor(
-                &resource_ptr->wrapper_ptr_pool[wrapperIndex]->object_ptr,
-                object_init_data_ptr);
-            if (return_error == EB_ErrorInsufficientResources)
-                return EB_ErrorInsufficientResources;
+    for (wrapperIndex = 0; wrapperIndex < object_init_count; ++wrapperIndex) {
+        return_error = EbSystemResourceAddObject(
+            resource_ptr,
+            &wrapper_ptr);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+
+        // Measured on the first object, with its wrapper
+        if (resource_ptr->growable && wrapperIndex == 0) {
+            eb_memory_arena_get_footprint(resource_ptr->arena_ptr, &footprint);
+            resource_ptr->object_size = footprint.allocated_size - resource_ptr->object_size;
         }
     }
 
@@ -473,8 +805,11 @@ EbErrorType eb_system_resource_ctor(
         producer_fifo_ptr_array_ptr);
     if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
+    resource_ptr->empty_queue->system_resource_ptr = resource_ptr;
+
     // Fill the Empty Fifo with every ObjectWrapper
-    for (wrapperIndex = 0; wrapperIndex < resource_ptr->object_total_count; ++wrapperIndex) {
+    for (wrapperIndex = 0; wrapperIndex < resource_ptr->object_count; ++wrapperIndex) {
+        resource_ptr->empty_object_count++;
         EbMuxingQueueObjectPushBack(
             resource_ptr->empty_queue,
             resource_ptr->wrapper_ptr_pool[wrapperIndex]);
@@ -489,6 +824,7 @@ EbErrorType eb_system_resource_ctor(
             consumer_fifo_ptr_array_ptr);
         if (return_error == EB_ErrorInsufficientResources)
             return EB_ErrorInsufficientResources;
+        resource_ptr->full_queue->system_resource_ptr = resource_ptr;
     }
     else {
         resource_ptr->full_queue = (EbMuxingQueue *)EB_NULL;
@@ -498,6 +834,70 @@ EbErrorType eb_system_resource_ctor(
     return return_error;
 }
 
+/*********************************************************************
+ * EbSystemResourceGrow
+ *   Constructs one more object and queues it as empty, unless another
+ *   process has grown the SystemResource or released an object in the
+ *   meantime, the SystemResource is full or the arena would go past the
+ *   memory budget.
+ *********************************************************************/
+static void EbSystemResourceGrow(
+    EbSystemResource  *resource_ptr)
+{
+    EbMemoryArena     *current_arena_ptr;
+    EbMemoryFootprint  footprint;
+    EbObjectWrapper   *wrapper_ptr;
+
+    eb_block_on_mutex(resource_ptr->grow_mutex);
+
+    if (eb_atomic_load_u32(&resource_ptr->empty_object_count) == 0 &&
+        resource_ptr->object_count < resource_ptr->object_total_count) {
+        eb_memory_arena_get_footprint(resource_ptr->arena_ptr, &footprint);
+
+        if (resource_ptr->memory_budget == 0 ||
+            footprint.allocated_size + resource_ptr->object_size <= resource_ptr->memory_budget) {
+            // The object belongs to the arena of the SystemResource, whichever
+            // thread grows it
+            current_arena_ptr = eb_memory_arena_get_current();
+            eb_memory_arena_set_current(resource_ptr->arena_ptr);
+
+            if (EbSystemResourceAddObject(resource_ptr, &wrapper_ptr) == EB_ErrorNone) {
+                eb_atomic_fetch_add_u32(&resource_ptr->empty_object_count, 1);
+#if LOCK_FREE_FIFO
+                EbMuxingQueueObjectPushBack(
+                    resource_ptr->empty_queue,
+                    wrapper_ptr);
+#else
+                eb_block_on_mutex(resource_ptr->empty_queue->lockout_mutex);
+
+                EbMuxingQueueObjectPushBack(
+                    resource_ptr->empty_queue,
+                    wrapper_ptr);
+
+                eb_release_mutex(resource_ptr->empty_queue->lockout_mutex);
+#endif
+            }
+
+            eb_memory_arena_set_current(current_arena_ptr);
+        }
+    }
+
+    eb_release_mutex(resource_ptr->grow_mutex);
+}
+
+/*********************************************************************
+ * eb_system_resource_set_release_callback
+ *********************************************************************/
+void eb_system_resource_set_release_callback(
+    EbSystemResource  *resource_ptr,
+    void             (*object_release_cb)(EbPtr object_ptr, EbPtr release_data_ptr),
+    EbPtr              release_data_ptr)
+{
+    resource_ptr->object_release_cb = object_release_cb;
+    resource_ptr->release_data_ptr = release_data_ptr;
+}
+
+#if !LOCK_FREE_FIFO
 /*********************************************************************
  * EbSystemResourceReleaseProcess
  *********************************************************************/
@@ -518,6 +918,7 @@ static EbErrorType EbReleaseProcess(
 
     return return_error;
 }
+#endif
 
 /*********************************************************************
  * EbSystemResourcePostObject
@@ -538,6 +939,11 @@ EbErrorType eb_post_full_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    EbMuxingQueueObjectPushBack(
+        object_ptr->system_resource_ptr->full_queue,
+        object_ptr);
+#else
     eb_block_on_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
 
     EbMuxingQueueObjectPushBack(
@@ -545,6 +951,7 @@ EbErrorType eb_post_full_object(
         object_ptr);
 
     eb_release_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -564,6 +971,36 @@ EbErrorType eb_release_object(
 {
     EbErrorType return_error = EB_ErrorNone;
 
+#if LOCK_FREE_FIFO
+    uint32_t liveCount;
+    uint32_t newLiveCount;
+
+    // Decrement live_count, the thread that takes it to zero releases the object
+    do {
+        liveCount = eb_atomic_load_u32(&object_ptr->live_count);
+        newLiveCount = (liveCount == 0) ? liveCount : liveCount - 1;
+        if ((object_ptr->release_enable == EB_TRUE) && (newLiveCount == 0))
+            newLiveCount = EB_ObjectWrapperReleasedValue;
+        else if (liveCount == EB_ObjectWrapperReleasedValue || liveCount == newLiveCount)
+            return return_error;
+    } while (eb_atomic_cas_u32(&object_ptr->live_count, liveCount, newLiveCount) == EB_FALSE);
+
+    if (newLiveCount == EB_ObjectWrapperReleasedValue) {
+        if (object_ptr->system_resource_ptr->object_release_cb)
+            object_ptr->system_resource_ptr->object_release_cb(
+                object_ptr->object_ptr,
+                object_ptr->system_resource_ptr->release_data_ptr);
+
+        if (object_ptr->system_resource_ptr->growable)
+            eb_atomic_fetch_add_u32(&object_ptr->system_resource_ptr->empty_object_count, 1);
+
+        EbMuxingQueueObjectPushFront(
+            object_ptr->system_resource_ptr->empty_queue,
+            object_ptr);
+    }
+
+    return return_error;
+#else
     eb_block_on_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     // Decrement live_count
@@ -573,6 +1010,14 @@ EbErrorType eb_release_object(
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
 
+        if (object_ptr->system_resource_ptr->object_release_cb)
+            object_ptr->system_resource_ptr->object_release_cb(
+                object_ptr->object_ptr,
+                object_ptr->system_resource_ptr->release_data_ptr);
+
+        if (object_ptr->system_resource_ptr->growable)
+            eb_atomic_fetch_add_u32(&object_ptr->system_resource_ptr->empty_object_count, 1);
+
         EbMuxingQueueObjectPushFront(
             object_ptr->system_resource_ptr->empty_queue,
             object_ptr);
@@ -581,6 +1026,7 @@ EbErrorType eb_release_object(
     eb_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
     return return_error;
+#endif
 }
 
 /*********************************************************************
@@ -603,7 +1049,28 @@ EbErrorType eb_get_empty_object(
     EbObjectWrapper **wrapper_dbl_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
+    EbSystemResource *resource_ptr = empty_fifo_ptr->queue_ptr->system_resource_ptr;
+
+    // A growable SystemResource constructs an object rather than wait for one
+    if (resource_ptr->growable && eb_atomic_load_u32(&resource_ptr->empty_object_count) == 0)
+        EbSystemResourceGrow(resource_ptr);
+
+#if PIPELINE_STATS
+    uint64_t waitBeginTime = eb_thread_stats_wait_begin();
+#endif
 
+#if LOCK_FREE_FIFO
+    // Spin then park until an empty buffer is available
+    EbRingBufferPop(
+        empty_fifo_ptr,
+        wrapper_dbl_ptr);
+
+    // Reset the wrapper's live_count
+    eb_atomic_store_u32(&(*wrapper_dbl_ptr)->live_count, 0);
+
+    // Object release enable
+    (*wrapper_dbl_ptr)->release_enable = EB_TRUE;
+#else
     // Queue the Fifo requesting the empty fifo
     EbReleaseProcess(empty_fifo_ptr);
 
@@ -626,6 +1093,15 @@ EbErrorType eb_get_empty_object(
 
     // Release Mutex
     eb_release_mutex(empty_fifo_ptr->lockout_mutex);
+#endif
+
+    if (resource_ptr->growable)
+        eb_atomic_fetch_add_u32(&resource_ptr->empty_object_count, (uint32_t)-1);
+
+#if PIPELINE_STATS
+    eb_atomic_fetch_add_u32(&empty_fifo_ptr->queue_ptr->object_count, (uint32_t)-1);
+    eb_thread_stats_wait_end(waitBeginTime, EB_FALSE, 0);
+#endif
 
     return return_error;
 }
@@ -650,7 +1126,17 @@ EbErrorType eb_get_full_object(
     EbObjectWrapper **wrapper_dbl_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
-
+#if PIPELINE_STATS
+    uint32_t fifoDepth = eb_atomic_load_u32(&full_fifo_ptr->queue_ptr->object_count);
+    uint64_t waitBeginTime = eb_thread_stats_wait_begin();
+#endif
+
+#if LOCK_FREE_FIFO
+    // Spin then park until a full buffer is available
+    EbRingBufferPop(
+        full_fifo_ptr,
+        wrapper_dbl_ptr);
+#else
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(full_fifo_ptr);
 
@@ -666,10 +1152,17 @@ EbErrorType eb_get_full_object(
 
     // Release Mutex
     eb_release_mutex(full_fifo_ptr->lockout_mutex);
+#endif
+
+#if PIPELINE_STATS
+    eb_atomic_fetch_add_u32(&full_fifo_ptr->queue_ptr->object_count, (uint32_t)-1);
+    eb_thread_stats_wait_end(waitBeginTime, EB_TRUE, fifoDepth);
+#endif
 
     return return_error;
 }
 
+#if !LOCK_FREE_FIFO
 /**************************************
 * EbFifoPopFront
 **************************************/
@@ -682,12 +1175,21 @@ static EbBool EbFifoPeakFront(
     else
         return EB_FALSE;
 }
+#endif
 
 EbErrorType eb_get_full_object_non_blocking(
     EbFifo   *full_fifo_ptr,
     EbObjectWrapper **wrapper_dbl_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
+#if LOCK_FREE_FIFO
+    if (EbRingBufferTryPop(full_fifo_ptr->queue_ptr, wrapper_dbl_ptr) == EB_FALSE)
+        *wrapper_dbl_ptr = (EbObjectWrapper*)EB_NULL;
+#if PIPELINE_STATS
+    else
+        eb_atomic_fetch_add_u32(&full_fifo_ptr->queue_ptr->object_count, (uint32_t)-1);
+#endif
+#else
     EbBool      fifoEmpty;
     // Queue the Fifo requesting the full fifo
     EbReleaseProcess(full_fifo_ptr);
@@ -707,6 +1209,7 @@ EbErrorType eb_get_full_object_non_blocking(
             wrapper_dbl_ptr);
     else
         *wrapper_dbl_ptr = (EbObjectWrapper*)EB_NULL;
+#endif
 
     return return_error;
 }
@@ -15,6 +15,14 @@ extern "C" {
      * Defines
      *********************************/
 #define EB_ObjectWrapperReleasedValue   ~0u
+#if LOCK_FREE_FIFO
+    // Bounds of the adaptive spin performed by a consumer before it parks
+    // on the queue semaphore
+#define EB_FIFO_SPIN_COUNT_MIN          16
+#define EB_FIFO_SPIN_COUNT_MAX          4096
+#define EB_FIFO_SPIN_YIELD_PERIOD       64
+#define EB_CACHE_LINE_SIZE              64
+#endif
 
      /*********************************************************************
       * Object Wrapper
@@ -74,6 +82,12 @@ extern "C" {
         // queue_ptr - pointer to MuxingQueue that the EbFifo is
         //   associated with.
         struct EbMuxingQueue *queue_ptr;
+#if LOCK_FREE_FIFO
+        // spin_count - number of polls of the MuxingQueue ring before
+        //   the owning process parks. Adapted on every get, only
+        //   touched by the process that owns the EbFifo.
+        uint32_t spin_count;
+#endif
     } EbFifo;
 
     /*********************************************************************
@@ -88,8 +102,25 @@ extern "C" {
         uint32_t  current_count;
     } EbCircularBuffer;
 
+#if LOCK_FREE_FIFO
+    /*********************************************************************
+     * RingCell
+     *   One slot of the bounded MPMC ring. sequence tells producers and
+     *   consumers whether the slot is free for the current lap.
+     *********************************************************************/
+    typedef struct EbRingCell
+    {
+        volatile uint32_t  sequence;
+        EbObjectWrapper   *wrapper_ptr;
+    } EbRingCell;
+#endif
+
     /*********************************************************************
      * MuxingQueue
+     *   With LOCK_FREE_FIFO the object and process circular buffers are
+     *   replaced by a single bounded MPMC ring shared by every process
+     *   Fifo of the queue. Consumers spin on the ring, then park on
+     *   park_semaphore; producers only post it when waiter_count > 0.
      *********************************************************************/
     typedef struct EbMuxingQueue
     {
@@ -98,6 +129,26 @@ extern "C" {
         EbCircularBuffer *process_queue;
         uint32_t              process_total_count;
         EbFifo          **process_fifo_ptr_array;
+        // system_resource_ptr - the SystemResource the queue belongs to
+        struct EbSystemResource *system_resource_ptr;
+#if PIPELINE_STATS
+        // object_count - number of objects queued, not yet taken by a
+        //   process. Sampled by the pipeline stats on each get.
+        volatile uint32_t  object_count;
+#endif
+#if LOCK_FREE_FIFO
+        EbRingCell        *ring_ptr;
+        uint32_t           ring_mask;
+        EbHandle           park_semaphore;
+        volatile uint32_t  waiter_count;
+        // enqueue_pos and dequeue_pos are written by different threads,
+        // keep them on separate cache lines
+        uint8_t            pad0[EB_CACHE_LINE_SIZE];
+        volatile uint32_t  enqueue_pos;
+        uint8_t            pad1[EB_CACHE_LINE_SIZE];
+        volatile uint32_t  dequeue_pos;
+        uint8_t            pad2[EB_CACHE_LINE_SIZE];
+#endif
     } EbMuxingQueue;
 
     /*********************************************************************
@@ -115,6 +166,10 @@ extern "C" {
         //   System Resoruce.
         uint32_t              object_total_count;
 
+        // object_count - A count of the objects constructed so far. Equal to
+        //   object_total_count unless the SystemResource is growable.
+        uint32_t              object_count;
+
         // wrapper_ptr_pool - An array of pointers to the EbObjectWrappers used
         //   to construct and destruct the SystemResource.
         EbObjectWrapper **wrapper_ptr_pool;
@@ -124,6 +179,29 @@ extern "C" {
 
         // The full FIFO contains a queue of completed buffers
         EbMuxingQueue     *full_queue;
+
+        // object_release_cb - called with the object when its live_count
+        //   drops to zero, before it goes back to the empty queue. NULL
+        //   unless set with eb_system_resource_set_release_callback.
+        void             (*object_release_cb)(EbPtr object_ptr, EbPtr release_data_ptr);
+        EbPtr              release_data_ptr;
+
+        // growable - the objects past the initial ones are constructed when
+        //   a process finds the empty queue dry, see
+        //   eb_system_resource_growable_ctor. empty_object_count counts the
+        //   objects in the empty queue, grow_mutex serializes the growth.
+        EbBool                growable;
+        volatile uint32_t     empty_object_count;
+        EbHandle              grow_mutex;
+        EbCtor                object_ctor;
+        EbPtr                 object_init_data_ptr;
+
+        // object_size - memory taken by the first object, memory_budget -
+        //   size the arena of the SystemResource may reach by growing it,
+        //   0 for no bound
+        uint64_t              object_size;
+        uint64_t              memory_budget;
+        struct EbMemoryArena *arena_ptr;
     } EbSystemResource;
 
     /*********************************************************************
@@ -219,6 +297,64 @@ extern "C" {
         EbCtor             object_ctor,
         EbPtr               object_init_data_ptr);
 
+    /*********************************************************************
+     * eb_system_resource_growable_ctor
+     *   Constructor for a growable EbSystemResource. Only
+     *   object_init_count objects are constructed, the following ones,
+     *   up to object_total_count, are constructed one at a time by
+     *   eb_get_empty_object when it finds no empty object, unless the
+     *   arena would then hold more than memory_budget bytes. The process
+     *   waits for a released object otherwise.
+     *
+     *   object_init_count
+     *     Number of objects constructed by the constructor, at least 1.
+     *
+     *   object_init_data_ptr, object_init_data_size
+     *     The object_init_data_size bytes at object_init_data_ptr are
+     *     copied, for the objects constructed later. object_init_data_ptr
+     *     is kept as is when object_init_data_size is 0.
+     *
+     *   memory_budget
+     *     Allocated size of the arena past which the SystemResource stops
+     *     growing, 0 for no bound.
+     *
+     *   The other parameters are the ones of eb_system_resource_ctor.
+     *********************************************************************/
+    extern EbErrorType eb_system_resource_growable_ctor(
+        EbSystemResource **resource_dbl_ptr,
+        uint32_t            object_init_count,
+        uint32_t            object_total_count,
+        uint32_t            producer_process_total_count,
+        uint32_t            consumer_process_total_count,
+        EbFifo         ***producer_fifo_ptr_array_ptr,
+        EbFifo         ***consumer_fifo_ptr_array_ptr,
+        EbBool              full_fifo_enabled,
+        EbCtor             object_ctor,
+        EbPtr               object_init_data_ptr,
+        uint32_t            object_init_data_size,
+        uint64_t            memory_budget);
+
+    /*********************************************************************
+     * eb_system_resource_set_release_callback
+     *   Sets the function called on each object of the SystemResource
+     *   once it is released for reuse, e.g. to hand back memory the object
+     *   references.  The callback runs on the thread of the last
+     *   eb_release_object call.
+     *
+     *   resource_ptr
+     *     pointer to the SystemResource.
+     *
+     *   object_release_cb
+     *     callback, called with the object and release_data_ptr.
+     *
+     *   release_data_ptr
+     *     pointer passed back to object_release_cb.
+     *********************************************************************/
+    extern void eb_system_resource_set_release_callback(
+        EbSystemResource  *resource_ptr,
+        void             (*object_release_cb)(EbPtr object_ptr, EbPtr release_data_ptr),
+        EbPtr              release_data_ptr);
+
     /*********************************************************************
      * eb_system_resource_dtor
      *   Destructor for EbSystemResource.  Fully destructs all members
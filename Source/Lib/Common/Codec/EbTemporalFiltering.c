@@ -1596,7 +1596,7 @@ void init_temporal_filtering(PictureParentControlSet **list_picture_control_set_
                                     PictureParentControlSet *picture_control_set_ptr_central,
                                     MotionEstimationContext_t *me_context_ptr,
                                     int32_t segment_index) {
-    uint8_t *altref_strength_ptr, *altref_nframes_ptr, index_center;
+    uint8_t *altref_strength_ptr, *altref_nframes_ptr;
     EbPictureBufferDesc *input_picture_ptr;
     uint8_t *alt_ref_buffer[COLOR_CHANNELS];
 
@@ -1604,9 +1604,6 @@ void init_temporal_filtering(PictureParentControlSet **list_picture_control_set_
     altref_nframes_ptr = &(picture_control_set_ptr_central->altref_nframes);
     altref_strength_ptr = &(picture_control_set_ptr_central->altref_strength);
 
-    // index of the central source frame
-    index_center = (uint8_t)(*altref_nframes_ptr / 2);
-
     // source central frame picture buffer
     input_picture_ptr = picture_control_set_ptr_central->enhanced_picture_ptr;
 
@@ -1619,25 +1616,24 @@ void init_temporal_filtering(PictureParentControlSet **list_picture_control_set_
         // adjust filter parameter based on the estimated noise of the picture
         adjust_filter_params(input_picture_ptr, altref_strength_ptr);
 
-        // Pad chroma reference samples - once only per picture
+        // Pad chroma samples - once only per picture. The central picture
+        // too, its last block row and column go past the picture
         for (int i = 0; i < *altref_nframes_ptr; i++) {
-            if (i != index_center) {
-                EbPictureBufferDesc *pic_ptr_ref = list_picture_control_set_ptr[i]->enhanced_picture_ptr;
-
-                generate_padding(pic_ptr_ref->buffer_cb,
-                    pic_ptr_ref->stride_cb,
-                    pic_ptr_ref->width >> 1,
-                    pic_ptr_ref->height >> 1,
-                    pic_ptr_ref->origin_x >> 1,
-                    pic_ptr_ref->origin_y >> 1);
-
-                generate_padding(pic_ptr_ref->buffer_cr,
-                    pic_ptr_ref->stride_cr,
-                    pic_ptr_ref->width >> 1,
-                    pic_ptr_ref->height >> 1,
-                    pic_ptr_ref->origin_x >> 1,
-                    pic_ptr_ref->origin_y >> 1);
-            }
+            EbPictureBufferDesc *pic_ptr_ref = list_picture_control_set_ptr[i]->enhanced_picture_ptr;
+
+            generate_padding(pic_ptr_ref->buffer_cb,
+                pic_ptr_ref->stride_cb,
+                pic_ptr_ref->width >> 1,
+                pic_ptr_ref->height >> 1,
+                pic_ptr_ref->origin_x >> 1,
+                pic_ptr_ref->origin_y >> 1);
+
+            generate_padding(pic_ptr_ref->buffer_cr,
+                pic_ptr_ref->stride_cr,
+                pic_ptr_ref->width >> 1,
+                pic_ptr_ref->height >> 1,
+                pic_ptr_ref->origin_x >> 1,
+                pic_ptr_ref->origin_y >> 1);
         }
     }
     eb_release_mutex(picture_control_set_ptr_central->temp_filt_mutex);
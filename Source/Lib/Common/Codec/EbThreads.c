@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include "EbDefinitions.h"
 #include "EbThreads.h"
+#include "EbMemoryArena.h"
  /****************************************
   * Win32 Includes
   ****************************************/
@@ -25,6 +26,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <pthread.h>
+#include <sched.h>
 #include <semaphore.h>
 #include <time.h>
 #include <unistd.h>
@@ -45,6 +47,23 @@ void printfTime(const char *fmt, ...)
 #endif
 #endif
 
+// Pool the calling thread runs in, NULL for threads not started through a pool
+static EB_THREAD_LOCAL EbThreadPool *thread_pool_ptr = NULL;
+
+typedef struct EbArenaThreadContext {
+    EbMemoryArena *arena_ptr;
+    void        *(*thread_function)(void *);
+    void          *thread_context;
+} EbArenaThreadContext;
+
+static void* arena_thread_entry(void *input_ptr)
+{
+    EbArenaThreadContext *context_ptr = (EbArenaThreadContext*)input_ptr;
+
+    eb_memory_arena_set_current(context_ptr->arena_ptr);
+    return context_ptr->thread_function(context_ptr->thread_context);
+}
+
 /****************************************
  * eb_create_thread
  ****************************************/
@@ -54,6 +73,19 @@ EbHandle eb_create_thread(
 {
     EbHandle thread_handle = NULL;
 
+    // The new thread allocates from the arena of its creator, the context
+    // goes with the arena
+    if (eb_memory_arena_get_current()) {
+        EbArenaThreadContext *context_ptr = (EbArenaThreadContext*)eb_memory_arena_alloc(sizeof(EbArenaThreadContext), sizeof(EbPtr), EB_FALSE);
+        if (context_ptr == NULL)
+            return NULL;
+        context_ptr->arena_ptr = eb_memory_arena_get_current();
+        context_ptr->thread_function = thread_function;
+        context_ptr->thread_context = thread_context;
+        thread_function = arena_thread_entry;
+        thread_context = context_ptr;
+    }
+
 #ifdef _WIN32
 
     thread_handle = (EbHandle)CreateThread(
@@ -241,10 +273,7 @@ EbErrorType eb_post_semaphore(
     return return_error;
 }
 
-/***************************************
- * eb_block_on_semaphore
- ***************************************/
-EbErrorType eb_block_on_semaphore(
+static EbErrorType semaphore_wait(
     EbHandle semaphore_handle)
 {
     EbErrorType return_error = EB_ErrorNone;
@@ -258,6 +287,38 @@ EbErrorType eb_block_on_semaphore(
     return return_error;
 }
 
+static EbBool semaphore_try_wait(
+    EbHandle semaphore_handle)
+{
+#ifdef _WIN32
+    return WaitForSingleObject((HANDLE)semaphore_handle, 0) == WAIT_OBJECT_0 ? EB_TRUE : EB_FALSE;
+#elif defined(__linux__) || defined(__APPLE__)
+    return sem_trywait((sem_t*)semaphore_handle) ? EB_FALSE : EB_TRUE;
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_block_on_semaphore
+ ***************************************/
+EbErrorType eb_block_on_semaphore(
+    EbHandle semaphore_handle)
+{
+    EbThreadPool *pool_ptr = thread_pool_ptr;
+    EbErrorType   return_error;
+
+    if (pool_ptr == NULL)
+        return semaphore_wait(semaphore_handle);
+    if (semaphore_try_wait(semaphore_handle))
+        return EB_ErrorNone;
+
+    // Hand the run slot over to another pool thread while blocked
+    eb_post_semaphore(pool_ptr->slot_semaphore);
+    return_error = semaphore_wait(semaphore_handle);
+    semaphore_wait(pool_ptr->slot_semaphore);
+
+    return return_error;
+}
+
 /***************************************
  * eb_destroy_semaphore
  ***************************************/
@@ -375,3 +436,325 @@ EbErrorType eb_destroy_mutex(
 
     return return_error;
 }
+
+/***************************************
+ * Condition Variables
+ ***************************************/
+typedef struct EbCondVar {
+#ifdef _WIN32
+    CRITICAL_SECTION    lock;
+    CONDITION_VARIABLE  cond;
+#else
+    pthread_mutex_t     lock;
+    pthread_cond_t      cond;
+#endif // _WIN32
+    // Threads in eb_wait_cond_var, eb_signal_cond_var skips the lock
+    // when there are none
+    volatile uint32_t   waiter_count;
+} EbCondVar;
+
+/***************************************
+ * eb_create_cond_var
+ ***************************************/
+EbHandle eb_create_cond_var(
+    void)
+{
+    EbCondVar *cond_var_ptr = (EbCondVar*)malloc(sizeof(EbCondVar));
+
+    if (cond_var_ptr == NULL)
+        return NULL;
+
+#ifdef _WIN32
+    InitializeCriticalSection(&cond_var_ptr->lock);
+    InitializeConditionVariable(&cond_var_ptr->cond);
+#else
+    if (pthread_mutex_init(&cond_var_ptr->lock, NULL)) {
+        free(cond_var_ptr);
+        return NULL;
+    }
+    if (pthread_cond_init(&cond_var_ptr->cond, NULL)) {
+        pthread_mutex_destroy(&cond_var_ptr->lock);
+        free(cond_var_ptr);
+        return NULL;
+    }
+#endif // _WIN32
+    cond_var_ptr->waiter_count = 0;
+
+    return (EbHandle)cond_var_ptr;
+}
+
+/***************************************
+ * eb_signal_cond_var
+ *   Wakes all the waiters, to be called
+ *   after each update of the values they
+ *   wait on.
+ ***************************************/
+EbErrorType eb_signal_cond_var(
+    EbHandle cond_var_handle)
+{
+    EbCondVar *cond_var_ptr = (EbCondVar*)cond_var_handle;
+
+    // The update of the value and this load are sequentially consistent,
+    // so a waiter either is counted here or sees the new value
+    if (eb_atomic_load_u32(&cond_var_ptr->waiter_count) == 0)
+        return EB_ErrorNone;
+
+#ifdef _WIN32
+    EnterCriticalSection(&cond_var_ptr->lock);
+    WakeAllConditionVariable(&cond_var_ptr->cond);
+    LeaveCriticalSection(&cond_var_ptr->lock);
+#else
+    pthread_mutex_lock(&cond_var_ptr->lock);
+    pthread_cond_broadcast(&cond_var_ptr->cond);
+    pthread_mutex_unlock(&cond_var_ptr->lock);
+#endif // _WIN32
+
+    return EB_ErrorNone;
+}
+
+/***************************************
+ * eb_wait_cond_var
+ *   Blocks until *value reaches target or
+ *   *abort_flag, if not NULL, is set.
+ *   Returns EB_FALSE on abort. A pool
+ *   thread gives its run slot back while
+ *   it blocks.
+ ***************************************/
+EbBool eb_wait_cond_var(
+    EbHandle           cond_var_handle,
+    volatile uint32_t *value,
+    uint32_t           target,
+    volatile uint32_t *abort_flag)
+{
+    EbCondVar    *cond_var_ptr = (EbCondVar*)cond_var_handle;
+    EbThreadPool *pool_ptr = thread_pool_ptr;
+    EbBool        reached;
+
+    if (eb_atomic_load_u32(value) >= target)
+        return EB_TRUE;
+    if (abort_flag && eb_atomic_load_u32(abort_flag))
+        return EB_FALSE;
+
+    if (pool_ptr)
+        eb_post_semaphore(pool_ptr->slot_semaphore);
+
+#ifdef _WIN32
+    EnterCriticalSection(&cond_var_ptr->lock);
+#else
+    pthread_mutex_lock(&cond_var_ptr->lock);
+#endif // _WIN32
+    eb_atomic_fetch_add_u32(&cond_var_ptr->waiter_count, 1);
+    for (;;) {
+        reached = (EbBool)(eb_atomic_load_u32(value) >= target);
+        if (reached || (abort_flag && eb_atomic_load_u32(abort_flag)))
+            break;
+#ifdef _WIN32
+        SleepConditionVariableCS(&cond_var_ptr->cond, &cond_var_ptr->lock, INFINITE);
+#else
+        pthread_cond_wait(&cond_var_ptr->cond, &cond_var_ptr->lock);
+#endif // _WIN32
+    }
+    eb_atomic_fetch_add_u32(&cond_var_ptr->waiter_count, (uint32_t)-1);
+#ifdef _WIN32
+    LeaveCriticalSection(&cond_var_ptr->lock);
+#else
+    pthread_mutex_unlock(&cond_var_ptr->lock);
+#endif // _WIN32
+
+    // The slot is taken back outside of the lock, the threads holding the
+    // slots may need it to signal
+    if (pool_ptr)
+        semaphore_wait(pool_ptr->slot_semaphore);
+
+    return reached;
+}
+
+/***************************************
+ * eb_destroy_cond_var
+ ***************************************/
+EbErrorType eb_destroy_cond_var(
+    EbHandle cond_var_handle)
+{
+    EbCondVar *cond_var_ptr = (EbCondVar*)cond_var_handle;
+    EbErrorType return_error = EB_ErrorNone;
+
+#ifdef _WIN32
+    DeleteCriticalSection(&cond_var_ptr->lock);
+#else
+    if (pthread_cond_destroy(&cond_var_ptr->cond) || pthread_mutex_destroy(&cond_var_ptr->lock))
+        return_error = EB_ErrorDestroyMutexFailed;
+#endif // _WIN32
+    free(cond_var_ptr);
+
+    return return_error;
+}
+
+/***************************************
+ * eb_atomic_load_u32
+ ***************************************/
+uint32_t eb_atomic_load_u32(
+    volatile uint32_t *ptr)
+{
+#ifdef _WIN32
+    return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+#elif defined(__linux__) || defined(__APPLE__)
+    return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_atomic_store_u32
+ ***************************************/
+void eb_atomic_store_u32(
+    volatile uint32_t *ptr,
+    uint32_t           value)
+{
+#ifdef _WIN32
+    InterlockedExchange((volatile LONG*)ptr, (LONG)value);
+#elif defined(__linux__) || defined(__APPLE__)
+    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_atomic_fetch_add_u32
+ *   Returns the value before the add.
+ ***************************************/
+uint32_t eb_atomic_fetch_add_u32(
+    volatile uint32_t *ptr,
+    uint32_t           value)
+{
+#ifdef _WIN32
+    return (uint32_t)InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)value);
+#elif defined(__linux__) || defined(__APPLE__)
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_atomic_cas_u32
+ *   Stores desired in *ptr if *ptr equals
+ *   expected. Returns EB_TRUE on success.
+ ***************************************/
+EbBool eb_atomic_cas_u32(
+    volatile uint32_t *ptr,
+    uint32_t           expected,
+    uint32_t           desired)
+{
+#ifdef _WIN32
+    return (EbBool)((uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, (LONG)desired, (LONG)expected) == expected);
+#elif defined(__linux__) || defined(__APPLE__)
+    return (EbBool)__atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_cpu_pause
+ *   Spin-wait hint to the processor.
+ ***************************************/
+void eb_cpu_pause(
+    void)
+{
+#ifdef _WIN32
+    YieldProcessor();
+#elif defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif // _WIN32
+}
+
+/***************************************
+ * eb_yield_thread
+ ***************************************/
+void eb_yield_thread(
+    void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#elif defined(__linux__) || defined(__APPLE__)
+    sched_yield();
+#endif // _WIN32
+}
+
+/***************************************
+ * Thread Pool
+ ***************************************/
+typedef struct EbPoolThreadContext {
+    EbThreadPool *pool_ptr;
+    void       *(*thread_function)(void *);
+    void         *thread_context;
+} EbPoolThreadContext;
+
+static void* pool_thread_entry(void *input_ptr)
+{
+    EbPoolThreadContext *context_ptr = (EbPoolThreadContext*)input_ptr;
+    void                *return_ptr;
+
+    thread_pool_ptr = context_ptr->pool_ptr;
+    semaphore_wait(thread_pool_ptr->slot_semaphore);
+
+    return_ptr = context_ptr->thread_function(context_ptr->thread_context);
+
+    eb_post_semaphore(thread_pool_ptr->slot_semaphore);
+    return return_ptr;
+}
+
+/***************************************
+ * eb_thread_pool_ctor
+ *   slot_count is the number of pool
+ *   threads allowed to run at once.
+ ***************************************/
+EbErrorType eb_thread_pool_ctor(
+    EbThreadPool **pool_dbl_ptr,
+    uint32_t       slot_count)
+{
+    EbThreadPool *pool_ptr;
+
+    EB_MALLOC(EbThreadPool*, pool_ptr, sizeof(EbThreadPool), EB_N_PTR);
+    *pool_dbl_ptr = pool_ptr;
+
+    pool_ptr->slot_count = slot_count ? slot_count : 1;
+    EB_CREATESEMAPHORE(EbHandle, pool_ptr->slot_semaphore, sizeof(EbHandle), EB_SEMAPHORE, pool_ptr->slot_count, pool_ptr->slot_count);
+
+    return EB_ErrorNone;
+}
+
+/***************************************
+ * eb_thread_pool_is_current
+ *   EB_TRUE if the calling thread runs in
+ *   a pool, i.e. holds one of its run
+ *   slots unless it is blocked.
+ ***************************************/
+EbBool eb_thread_pool_is_current(void)
+{
+    return thread_pool_ptr ? EB_TRUE : EB_FALSE;
+}
+
+/***************************************
+ * eb_thread_pool_bind
+ *   Redirects thread_function and
+ *   thread_context so that the thread
+ *   created from them takes a run slot of
+ *   pool_ptr before entering the kernel.
+ *   Nothing is changed if pool_ptr is NULL.
+ ***************************************/
+EbErrorType eb_thread_pool_bind(
+    EbThreadPool   *pool_ptr,
+    void         *(**thread_function)(void *),
+    void          **thread_context)
+{
+    EbPoolThreadContext *context_ptr;
+
+    if (pool_ptr == NULL)
+        return EB_ErrorNone;
+
+    EB_MALLOC(EbPoolThreadContext*, context_ptr, sizeof(EbPoolThreadContext), EB_N_PTR);
+
+    context_ptr->pool_ptr        = pool_ptr;
+    context_ptr->thread_function = *thread_function;
+    context_ptr->thread_context  = *thread_context;
+
+    *thread_function = pool_thread_entry;
+    *thread_context  = context_ptr;
+
+    return EB_ErrorNone;
+}
@@ -15,6 +15,12 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+#ifdef _WIN32
+#define EB_THREAD_LOCAL __declspec(thread)
+#else
+#define EB_THREAD_LOCAL __thread
+#endif
+
     // Create wrapper functions that hide thread calls,
     // semaphores, mutex, etc. These wrappers also hide
     // platform specific implementations of these objects.
@@ -70,39 +76,114 @@ extern "C" {
     extern EbErrorType eb_destroy_mutex(
         EbHandle mutex_handle);
 
-    extern    EbMemoryMapEntry *memory_map;                // library Memory table
-    extern    uint32_t         *memory_map_index;          // library memory index
-    extern    uint64_t         *total_lib_memory;          // library Memory malloc'd
+    /**************************************
+     * Condition Variables
+     *   Wait for a counter raised by other
+     *   threads, each raise followed by an
+     *   eb_signal_cond_var.
+     **************************************/
+    extern EbHandle eb_create_cond_var(
+        void);
+
+    extern EbErrorType eb_signal_cond_var(
+        EbHandle cond_var_handle);
+
+    extern EbBool eb_wait_cond_var(
+        EbHandle           cond_var_handle,
+        volatile uint32_t *value,
+        uint32_t           target,
+        volatile uint32_t *abort_flag);
+
+    extern EbErrorType eb_destroy_cond_var(
+        EbHandle cond_var_handle);
+
+    /**************************************
+     * Atomics
+     *   All operations are sequentially
+     *   consistent full barriers.
+     **************************************/
+    extern uint32_t eb_atomic_load_u32(
+        volatile uint32_t *ptr);
+
+    extern void eb_atomic_store_u32(
+        volatile uint32_t *ptr,
+        uint32_t           value);
+
+    extern uint32_t eb_atomic_fetch_add_u32(
+        volatile uint32_t *ptr,
+        uint32_t           value);
+
+    extern EbBool eb_atomic_cas_u32(
+        volatile uint32_t *ptr,
+        uint32_t           expected,
+        uint32_t           desired);
+
+    /**************************************
+     * Spin Wait
+     **************************************/
+    extern void eb_cpu_pause(
+        void);
+
+    extern void eb_yield_thread(
+        void);
+
+    /**************************************
+     * Thread Pool
+     *   Threads bound to a pool share its
+     *   slot_count run slots. A pool thread
+     *   gives its slot back while it waits in
+     *   eb_block_on_semaphore or
+     *   eb_wait_cond_var, so the slots
+     *   follow whichever stage has work. It
+     *   keeps its slot while it spins or
+     *   yields, so a pool thread must not
+     *   busy wait on another pool thread.
+     **************************************/
+    typedef struct EbThreadPool {
+        EbHandle slot_semaphore;
+        uint32_t slot_count;
+    } EbThreadPool;
+
+    extern EbErrorType eb_thread_pool_ctor(
+        EbThreadPool **pool_dbl_ptr,
+        uint32_t       slot_count);
+
+    extern EbBool eb_thread_pool_is_current(
+        void);
+
+    extern EbErrorType eb_thread_pool_bind(
+        EbThreadPool   *pool_ptr,
+        void         *(**thread_function)(void *),
+        void          **thread_context);
+
 #ifdef _WIN32
-    extern    GROUP_AFFINITY    group_affinity;
-    extern    uint8_t           num_groups;
-    extern    EbBool            alternate_groups;
+    /**************************************
+     * Thread Affinity
+     *   Where the threads of one encoder
+     *   instance run, kept per instance so
+     *   the setting of an instance does not
+     *   carry over to the next one.
+     **************************************/
+    typedef struct EbThreadAffinity {
+        GROUP_AFFINITY group_affinity;
+        uint8_t        num_groups;
+        EbBool         alternate_groups;
+    } EbThreadAffinity;
 
-#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context) \
+#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context, affinity) \
     pointer = eb_create_thread(thread_function, thread_context); \
     if (pointer == (type)EB_NULL) \
         return EB_ErrorInsufficientResources; \
     else { \
-        EbMemoryMapEntry *node = malloc(sizeof(EbMemoryMapEntry)); \
-        if (node == (EbMemoryMapEntry*)EB_NULL) return EB_ErrorInsufficientResources; \
-        node->ptr_type         = pointer_class; \
-        node->ptr              = (EbPtr)pointer;\
-        node->prev_entry       = (EbPtr)memory_map;   \
-        memory_map             = node;          \
-        (*memory_map_index)++;                  \
-        if (n_elements % 8 == 0) \
-            *total_lib_memory += ((n_elements) + sizeof(EbMemoryMapEntry)); \
-        else \
-            *total_lib_memory += (((n_elements)+(8 - ((n_elements) % 8))) + sizeof(EbMemoryMapEntry)); \
-        if(num_groups == 1) \
-            SetThreadAffinityMask(pointer, group_affinity.Mask);\
-        else if (num_groups == 2 && alternate_groups){ \
-            group_affinity.Group = 1 - group_affinity.Group; \
-            SetThreadGroupAffinity(pointer,&group_affinity,NULL); \
+        EB_ADD_MEM(pointer, pointer_class, eb_destroy_thread); \
+        if((affinity)->num_groups == 1) \
+            SetThreadAffinityMask(pointer, (affinity)->group_affinity.Mask);\
+        else if ((affinity)->num_groups == 2 && (affinity)->alternate_groups){ \
+            (affinity)->group_affinity.Group = 1 - (affinity)->group_affinity.Group; \
+            SetThreadGroupAffinity(pointer,&(affinity)->group_affinity,NULL); \
         } \
-        else if (num_groups == 2 && !alternate_groups) \
-            SetThreadGroupAffinity(pointer,&group_affinity,NULL); \
-        lib_thread_count++; \
+        else if ((affinity)->num_groups == 2 && !(affinity)->alternate_groups) \
+            SetThreadGroupAffinity(pointer,&(affinity)->group_affinity,NULL); \
     }
 
 #elif defined(__linux__)
@@ -110,47 +191,45 @@ extern "C" {
 #define _GNU_SOURCE
 #include <sched.h>
 #include <pthread.h>
-extern    cpu_set_t                   group_affinity;
-#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context) \
+#define MAX_PROCESSOR_GROUP 16
+typedef struct logicalProcessorGroup {
+    uint32_t num;
+    uint32_t group[1024];
+}processorGroup;
+/**************************************
+ * Thread Affinity
+ *   Where the threads of one encoder
+ *   instance run, kept per instance so
+ *   the setting of an instance does not
+ *   carry over to the next one.
+ **************************************/
+typedef struct EbThreadAffinity {
+    cpu_set_t      group_affinity;
+    uint8_t        num_groups;
+    processorGroup lp_group[MAX_PROCESSOR_GROUP];
+} EbThreadAffinity;
+#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context, affinity) \
     pointer = eb_create_thread(thread_function, thread_context); \
     if (pointer == (type)EB_NULL) { \
         return EB_ErrorInsufficientResources; \
     } \
    else { \
-        pthread_setaffinity_np(*((pthread_t*)pointer),sizeof(cpu_set_t),&group_affinity); \
-        EbMemoryMapEntry *node = malloc(sizeof(EbMemoryMapEntry)); \
-        if (node == (EbMemoryMapEntry*)EB_NULL) return EB_ErrorInsufficientResources; \
-        node->ptr_type         = pointer_class; \
-        node->ptr              = (EbPtr)pointer;\
-        node->prev_entry       = (EbPtr)memory_map;   \
-        memory_map             = node;          \
-        (*memory_map_index)++; \
-        if (n_elements % 8 == 0) \
-            *total_lib_memory += ((n_elements) + sizeof(EbMemoryMapEntry)); \
-        else \
-            *total_lib_memory += (((n_elements)+(8 - ((n_elements) % 8))) + sizeof(EbMemoryMapEntry)); \
-        lib_thread_count++; \
+        pthread_setaffinity_np(*((pthread_t*)pointer),sizeof(cpu_set_t),&(affinity)->group_affinity); \
+        EB_ADD_MEM(pointer, pointer_class, eb_destroy_thread); \
     }
 
 #else
-#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context) \
+typedef struct EbThreadAffinity {
+    uint8_t        num_groups;
+} EbThreadAffinity;
+#define EB_CREATETHREAD(type, pointer, n_elements, pointer_class, thread_function, thread_context, affinity) \
+    (void)(affinity); \
     pointer = eb_create_thread(thread_function, thread_context); \
     if (pointer == (type)EB_NULL) { \
         return EB_ErrorInsufficientResources; \
     } \
    else { \
-        EbMemoryMapEntry *node = malloc(sizeof(EbMemoryMapEntry)); \
-        if (node == (EbMemoryMapEntry*)EB_NULL) return EB_ErrorInsufficientResources; \
-        node->ptr_type         = pointer_class; \
-        node->ptr              = (EbPtr)pointer;\
-        node->prev_entry       = (EbPtr)memory_map;   \
-        memory_map             = node;          \
-        (*memory_map_index)++; \
-        if (n_elements % 8 == 0) \
-            *total_lib_memory += ((n_elements) + sizeof(EbMemoryMapEntry)); \
-        else \
-            *total_lib_memory += (((n_elements)+(8 - ((n_elements) % 8))) + sizeof(EbMemoryMapEntry)); \
-        lib_thread_count++; \
+        EB_ADD_MEM(pointer, pointer_class, eb_destroy_thread); \
     }
 #endif
 #ifdef __cplusplus
@@ -0,0 +1,228 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <math.h>
+
+#include "EbUtility.h"
+
+#include "EbModeDecisionProcess.h"
+#include "EbRateControlProcess.h"
+#include "RateControlTwoPass.h"
+
+/*
+ * Range of the correction of the predicted sizes by the sizes fed back
+ */
+#define TWO_PASS_MIN_RATIO      0.25
+#define TWO_PASS_MAX_RATIO      4.0
+
+/*
+ * @private
+ * @function get_q_step. Helper to interpolate the quantizer step size of a
+ * fractional QP, clipped to the QP range of the configuration
+ * @param {TwoPassRateControl*} rc_ptr.
+ * @param {double} qp.
+ * @return {double}.
+ */
+static double get_q_step(TwoPassRateControl *rc_ptr, double qp);
+
+/*
+ * @private
+ * @function predict_pending_bits. Helper to predict the size of the pictures
+ * not given a QP yet when their first pass QP is offset by delta_qp
+ * @param {TwoPassRateControl*} rc_ptr.
+ * @param {double} delta_qp.
+ * @return {double}.
+ */
+static double predict_pending_bits(TwoPassRateControl *rc_ptr, double delta_qp);
+
+EbErrorType first_pass_stats_ctor(uint8_t **stats_dbl_ptr, uint32_t *size_ptr, SequenceControlSet *sequence_control_set_ptr) {
+    uint32_t                frame_count = (uint32_t)sequence_control_set_ptr->static_config.frames_to_be_encoded;
+    uint32_t                size = sizeof(FirstPassStatsHeader) + frame_count * sizeof(FirstPassFrameStats);
+    uint8_t                *stats;
+    FirstPassStatsHeader   *header;
+
+    EB_CALLOC(uint8_t*, stats, 1, size, EB_N_PTR);
+    header = (FirstPassStatsHeader*)stats;
+    header->magic = FIRST_PASS_STATS_MAGIC;
+    header->version = FIRST_PASS_STATS_VERSION;
+    header->width = sequence_control_set_ptr->seq_header.max_frame_width;
+    header->height = sequence_control_set_ptr->seq_header.max_frame_height;
+    header->frame_count = frame_count;
+    header->frame_rate = sequence_control_set_ptr->static_config.frame_rate;
+
+    *stats_dbl_ptr = stats;
+    *size_ptr = size;
+
+    return EB_ErrorNone;
+}
+
+EbErrorType first_pass_stats_check(const uint8_t *stats, uint32_t size, SequenceControlSet *sequence_control_set_ptr) {
+    const FirstPassStatsHeader  *header = (const FirstPassStatsHeader*)stats;
+    uint32_t                    frame_count = (uint32_t)sequence_control_set_ptr->static_config.frames_to_be_encoded;
+
+    if (stats == NULL || size < sizeof(FirstPassStatsHeader) ||
+        header->magic != FIRST_PASS_STATS_MAGIC || header->version != FIRST_PASS_STATS_VERSION ||
+        size < sizeof(FirstPassStatsHeader) + (uint64_t)header->frame_count * sizeof(FirstPassFrameStats)) {
+        SVT_LOG("Error: The second pass needs the statistics of a first pass\n");
+        return EB_ErrorBadParameter;
+    }
+    if (header->width == 0 || header->height == 0) {
+        SVT_LOG("Error: The first pass statistics have no resolution\n");
+        return EB_ErrorBadParameter;
+    }
+    if (header->frame_count < frame_count) {
+        SVT_LOG("Error: The first pass has %u frames, the second pass needs %u\n", header->frame_count, frame_count);
+        return EB_ErrorBadParameter;
+    }
+
+    return EB_ErrorNone;
+}
+
+void first_pass_stats_record(uint8_t *stats, PictureParentControlSet *picture_ptr) {
+    const FirstPassStatsHeader  *header = (const FirstPassStatsHeader*)stats;
+    FirstPassFrameStats         *frame;
+
+    if (picture_ptr->picture_number >= header->frame_count)
+        return;
+    frame = (FirstPassFrameStats*)(stats + sizeof(FirstPassStatsHeader)) + picture_ptr->picture_number;
+
+    frame->bits = (uint32_t)MIN(picture_ptr->total_num_bits, (uint64_t)0xFFFFFFFF);
+    frame->qp = picture_ptr->picture_qp;
+    frame->slice_type = (uint8_t)picture_ptr->slice_type;
+    frame->temporal_layer_index = picture_ptr->temporal_layer_index;
+    frame->reserved = 0;
+}
+
+EbErrorType two_pass_rate_control_ctor(TwoPassRateControl **object_dbl_ptr) {
+    TwoPassRateControl  *rc_ptr;
+
+    EB_MALLOC(TwoPassRateControl*, rc_ptr, sizeof(TwoPassRateControl), EB_N_PTR);
+    *object_dbl_ptr = rc_ptr;
+
+    EB_MEMSET(rc_ptr, 0, sizeof(TwoPassRateControl));
+
+    return EB_ErrorNone;
+}
+
+EbErrorType two_pass_rate_control_init(TwoPassRateControl *rc_ptr, SequenceControlSet *sequence_control_set_ptr, const uint8_t *stats) {
+    EbSvtAv1EncConfiguration    *config = &sequence_control_set_ptr->static_config;
+    const FirstPassStatsHeader  *header = (const FirstPassStatsHeader*)stats;
+    uint32_t                    frame_rate = config->frame_rate;
+    double                      fps = frame_rate > 1000 ? frame_rate / (double)(1 << 16) : (double)frame_rate;
+    uint32_t                    frame_index;
+    uint32_t                    qp;
+
+    rc_ptr->frame_stats = (const FirstPassFrameStats*)(stats + sizeof(FirstPassStatsHeader));
+    // A first pass at another resolution, e.g. of another rendition of a
+    // ladder, is scaled by the number of pixels, the sizes fed back correct
+    // the rest
+    rc_ptr->bits_scale = (double)sequence_control_set_ptr->seq_header.max_frame_width * sequence_control_set_ptr->seq_header.max_frame_height /
+        ((double)header->width * header->height);
+    rc_ptr->frame_count = (uint32_t)config->frames_to_be_encoded;
+    rc_ptr->min_qp = config->min_qp_allowed;
+    rc_ptr->max_qp = config->max_qp_allowed;
+    EB_CALLOC(double*, rc_ptr->predicted_bits, rc_ptr->frame_count, sizeof(double), EB_N_PTR);
+
+    for (qp = MIN_QP_VALUE; qp <= MAX_QP_VALUE; qp++) {
+        rc_ptr->q_step[qp] = av1_convert_qindex_to_q(quantizer_to_qindex[qp], (AomBitDepth)config->encoder_bit_depth);
+        rc_ptr->pending_bits[qp] = 0;
+    }
+    for (frame_index = 0; frame_index < rc_ptr->frame_count; frame_index++) {
+        const FirstPassFrameStats *frame = &rc_ptr->frame_stats[frame_index];
+
+        rc_ptr->pending_bits[MIN(frame->qp, MAX_QP_VALUE)] += frame->bits * rc_ptr->bits_scale;
+    }
+
+    rc_ptr->target_bits = (double)config->target_bit_rate * rc_ptr->frame_count / fps;
+    rc_ptr->actual_bits = 0;
+    rc_ptr->actual_predicted_bits = 0;
+    rc_ptr->in_flight_predicted_bits = 0;
+
+    return EB_ErrorNone;
+}
+
+uint8_t two_pass_rate_control_get_quantizer(TwoPassRateControl *rc_ptr, PictureParentControlSet *picture_ptr) {
+    const FirstPassFrameStats   *frame;
+    uint32_t                    first_pass_qp;
+    double                      ratio = 1.0;
+    double                      remaining_bits;
+    int32_t                     qp;
+
+    if (picture_ptr->picture_number >= rc_ptr->frame_count)
+        return (uint8_t)rc_ptr->max_qp;
+    frame = &rc_ptr->frame_stats[picture_ptr->picture_number];
+    first_pass_qp = MIN(frame->qp, MAX_QP_VALUE);
+
+    // Scale the predictions by how far the sizes fed back are from them
+    if (rc_ptr->actual_predicted_bits > 0)
+        ratio = CLIP3(TWO_PASS_MIN_RATIO, TWO_PASS_MAX_RATIO, rc_ptr->actual_bits / rc_ptr->actual_predicted_bits);
+    remaining_bits = rc_ptr->target_bits - rc_ptr->actual_bits - ratio * rc_ptr->in_flight_predicted_bits;
+
+    if (remaining_bits <= 0)
+        qp = (int32_t)rc_ptr->max_qp;
+    else {
+        // The predicted size decreases with the offset, search the offset
+        // that spends the bits left
+        double  min_delta_qp = -MAX_QP_VALUE;
+        double  max_delta_qp = MAX_QP_VALUE;
+        int32_t iteration;
+
+        for (iteration = 0; iteration < 24; iteration++) {
+            double delta_qp = (min_delta_qp + max_delta_qp) / 2;
+
+            if (ratio * predict_pending_bits(rc_ptr, delta_qp) > remaining_bits)
+                min_delta_qp = delta_qp;
+            else
+                max_delta_qp = delta_qp;
+        }
+        qp = (int32_t)floor(first_pass_qp + max_delta_qp + 0.5);
+    }
+    qp = CLIP3((int32_t)rc_ptr->min_qp, (int32_t)rc_ptr->max_qp, qp);
+
+    rc_ptr->pending_bits[first_pass_qp] -= frame->bits * rc_ptr->bits_scale;
+    rc_ptr->predicted_bits[picture_ptr->picture_number] = frame->bits * rc_ptr->bits_scale * rc_ptr->q_step[first_pass_qp] / rc_ptr->q_step[qp];
+    rc_ptr->in_flight_predicted_bits += rc_ptr->predicted_bits[picture_ptr->picture_number];
+
+    return (uint8_t)qp;
+}
+
+void two_pass_rate_control_update(TwoPassRateControl *rc_ptr, PictureParentControlSet *picture_ptr) {
+    double  predicted_bits;
+
+    if (picture_ptr->picture_number >= rc_ptr->frame_count)
+        return;
+    predicted_bits = rc_ptr->predicted_bits[picture_ptr->picture_number];
+
+    rc_ptr->actual_bits += picture_ptr->total_num_bits;
+    rc_ptr->actual_predicted_bits += predicted_bits;
+    rc_ptr->in_flight_predicted_bits -= predicted_bits;
+}
+
+static double get_q_step(TwoPassRateControl *rc_ptr, double qp) {
+    int32_t  qp_index;
+    double   weight;
+
+    qp = CLIP3((double)rc_ptr->min_qp, (double)rc_ptr->max_qp, qp);
+    qp_index = (int32_t)qp;
+    if (qp_index >= MAX_QP_VALUE)
+        return rc_ptr->q_step[MAX_QP_VALUE];
+    weight = qp - qp_index;
+
+    // The step size grows about exponentially with the QP
+    return rc_ptr->q_step[qp_index] * pow(rc_ptr->q_step[qp_index + 1] / rc_ptr->q_step[qp_index], weight);
+}
+
+static double predict_pending_bits(TwoPassRateControl *rc_ptr, double delta_qp) {
+    double  bits = 0;
+    int32_t qp;
+
+    // The size of a picture is about inversely proportional to the step size
+    for (qp = MIN_QP_VALUE; qp <= MAX_QP_VALUE; qp++) {
+        if (rc_ptr->pending_bits[qp] > 0)
+            bits += rc_ptr->pending_bits[qp] * rc_ptr->q_step[qp] / get_q_step(rc_ptr, qp + delta_qp);
+    }
+
+    return bits;
+}
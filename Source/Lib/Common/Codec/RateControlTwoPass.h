@@ -0,0 +1,205 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef RateControlTwoPass_h
+#define RateControlTwoPass_h
+
+#include "EbSequenceControlSet.h"
+#include "EbPictureControlSet.h"
+
+/*
+ * Signature of the first pass statistics, "SVP1"
+ */
+#define FIRST_PASS_STATS_MAGIC      0x31505653
+#define FIRST_PASS_STATS_VERSION    2
+
+/*
+ * @struct Header of the first pass statistics, followed by frame_count
+ * FirstPassFrameStats indexed by picture number. All the fields are in the
+ * byte order of the host.
+ */
+typedef struct FirstPassStatsHeader {
+    uint32_t    magic;
+    uint32_t    version;
+    /*
+     * @variable uint32_t. Size of the encoded pictures in pixels
+     */
+    uint32_t    width;
+    uint32_t    height;
+    /*
+     * @variable uint32_t. Number of pictures of the first pass
+     */
+    uint32_t    frame_count;
+    /*
+     * @variable uint32_t. Frame rate of the first pass in Q16
+     */
+    uint32_t    frame_rate;
+} FirstPassStatsHeader;
+
+/*
+ * @struct Statistics of a picture in the first pass
+ */
+typedef struct FirstPassFrameStats {
+    /*
+     * @variable uint32_t. Size of the picture in bits. It is the complexity
+     * measure of the second pass: coded by the same tools at a known QP, it
+     * already accounts for the texture, the motion and the side information
+     * that the ME and variance costs only estimate
+     */
+    uint32_t    bits;
+    /*
+     * @variable uint8_t. QP the picture was coded with
+     */
+    uint8_t     qp;
+    /*
+     * @variable uint8_t. EB_SLICE of the picture
+     */
+    uint8_t     slice_type;
+    uint8_t     temporal_layer_index;
+    uint8_t     reserved;
+} FirstPassFrameStats;
+
+/*
+ * @struct Holds the bit allocation of the second pass over the whole clip
+ */
+typedef struct TwoPassRateControl {
+    /*
+     * @variable FirstPassFrameStats*. Statistics of the first pass, indexed
+     * by picture number
+     */
+    const FirstPassFrameStats  *frame_stats;
+
+    /*
+     * @variable double. Ratio of the number of pixels of the second pass to
+     * the one of the first pass
+     */
+    double      bits_scale;
+
+    /*
+     * @variable uint32_t. Number of pictures of the second pass
+     */
+    uint32_t    frame_count;
+
+    /*
+     * @variable uint32_t. QP range set in the configuration
+     */
+    uint32_t    min_qp;
+    uint32_t    max_qp;
+
+    /*
+     * @variable double[64]. Quantizer step size of each QP
+     */
+    double      q_step[MAX_QP_VALUE + 1];
+
+    /*
+     * @variable double[64]. First pass bits of the pictures not given a QP
+     * yet, indexed by their first pass QP
+     */
+    double      pending_bits[MAX_QP_VALUE + 1];
+
+    /*
+     * @variable double*. Size predicted for each picture at the QP it was
+     * given, indexed by picture number
+     */
+    double     *predicted_bits;
+
+    /*
+     * @variable double. Bits of the whole clip at the target bitrate
+     */
+    double      target_bits;
+
+    /*
+     * @variable double. Bits of the pictures fed back so far, and the size
+     * that was predicted for them
+     */
+    double      actual_bits;
+    double      actual_predicted_bits;
+
+    /*
+     * @variable double. Predicted size of the pictures given a QP but not fed
+     * back yet
+     */
+    double      in_flight_predicted_bits;
+} TwoPassRateControl;
+
+/*
+ * @function first_pass_stats_ctor. Allocate the statistics of a first pass
+ * and fill their header.
+ * @param {uint8_t**} stats_dbl_ptr. Address of the pointer to the statistics
+ * @param {uint32_t*} size_ptr. Set to the size of the statistics in bytes
+ * @param {SequenceControlSet*} sequence_control_set_ptr. Configuration of the first pass
+ * @return {EbErrorType}.
+ */
+EbErrorType first_pass_stats_ctor(uint8_t **stats_dbl_ptr,
+                                  uint32_t *size_ptr,
+                                  SequenceControlSet *sequence_control_set_ptr);
+
+/*
+ * @function first_pass_stats_check. Check that statistics can drive the
+ * second pass of the given configuration. The first pass may be at another
+ * resolution.
+ * @param {uint8_t*} stats. Statistics of the first pass
+ * @param {uint32_t} size. Size of the statistics in bytes
+ * @param {SequenceControlSet*} sequence_control_set_ptr. Configuration of the second pass
+ * @return {EbErrorType}. EB_ErrorBadParameter when they can not
+ */
+EbErrorType first_pass_stats_check(const uint8_t *stats,
+                                   uint32_t size,
+                                   SequenceControlSet *sequence_control_set_ptr);
+
+/*
+ * @function first_pass_stats_record. Record the statistics of a coded picture.
+ * Must be called once its size is known.
+ * @param {uint8_t*} stats. Statistics of the first pass
+ * @param {PictureParentControlSet*} picture_ptr. Coded picture.
+ * @return {void}.
+ */
+void first_pass_stats_record(uint8_t *stats,
+                             PictureParentControlSet *picture_ptr);
+
+/*
+ * @function two_pass_rate_control_ctor. Allocate and initialize a new
+ * TwoPassRateControl with default values.
+ * @param {TwoPassRateControl**} object_dbl_ptr. Address of the pointer to TwoPassRateControl
+ * @return {EbErrorType}.
+ */
+EbErrorType two_pass_rate_control_ctor(TwoPassRateControl **object_dbl_ptr);
+
+/*
+ * @function two_pass_rate_control_init. Initialize the allocation with the
+ * statistics of the first pass. Must be called before
+ * two_pass_rate_control_get_quantizer and two_pass_rate_control_update
+ * @param {TwoPassRateControl*} rc_ptr.
+ * @param {SequenceControlSet*} sequence_control_set_ptr. Configuration of the second pass
+ * @param {uint8_t*} stats. Statistics checked by first_pass_stats_check
+ * @return {EbErrorType}.
+ */
+EbErrorType two_pass_rate_control_init(TwoPassRateControl *rc_ptr,
+                                       SequenceControlSet *sequence_control_set_ptr,
+                                       const uint8_t *stats);
+
+/*
+ * @function two_pass_rate_control_get_quantizer. Return the QP of the given
+ * picture. The first pass sizes of the pictures left are scaled to the QPs
+ * that make them fit in the bits left, the pictures keep the QP offsets they
+ * had in the first pass.
+ * @param {TwoPassRateControl*} rc_ptr.
+ * @param {PictureParentControlSet*} picture_ptr. Picture to be encoded, in decode order.
+ * @return {uint8_t}. QP of the picture
+ */
+uint8_t two_pass_rate_control_get_quantizer(TwoPassRateControl *rc_ptr,
+                                            PictureParentControlSet *picture_ptr);
+
+/*
+ * @function two_pass_rate_control_update. Correct the allocation with the size
+ * of a coded picture.
+ * @param {TwoPassRateControl*} rc_ptr.
+ * @param {PictureParentControlSet*} picture_ptr. Coded picture.
+ * @return {void}.
+ */
+void two_pass_rate_control_update(TwoPassRateControl *rc_ptr,
+                                  PictureParentControlSet *picture_ptr);
+
+#endif // RateControlTwoPass_h
@@ -258,6 +258,7 @@ typedef struct SBInfo {
     int32_t         *sb_chroma_coeff;
 
     ModeInfo_t      *sb_mode_info;
+    int16_t         *sb_mi_map; /*!< sb_mode_info offset of each 4x4 */
 
     //Add buffer for coeff storage
 
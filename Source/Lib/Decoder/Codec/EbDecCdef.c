@@ -0,0 +1,355 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/*
+* Copyright (c) 2016, Alliance for Open Media. All rights reserved
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at www.aomedia.org/license/software. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+*/
+
+// SUMMARY
+//   Contains the CDEF of the decoder
+
+/**************************************
+ * Includes
+ **************************************/
+
+#include "EbDefinitions.h"
+#include "EbPictureBufferDesc.h"
+
+#include "EbSvtAv1Dec.h"
+#include "EbDecHandle.h"
+
+#include "EbObuParse.h"
+#include "EbDecNbr.h"
+#include "EbDecInverseQuantize.h"
+#include "EbDecCdef.h"
+
+#include "EbCdef.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE void fill_rect(uint16_t *dst, int32_t dstride, int32_t v,
+                             int32_t h, uint16_t x)
+{
+    for (int32_t i = 0; i < v; i++) {
+        for (int32_t j = 0; j < h; j++)
+            dst[i * dstride + j] = x;
+    }
+}
+
+static INLINE void copy_rect(uint16_t *dst, int32_t dstride,
+                             const uint16_t *src, int32_t sstride,
+                             int32_t v, int32_t h)
+{
+    for (int32_t i = 0; i < v; i++) {
+        for (int32_t j = 0; j < h; j++)
+            dst[i * dstride + j] = src[i * sstride + j];
+    }
+}
+
+/* Copies v x h samples at row, col of the recon plane src to 16 bit */
+static void copy_sb_16(uint16_t *dst, int32_t dstride, const uint8_t *src,
+                       int32_t is_16bit, int32_t row, int32_t col,
+                       int32_t sstride, int32_t v, int32_t h)
+{
+    if (is_16bit)
+        copy_rect(dst, dstride, (const uint16_t *)src + row * sstride + col,
+                  sstride, v, h);
+    else
+        copy_rect8_8bit_to_16bit(dst, dstride, src + row * sstride + col,
+                                 sstride, v, h);
+}
+
+static int32_t is_8x8_block_skip(EbDecHandle *dec_handle_ptr,
+                                 int32_t mi_row, int32_t mi_col)
+{
+    int32_t is_skip = 1;
+
+    for (int32_t r = 0; r < mi_size_high[BLOCK_8X8]; ++r)
+        for (int32_t c = 0; c < mi_size_wide[BLOCK_8X8]; ++c)
+            is_skip &= get_frame_mode_info(dec_handle_ptr, mi_row + r,
+                                           mi_col + c, NULL)->skip;
+    return is_skip;
+}
+
+/* List of the 8x8s of the 64x64 at mi_row, mi_col that have coded residue */
+static int32_t compute_cdef_list(EbDecHandle *dec_handle_ptr, int32_t mi_row,
+                                 int32_t mi_col, cdef_list *dlist)
+{
+    FrameHeader *frame_info = &dec_handle_ptr->frame_header;
+    int32_t maxr = AOMMIN((int32_t)frame_info->mi_rows - mi_row, MI_SIZE_64X64);
+    int32_t maxc = AOMMIN((int32_t)frame_info->mi_cols - mi_col, MI_SIZE_64X64);
+    int32_t count = 0;
+
+    for (int32_t r = 0; r < maxr; r += mi_size_high[BLOCK_8X8]) {
+        for (int32_t c = 0; c < maxc; c += mi_size_wide[BLOCK_8X8]) {
+            if (!is_8x8_block_skip(dec_handle_ptr, mi_row + r, mi_col + c)) {
+                dlist[count].by = (uint8_t)(r >> 1);
+                dlist[count].bx = (uint8_t)(c >> 1);
+                dlist[count].skip = 0;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/* cdef_strength index of the 64x64 at fbr, fbc, -1 if not coded */
+static int32_t get_fb_cdef_strength(EbDecHandle *dec_handle_ptr,
+                                    int32_t fbr, int32_t fbc)
+{
+    MasterFrameBuf  *master_frame_buf = &dec_handle_ptr->master_frame_buf;
+    SeqHeader       *seq_header = &dec_handle_ptr->seq_header;
+    int32_t         sb_mi_log2 = seq_header->sb_size_log2 - MI_SIZE_LOG2;
+    int32_t         mi_row = fbr * MI_SIZE_64X64;
+    int32_t         mi_col = fbc * MI_SIZE_64X64;
+    SBInfo          *sb_info = master_frame_buf->cur_frame_bufs[0].sb_info +
+                               (mi_row >> sb_mi_log2) * master_frame_buf->sb_cols +
+                               (mi_col >> sb_mi_log2);
+    int32_t         index = seq_header->sb_size == BLOCK_128X128 ?
+                            (fbc & 1) + 2 * (fbr & 1) : 0;
+
+    return sb_info->sb_cdef_strength[index];
+}
+
+void dec_cdef_frame_init(EbDecHandle *dec_handle_ptr)
+{
+    DecCdefCtxt *cdef_ctxt = (DecCdefCtxt *)dec_handle_ptr->pv_cdef_ctxt;
+    int32_t nhfb = (dec_handle_ptr->frame_header.mi_cols + MI_SIZE_64X64 - 1) /
+                   MI_SIZE_64X64;
+
+    memset(cdef_ctxt->row_cdef, 1, sizeof(*cdef_ctxt->row_cdef) * (nhfb + 2) * 2);
+    cdef_ctxt->prev_row_cdef = cdef_ctxt->row_cdef + 1;
+    cdef_ctxt->curr_row_cdef = cdef_ctxt->prev_row_cdef + nhfb + 2;
+}
+
+void dec_cdef_fb_row(EbDecHandle *dec_handle_ptr, int32_t fbr)
+{
+    DecCdefCtxt         *cdef_ctxt = (DecCdefCtxt *)dec_handle_ptr->pv_cdef_ctxt;
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->recon_picture_buf[0];
+    FrameHeader         *frame_info = &dec_handle_ptr->frame_header;
+    CDEFParams          *cdef_params = &frame_info->CDEF_params;
+    EbColorConfig       *color_config = &dec_handle_ptr->seq_header.color_config;
+    const int32_t       num_planes = av1_num_planes(color_config);
+    const int32_t       is_16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    const int32_t       coeff_shift = AOMMAX(color_config->bit_depth - 8, 0);
+    const int32_t       nvfb = (frame_info->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t       nhfb = (frame_info->mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    const int32_t       stride = cdef_ctxt->linebuf_stride;
+    uint16_t            **linebuf = cdef_ctxt->linebuf;
+    uint16_t            **colbuf = cdef_ctxt->colbuf;
+    uint8_t             *prev_row_cdef = cdef_ctxt->prev_row_cdef;
+    uint8_t             *curr_row_cdef = cdef_ctxt->curr_row_cdef;
+    DECLARE_ALIGNED(16, uint16_t, src[CDEF_INBUF_SIZE]);
+    cdef_list           dlist[MI_SIZE_64X64 * MI_SIZE_64X64];
+    int32_t             dir[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
+    int32_t             var[CDEF_NBLOCKS][CDEF_NBLOCKS] = { { 0 } };
+    uint8_t             *rec_buf[MAX_MB_PLANE];
+    int32_t             rec_stride[MAX_MB_PLANE];
+    int32_t             xdec[MAX_MB_PLANE], ydec[MAX_MB_PLANE];
+    int32_t             mi_wide_l2[MAX_MB_PLANE], mi_high_l2[MAX_MB_PLANE];
+    int32_t             cdef_left = 1;
+    int32_t             cdef_count;
+
+    rec_buf[0] = recon_picture_buf->buffer_y;
+    rec_buf[1] = recon_picture_buf->buffer_cb;
+    rec_buf[2] = recon_picture_buf->buffer_cr;
+    rec_stride[0] = recon_picture_buf->stride_y;
+    rec_stride[1] = recon_picture_buf->stride_cb;
+    rec_stride[2] = recon_picture_buf->stride_cr;
+
+    for (int32_t pli = 0; pli < num_planes; pli++) {
+        int32_t block_height;
+
+        xdec[pli] = pli ? color_config->subsampling_x : 0;
+        ydec[pli] = pli ? color_config->subsampling_y : 0;
+        mi_wide_l2[pli] = MI_SIZE_LOG2 - xdec[pli];
+        mi_high_l2[pli] = MI_SIZE_LOG2 - ydec[pli];
+        rec_buf[pli] += ((recon_picture_buf->origin_y >> ydec[pli]) *
+            rec_stride[pli] + (recon_picture_buf->origin_x >> xdec[pli])) <<
+            is_16bit;
+
+        block_height = (MI_SIZE_64X64 << mi_high_l2[pli]) + 2 * CDEF_VBORDER;
+        fill_rect(colbuf[pli], CDEF_HBORDER, block_height, CDEF_HBORDER,
+            CDEF_VERY_LARGE);
+    }
+
+    for (int32_t fbc = 0; fbc < nhfb; fbc++) {
+        int32_t level, sec_strength;
+        int32_t uv_level, uv_sec_strength;
+        int32_t nhb, nvb;
+        int32_t cstart = 0;
+        int32_t frame_top, frame_left, frame_bottom, frame_right;
+        int32_t mi_row = MI_SIZE_64X64 * fbr;
+        int32_t mi_col = MI_SIZE_64X64 * fbc;
+        int32_t strength_idx = get_fb_cdef_strength(dec_handle_ptr, fbr, fbc);
+
+        curr_row_cdef[fbc] = 0;
+        if (strength_idx == -1) {
+            cdef_left = 0;
+            continue;
+        }
+        /* If the left block has not been filtered, its samples are still
+           in the recon */
+        if (!cdef_left)
+            cstart = -CDEF_HBORDER;
+
+        nhb = AOMMIN(MI_SIZE_64X64, (int32_t)frame_info->mi_cols - mi_col);
+        nvb = AOMMIN(MI_SIZE_64X64, (int32_t)frame_info->mi_rows - mi_row);
+
+        frame_top = (mi_row == 0) ? 1 : 0;
+        frame_left = (mi_col == 0) ? 1 : 0;
+        if (fbr != nvfb - 1)
+            frame_bottom = (mi_row + MI_SIZE_64X64 == (int32_t)frame_info->mi_rows);
+        else
+            frame_bottom = 1;
+        if (fbc != nhfb - 1)
+            frame_right = (mi_col + MI_SIZE_64X64 == (int32_t)frame_info->mi_cols);
+        else
+            frame_right = 1;
+
+        level = cdef_params->cdef_y_strength[strength_idx] / CDEF_SEC_STRENGTHS;
+        sec_strength = cdef_params->cdef_y_strength[strength_idx] % CDEF_SEC_STRENGTHS;
+        sec_strength += sec_strength == 3;
+        uv_level = cdef_params->cdef_uv_strength[strength_idx] / CDEF_SEC_STRENGTHS;
+        uv_sec_strength = cdef_params->cdef_uv_strength[strength_idx] % CDEF_SEC_STRENGTHS;
+        uv_sec_strength += uv_sec_strength == 3;
+        if ((level == 0 && sec_strength == 0 && uv_level == 0 &&
+             uv_sec_strength == 0) ||
+            (cdef_count = compute_cdef_list(dec_handle_ptr, mi_row, mi_col,
+                                            dlist)) == 0)
+        {
+            cdef_left = 0;
+            continue;
+        }
+
+        curr_row_cdef[fbc] = 1;
+        for (int32_t pli = 0; pli < num_planes; pli++) {
+            int32_t coffset;
+            int32_t rend, cend;
+            int32_t damping = cdef_params->cdef_damping;
+            int32_t hsize = nhb << mi_wide_l2[pli];
+            int32_t vsize = nvb << mi_high_l2[pli];
+            int32_t fb_row = (MI_SIZE_64X64 << mi_high_l2[pli]) * fbr;
+            uint8_t *rec = rec_buf[pli];
+            int32_t rstride = rec_stride[pli];
+
+            if (pli) {
+                level = uv_level;
+                sec_strength = uv_sec_strength;
+            }
+
+            cend = (fbc == nhfb - 1) ? hsize : hsize + CDEF_HBORDER;
+            rend = (fbr == nvfb - 1) ? vsize : vsize + CDEF_VBORDER;
+
+            coffset = fbc * MI_SIZE_64X64 << mi_wide_l2[pli];
+            if (fbc == nhfb - 1) {
+                /* On the last fb column, fill in the right border with
+                   CDEF_VERY_LARGE to avoid filtering with the outside */
+                fill_rect(&src[cend + CDEF_HBORDER], CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, hsize + CDEF_HBORDER - cend,
+                    CDEF_VERY_LARGE);
+            }
+            if (fbr == nvfb - 1) {
+                /* On the last fb row, fill in the bottom border with
+                   CDEF_VERY_LARGE to avoid filtering with the outside */
+                fill_rect(&src[(rend + CDEF_VBORDER) * CDEF_BSTRIDE],
+                    CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            }
+
+            /* Pixels of the current fb */
+            copy_sb_16(&src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER + cstart],
+                CDEF_BSTRIDE, rec, is_16bit, fb_row, coffset + cstart, rstride,
+                rend, cend - cstart);
+
+            /* Lines above, from the recon if that fb was not filtered */
+            if (!prev_row_cdef[fbc])
+                copy_sb_16(&src[CDEF_HBORDER], CDEF_BSTRIDE, rec, is_16bit,
+                    fb_row - CDEF_VBORDER, coffset, rstride, CDEF_VBORDER, hsize);
+            else if (fbr > 0)
+                copy_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE,
+                    &linebuf[pli][coffset], stride, CDEF_VBORDER, hsize);
+            else
+                fill_rect(&src[CDEF_HBORDER], CDEF_BSTRIDE, CDEF_VBORDER, hsize,
+                    CDEF_VERY_LARGE);
+
+            if (!prev_row_cdef[fbc - 1])
+                copy_sb_16(src, CDEF_BSTRIDE, rec, is_16bit,
+                    fb_row - CDEF_VBORDER, coffset - CDEF_HBORDER, rstride,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            else if (fbr > 0 && fbc > 0)
+                copy_rect(src, CDEF_BSTRIDE,
+                    &linebuf[pli][coffset - CDEF_HBORDER], stride,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            else
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER, CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+
+            if (!prev_row_cdef[fbc + 1])
+                copy_sb_16(&src[CDEF_HBORDER + hsize], CDEF_BSTRIDE, rec,
+                    is_16bit, fb_row - CDEF_VBORDER, coffset + hsize, rstride,
+                    CDEF_VBORDER, CDEF_HBORDER);
+            else if (fbr > 0 && fbc < nhfb - 1)
+                copy_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    &linebuf[pli][coffset + hsize], stride, CDEF_VBORDER,
+                    CDEF_HBORDER);
+            else
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
+
+            /* Columns on the left, saved before that fb was filtered */
+            if (cdef_left)
+                copy_rect(src, CDEF_BSTRIDE, colbuf[pli], CDEF_HBORDER,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+
+            /* Save the columns and lines the fbs on the right and below
+               need before filtering in place */
+            if (fbc < nhfb - 1)
+                copy_rect(colbuf[pli], CDEF_HBORDER, src + hsize, CDEF_BSTRIDE,
+                    rend + CDEF_VBORDER, CDEF_HBORDER);
+            if (fbr < nvfb - 1)
+                copy_sb_16(&linebuf[pli][coffset], stride, rec, is_16bit,
+                    (MI_SIZE_64X64 << mi_high_l2[pli]) * (fbr + 1) - CDEF_VBORDER,
+                    coffset, rstride, CDEF_VBORDER, hsize);
+
+            if (frame_top)
+                fill_rect(src, CDEF_BSTRIDE, CDEF_VBORDER,
+                    hsize + 2 * CDEF_HBORDER, CDEF_VERY_LARGE);
+            if (frame_left)
+                fill_rect(src, CDEF_BSTRIDE, vsize + 2 * CDEF_VBORDER,
+                    CDEF_HBORDER, CDEF_VERY_LARGE);
+            if (frame_bottom)
+                fill_rect(&src[(vsize + CDEF_VBORDER) * CDEF_BSTRIDE],
+                    CDEF_BSTRIDE, CDEF_VBORDER, hsize + 2 * CDEF_HBORDER,
+                    CDEF_VERY_LARGE);
+            if (frame_right)
+                fill_rect(&src[hsize + CDEF_HBORDER], CDEF_BSTRIDE,
+                    vsize + 2 * CDEF_VBORDER, CDEF_HBORDER, CDEF_VERY_LARGE);
+
+            if (is_16bit)
+                cdef_filter_fb(NULL, (uint16_t *)rec + fb_row * rstride + coffset,
+                    rstride, &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER],
+                    xdec[pli], ydec[pli], dir, NULL, var, pli, dlist,
+                    cdef_count, level, sec_strength, damping, damping,
+                    coeff_shift);
+            else
+                cdef_filter_fb(rec + fb_row * rstride + coffset, NULL,
+                    rstride, &src[CDEF_VBORDER * CDEF_BSTRIDE + CDEF_HBORDER],
+                    xdec[pli], ydec[pli], dir, NULL, var, pli, dlist,
+                    cdef_count, level, sec_strength, damping, damping,
+                    coeff_shift);
+        }
+        cdef_left = 1;
+    }
+
+    cdef_ctxt->prev_row_cdef = curr_row_cdef;
+    cdef_ctxt->curr_row_cdef = prev_row_cdef;
+}
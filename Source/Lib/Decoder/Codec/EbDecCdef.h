@@ -0,0 +1,37 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecCdef_h
+#define EbDecCdef_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* State carried from one 64x64 filter block row to the next : the pre CDEF
+   bottom lines of the row above and the right columns of the block on the
+   left, as CDEF is done in place */
+typedef struct DecCdefCtxt {
+    uint16_t    *linebuf[MAX_MB_PLANE];
+    uint16_t    *colbuf[MAX_MB_PLANE];
+    int32_t     linebuf_stride;
+
+    /* Filtered flags of the fbs of the previous and current fb row,
+       with a guard entry on either side */
+    uint8_t     *row_cdef;
+    uint8_t     *prev_row_cdef;
+    uint8_t     *curr_row_cdef;
+} DecCdefCtxt;
+
+void dec_cdef_frame_init(EbDecHandle *dec_handle_ptr);
+
+/* Applies CDEF to 64x64 filter block row fbr. The rows are filtered in
+   order, once the deblocking has gone past the top lines of row fbr + 1. */
+void dec_cdef_fb_row(EbDecHandle *dec_handle_ptr, int32_t fbr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbDecCdef_h
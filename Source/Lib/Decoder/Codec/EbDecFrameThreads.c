@@ -0,0 +1,154 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// SUMMARY
+//   Contains the frame parallel decoding functions
+
+/**************************************
+ * Includes
+ **************************************/
+#include <stdlib.h>
+
+#include "EbDefinitions.h"
+#include "EbPictureBufferDesc.h"
+
+#include "EbSvtAv1Dec.h"
+#include "EbDecHandle.h"
+#include "EbThreads.h"
+
+#include "EbObuParse.h"
+#include "EbDecMemInit.h"
+#include "EbDecFrameThreads.h"
+
+int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer);
+
+void *dec_frame_thread_kernel(void *input_ptr)
+{
+    DecFrameSlot *frame_slot = (DecFrameSlot *)input_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(frame_slot->start_semaphore);
+
+        frame_slot->status = decode_multiple_obu(frame_slot->frm_dec_ptr,
+            frame_slot->data, frame_slot->data_size);
+
+        eb_post_semaphore(frame_slot->done_semaphore);
+    }
+    return EB_NULL;
+}
+
+/* Waits for the frame of the slot, keeping its first error */
+static void wait_frame_slot(EbDecHandle *dec_handle_ptr,
+                            DecFrameSlot *frame_slot)
+{
+    if (frame_slot->done)
+        return;
+    eb_block_on_semaphore(frame_slot->done_semaphore);
+    frame_slot->done = 1;
+    if (frame_slot->status != EB_ErrorNone &&
+        dec_handle_ptr->frm_status == EB_ErrorNone)
+        dec_handle_ptr->frm_status = frame_slot->status;
+}
+
+static DecFrameSlot *get_frame_slot(EbDecHandle *dec_handle_ptr, uint32_t i)
+{
+    DecFrameSlot *frame_slots = (DecFrameSlot *)dec_handle_ptr->pv_frame_slots;
+    return &frame_slots[(dec_handle_ptr->frm_slot_head + i) %
+                        dec_handle_ptr->num_frms_prll];
+}
+
+EbErrorType dec_frame_prll_decode(EbDecHandle *dec_handle_ptr,
+    const uint8_t *data, size_t data_size)
+{
+    EbErrorType status;
+    DecFrameSlot *frame_slot;
+    EbDecHandle *frm_dec_ptr;
+    int intra_only;
+
+    dec_handle_ptr->frm_flush = (0 == data_size);
+    if (dec_handle_ptr->frm_flush)
+        return EB_ErrorNone;
+
+    /* All the slots in flight : the picture of the oldest one was not
+       taken. It is only freed by dec_frame_prll_get_picture on this same
+       thread, so the temporal unit is refused untouched rather than
+       waited for. */
+    if (dec_handle_ptr->frm_slots_busy == (uint32_t)dec_handle_ptr->num_frms_prll)
+        return EB_ErrorInsufficientResources;
+
+    /* Sequence headers are read here, the frame decoders get them with
+       each frame */
+    status = scan_temporal_unit(dec_handle_ptr, data, data_size, &intra_only);
+    if (status != EB_ErrorNone)
+        return status;
+
+    /* Other frames may refer to any frame before them */
+    if (!intra_only) {
+        for (uint32_t i = 0; i < dec_handle_ptr->frm_slots_busy; i++)
+            wait_frame_slot(dec_handle_ptr, get_frame_slot(dec_handle_ptr, i));
+    }
+
+    frame_slot = get_frame_slot(dec_handle_ptr, dec_handle_ptr->frm_slots_busy);
+    frm_dec_ptr = frame_slot->frm_dec_ptr;
+
+    /* The copies go to the memory map, freed at deinit. The size at least
+       doubles, so the outgrown ones add up to less than the last one. */
+    if (frame_slot->data_alloc < data_size) {
+        size_t data_alloc = AOMMAX(data_size, 2 * frame_slot->data_alloc);
+        frame_slot->data_alloc = 0;
+        EB_MALLOC_DEC(uint8_t *, frame_slot->data, data_alloc, EB_N_PTR);
+        frame_slot->data_alloc = data_alloc;
+    }
+    memcpy(frame_slot->data, data, data_size);
+    frame_slot->data_size = data_size;
+
+    frm_dec_ptr->seq_header = dec_handle_ptr->seq_header;
+    frm_dec_ptr->seq_header_done = dec_handle_ptr->seq_header_done;
+    /* Memory init on this thread, the memory map is not thread safe */
+    if (0 == frm_dec_ptr->mem_init_done && 1 == frm_dec_ptr->seq_header_done) {
+        status = dec_mem_init(frm_dec_ptr);
+        if (status != EB_ErrorNone)
+            return status;
+    }
+
+    frame_slot->done = 0;
+    dec_handle_ptr->frm_slots_busy++;
+    eb_post_semaphore(frame_slot->start_semaphore);
+
+    return EB_ErrorNone;
+}
+
+int dec_frame_prll_get_picture(EbDecHandle *dec_handle_ptr,
+    EbBufferHeaderType *p_buffer)
+{
+    DecFrameSlot *frame_slot;
+
+    if (0 == dec_handle_ptr->frm_slots_busy)
+        return 0;
+    if (!dec_handle_ptr->frm_flush && dec_handle_ptr->frm_slots_busy <
+        (uint32_t)dec_handle_ptr->num_frms_prll)
+        return 0;
+
+    frame_slot = get_frame_slot(dec_handle_ptr, 0);
+    wait_frame_slot(dec_handle_ptr, frame_slot);
+
+    dec_handle_ptr->frm_slot_head = (dec_handle_ptr->frm_slot_head + 1) %
+                                    dec_handle_ptr->num_frms_prll;
+    dec_handle_ptr->frm_slots_busy--;
+
+    return svt_dec_out_buf(frame_slot->frm_dec_ptr, p_buffer);
+}
+
+void dec_frame_prll_deinit(EbDecHandle *dec_handle_ptr)
+{
+    DecFrameSlot *frame_slots = (DecFrameSlot *)dec_handle_ptr->pv_frame_slots;
+
+    if (frame_slots == NULL)
+        return;
+
+    for (uint32_t i = 0; i < dec_handle_ptr->frm_slots_busy; i++)
+        wait_frame_slot(dec_handle_ptr, get_frame_slot(dec_handle_ptr, i));
+    dec_handle_ptr->frm_slots_busy = 0;
+}
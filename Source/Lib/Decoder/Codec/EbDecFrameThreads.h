@@ -0,0 +1,56 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecFrameThreads_h
+#define EbDecFrameThreads_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One frame in flight of frame parallel decoding */
+typedef struct DecFrameSlot {
+    /* Frame decoder, with its own frame buffers and tile decode threads */
+    EbDecHandle *frm_dec_ptr;
+
+    /* Copy of the temporal unit, the caller's buffer is reused after the
+       decode call */
+    uint8_t     *data;
+    size_t      data_size;
+    size_t      data_alloc;
+
+    EbErrorType status;
+    /* done_semaphore already taken for the frame in flight */
+    uint8_t     done;
+
+    EbHandle    frame_thread_handle;
+    /* Posted once per frame, to start it and when it is decoded */
+    EbHandle    start_semaphore;
+    EbHandle    done_semaphore;
+} DecFrameSlot;
+
+void *dec_frame_thread_kernel(void *input_ptr);
+
+/* Queues the temporal unit on the next slot. Intra frames start right away,
+   the others once all the frames in flight are decoded. A data_size of 0
+   flushes, the frames in flight are then output one per get picture call.
+   Returns EB_ErrorInsufficientResources, without reading the temporal unit,
+   when all the slots hold a picture not taken yet. */
+EbErrorType dec_frame_prll_decode(EbDecHandle *dec_handle_ptr,
+    const uint8_t *data, size_t data_size);
+
+/* Outputs the oldest frame in flight, once num_frms_prll are in flight or
+   on flush. Returns 0 when there is none to output. */
+int dec_frame_prll_get_picture(EbDecHandle *dec_handle_ptr,
+    EbBufferHeaderType *p_buffer);
+
+/* Waits for the frames in flight, their temporal unit copies are freed with
+   the memory map */
+void dec_frame_prll_deinit(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+    }
+#endif
+#endif // EbDecFrameThreads_h
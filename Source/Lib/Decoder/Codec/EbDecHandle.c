@@ -17,9 +17,11 @@
 #include "EbSvtAv1Dec.h"
 #include "EbDecHandle.h"
 #include "EbDecMemInit.h"
+#include "EbDecFrameThreads.h"
 
 #if defined(__linux__) || defined(__APPLE__)
 #include <pthread.h>
+#include <unistd.h>
 #include <errno.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -38,20 +40,22 @@ uint64_t                         *svt_dec_total_lib_memory;
 
 uint32_t                         svt_dec_lib_malloc_count = 0;
 
-//TODO: Should be removed! Check
-EbMemoryMapEntry                 *memory_map;
-uint32_t                         *memory_map_index;
-uint64_t                         *total_lib_memory;
-
-uint32_t                         lib_malloc_count = 0;
-uint32_t                         lib_semaphore_count = 0;
-uint32_t                         lib_mutex_count = 0;
-
 void init_intra_dc_predictors_c_internal(void);
 void init_intra_predictors_internal(void);
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr,
             const uint8_t *data, size_t data_size);
 
+//Get Number of logical processors
+static uint32_t dec_get_num_processors() {
+#ifdef _WIN32
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return sysinfo.dwNumberOfProcessors;
+#else
+    return sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
 void SwitchToRealTime(){
 #if defined(__linux__) || defined(__APPLE__)
 
@@ -222,6 +226,7 @@ EbErrorType eb_svt_dec_set_default_parameter(
     config_ptr->max_color_format = EB_YUV420;
     config_ptr->asm_type = 0;
     config_ptr->threads = 1;
+    config_ptr->max_frame_delay = 1;
 
     // Application Specific parameters
     config_ptr->channel_id = 0;
@@ -338,14 +343,26 @@ EB_API EbErrorType eb_init_decoder(
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
 
     dec_handle_ptr->dec_cnt = -1;
-    dec_handle_ptr->num_frms_prll   = 1;
-    if(dec_handle_ptr->num_frms_prll > DEC_MAX_NUM_FRM_PRLL)
-        dec_handle_ptr->num_frms_prll = DEC_MAX_NUM_FRM_PRLL;
+    /* Frames in flight, each in a frame decoder of its own */
+    dec_handle_ptr->num_frms_prll   = dec_handle_ptr->dec_config.max_frame_delay;
+    if (dec_handle_ptr->num_frms_prll < 1)
+        dec_handle_ptr->num_frms_prll = 1;
+    if(dec_handle_ptr->num_frms_prll > DEC_MAX_FRM_DELAY)
+        dec_handle_ptr->num_frms_prll = DEC_MAX_FRM_DELAY;
     dec_handle_ptr->seq_header_done = 0;
     dec_handle_ptr->mem_init_done   = 0;
 
     dec_handle_ptr->seen_frame_header = 0;
     dec_handle_ptr->show_existing_frame = 0;
+    dec_handle_ptr->output_pending = 0;
+    dec_handle_ptr->pv_frame_slots = NULL;
+
+    /* Tile decode threads, 0 : one per logical processor */
+    dec_handle_ptr->num_threads = dec_handle_ptr->dec_config.threads;
+    if (0 == dec_handle_ptr->num_threads)
+        dec_handle_ptr->num_threads = dec_get_num_processors();
+    if (0 == dec_handle_ptr->num_threads)
+        dec_handle_ptr->num_threads = 1;
 
     assert(0 == dec_handle_ptr->dec_config.asm_type);
     setup_rtcd_internal(dec_handle_ptr->dec_config.asm_type);
@@ -357,7 +374,10 @@ EB_API EbErrorType eb_init_decoder(
     /************************************
     * Decoder Memory Init
     ************************************/
-    return_error = dec_mem_init(dec_handle_ptr);
+    if (dec_handle_ptr->num_frms_prll > 1)
+        return_error = dec_frame_threads_init(dec_handle_ptr);
+    else
+        return_error = dec_mem_init(dec_handle_ptr);
     if (return_error != EB_ErrorNone)
         return return_error;
 
@@ -378,8 +398,23 @@ EB_API EbErrorType eb_svt_decode_frame(
 
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
     /*TODO : Remove or move. For Test purpose only */
-    dec_handle_ptr->dec_cnt++;
-    printf("\n SVT-AV1 Dec : Decoding Pic #%d", dec_handle_ptr->dec_cnt);
+    if (data_size) {
+        dec_handle_ptr->dec_cnt++;
+        printf("\n SVT-AV1 Dec : Decoding Pic #%d", dec_handle_ptr->dec_cnt);
+    }
+
+    if (dec_handle_ptr->num_frms_prll > 1) {
+        return_error = dec_frame_prll_decode(dec_handle_ptr, data, data_size);
+        if (return_error == EB_ErrorNone)
+            return_error = dec_handle_ptr->frm_status;
+        dec_handle_ptr->frm_status = EB_ErrorNone;
+        return return_error;
+    }
+
+    /* Nothing buffered to flush */
+    dec_handle_ptr->output_pending = (0 != data_size);
+    if (0 == data_size)
+        return return_error;
 
     return_error = decode_multiple_obu(dec_handle_ptr, data, data_size);
 
@@ -403,9 +438,17 @@ EB_API EbErrorType eb_svt_dec_get_picture(
         return EB_ErrorBadParameter;
 
     EbDecHandle     *dec_handle_ptr = (EbDecHandle   *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->num_frms_prll > 1) {
+        if (0 == dec_frame_prll_get_picture(dec_handle_ptr, p_buffer))
+            return_error = EB_DecNoOutputPicture;
+        return return_error;
+    }
+
     /* Copy from recon pointer and return! TODO: Should remove the memcpy! */
-    if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
+    if (0 == dec_handle_ptr->output_pending ||
+        0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
         return_error = EB_DecNoOutputPicture;
+    dec_handle_ptr->output_pending = 0;
     return return_error;
 }
 
@@ -421,6 +464,8 @@ EB_API EbErrorType eb_deinit_decoder(
     EbErrorType return_error    = EB_ErrorNone;
 
     if (dec_handle_ptr) {
+        /* No frame decoder may run while its buffers are freed */
+        dec_frame_prll_deinit(dec_handle_ptr);
         if (svt_dec_memory_map) {
             // Loop through the ptr table and free all malloc'd pointers per channel
             EbMemoryMapEntry*    memory_entry = svt_dec_memory_map;
@@ -446,6 +491,9 @@ EB_API EbErrorType eb_deinit_decoder(
                         case EB_MUTEX:
                             eb_destroy_mutex(memory_entry->ptr);
                             break;
+                        case EB_COND_VAR:
+                            eb_destroy_cond_var(memory_entry->ptr);
+                            break;
                         default:
                             return_error = EB_ErrorMax;
                             break;
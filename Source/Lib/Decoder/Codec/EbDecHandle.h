@@ -15,6 +15,9 @@ extern "C" {
 
 /* Maximum number of frames in parallel */
 #define DEC_MAX_NUM_FRM_PRLL    1
+/* Maximum number of frames in flight in frame parallel decoding, each one
+   in its own frame decoder */
+#define DEC_MAX_FRM_DELAY       16
 /* Number of ref frame buffers needed */
 #define DEC_MAX_REF_FRM_BUF   (REF_FRAMES + DEC_MAX_NUM_FRM_PRLL)
 
@@ -23,6 +26,8 @@ typedef struct CurFrameBuf {
     SBInfo          *sb_info;
 
     ModeInfo_t      *mode_info;
+    /* Offset in sb_mode_info of each 4x4, num_mis_in_sb per SB */
+    int16_t         *mi_map;
 
     int32_t         *luma_coeff;
     int32_t         *chroma_coeff;
@@ -63,9 +68,6 @@ typedef struct MasterFrameBuf {
 
     int32_t         sb_cols;
     int32_t         sb_rows;
-
-    /* TODO : Should be moved to thread ctxt */
-    FrameMiMap      frame_mi_map;
 } MasterFrameBuf;
 
 /**************************************
@@ -92,10 +94,62 @@ typedef struct EbDecHandle {
 
     uint8_t seen_frame_header;
     uint8_t show_existing_frame;
+    /* Set by a decode call, cleared once its picture is output */
+    uint8_t output_pending;
+
+    /* Frame parallel decoding, when num_frms_prll > 1 : each temporal unit
+       is decoded on the frame thread of a slot by the frame decoder of the
+       slot, an EbDecHandle of its own. The frm_slots_busy slots from
+       frm_slot_head are in flight, in decode order. */
+    void       *pv_frame_slots;
+    uint32_t    frm_slot_head;
+    uint32_t    frm_slots_busy;
+    /* End of stream signalled, the frames in flight are output */
+    uint8_t     frm_flush;
+    /* First error of the frames done since the last decode call */
+    EbErrorType frm_status;
 
     // Thread Handles
-
-    // Module Contexts
+    /* Number of tile decode threads, including the calling thread */
+    uint32_t    num_threads;
+    /* num_threads - 1 tile threads, the calling thread is the last one */
+    EbHandle   *tile_thread_handles;
+    void       *pv_tile_thread_ctxt;
+    /* Posted once per thread at the start and end of each tile group */
+    EbHandle    tile_start_semaphore;
+    EbHandle    tile_done_semaphore;
+
+    /* Tiles of the current tile group, handed out through next_tile_job */
+    void               *pv_tile_jobs;
+    uint32_t            num_tile_jobs;
+    volatile uint32_t   next_tile_job;
+
+    /* Row wavefront of one tile, when there are fewer tiles than threads :
+       the calling thread parses the tile while all threads decode its SB
+       rows, handed out through next_sb_row. Counts of SBs parsed / decoded
+       in each SB row, as sb_col + 1 of the last one. */
+    TileInfo           *wf_tile_info;
+    volatile uint32_t  *sb_row_parsed;
+    volatile uint32_t  *sb_row_decoded;
+    volatile uint32_t   next_sb_row;
+    volatile uint32_t   wf_abort;
+    /* Signaled after each update of the progress counts or wf_abort */
+    EbHandle            wf_cond_var;
+
+    /* Post filters, run in SB rows behind the reconstruction of the frame :
+       count of SBs reconstructed in each SB row over all the tiles, next
+       SB row to deblock and next 64x64 row to CDEF. Only the thread
+       holding pf_busy runs them, the others go on reconstructing. */
+    volatile uint32_t  *sb_row_recon;
+    uint32_t            lf_sb_row;
+    uint32_t            cdef_fb_row;
+    volatile uint32_t   pf_busy;
+    /* Deblocking limits and levels of the frame */
+    LoopFilterInfoN     lf_info;
+    /* CDEF line and column buffers, carried from one 64x64 row to the next */
+    void               *pv_cdef_ctxt;
+
+    // Module Contexts : one per tile decode thread
     void   *pv_parse_ctxt;
 
     void   *pv_dec_mod_ctxt;
@@ -109,7 +109,9 @@ void av1_init_sb(FrameHeader *frame)
 
 // Called in parse_decode_block()
 // Update de-quantization parameter based on delta qp param
-void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info)
+// sb_dequants is owned by the calling thread, the frame dequants are shared
+void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info,
+    Dequants **dequants, Dequants *sb_dequants)
 {
     int32_t current_qindex;
     int dc_delta_q, ac_delta_q;
@@ -117,8 +119,9 @@ void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info)
     FrameHeader *frame = &dec_handle->frame_header;
 
     if (!frame->delta_q_params.delta_q_present)
-        frame->dequants_delta_q = &frame->dequants;
+        *dequants = &frame->dequants;
     else {
+        *dequants = sb_dequants;
         for (int i = 0; i < MAX_SEGMENTS; i++) {
             current_qindex =
                 get_qindex(&frame->segmentation_params, i,
@@ -128,25 +131,25 @@ void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info)
             // Y Plane: AC and DC
             dc_delta_q = frame->quantization_params.delta_q_y_dc;
             ac_delta_q = 0;
-            frame->dequants_delta_q->y_dequant_QTX[i][0] = get_dc_quant(
+            sb_dequants->y_dequant_QTX[i][0] = get_dc_quant(
                 current_qindex, dc_delta_q, seq_header->color_config.bit_depth);
-            frame->dequants_delta_q->y_dequant_QTX[i][1] = get_ac_quant(
+            sb_dequants->y_dequant_QTX[i][1] = get_ac_quant(
                 current_qindex, ac_delta_q, seq_header->color_config.bit_depth);
 
             // U Plane: AC and DC
             dc_delta_q = frame->quantization_params.delta_q_u_dc;
             ac_delta_q = frame->quantization_params.delta_q_u_ac;
-            frame->dequants_delta_q->u_dequant_QTX[i][0] = get_dc_quant(
+            sb_dequants->u_dequant_QTX[i][0] = get_dc_quant(
                 current_qindex, dc_delta_q, seq_header->color_config.bit_depth);
-            frame->dequants_delta_q->u_dequant_QTX[i][1] = get_ac_quant(
+            sb_dequants->u_dequant_QTX[i][1] = get_ac_quant(
                 current_qindex, ac_delta_q, seq_header->color_config.bit_depth);
 
             // V Plane: AC and DC
             dc_delta_q = frame->quantization_params.delta_q_v_dc;
             ac_delta_q = frame->quantization_params.delta_q_v_ac;
-            frame->dequants_delta_q->v_dequant_QTX[i][0] = get_dc_quant(
+            sb_dequants->v_dequant_QTX[i][0] = get_dc_quant(
                 current_qindex, dc_delta_q, seq_header->color_config.bit_depth);
-            frame->dequants_delta_q->v_dequant_QTX[i][1] = get_ac_quant(
+            sb_dequants->v_dequant_QTX[i][1] = get_ac_quant(
                 current_qindex, ac_delta_q, seq_header->color_config.bit_depth);
         }
     }
@@ -160,7 +163,8 @@ int get_dqv(const int16_t *dequant, int coeff_idx, const QmVal *iqmatrix) {
     return dqv;
 }
 
-int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, ModeInfo_t *mode,
+int32_t inverse_quantize(EbDecHandle * dec_handle, Dequants *dequants,
+    PartitionInfo_t *part, ModeInfo_t *mode,
     int32_t *level, int32_t *qcoeffs, TxType tx_type, TxSize tx_size, int plane)
 {
     (void)part;
@@ -183,7 +187,7 @@ int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, ModeIn
         iqmatrix = IS_2D_TRANSFORM(tx_type)
             ? frame->giqmatrix[qmlevel][AOM_PLANE_Y][qm_tx_size]
             : frame->giqmatrix[NUM_QM_LEVELS - 1][0][qm_tx_size];
-        dequant = frame->dequants_delta_q->y_dequant_QTX[mode->segment_id];
+        dequant = dequants->y_dequant_QTX[mode->segment_id];
     }
     else if (plane == 1) {
         qmlevel = (lossless || using_qm == 0) ? NUM_QM_LEVELS - 1 :
@@ -191,7 +195,7 @@ int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, ModeIn
         iqmatrix = IS_2D_TRANSFORM(tx_type)
             ? frame->giqmatrix[qmlevel][AOM_PLANE_U][qm_tx_size]
             : frame->giqmatrix[NUM_QM_LEVELS - 1][0][qm_tx_size];
-        dequant = frame->dequants_delta_q->u_dequant_QTX[mode->segment_id];
+        dequant = dequants->u_dequant_QTX[mode->segment_id];
     }
     else {
         qmlevel = (lossless || using_qm == 0) ? NUM_QM_LEVELS - 1 :
@@ -199,7 +203,7 @@ int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, ModeIn
         iqmatrix = IS_2D_TRANSFORM(tx_type)
             ? frame->giqmatrix[qmlevel][AOM_PLANE_V][qm_tx_size]
             : frame->giqmatrix[NUM_QM_LEVELS - 1][0][qm_tx_size];
-        dequant = frame->dequants_delta_q->v_dequant_QTX[mode->segment_id];
+        dequant = dequants->v_dequant_QTX[mode->segment_id];
     }
 
     const int shift = av1_get_tx_scale(tx_size);
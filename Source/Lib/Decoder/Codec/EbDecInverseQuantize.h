@@ -17,9 +17,11 @@ int16_t get_ac_quant(int32_t qindex, int32_t delta, AomBitDepth bit_depth);
 void setup_segmentation_dequant(FrameHeader *frame_info, SeqHeader *seq_header,
     EbColorConfig *color_config);
 void av1_inverse_qm_init(FrameHeader *iquant_matrix, EbColorConfig *color_config);
-void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info);
+void update_dequant(EbDecHandle *dec_handle, SBInfo *sb_info,
+    Dequants **dequants, Dequants *sb_dequants);
 int get_dqv(const int16_t *dequant, int coeff_idx, const QmVal *iqmatrix);
-int32_t inverse_quantize(EbDecHandle * dec_handle, PartitionInfo_t *part, ModeInfo_t *mode,
+int32_t inverse_quantize(EbDecHandle * dec_handle, Dequants *dequants,
+    PartitionInfo_t *part, ModeInfo_t *mode,
     int32_t *level, int32_t *qcoeffs, TxType tx_type, TxSize tx_size, int plane);
 
 #endif // EbDecInverseQuantize_h
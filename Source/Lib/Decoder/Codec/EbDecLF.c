@@ -0,0 +1,407 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/*
+* Copyright (c) 2016, Alliance for Open Media. All rights reserved
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at www.aomedia.org/license/software. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+*/
+
+// SUMMARY
+//   Contains the deblocking filter of the decoder
+
+/**************************************
+ * Includes
+ **************************************/
+
+#include "EbDefinitions.h"
+#include "EbPictureBufferDesc.h"
+#include "EbUtility.h"
+
+#include "EbSvtAv1Dec.h"
+#include "EbDecHandle.h"
+
+#include "EbObuParse.h"
+#include "EbDecParseHelper.h"
+#include "EbDecNbr.h"
+#include "EbDecInverseQuantize.h"
+#include "EbDecLF.h"
+
+#include "EbDeblockingFilter.h"
+
+typedef enum LfEdgeDir {
+    LF_VERT_EDGE = 0,
+    LF_HORZ_EDGE = 1
+} LfEdgeDir;
+
+/* Filter of one 4 sample edge segment, filter_length 0 is no filter */
+typedef struct DecLfParams {
+    int32_t         filter_length;
+    const uint8_t   *lim;
+    const uint8_t   *mblim;
+    const uint8_t   *hev_thr;
+} DecLfParams;
+
+static const int32_t mode_lf_lut[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // INTRA_MODES
+    1, 1, 0, 1,                             // INTER_MODES (GLOBALMV == 0)
+    1, 1, 1, 1, 1, 1, 0, 1  // INTER_COMPOUND_MODES (GLOBAL_GLOBALMV == 0)
+};
+
+static const SEG_LVL_FEATURES seg_lvl_lf_lut[MAX_MB_PLANE][2] = {
+    { SEG_LVL_ALT_LF_Y_V, SEG_LVL_ALT_LF_Y_H },
+    { SEG_LVL_ALT_LF_U, SEG_LVL_ALT_LF_U },
+    { SEG_LVL_ALT_LF_V, SEG_LVL_ALT_LF_V }
+};
+
+static const int32_t delta_lf_id_lut[MAX_MB_PLANE][2] = {
+    { 0, 1 }, { 2, 2 }, { 3, 3 }
+};
+
+/* Frame level filter level of plane in direction dir */
+static INLINE int32_t get_base_level(LoopFilterParams *lf_params,
+                                     int32_t plane, int32_t dir)
+{
+    return lf_params->loop_filter_level[plane == 0 ? dir : plane + 1];
+}
+
+static void update_sharpness(LoopFilterInfoN *lfi, int32_t sharpness_lvl)
+{
+    for (int32_t lvl = 0; lvl <= MAX_LOOP_FILTER; lvl++) {
+        int32_t block_inside_limit = lvl >>
+            ((sharpness_lvl > 0) + (sharpness_lvl > 4));
+
+        if (sharpness_lvl > 0 && block_inside_limit > (9 - sharpness_lvl))
+            block_inside_limit = 9 - sharpness_lvl;
+        if (block_inside_limit < 1)
+            block_inside_limit = 1;
+
+        memset(lfi->lfthr[lvl].lim, block_inside_limit, SIMD_WIDTH);
+        memset(lfi->lfthr[lvl].mblim, (2 * (lvl + 2) + block_inside_limit),
+            SIMD_WIDTH);
+        memset(lfi->lfthr[lvl].hev_thr, (lvl >> 4), SIMD_WIDTH);
+    }
+}
+
+void dec_lf_frame_init(EbDecHandle *dec_handle_ptr)
+{
+    LoopFilterInfoN     *lfi = &dec_handle_ptr->lf_info;
+    FrameHeader         *frame_info = &dec_handle_ptr->frame_header;
+    LoopFilterParams    *lf_params = &frame_info->loop_filter_params;
+    SegmentationParams  *seg_params = &frame_info->segmentation_params;
+
+    update_sharpness(lfi, lf_params->loop_filter_sharpness);
+
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; plane++) {
+        for (int32_t seg_id = 0; seg_id < MAX_SEGMENTS; seg_id++) {
+            for (int32_t dir = 0; dir < 2; dir++) {
+                int32_t lvl_seg = get_base_level(lf_params, plane, dir);
+                SEG_LVL_FEATURES seg_lf_feature_id = seg_lvl_lf_lut[plane][dir];
+
+                if (seg_feature_active_idx(seg_params, seg_id, seg_lf_feature_id)) {
+                    lvl_seg = clamp(lvl_seg + get_segdata(seg_params, seg_id,
+                        seg_lf_feature_id), 0, MAX_LOOP_FILTER);
+                }
+
+                if (!lf_params->loop_filter_delta_enabled) {
+                    memset(lfi->lvl[plane][seg_id][dir], lvl_seg,
+                        sizeof(lfi->lvl[plane][seg_id][dir]));
+                }
+                else {
+                    const int32_t scale = 1 << (lvl_seg >> 5);
+                    const int32_t intra_lvl = lvl_seg +
+                        lf_params->loop_filter_ref_deltas[INTRA_FRAME] * scale;
+                    lfi->lvl[plane][seg_id][dir][INTRA_FRAME][0] =
+                        (uint8_t)clamp(intra_lvl, 0, MAX_LOOP_FILTER);
+
+                    for (int32_t ref = LAST_FRAME; ref < REF_FRAMES; ++ref) {
+                        for (int32_t mode = 0; mode < MAX_MODE_LF_DELTAS; ++mode) {
+                            const int32_t inter_lvl = lvl_seg +
+                                lf_params->loop_filter_ref_deltas[ref] * scale +
+                                lf_params->loop_filter_mode_deltas[mode] * scale;
+                            lfi->lvl[plane][seg_id][dir][ref][mode] =
+                                (uint8_t)clamp(inter_lvl, 0, MAX_LOOP_FILTER);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+static uint8_t get_filter_level(EbDecHandle *dec_handle_ptr, ModeInfo_t *mi,
+                                SBInfo *sb_info, int32_t dir, int32_t plane)
+{
+    FrameHeader         *frame_info = &dec_handle_ptr->frame_header;
+    LoopFilterParams    *lf_params = &frame_info->loop_filter_params;
+    SegmentationParams  *seg_params = &frame_info->segmentation_params;
+    DeltaLFParams       *delta_lf_params = &frame_info->delta_lf_params;
+    int32_t             segment_id = mi->segment_id;
+
+    if (delta_lf_params->delta_lf_present) {
+        /* The levels of the SB depend on its delta lf, lf_info can't be used */
+        int32_t delta_lf = sb_info->sb_delta_lf[delta_lf_params->delta_lf_multi ?
+            delta_lf_id_lut[plane][dir] : 0];
+        int32_t lvl_seg = clamp(delta_lf + get_base_level(lf_params, plane, dir),
+            0, MAX_LOOP_FILTER);
+        SEG_LVL_FEATURES seg_lf_feature_id = seg_lvl_lf_lut[plane][dir];
+
+        if (seg_feature_active_idx(seg_params, segment_id, seg_lf_feature_id)) {
+            lvl_seg = clamp(lvl_seg + get_segdata(seg_params, segment_id,
+                seg_lf_feature_id), 0, MAX_LOOP_FILTER);
+        }
+
+        if (lf_params->loop_filter_delta_enabled) {
+            const int32_t scale = 1 << (lvl_seg >> 5);
+            lvl_seg += lf_params->loop_filter_ref_deltas[mi->ref_frame[0]] * scale;
+            if (mi->ref_frame[0] > INTRA_FRAME)
+                lvl_seg += lf_params->loop_filter_mode_deltas[mode_lf_lut[mi->mode]] *
+                           scale;
+            lvl_seg = clamp(lvl_seg, 0, MAX_LOOP_FILTER);
+        }
+        return (uint8_t)lvl_seg;
+    }
+
+    return dec_handle_ptr->lf_info.lvl[plane][segment_id][dir][mi->ref_frame[0]]
+        [mode_lf_lut[mi->mode]];
+}
+
+/* Transform size of mi in plane, as seen across an edge of edge_dir */
+static TxSize get_lf_tx_size(EbDecHandle *dec_handle_ptr, ModeInfo_t *mi,
+                             SBInfo *sb_info, LfEdgeDir edge_dir, int32_t plane,
+                             int32_t sub_x, int32_t sub_y)
+{
+    TxSize tx_size;
+
+    if (dec_handle_ptr->frame_header.lossless_array[mi->segment_id])
+        tx_size = TX_4X4;
+    else if (plane == 0)
+        /* Intra blocks have a single luma tx size */
+        tx_size = sb_info->sb_luma_trans_info[mi->first_luma_tu_offset].tx_size;
+    else
+        tx_size = av1_get_adjusted_tx_size(max_txsize_rect_lookup[
+            get_plane_block_size(mi->sb_type, sub_x, sub_y)]);
+
+    return edge_dir == LF_VERT_EDGE ? txsize_horz_map[tx_size] :
+                                      txsize_vert_map[tx_size];
+}
+
+/* Sets params for the edge of edge_dir at x, y of plane and returns the
+   transform size of the block there, which is the step to the next edge */
+static TxSize set_lpf_params(DecLfParams *params, EbDecHandle *dec_handle_ptr,
+                             LfEdgeDir edge_dir, uint32_t x, uint32_t y,
+                             int32_t plane, int32_t sub_x, int32_t sub_y)
+{
+    SBInfo      *sb_info, *pv_sb_info;
+    ModeInfo_t  *mi, *pv_mi;
+    TxSize      tx_size, pv_tx_size;
+    uint32_t    mi_row = sub_y | ((y << sub_y) >> MI_SIZE_LOG2);
+    uint32_t    mi_col = sub_x | ((x << sub_x) >> MI_SIZE_LOG2);
+    uint32_t    coord = (edge_dir == LF_VERT_EDGE) ? x : y;
+
+    params->filter_length = 0;
+
+    mi = get_frame_mode_info(dec_handle_ptr, mi_row, mi_col, &sb_info);
+    tx_size = get_lf_tx_size(dec_handle_ptr, mi, sb_info, edge_dir, plane,
+                             sub_x, sub_y);
+
+    /* Not a transform edge, or the picture boundary */
+    if (coord == 0 || (coord & ((edge_dir == LF_VERT_EDGE ?
+        tx_size_wide[tx_size] : tx_size_high[tx_size]) - 1)))
+        return tx_size;
+
+    {
+        uint32_t pv_row = (edge_dir == LF_VERT_EDGE) ? mi_row :
+                          mi_row - (1 << sub_y);
+        uint32_t pv_col = (edge_dir == LF_VERT_EDGE) ?
+                          mi_col - (1 << sub_x) : mi_col;
+        BlockSize plane_bsize = get_plane_block_size(mi->sb_type, sub_x, sub_y);
+        uint32_t pred_mask = (edge_dir == LF_VERT_EDGE ?
+            block_size_wide[plane_bsize] : block_size_high[plane_bsize]) - 1;
+        int32_t pu_edge = !(coord & pred_mask);
+        uint8_t curr_level = get_filter_level(dec_handle_ptr, mi, sb_info,
+                                              edge_dir, plane);
+        int32_t curr_skipped = mi->skip && dec_is_inter_block(mi);
+        uint8_t pv_level;
+        int32_t pv_skipped;
+
+        pv_mi = get_frame_mode_info(dec_handle_ptr, pv_row, pv_col, &pv_sb_info);
+        pv_tx_size = get_lf_tx_size(dec_handle_ptr, pv_mi, pv_sb_info, edge_dir,
+                                    plane, sub_x, sub_y);
+        pv_level = get_filter_level(dec_handle_ptr, pv_mi, pv_sb_info,
+                                    edge_dir, plane);
+        pv_skipped = pv_mi->skip && dec_is_inter_block(pv_mi);
+
+        if ((curr_level || pv_level) &&
+            (!pv_skipped || !curr_skipped || pu_edge))
+        {
+            const TxSize min_tx_size = AOMMIN(tx_size, pv_tx_size);
+            const LoopFilterThresh *limits = dec_handle_ptr->lf_info.lfthr +
+                (curr_level ? curr_level : pv_level);
+
+            if (min_tx_size <= TX_4X4)
+                params->filter_length = 4;
+            else if (min_tx_size == TX_8X8)
+                params->filter_length = plane ? 6 : 8;
+            else
+                params->filter_length = plane ? 6 : 14;
+
+            params->lim = limits->lim;
+            params->mblim = limits->mblim;
+            params->hev_thr = limits->hev_thr;
+        }
+    }
+    return tx_size;
+}
+
+static void filter_edge(void *buf, int32_t stride, LfEdgeDir edge_dir,
+                        DecLfParams *params, int32_t is_16bit, int32_t bit_depth)
+{
+    if (!is_16bit) {
+        uint8_t *p = (uint8_t *)buf;
+        if (edge_dir == LF_VERT_EDGE) {
+            switch (params->filter_length) {
+            case 4: aom_lpf_vertical_4(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 6: aom_lpf_vertical_6(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 8: aom_lpf_vertical_8(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 14: aom_lpf_vertical_14(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            default: break;
+            }
+        }
+        else {
+            switch (params->filter_length) {
+            case 4: aom_lpf_horizontal_4(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 6: aom_lpf_horizontal_6(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 8: aom_lpf_horizontal_8(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            case 14: aom_lpf_horizontal_14(p, stride, params->mblim, params->lim,
+                        params->hev_thr); break;
+            default: break;
+            }
+        }
+    }
+    else {
+        uint16_t *p = (uint16_t *)buf;
+        if (edge_dir == LF_VERT_EDGE) {
+            switch (params->filter_length) {
+            case 4: aom_highbd_lpf_vertical_4(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 6: aom_highbd_lpf_vertical_6(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 8: aom_highbd_lpf_vertical_8(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 14: aom_highbd_lpf_vertical_14(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            default: break;
+            }
+        }
+        else {
+            switch (params->filter_length) {
+            case 4: aom_highbd_lpf_horizontal_4(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 6: aom_highbd_lpf_horizontal_6(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 8: aom_highbd_lpf_horizontal_8(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            case 14: aom_highbd_lpf_horizontal_14(p, stride, params->mblim,
+                        params->lim, params->hev_thr, bit_depth); break;
+            default: break;
+            }
+        }
+    }
+}
+
+/* Filters the edges of edge_dir of plane in SB row sb_row, over the whole
+   width of the frame */
+static void filter_sb_row_edges(EbDecHandle *dec_handle_ptr, int32_t plane,
+                                LfEdgeDir edge_dir, int32_t sb_row)
+{
+    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->recon_picture_buf[0];
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    FrameSize   *frame_size = &dec_handle_ptr->frame_header.frame_size;
+    int32_t     sub_x = plane ? seq_header->color_config.subsampling_x : 0;
+    int32_t     sub_y = plane ? seq_header->color_config.subsampling_y : 0;
+    uint32_t    width = (frame_size->frame_width + sub_x) >> sub_x;
+    uint32_t    height = (frame_size->frame_height + sub_y) >> sub_y;
+    uint32_t    y_start = (uint32_t)(sb_row << seq_header->sb_size_log2) >> sub_y;
+    uint32_t    y_end = AOMMIN(height,
+                    (uint32_t)((sb_row + 1) << seq_header->sb_size_log2) >> sub_y);
+    int32_t     is_16bit = recon_picture_buf->bit_depth != EB_8BIT;
+    int32_t     bytes = is_16bit ? 2 : 1;
+    uint8_t     *buf;
+    int32_t     stride;
+    DecLfParams params;
+
+    switch (plane) {
+    case 0:
+        buf = recon_picture_buf->buffer_y;
+        stride = recon_picture_buf->stride_y;
+        break;
+    case 1:
+        buf = recon_picture_buf->buffer_cb;
+        stride = recon_picture_buf->stride_cb;
+        break;
+    default:
+        buf = recon_picture_buf->buffer_cr;
+        stride = recon_picture_buf->stride_cr;
+        break;
+    }
+    buf += ((recon_picture_buf->origin_y >> sub_y) * stride +
+            (recon_picture_buf->origin_x >> sub_x)) * bytes;
+
+    if (edge_dir == LF_VERT_EDGE) {
+        for (uint32_t y = y_start; y < y_end; y += MI_SIZE) {
+            for (uint32_t x = 0; x < width;) {
+                TxSize tx_size = set_lpf_params(&params, dec_handle_ptr,
+                    edge_dir, x, y, plane, sub_x, sub_y);
+                filter_edge(buf + (y * stride + x) * bytes, stride, edge_dir,
+                    &params, is_16bit, seq_header->color_config.bit_depth);
+                x += tx_size_wide[tx_size];
+            }
+        }
+    }
+    else {
+        for (uint32_t x = 0; x < width; x += MI_SIZE) {
+            for (uint32_t y = y_start; y < y_end;) {
+                TxSize tx_size = set_lpf_params(&params, dec_handle_ptr,
+                    edge_dir, x, y, plane, sub_x, sub_y);
+                filter_edge(buf + (y * stride + x) * bytes, stride, edge_dir,
+                    &params, is_16bit, seq_header->color_config.bit_depth);
+                y += tx_size_high[tx_size];
+            }
+        }
+    }
+}
+
+void dec_lf_sb_row(EbDecHandle *dec_handle_ptr, int32_t sb_row)
+{
+    LoopFilterParams *lf_params =
+        &dec_handle_ptr->frame_header.loop_filter_params;
+    int32_t num_planes = av1_num_planes(&dec_handle_ptr->seq_header.color_config);
+
+    for (int32_t plane = 0; plane < num_planes; plane++) {
+        if (plane == 0 && !lf_params->loop_filter_level[0] &&
+            !lf_params->loop_filter_level[1])
+            break;
+        else if (plane == 1 && !lf_params->loop_filter_level[2])
+            continue;
+        else if (plane == 2 && !lf_params->loop_filter_level[3])
+            continue;
+
+        filter_sb_row_edges(dec_handle_ptr, plane, LF_VERT_EDGE, sb_row);
+        filter_sb_row_edges(dec_handle_ptr, plane, LF_HORZ_EDGE, sb_row);
+    }
+}
@@ -0,0 +1,24 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecLF_h
+#define EbDecLF_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sets up lf_info, the limits and levels of the frame */
+void dec_lf_frame_init(EbDecHandle *dec_handle_ptr);
+
+/* Deblocks SB row sb_row of all the planes : the vertical edges, then the
+   horizontal ones. The top edge of the row changes the bottom of the row
+   above, so the rows have to be filtered in order. */
+void dec_lf_sb_row(EbDecHandle *dec_handle_ptr, int32_t sb_row);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbDecLF_h
@@ -22,6 +22,11 @@
 
 #include "EbDecMemInit.h"
 #include "EbDecInverseQuantize.h"
+#include "EbDecParseFrame.h"
+#include "EbDecCdef.h"
+#include "EbDecFrameThreads.h"
+
+#include "EbCdef.h"
 
 /*TODO: Remove and harmonize with encoder. Globals prevent harmonization now! */
 /*****************************************
@@ -138,6 +143,10 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         EB_MALLOC_DEC(ModeInfo_t*, cur_frame_buf->mode_info,
                     (num_sb * num_mis_in_sb * sizeof(ModeInfo_t)), EB_N_PTR);
 
+        /* ModeInfo offset map at 4x4 level, for decode after parse */
+        EB_MALLOC_DEC(int16_t*, cur_frame_buf->mi_map,
+                    (num_sb * num_mis_in_sb * sizeof(int16_t)), EB_N_PTR);
+
         /* TransformInfo str allocation at 4x4 level */
         EB_MALLOC_DEC(TransformInfo_t*, cur_frame_buf->luma_trans_info,
             (num_sb * num_mis_in_sb * sizeof(TransformInfo_t)), EB_N_PTR);
@@ -172,24 +181,34 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
         EB_MALLOC_DEC(int32_t*, cur_frame_buf->delta_q,
             (num_sb * sizeof(int32_t)), EB_N_PTR);
 
-        /* cdef_strength allocation at SB level */
+        /* cdef_strength allocation at SB level, read_cdef
+           resets all 4 even for 64x64 SBs */
         EB_MALLOC_DEC(int8_t*, cur_frame_buf->cdef_strength,
-            (num_sb * (seq_header->use_128x128_superblock ? 4 : 1) *
-            sizeof(int8_t)), EB_N_PTR);
+            (num_sb * 4 * sizeof(int8_t)), EB_N_PTR);
 
-        /* delta_lf allocation at SB level */
+        /* delta_lf allocation at SB level, one per lf_id */
         EB_MALLOC_DEC(int32_t*, cur_frame_buf->delta_lf,
-            (num_sb * sizeof(int32_t)), EB_N_PTR);
+            (num_sb * FRAME_LF_COUNT * sizeof(int32_t)), EB_N_PTR);
 
         /* tile map allocation at SB level */
         EB_MALLOC_DEC(uint8_t*, cur_frame_buf->tile_map_sb,
             (num_sb * sizeof(uint8_t)), EB_N_PTR);
     }
 
-    /* Top SB 4x4 row MI map */
-    EB_MALLOC_DEC(int16_t*, dec_handle_ptr->master_frame_buf.frame_mi_map.top_sbrow_mi_map,
-        (sb_cols * (1 << (sb_size_log2 - MI_SIZE_LOG2)) * sizeof(int16_t)), EB_N_PTR);
-    dec_handle_ptr->master_frame_buf.frame_mi_map.num_mis_in_sb_wd = (1 << (sb_size_log2 - MI_SIZE_LOG2));
+    /* Tile jobs of a tile group, a tile has at least 1 SB */
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_tile_jobs,
+        (num_sb * sizeof(DecTileJob)), EB_N_PTR);
+
+    /* Row wavefront progress at SB row level */
+    EB_MALLOC_DEC(volatile uint32_t*, dec_handle_ptr->sb_row_parsed,
+        (sb_rows * sizeof(uint32_t)), EB_N_PTR);
+    EB_MALLOC_DEC(volatile uint32_t*, dec_handle_ptr->sb_row_decoded,
+        (sb_rows * sizeof(uint32_t)), EB_N_PTR);
+    dec_handle_ptr->wf_tile_info = NULL;
+
+    /* Post filter progress at SB row level */
+    EB_MALLOC_DEC(volatile uint32_t*, dec_handle_ptr->sb_row_recon,
+        (sb_rows * sizeof(uint32_t)), EB_N_PTR);
 
     /* TODO: Recon Pic Buf. Should be generalized! */
     EbPictureBufferDescInitData input_picture_buffer_desc_init_data;
@@ -218,12 +237,12 @@ static EbErrorType init_master_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
 }
 
 /*TODO: Move to module files */
-static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
+static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr,
+                                       ParseCtxt *parse_ctx)
+{
     EbErrorType return_error = EB_ErrorNone;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_parse_ctxt, sizeof(ParseCtxt), EB_N_PTR);
-
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
+    parse_ctx->dec_handle_ptr = (void *)dec_handle_ptr;
 
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
 
@@ -263,44 +282,177 @@ static EbErrorType init_parse_context (EbDecHandle  *dec_handle_ptr) {
     EB_MALLOC_DEC(uint8_t*, neigh_ctx->above_seg_pred_ctx, num_mi_col * sizeof(uint8_t), EB_N_PTR);
     EB_MALLOC_DEC(uint8_t*, neigh_ctx->left_seg_pred_ctx, num_mi_row * sizeof(uint8_t), EB_N_PTR);
 
+    /* Top SB 4x4 row MI map */
+    EB_MALLOC_DEC(int16_t*, parse_ctx->frame_mi_map.top_sbrow_mi_map,
+        (sb_cols * num_4x4_neigh_sb * sizeof(int16_t)), EB_N_PTR);
+    parse_ctx->frame_mi_map.num_mis_in_sb_wd = num_4x4_neigh_sb;
+
     return return_error;
 }
 
 /*TODO: Move to module files */
-static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr)
+static EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr,
+                                     DecModCtxt *dec_mod_ctxt)
 {
     EbErrorType return_error = EB_ErrorNone;
 
-    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_dec_mod_ctxt, sizeof(DecModCtxt), EB_N_PTR);
-
-    DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
-
     dec_mod_ctxt->dec_handle_ptr = (void *)dec_handle_ptr;
 
     int32_t sb_size_log2 = dec_handle_ptr->seq_header.sb_size_log2;
     EB_MALLOC_DEC(int32_t*, dec_mod_ctxt->sb_iquant_ptr, (1 << sb_size_log2) *
                   (1 << sb_size_log2) * sizeof(int32_t), EB_N_PTR);
 
-    av1_inverse_qm_init(&dec_handle_ptr->frame_header, &dec_handle_ptr->seq_header.color_config);
-
     return return_error;
 }
 
+/*TODO: Move to module files */
+static EbErrorType init_cdef_ctxt(EbDecHandle  *dec_handle_ptr)
+{
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    DecCdefCtxt *cdef_ctxt;
+    int32_t     mi_cols = 2 * ((seq_header->max_frame_width + 7) >> 3);
+    int32_t     nhfb = (mi_cols + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    int32_t     num_planes = av1_num_planes(&seq_header->color_config);
+
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_cdef_ctxt, sizeof(DecCdefCtxt),
+        EB_N_PTR);
+    cdef_ctxt = (DecCdefCtxt *)dec_handle_ptr->pv_cdef_ctxt;
+
+    cdef_ctxt->linebuf_stride = (mi_cols << MI_SIZE_LOG2) + 2 * CDEF_HBORDER;
+    for (int32_t pli = 0; pli < num_planes; pli++) {
+        EB_MALLOC_DEC(uint16_t*, cdef_ctxt->linebuf[pli], (CDEF_VBORDER *
+            cdef_ctxt->linebuf_stride * sizeof(uint16_t)), EB_N_PTR);
+        EB_MALLOC_DEC(uint16_t*, cdef_ctxt->colbuf[pli], (((MI_SIZE_64X64 <<
+            MI_SIZE_LOG2) + 2 * CDEF_VBORDER) * CDEF_HBORDER *
+            sizeof(uint16_t)), EB_N_PTR);
+    }
+    EB_MALLOC_DEC(uint8_t*, cdef_ctxt->row_cdef, ((nhfb + 2) * 2 *
+        sizeof(uint8_t)), EB_N_PTR);
+
+    return EB_ErrorNone;
+}
+
+/* Tile decode threads, created last so that eb_deinit_decoder stops them
+   before freeing the contexts they use */
+static EbErrorType init_tile_threads(EbDecHandle  *dec_handle_ptr)
+{
+    uint32_t num_threads = dec_handle_ptr->num_threads;
+    DecTileThreadCtxt *thread_ctxt;
+
+    if (num_threads < 2)
+        return EB_ErrorNone;
+
+    EB_CREATESEMAPHORE_DEC(dec_handle_ptr->tile_start_semaphore, 0,
+                           num_threads - 1);
+    EB_CREATESEMAPHORE_DEC(dec_handle_ptr->tile_done_semaphore, 0,
+                           num_threads - 1);
+    EB_CREATECONDVAR_DEC(dec_handle_ptr->wf_cond_var);
+
+    EB_MALLOC_DEC(EbHandle*, dec_handle_ptr->tile_thread_handles,
+        ((num_threads - 1) * sizeof(EbHandle)), EB_N_PTR);
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_tile_thread_ctxt,
+        ((num_threads - 1) * sizeof(DecTileThreadCtxt)), EB_N_PTR);
+    thread_ctxt = (DecTileThreadCtxt *)dec_handle_ptr->pv_tile_thread_ctxt;
+
+    /* Context 0 belongs to the calling thread */
+    for (uint32_t i = 0; i < num_threads - 1; i++) {
+        thread_ctxt[i].dec_handle_ptr = dec_handle_ptr;
+        thread_ctxt[i].thread_idx = i + 1;
+        EB_CREATETHREAD_DEC(dec_handle_ptr->tile_thread_handles[i],
+                            dec_tile_thread_kernel, &thread_ctxt[i]);
+    }
+    return EB_ErrorNone;
+}
+
 EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
     EbErrorType return_error = EB_ErrorNone;
+    uint32_t    num_threads = dec_handle_ptr->num_threads;
 
     if (0 == dec_handle_ptr->seq_header_done)
         return EB_ErrorNone;
 
-    /* init module ctxts */
-    return_error = init_parse_context(dec_handle_ptr);
+    /* init module ctxts, one of each per tile decode thread */
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_parse_ctxt,
+        num_threads * sizeof(ParseCtxt), EB_N_PTR);
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_dec_mod_ctxt,
+        num_threads * sizeof(DecModCtxt), EB_N_PTR);
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        ParseCtxt *parse_ctx = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt + i;
+        DecModCtxt *dec_mod_ctxt = (DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt + i;
+
+        return_error = init_parse_context(dec_handle_ptr, parse_ctx);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+
+        return_error = init_dec_mod_ctxt(dec_handle_ptr, dec_mod_ctxt);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
 
-    return_error = init_dec_mod_ctxt(dec_handle_ptr);
+    av1_inverse_qm_init(&dec_handle_ptr->frame_header, &dec_handle_ptr->seq_header.color_config);
 
     /* init frame buffers */
     return_error = init_master_frame_ctxt(dec_handle_ptr);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    return_error = init_cdef_ctxt(dec_handle_ptr);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    return_error = init_tile_threads(dec_handle_ptr);
 
     dec_handle_ptr->mem_init_done = 1;
 
     return return_error;
 }
+
+/* Frame decoders of frame parallel decoding, one per slot, sharing the
+   threads. Their buffers are allocated with the first frame they decode,
+   once the sequence header is known. */
+EbErrorType dec_frame_threads_init(EbDecHandle  *dec_handle_ptr)
+{
+    int32_t num_slots = dec_handle_ptr->num_frms_prll;
+    uint32_t frm_threads = dec_handle_ptr->num_threads / num_slots;
+    DecFrameSlot *frame_slots;
+
+    EB_MALLOC_DEC(void *, dec_handle_ptr->pv_frame_slots,
+        num_slots * sizeof(DecFrameSlot), EB_N_PTR);
+    frame_slots = (DecFrameSlot *)dec_handle_ptr->pv_frame_slots;
+
+    dec_handle_ptr->frm_slot_head = 0;
+    dec_handle_ptr->frm_slots_busy = 0;
+    dec_handle_ptr->frm_flush = 0;
+    dec_handle_ptr->frm_status = EB_ErrorNone;
+
+    for (int32_t i = 0; i < num_slots; i++) {
+        DecFrameSlot *frame_slot = &frame_slots[i];
+        EbDecHandle *frm_dec_ptr;
+
+        EB_MALLOC_DEC(EbDecHandle *, frame_slot->frm_dec_ptr,
+            sizeof(EbDecHandle), EB_N_PTR);
+        frm_dec_ptr = frame_slot->frm_dec_ptr;
+        memset(frm_dec_ptr, 0, sizeof(EbDecHandle));
+        frm_dec_ptr->dec_config = dec_handle_ptr->dec_config;
+        frm_dec_ptr->dec_cnt = -1;
+        frm_dec_ptr->num_frms_prll = 1;
+        frm_dec_ptr->num_threads = frm_threads ? frm_threads : 1;
+
+        frame_slot->data = NULL;
+        frame_slot->data_size = 0;
+        frame_slot->data_alloc = 0;
+        frame_slot->status = EB_ErrorNone;
+        frame_slot->done = 1;
+
+        EB_CREATESEMAPHORE_DEC(frame_slot->start_semaphore, 0, 1);
+        EB_CREATESEMAPHORE_DEC(frame_slot->done_semaphore, 0, 1);
+    }
+
+    /* Threads last, see init_tile_threads */
+    for (int32_t i = 0; i < num_slots; i++) {
+        EB_CREATETHREAD_DEC(frame_slots[i].frame_thread_handle,
+                            dec_frame_thread_kernel, &frame_slots[i]);
+    }
+    return EB_ErrorNone;
+}
@@ -73,7 +73,34 @@ extern uint32_t                         svt_dec_lib_malloc_count;
         svt_dec_lib_malloc_count++; \
     }
 
+#define EB_ADD_MEM_DEC(pointer, n_elements, pointer_class) \
+    if (pointer == EB_NULL) \
+        return EB_ErrorInsufficientResources; \
+    else { \
+        EbMemoryMapEntry *node = malloc(sizeof(EbMemoryMapEntry)); \
+        if (node == (EbMemoryMapEntry*)EB_NULL) return EB_ErrorInsufficientResources; \
+        node->ptr_type         = pointer_class; \
+        node->ptr              = (EbPtr)pointer;\
+        node->prev_entry       = (EbPtr)svt_dec_memory_map;   \
+        svt_dec_memory_map     = node;          \
+        (*svt_dec_memory_map_index)++; \
+        *svt_dec_total_lib_memory += ((n_elements) + sizeof(EbMemoryMapEntry)); \
+    }
+
+#define EB_CREATESEMAPHORE_DEC(pointer, initial_count, max_count) \
+    pointer = eb_create_semaphore(initial_count, max_count); \
+    EB_ADD_MEM_DEC(pointer, 1, EB_SEMAPHORE)
+
+#define EB_CREATECONDVAR_DEC(pointer) \
+    pointer = eb_create_cond_var(); \
+    EB_ADD_MEM_DEC(pointer, 1, EB_COND_VAR)
+
+#define EB_CREATETHREAD_DEC(pointer, thread_function, thread_context) \
+    pointer = eb_create_thread(thread_function, thread_context); \
+    EB_ADD_MEM_DEC(pointer, 1, EB_THREAD)
+
 EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr);
+EbErrorType dec_frame_threads_init(EbDecHandle  *dec_handle_ptr);
 
 #ifdef __cplusplus
     }
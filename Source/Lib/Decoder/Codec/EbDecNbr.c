@@ -24,9 +24,17 @@ void update_nbrs_before_sb(FrameMiMap *frame_mi_map, int32_t sb_col) {
 }
 
 /* TODO : Should be moved to nbr file */
-void update_nbrs_after_sb(FrameMiMap *frame_mi_map, int32_t sb_col) {
+void update_nbrs_after_sb(FrameMiMap *frame_mi_map, SBInfo *sb_info,
+                          int32_t sb_col)
+{
     int32_t num_mis_in_sb_wd = frame_mi_map->num_mis_in_sb_wd;
 
+    /* Keep the SB map for decode, which can run behind parse */
+    for (int i = 0; i < num_mis_in_sb_wd; i++)
+        memcpy(&sb_info->sb_mi_map[i * num_mis_in_sb_wd],
+            &frame_mi_map->cur_sb_mi_map[i + 1][1],
+            num_mis_in_sb_wd * sizeof(int16_t));
+
     /* Update cur right 4x4 col as next left 4x4 */
     for (int i = 1; i < num_mis_in_sb_wd + 1; i++)
         frame_mi_map->cur_sb_mi_map[i][0] = frame_mi_map->cur_sb_mi_map[i][num_mis_in_sb_wd];
@@ -36,12 +44,11 @@ void update_nbrs_after_sb(FrameMiMap *frame_mi_map, int32_t sb_col) {
 }
 
 /* TODO : Should be moved to nbr file */
-void update_block_nbrs(EbDecHandle *dec_handle,
+void update_block_nbrs(ParseCtxt *parse_ctx,
     int mi_row, int mi_col,
     BlockSize subsize)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
-    FrameMiMap  *frame_mi_map = &dec_handle->master_frame_buf.frame_mi_map;
+    FrameMiMap  *frame_mi_map = &parse_ctx->frame_mi_map;
 
     int32_t offset = parse_ctx->cur_mode_info_cnt;
     // int32_t num_mis_in_sb_wd = frame_mi_map->num_mis_in_sb_wd;
@@ -61,38 +68,67 @@ void update_block_nbrs(EbDecHandle *dec_handle,
             frame_mi_map->cur_sb_mi_map[i][j] = offset;
 }
 
-/* TODO : Should be moved to nbr file */
-ModeInfo_t* get_cur_mode_info(void *pv_dec_handle,
+/* Mode info of the 4x4 at mi_row, mi_col for decode. The 4x4 is in the
+   current SB, or in the left or above SB for the nbr mode info. Reads the
+   sb_mi_map of the SBs, so it does not depend on the parse progress. */
+ModeInfo_t* get_cur_mode_info(void *pv_dec_mod_ctxt,
                               int mi_row, int mi_col, SBInfo *sb_info)
 {
-    EbDecHandle *dec_handle     = (EbDecHandle *)pv_dec_handle;
-    FrameMiMap  *frame_mi_map   = &dec_handle->master_frame_buf.frame_mi_map;
-    DecModCtxt *dec_mod_ctxt    = (DecModCtxt *)dec_handle->pv_dec_mod_ctxt;
+    DecModCtxt  *dec_mod_ctxt   = (DecModCtxt *)pv_dec_mod_ctxt;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
 
-    ModeInfo_t *cur_mi = NULL;
+    int32_t num_mis_in_sb_wd = dec_handle_ptr->seq_header.sb_mi_size;
 
-    int32_t num_mis_in_sb_wd = frame_mi_map->num_mis_in_sb_wd;
+    int32_t cur_blk_mi_row = mi_row - dec_mod_ctxt->sb_row_mi;
+    int32_t cur_blk_mi_col = mi_col - dec_mod_ctxt->sb_col_mi;
 
-    int32_t cur_blk_mi_row = (mi_row - dec_mod_ctxt->sb_row_mi) + 1;
-    int32_t cur_blk_mi_col = (mi_col - dec_mod_ctxt->sb_col_mi) + 1;
+    /* From Left SB */
+    if (cur_blk_mi_col < 0) {
+        sb_info = dec_mod_ctxt->left_sb_info;
+        cur_blk_mi_col += num_mis_in_sb_wd;
+    }
+    /* From Top SB */
+    else if (cur_blk_mi_row < 0) {
+        sb_info = dec_mod_ctxt->above_sb_info;
+        cur_blk_mi_row += num_mis_in_sb_wd;
+    }
 
     /* Can be removed later */
-    assert(cur_blk_mi_row >= 1 && cur_blk_mi_row <= num_mis_in_sb_wd);
-    assert(cur_blk_mi_col >= 1 && cur_blk_mi_col <= num_mis_in_sb_wd);
+    assert(cur_blk_mi_row >= 0 && cur_blk_mi_row < num_mis_in_sb_wd);
+    assert(cur_blk_mi_col >= 0 && cur_blk_mi_col < num_mis_in_sb_wd);
 
-    (void)num_mis_in_sb_wd;
-    int32_t offset = frame_mi_map->cur_sb_mi_map[cur_blk_mi_row][cur_blk_mi_col];
-    cur_mi = &sb_info->sb_mode_info[offset];
+    int32_t offset = sb_info->sb_mi_map[cur_blk_mi_row * num_mis_in_sb_wd +
+                                        cur_blk_mi_col];
+    return &sb_info->sb_mode_info[offset];
+}
+
+/* Mode info of the 4x4 at mi_row, mi_col anywhere in the frame, for the
+   post filters. The SB of the 4x4 must be parsed. Its SBInfo is returned
+   in pp_sb_info when not NULL. */
+ModeInfo_t* get_frame_mode_info(EbDecHandle *dec_handle_ptr,
+                                int mi_row, int mi_col, SBInfo **pp_sb_info)
+{
+    MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
+    int32_t num_mis_in_sb_wd = dec_handle_ptr->seq_header.sb_mi_size;
+    int32_t sb_mi_log2 = dec_handle_ptr->seq_header.sb_size_log2 - MI_SIZE_LOG2;
+
+    SBInfo *sb_info = master_frame_buf->cur_frame_bufs[0].sb_info +
+        (mi_row >> sb_mi_log2) * master_frame_buf->sb_cols +
+        (mi_col >> sb_mi_log2);
+
+    int32_t offset = sb_info->sb_mi_map[(mi_row & (num_mis_in_sb_wd - 1)) *
+        num_mis_in_sb_wd + (mi_col & (num_mis_in_sb_wd - 1))];
 
-    return cur_mi;
+    if (pp_sb_info != NULL)
+        *pp_sb_info = sb_info;
+    return &sb_info->sb_mode_info[offset];
 }
 
 /* TODO : Should remove parse_ctx dependency */
-ModeInfo_t * get_left_mode_info(EbDecHandle *dec_handle,
+ModeInfo_t * get_left_mode_info(ParseCtxt *parse_ctx,
     int mi_row, int mi_col, SBInfo *sb_info)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
-    FrameMiMap  *frame_mi_map = &dec_handle->master_frame_buf.frame_mi_map;
+    FrameMiMap  *frame_mi_map = &parse_ctx->frame_mi_map;
     ModeInfo_t  *left_mi = NULL;
 
     int32_t num_mis_in_sb_wd = frame_mi_map->num_mis_in_sb_wd;
@@ -116,11 +152,10 @@ ModeInfo_t * get_left_mode_info(EbDecHandle *dec_handle,
 }
 
 /* TODO : Should remove parse_ctx dependency */
-ModeInfo_t* get_top_mode_info(EbDecHandle *dec_handle,
+ModeInfo_t* get_top_mode_info(ParseCtxt *parse_ctx,
     int mi_row, int mi_col, SBInfo *sb_info)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
-    FrameMiMap  *frame_mi_map = &dec_handle->master_frame_buf.frame_mi_map;
+    FrameMiMap  *frame_mi_map = &parse_ctx->frame_mi_map;
     ModeInfo_t  *top_mi = NULL;
 
     int32_t num_mis_in_sb_wd = frame_mi_map->num_mis_in_sb_wd;
@@ -8,19 +8,23 @@
 
 void update_nbrs_before_sb(FrameMiMap *frame_mi_map, int32_t sb_col);
 
-void update_nbrs_after_sb(FrameMiMap *frame_mi_map, int32_t sb_col);
+void update_nbrs_after_sb(FrameMiMap *frame_mi_map, SBInfo *sb_info,
+    int32_t sb_col);
 
-ModeInfo_t* get_cur_mode_info(void *pv_dec_handle,
+ModeInfo_t* get_cur_mode_info(void *pv_dec_mod_ctxt,
     int mi_row, int mi_col, SBInfo *sb_info);
 
-void update_block_nbrs(EbDecHandle *dec_handle,
+ModeInfo_t* get_frame_mode_info(EbDecHandle *dec_handle_ptr,
+    int mi_row, int mi_col, SBInfo **pp_sb_info);
+
+void update_block_nbrs(ParseCtxt *parse_ctx,
     int mi_row, int mi_col,
     BlockSize subsize);
 
-ModeInfo_t * get_left_mode_info(EbDecHandle *dec_handle,
+ModeInfo_t * get_left_mode_info(ParseCtxt *parse_ctx,
     int mi_row, int mi_col, SBInfo *sb_info);
 
-ModeInfo_t* get_top_mode_info(EbDecHandle *dec_handle,
+ModeInfo_t* get_top_mode_info(ParseCtxt *parse_ctx,
     int mi_row, int mi_col, SBInfo *sb_info);
 
 #endif //EbDecNbr_h
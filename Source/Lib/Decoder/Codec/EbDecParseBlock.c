@@ -473,19 +473,19 @@ static INLINE int get_nz_map_ctx_from_stats(
     return 0;
 }
 
-void palette_mode_info(/*EbDecHandle *dec_handle,
+void palette_mode_info(/*ParseCtxt *parse_ctx,
     int mi_row, int mi_col, SvtReader *r*/) {
     //TO-DO
     assert(0);
 }
 
-void filter_intra_mode_info(EbDecHandle *dec_handle,
+void filter_intra_mode_info(ParseCtxt *parse_ctx,
     PartitionInfo_t *xd, SvtReader *r) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *const mbmi = xd->mi;
     FilterIntraModeInfo_t *filter_intra_mode_info =
         &mbmi->filter_intra_mode_info;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
 
     if (filter_intra_allowed(dec_handle, mbmi)) {
         filter_intra_mode_info->use_filter_intra = svt_read_symbol(
@@ -518,8 +518,9 @@ uint8_t read_cfl_alphas(FRAME_CONTEXT *ec_ctx, SvtReader *r,
     return idx;
 }
 
-void read_cdef(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *xd,
+void read_cdef(ParseCtxt *parse_ctx, SvtReader *r, PartitionInfo_t *xd,
     int mi_col, int mi_row, int8_t *cdef_strength) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *const mbmi = xd->mi;
 
     if (dec_handle->frame_header.coded_lossless || dec_handle->frame_header.allow_intrabc
@@ -541,9 +542,10 @@ void read_cdef(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *xd,
         : cdef_strength[index];
 }
 
-int read_delta_qindex(EbDecHandle *dec_handle,
+int read_delta_qindex(ParseCtxt *parse_ctx,
     SvtReader *r, ModeInfo_t *const mbmi,
     int mi_col, int mi_row) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int sign, abs, reduced_delta_qindex = 0;
     BlockSize bsize = mbmi->sb_type;
     const int b_col = mi_col & (dec_handle->seq_header.sb_mi_size - 1);
@@ -552,8 +554,7 @@ int read_delta_qindex(EbDecHandle *dec_handle,
 
     if ((bsize != dec_handle->seq_header.sb_size || mbmi->skip == 0) &&
         read_delta_q_flag) {
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-        abs = svt_read_symbol(r, parse_ctxt->frm_ctx[0].delta_q_cdf, DELTA_Q_PROBS + 1, ACCT_STR);
+        abs = svt_read_symbol(r, parse_ctx->frm_ctx[0].delta_q_cdf, DELTA_Q_PROBS + 1, ACCT_STR);
         const int smallval = (abs < DELTA_Q_SMALL);
 
         if (!smallval) {
@@ -571,10 +572,11 @@ int read_delta_qindex(EbDecHandle *dec_handle,
     return reduced_delta_qindex;
 }
 
-int read_delta_lflevel(EbDecHandle *dec_handle, SvtReader *r,
+int read_delta_lflevel(ParseCtxt *parse_ctx, SvtReader *r,
     AomCdfProb *cdf,
     ModeInfo_t *mbmi, int mi_col,
     int mi_row) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int reduced_delta_lflevel = 0;
     const BlockSize bsize = mbmi->sb_type;
     const int b_col = mi_col & (dec_handle->seq_header.sb_mi_size - 1);
@@ -602,10 +604,10 @@ int seg_feature_active(SegmentationParams *seg, int segment_id,
     return seg->segmentation_enabled && seg->feature_data[segment_id][feature_id];
 }
 
-int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
+int read_skip(ParseCtxt *parse_ctx, PartitionInfo_t *xd, int segment_id,
     SvtReader *r)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     uint8_t segIdPreSkip = dec_handle->frame_header.segmentation_params.seg_id_pre_skip;
     if (segIdPreSkip && seg_feature_active(&dec_handle->frame_header.segmentation_params,
         segment_id, SEG_LVL_SKIP))
@@ -614,13 +616,14 @@ int read_skip(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
         const int above_skip = xd->above_mbmi ? xd->above_mbmi->skip : 0;
         const int left_skip = xd->left_mbmi ? xd->left_mbmi->skip : 0;
         int ctx = above_skip + left_skip;
-        return svt_read_symbol(r, parse_ctxt->frm_ctx[0].skip_cdfs[ctx], 2, ACCT_STR);
+        return svt_read_symbol(r, parse_ctx->frm_ctx[0].skip_cdfs[ctx], 2, ACCT_STR);
     }
 }
 
-int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
+int read_skip_mode(ParseCtxt *parse_ctx, PartitionInfo_t *xd, int segment_id,
     SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     if (seg_feature_active(&dec_handle->frame_header.segmentation_params, segment_id, SEG_LVL_SKIP) ||
         seg_feature_active(&dec_handle->frame_header.segmentation_params, segment_id, SEG_LVL_REF_FRAME) ||
         seg_feature_active(&dec_handle->frame_header.segmentation_params, segment_id, SEG_LVL_GLOBALMV) ||
@@ -629,65 +632,50 @@ int read_skip_mode(EbDecHandle *dec_handle, PartitionInfo_t *xd, int segment_id,
         block_size_high[xd->mi->sb_type] < 8) {
         return 0;
     }
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     int above_skip_mode = xd->above_mbmi ? xd->above_mbmi->skip_mode : 0;
     int left_skip_mode = xd->left_mbmi ? xd->left_mbmi->skip_mode : 0;
     int ctx = above_skip_mode + left_skip_mode;
-    return svt_read_symbol(r, parse_ctxt->frm_ctx[0].skip_mode_cdfs[ctx], 2, ACCT_STR);
+    return svt_read_symbol(r, parse_ctx->frm_ctx[0].skip_mode_cdfs[ctx], 2, ACCT_STR);
 }
 
 // If delta q is present, reads delta_q index.
 // Also reads delta_q loop filter levels, if present.
-static void read_delta_params(EbDecHandle *dec_handle, SvtReader *r,
+static void read_delta_params(ParseCtxt *parse_ctx, SvtReader *r,
                               PartitionInfo_t *xd,
                               const int mi_row, const int mi_col)
 {
-    ParseCtxt       *parse_ctxt     = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     DeltaQParams    *delta_q_params = &dec_handle->frame_header.delta_q_params;
     DeltaLFParams   *delta_lf_params = &dec_handle->frame_header.delta_lf_params;
     SBInfo          *sb_info = xd->sb_info;
 
     if (delta_q_params->delta_q_present) {
         ModeInfo_t *const mbmi = &xd->mi[0];
-        int current_qindex;
         int base_qindex = dec_handle->frame_header.quantization_params.base_q_idx;
 
-        sb_info->sb_delta_q[0] = read_delta_qindex(dec_handle, r, mbmi, mi_col, mi_row) *
-                                delta_q_params->delta_q_res;
-        current_qindex = base_qindex + sb_info->sb_delta_q[0];
+        /* Deltas accumulate over the SBs of the tile */
+        parse_ctx->cur_qindex += read_delta_qindex(parse_ctx, r, mbmi, mi_col,
+                                    mi_row) * (1 << delta_q_params->delta_q_res);
         /* Normative: Clamp to [1,MAXQ] to not interfere with lossless mode */
-        /* TODO: Should add cur q idx and remove this repetitive? */
-        sb_info->sb_delta_q[0] = clamp(current_qindex, 1, MAXQ) - base_qindex;
+        parse_ctx->cur_qindex = clamp(parse_ctx->cur_qindex, 1, MAXQ);
+        sb_info->sb_delta_q[0] = parse_ctx->cur_qindex - base_qindex;
 
-        FRAME_CONTEXT *const ec_ctx = &parse_ctxt->frm_ctx[0];
+        FRAME_CONTEXT *const ec_ctx = &parse_ctx->frm_ctx[0];
 
         if (delta_lf_params->delta_lf_present) {
-            if (delta_lf_params->delta_lf_multi) {
-                EbColorConfig *color_info = &dec_handle->seq_header.color_config;
-                int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
-                const int frame_lf_count =
-                    num_planes > 1 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-                for (int lf_id = 0; lf_id < frame_lf_count; ++lf_id) {
-                    int tmp_lvl;
-                    int base_lvl = dec_handle->frame_header.loop_filter_params.loop_filter_level[lf_id];
-                    sb_info->sb_delta_lf[lf_id] =
-                        read_delta_lflevel(dec_handle, r, ec_ctx->delta_lf_multi_cdf[lf_id],
-                                           mbmi, mi_col, mi_row) *
-                                           delta_lf_params->delta_lf_res;
-                    tmp_lvl = base_lvl + sb_info->sb_delta_lf[lf_id];
-                    tmp_lvl = clamp(tmp_lvl, -MAX_LOOP_FILTER, MAX_LOOP_FILTER);
-                    sb_info->sb_delta_lf[lf_id] = tmp_lvl - base_lvl;
-                }
-            } else {
-                int tmp_lvl;
-                int base_lvl = dec_handle->frame_header.loop_filter_params.loop_filter_level[0];
-                sb_info->sb_delta_lf[0] =
-                                read_delta_lflevel(dec_handle, r, ec_ctx->delta_lf_cdf,
-                                                    mbmi, mi_col, mi_row) *
-                                delta_lf_params->delta_lf_res;
-                tmp_lvl = base_lvl + sb_info->sb_delta_lf[0];
-                tmp_lvl = clamp(tmp_lvl, -MAX_LOOP_FILTER, MAX_LOOP_FILTER);
-                sb_info->sb_delta_lf[0] = tmp_lvl - base_lvl;
+            EbColorConfig *color_info = &dec_handle->seq_header.color_config;
+            int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
+            const int frame_lf_count = !delta_lf_params->delta_lf_multi ? 1 :
+                num_planes > 1 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
+            for (int lf_id = 0; lf_id < frame_lf_count; ++lf_id) {
+                AomCdfProb *cdf = delta_lf_params->delta_lf_multi ?
+                    ec_ctx->delta_lf_multi_cdf[lf_id] : ec_ctx->delta_lf_cdf;
+                int tmp_lvl = parse_ctx->delta_lf[lf_id] +
+                    read_delta_lflevel(parse_ctx, r, cdf, mbmi, mi_col, mi_row) *
+                    (1 << delta_lf_params->delta_lf_res);
+                parse_ctx->delta_lf[lf_id] =
+                    clamp(tmp_lvl, -MAX_LOOP_FILTER, MAX_LOOP_FILTER);
+                sb_info->sb_delta_lf[lf_id] = parse_ctx->delta_lf[lf_id];
             }
         }
     }
@@ -725,26 +713,26 @@ int get_segment_id(FrameHeader *frm_info, uint8_t *segment_ids,
     return segment_id;
 }
 
-static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_t mi_row,
+static int read_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int skip)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int cdf_num = 0;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int prev_ul = -1;  // top left segment_id
     int prev_l = -1;   // left segment_id
     int prev_u = -1;   // top segment_id
     int pred = -1;
     if ((xd->up_available) && (xd->left_available)) {
-        prev_ul = get_segment_id(&dec_handle->frame_header, parse_ctxt->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row - 1,
+        prev_ul = get_segment_id(&dec_handle->frame_header, parse_ctx->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row - 1,
             mi_col - 1);
     }
     if (xd->up_available) {
-        prev_u = get_segment_id(&dec_handle->frame_header, parse_ctxt->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row - 1,
+        prev_u = get_segment_id(&dec_handle->frame_header, parse_ctx->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row - 1,
             mi_col);
     }
     if (xd->left_available) {
-        prev_l = get_segment_id(&dec_handle->frame_header, parse_ctxt->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row,
+        prev_l = get_segment_id(&dec_handle->frame_header, parse_ctx->parse_nbr4x4_ctxt.segment_maps, BLOCK_4X4, mi_row,
             mi_col - 1);
     }
     if ((prev_ul == prev_u) && (prev_ul == prev_l))
@@ -762,7 +750,7 @@ static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_
 
     if (skip) return pred;
 
-    FRAME_CONTEXT *ec_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *ec_ctx = &parse_ctx->frm_ctx[0];
     SegmentationParams *seg = &(dec_handle->frame_header.segmentation_params);
 
     struct segmentation_probs *segp = &ec_ctx->seg;
@@ -772,9 +760,10 @@ static int read_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, uint32_
     return neg_deinterleave(coded_id, pred, seg->last_active_seg_id + 1);
 }
 
-int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, int mi_col,
+int intra_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd, int mi_row, int mi_col,
     int bsize, SvtReader *r, int skip)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     int segment_id = 0;
 
@@ -784,17 +773,17 @@ int intra_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd, int mi_row, i
         const int bh = mi_size_high[bsize];
         const int x_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_cols - mi_col), bw);
         const int y_mis = AOMMIN((int32_t)(dec_handle->frame_header.mi_rows - mi_row), bh);
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, skip);
-        set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+        segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, skip);
+        set_segment_id(parse_ctx, mi_offset, x_mis, y_mis, segment_id);
     }
     return segment_id;
 }
 
-void intra_frame_mode_info(EbDecHandle *dec_handle,
+void intra_frame_mode_info(ParseCtxt *parse_ctx,
     PartitionInfo_t *xd, int mi_row,
     int mi_col, SvtReader *r, int8_t *cdef_strength)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *const mbmi = xd->mi;
     const ModeInfo_t *above_mi = xd->above_mbmi;
     const ModeInfo_t *left_mi = xd->left_mbmi;
@@ -805,24 +794,24 @@ void intra_frame_mode_info(EbDecHandle *dec_handle,
 
     if (seg->seg_id_pre_skip)
         mbmi->segment_id =
-        intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, 0);
+        intra_segment_id(parse_ctx, xd, mi_row, mi_col, bsize, r, 0);
 
-    mbmi->skip = read_skip(dec_handle, xd, mbmi->segment_id, r);
+    mbmi->skip = read_skip(parse_ctx, xd, mbmi->segment_id, r);
 
     if (!seg->seg_id_pre_skip)
         mbmi->segment_id =
-        intra_segment_id(dec_handle, xd, mi_row, mi_col, bsize, r, mbmi->skip);
+        intra_segment_id(parse_ctx, xd, mi_row, mi_col, bsize, r, mbmi->skip);
 
-    read_cdef(dec_handle, r, xd, mi_col, mi_row, cdef_strength);
+    read_cdef(parse_ctx, r, xd, mi_col, mi_row, cdef_strength);
 
-    read_delta_params(dec_handle, r, xd, mi_row, mi_col);
+    read_delta_params(parse_ctx, r, xd, mi_row, mi_col);
 
     mbmi->ref_frame[0] = INTRA_FRAME;
     mbmi->ref_frame[1] = NONE_FRAME;
 
     mbmi->use_intrabc = 0;
     if (allow_intrabc(dec_handle))
-        mbmi->use_intrabc = svt_read_symbol(r, parse_ctxt->frm_ctx[0].intrabc_cdf, 2, ACCT_STR);
+        mbmi->use_intrabc = svt_read_symbol(r, parse_ctx->frm_ctx[0].intrabc_cdf, 2, ACCT_STR);
 
     if (mbmi->use_intrabc) {
         mbmi->mode = DC_PRED;
@@ -835,24 +824,24 @@ void intra_frame_mode_info(EbDecHandle *dec_handle,
     }
     else
     {
-        mbmi->mode = read_intra_mode(r, get_y_mode_cdf(&parse_ctxt->frm_ctx[0], above_mi, left_mi));
+        mbmi->mode = read_intra_mode(r, get_y_mode_cdf(&parse_ctx->frm_ctx[0], above_mi, left_mi));
         mbmi->angle_delta[PLANE_TYPE_Y] =
-            intra_angle_info(r, &parse_ctxt->frm_ctx[0].angle_delta_cdf[mbmi->mode - V_PRED][0], mbmi->mode, bsize);
+            intra_angle_info(r, &parse_ctx->frm_ctx[0].angle_delta_cdf[mbmi->mode - V_PRED][0], mbmi->mode, bsize);
         const int has_chroma =
                 dec_is_chroma_reference(mi_row, mi_col, bsize, color_config.subsampling_x,
                 color_config.subsampling_y);
         if (has_chroma) {
             mbmi->uv_mode =
-                read_intra_mode_uv(&parse_ctxt->frm_ctx[0], r, is_cfl_allowed(xd, &color_config, lossless_array), mbmi->mode);
+                read_intra_mode_uv(&parse_ctx->frm_ctx[0], r, is_cfl_allowed(xd, &color_config, lossless_array), mbmi->mode);
             if (mbmi->uv_mode == UV_CFL_PRED)
-                mbmi->cfl_alpha_idx = read_cfl_alphas(&parse_ctxt->frm_ctx[0], r, &mbmi->cfl_alpha_signs);
+                mbmi->cfl_alpha_idx = read_cfl_alphas(&parse_ctx->frm_ctx[0], r, &mbmi->cfl_alpha_signs);
             mbmi->angle_delta[PLANE_TYPE_UV] =
-            intra_angle_info(r, &parse_ctxt->frm_ctx[0].angle_delta_cdf[mbmi->uv_mode - V_PRED][0], dec_get_uv_mode(mbmi->uv_mode), bsize);
+            intra_angle_info(r, &parse_ctx->frm_ctx[0].angle_delta_cdf[mbmi->uv_mode - V_PRED][0], dec_get_uv_mode(mbmi->uv_mode), bsize);
         }
 
         if (allow_palette(dec_handle->frame_header.allow_screen_content_tools, bsize))
             palette_mode_info(/*dec_handle, mi_row, mi_col, r*/);
-        filter_intra_mode_info(dec_handle, xd, r);
+        filter_intra_mode_info(parse_ctx, xd, r);
     }
 }
 
@@ -874,13 +863,13 @@ void update_seg_ctx(ParseNbr4x4Ctxt *ngr_ctx, int blk_col,
     memset(left_seg_ctx, seg_id_predicted, h4);
 }
 
-int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int read_inter_segment_id(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
     uint32_t mi_row, uint32_t mi_col, int preskip,
     SvtReader *r) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SegmentationParams *seg = &dec_handle->frame_header.segmentation_params;
     ModeInfo_t *const mbmi = xd->mi;
     FrameHeader *frame_header = &dec_handle->frame_header;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     const int mi_offset = mi_row * frame_header->mi_cols + mi_col;
     const uint32_t bw = mi_size_wide[mbmi->sb_type];
     const uint32_t bh = mi_size_high[mbmi->sb_type];
@@ -890,7 +879,7 @@ int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
 
     //TODO - check neighbour access index
     int predictedSegmentId = get_segment_id(frame_header,
-        parse_ctxt->parse_nbr4x4_ctxt.segment_maps, mbmi->sb_type, mi_row, mi_col);
+        parse_ctx->parse_nbr4x4_ctxt.segment_maps, mbmi->sb_type, mi_row, mi_col);
 
     if (!seg->segmentation_enabled) return 0;  // Default for disabled segmentation
 
@@ -905,37 +894,36 @@ int read_inter_segment_id(EbDecHandle *dec_handle, PartitionInfo_t *xd,
         if (mbmi->skip) {
             if (seg->segmentation_temporal_update)
                 mbmi->seg_id_predicted = 0;
-            update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt, mi_col, bw, bh, mbmi->seg_id_predicted);
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 1);
-            set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+            update_seg_ctx(&parse_ctx->parse_nbr4x4_ctxt, mi_col, bw, bh, mbmi->seg_id_predicted);
+            segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 1);
+            set_segment_id(parse_ctx, mi_offset, x_mis, y_mis, segment_id);
             return segment_id;
         }
     }
 
     if (seg->segmentation_temporal_update) {
         const int ctx = get_pred_context_seg_id(xd);
-        ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-        struct segmentation_probs *const segp = &parse_ctxt->frm_ctx[0].seg;
+        struct segmentation_probs *const segp = &parse_ctx->frm_ctx[0].seg;
         AomCdfProb *pred_cdf = segp->pred_cdf[ctx];
         mbmi->seg_id_predicted = svt_read_symbol(r, pred_cdf, 2, ACCT_STR);
         if (mbmi->seg_id_predicted)
             segment_id = predictedSegmentId;
         else
-            segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
-        update_seg_ctx(&parse_ctxt->parse_nbr4x4_ctxt, mi_col, bw, bh, mbmi->seg_id_predicted);
+            segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 0);
+        update_seg_ctx(&parse_ctx->parse_nbr4x4_ctxt, mi_col, bw, bh, mbmi->seg_id_predicted);
     }
     else
-        segment_id = read_segment_id(dec_handle, xd, mi_row, mi_col, r, 0);
-    set_segment_id(dec_handle, mi_offset, x_mis, y_mis, segment_id);
+        segment_id = read_segment_id(parse_ctx, xd, mi_row, mi_col, r, 0);
+    set_segment_id(parse_ctx, mi_offset, x_mis, y_mis, segment_id);
 
     return segment_id;
 }
 
-void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
+void intra_block_mode_info(ParseCtxt *parse_ctx, int mi_row,
     int mi_col, PartitionInfo_t* xd,
     ModeInfo_t *mbmi,
     SvtReader *r) {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     const BlockSize bsize = mbmi->sb_type;
     mbmi->ref_frame[0] = INTRA_FRAME;
     mbmi->ref_frame[1] = NONE_FRAME;
@@ -943,34 +931,34 @@ void intra_block_mode_info(EbDecHandle *dec_handle, int mi_row,
     EbColorConfig *color_cfg = &dec_handle->seq_header.color_config;
     uint8_t     *lossless_array = &dec_handle->frame_header.lossless_array[0];
 
-    mbmi->mode = read_intra_mode(r, parse_ctxt->frm_ctx[0].y_mode_cdf[size_group_lookup[bsize]]);
+    mbmi->mode = read_intra_mode(r, parse_ctx->frm_ctx[0].y_mode_cdf[size_group_lookup[bsize]]);
 
     mbmi->angle_delta[PLANE_TYPE_Y] =
-        intra_angle_info(r, &parse_ctxt->frm_ctx[0].angle_delta_cdf[mbmi->mode - V_PRED][0], mbmi->mode, bsize);
+        intra_angle_info(r, &parse_ctx->frm_ctx[0].angle_delta_cdf[mbmi->mode - V_PRED][0], mbmi->mode, bsize);
     const int has_chroma =
         dec_is_chroma_reference(mi_row, mi_col, bsize, color_cfg->subsampling_x,
             color_cfg->subsampling_y);
     xd->has_chroma = has_chroma;
     if (has_chroma) {
         mbmi->uv_mode =
-            read_intra_mode_uv(&parse_ctxt->frm_ctx[0], r, is_cfl_allowed(xd, color_cfg, lossless_array), mbmi->mode);
+            read_intra_mode_uv(&parse_ctx->frm_ctx[0], r, is_cfl_allowed(xd, color_cfg, lossless_array), mbmi->mode);
         if (mbmi->uv_mode == UV_CFL_PRED) {
             mbmi->cfl_alpha_idx =
-                read_cfl_alphas(&parse_ctxt->frm_ctx[0], r, &mbmi->cfl_alpha_signs);
+                read_cfl_alphas(&parse_ctx->frm_ctx[0], r, &mbmi->cfl_alpha_signs);
         }
         mbmi->angle_delta[PLANE_TYPE_UV] = intra_angle_info(r,
-            &parse_ctxt->frm_ctx[0].angle_delta_cdf[mbmi->uv_mode - V_PRED][0], dec_get_uv_mode(mbmi->uv_mode), bsize);
+            &parse_ctx->frm_ctx[0].angle_delta_cdf[mbmi->uv_mode - V_PRED][0], dec_get_uv_mode(mbmi->uv_mode), bsize);
     }
 
     if (allow_palette(dec_handle->seq_header.seq_force_screen_content_tools, bsize))
         palette_mode_info(/*dec_handle, mi_row, mi_col, r*/);
 
-    filter_intra_mode_info(dec_handle, xd, r);
+    filter_intra_mode_info(parse_ctx, xd, r);
 }
 
-int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
+int read_is_inter(ParseCtxt *parse_ctx, PartitionInfo_t * xd,
     int segment_id, SvtReader *r) {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     int is_inter = 0;
     if (xd->mi->skip_mode)
         is_inter = 1;
@@ -980,80 +968,83 @@ int read_is_inter(EbDecHandle* dec_handle, PartitionInfo_t * xd,
         is_inter = 1;
     else {
         const int ctx = get_intra_inter_context(xd);
-        is_inter = svt_read_symbol(r, parse_ctxt->frm_ctx[0].intra_inter_cdf[ctx], 2, ACCT_STR);
+        is_inter = svt_read_symbol(r, parse_ctx->frm_ctx[0].intra_inter_cdf[ctx], 2, ACCT_STR);
     }
     return is_inter;
 }
 
-void inter_frame_mode_info(EbDecHandle *dec_handle,
+void inter_frame_mode_info(ParseCtxt *parse_ctx,
     PartitionInfo_t * xd, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int8_t *cdef_strength) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = xd->mi;
     int inter_block = 1;
 
     mbmi->mv[0].as_int = 0;
     mbmi->mv[1].as_int = 0;
-    mbmi->segment_id = read_inter_segment_id(dec_handle, xd, mi_row, mi_col, 1, r);
+    mbmi->segment_id = read_inter_segment_id(parse_ctx, xd, mi_row, mi_col, 1, r);
 
-    mbmi->skip_mode = read_skip_mode(dec_handle, xd, mbmi->segment_id, r);
+    mbmi->skip_mode = read_skip_mode(parse_ctx, xd, mbmi->segment_id, r);
 
     if (mbmi->skip_mode)
         mbmi->skip = 1;
     else
-        mbmi->skip = read_skip(dec_handle, xd, mbmi->segment_id, r);
+        mbmi->skip = read_skip(parse_ctx, xd, mbmi->segment_id, r);
 
     if (!dec_handle->frame_header.segmentation_params.seg_id_pre_skip)
-        mbmi->segment_id = read_inter_segment_id(dec_handle, xd, mi_row, mi_col, 0, r);
+        mbmi->segment_id = read_inter_segment_id(parse_ctx, xd, mi_row, mi_col, 0, r);
 
-    read_cdef(dec_handle, r, xd, mi_col, mi_row, cdef_strength);
+    read_cdef(parse_ctx, r, xd, mi_col, mi_row, cdef_strength);
 
     /*TODO : Change to read_delta_params */
     assert(0);
 
     if (!mbmi->skip_mode)
-        inter_block = read_is_inter(dec_handle, xd, mbmi->segment_id, r);
+        inter_block = read_is_inter(parse_ctx, xd, mbmi->segment_id, r);
 
     if (inter_block);
         /*TO-DO fix for inter parse
         inter_block_mode_info(dec_handle, xd, mbmi, mi_row, mi_col, r);*/
     else
-        intra_block_mode_info(dec_handle, mi_row, mi_col, xd, mbmi, r);
+        intra_block_mode_info(parse_ctx, mi_row, mi_col, xd, mbmi, r);
 }
 
-void mode_info(EbDecHandle *decHandle, PartitionInfo_t *part_info, uint32_t mi_row,
+void mode_info(ParseCtxt *parse_ctx, PartitionInfo_t *part_info, uint32_t mi_row,
     uint32_t mi_col, SvtReader *r, int8_t *cdef_strength) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mi = part_info->mi;
     mi->use_intrabc = 0;
 
-    if (decHandle->frame_header.frame_type == KEY_FRAME || decHandle->frame_header.frame_type == INTRA_ONLY_FRAME)
-        intra_frame_mode_info(decHandle, part_info, mi_row, mi_col, r, cdef_strength);
+    if (dec_handle->frame_header.frame_type == KEY_FRAME || dec_handle->frame_header.frame_type == INTRA_ONLY_FRAME)
+        intra_frame_mode_info(parse_ctx, part_info, mi_row, mi_col, r, cdef_strength);
     else
         // TO-DO
-        inter_frame_mode_info(decHandle, part_info, mi_row, mi_col, r, cdef_strength);
+        inter_frame_mode_info(parse_ctx, part_info, mi_row, mi_col, r, cdef_strength);
 }
 
-TxSize read_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+TxSize read_tx_size(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
                     int allow_select, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = xd->mi;
     const TxMode tx_mode = dec_handle->frame_header.tx_mode;
     const BlockSize bsize = xd->mi->sb_type;
     if (dec_handle->frame_header.lossless_array[mbmi->segment_id]) return TX_4X4;
 
     if (bsize > BLOCK_4X4 && allow_select && tx_mode == TX_MODE_SELECT) {
-        const TxSize coded_tx_size = read_selected_tx_size(xd, r, dec_handle);
+        const TxSize coded_tx_size = read_selected_tx_size(xd, r, parse_ctx);
         return coded_tx_size;
     }
     assert(IMPLIES(tx_mode == ONLY_4X4, bsize == BLOCK_4X4));
     TxSize tx_size = max_txsize_rect_lookup[bsize];
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    update_tx_context(parse_ctxt, xd->mi_row, xd->mi_col, bsize, tx_size);
+    update_tx_context(parse_ctx, xd->mi_row, xd->mi_col, bsize, tx_size);
     return tx_size;
 }
 
-void read_var_tx_size(EbDecHandle *dec_handle, PartitionInfo_t *pi,
+void read_var_tx_size(ParseCtxt *parse_ctx, PartitionInfo_t *pi,
                                TxSize tx_size,
                                int blk_row, int blk_col) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = pi->mi;
     const BlockSize bsize = mbmi->sb_type;
     (void)dec_handle;
@@ -1078,10 +1069,10 @@ static INLINE TxSize av1_get_max_uv_txsize(BlockSize bsize, int subsampling_x,
 }
 
 /* Update Flat Transform Info for Intra Case! */
-void update_flat_trans_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info,
+void update_flat_trans_info(ParseCtxt *parse_ctx, PartitionInfo_t *part_info,
                             BlockSize bsize, TxSize tx_size)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = part_info->mi;
     SBInfo     *sb_info = part_info->sb_info;
     EbColorConfig color_config = dec_handle->seq_header.color_config;
@@ -1160,8 +1151,9 @@ void update_flat_trans_info(EbDecHandle *dec_handle, PartitionInfo_t *part_info,
     parse_ctx->first_chroma_tu_offset += 2 * num_chroma_tus;
 }
 
-void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *part_info,
+void read_block_tx_size(ParseCtxt *parse_ctx, SvtReader *r, PartitionInfo_t *part_info,
                            BlockSize bsize) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = part_info->mi;
 
     int inter_block_tx = dec_is_inter_block(mbmi);
@@ -1178,12 +1170,12 @@ void read_block_tx_size(EbDecHandle *dec_handle, SvtReader *r, PartitionInfo_t *
 
         for (int idy = 0; idy < height; idy += bh)
             for (int idx = 0; idx < width; idx += bw)
-                read_var_tx_size(dec_handle, part_info, max_tx_size, idx, idy);
+                read_var_tx_size(parse_ctx, part_info, max_tx_size, idx, idy);
     }
     else {
-        TxSize tx_size = read_tx_size(dec_handle, part_info, !mbmi->skip || !inter_block_tx, r);
+        TxSize tx_size = read_tx_size(parse_ctx, part_info, !mbmi->skip || !inter_block_tx, r);
         /* Update Flat Transform Info */
-        update_flat_trans_info(dec_handle, part_info, bsize, tx_size);
+        update_flat_trans_info(parse_ctx, part_info, bsize, tx_size);
     }
 }
 
@@ -1250,15 +1242,15 @@ TxSetType get_tx_set(TxSize tx_size, int is_inter,
     return get_ext_tx_set_type(tx_size, is_inter, use_reduced_set);
 }
 
-void parse_transform_type(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+void parse_transform_type(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
      TxSize tx_size, SvtReader *r, TransformInfo_t *trans_info) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = xd->mi;
 
     TxType *tx_type = &trans_info->txk_type;
     *tx_type = DCT_DCT;
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
 
     // No need to read transform type if block is skipped.
     if (mbmi->skip || seg_feature_active(&dec_handle->frame_header.segmentation_params, mbmi->segment_id, SEG_LVL_SKIP))
@@ -1382,10 +1374,10 @@ static INLINE int is_any_masked_compound_used(BlockSize sb_type) {
     return 0;
 }
 
-void read_interintra_mode(EbDecHandle *dec_handle, ModeInfo_t *mbmi,
+void read_interintra_mode(ParseCtxt *parse_ctx, ModeInfo_t *mbmi,
     SvtReader *r, int size_group) {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
     BlockSize bsize = mbmi->sb_type;
     if (dec_handle->seq_header.enable_interintra_compound && !mbmi->skip_mode &&
         is_interintra_allowed(mbmi)) {
@@ -1436,13 +1428,13 @@ static INLINE int get_comp_group_idx_context(const PartitionInfo_t *xd) {
     return AOMMIN(5, above_ctx + left_ctx);
 }
 
-void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *xd, ModeInfo_t *mbmi,
+void read_compound_type(ParseCtxt *parse_ctx, PartitionInfo_t *xd, ModeInfo_t *mbmi,
     SvtReader *r) {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     BlockSize bsize = mbmi->sb_type;
     mbmi->inter_compound.comp_group_idx = 0;
     mbmi->inter_compound.compound_idx = 1;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
 
     if(mbmi->skip_mode) mbmi->inter_compound.type = COMPOUND_AVERAGE;
 
@@ -1508,10 +1500,9 @@ void read_compound_type(EbDecHandle *dec_handle, PartitionInfo_t *xd, ModeInfo_t
     }
 }
 
-MotionMode read_motion_mode(EbDecHandle *dec_handle,
+MotionMode read_motion_mode(ParseCtxt *parse_ctx,
     ModeInfo_t *mbmi, SvtReader *r) {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
 
     //if (dec_handle->switchable_motion_mode == 0) return SIMPLE_TRANSLATION;
     if (mbmi->skip_mode) return SIMPLE_TRANSLATION;
@@ -1566,16 +1557,16 @@ static INLINE int is_mv_valid(const MV *mv) {
         mv->col < MV_UPP;
 }
 
-int assign_mv(EbDecHandle *dec_handle, PartitionInfo_t *xd,
+int assign_mv(ParseCtxt *parse_ctx, PartitionInfo_t *xd,
     MvReferenceFrame ref_frame[2], IntMv mv[2],
     IntMv ref_mv[2], IntMv nearest_mv[2],
     IntMv near_mv[2], int mi_row, int mi_col,
     int is_compound, int allow_hp, SvtReader *r)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     ModeInfo_t *mbmi = xd->mi;
     BlockSize bsize = mbmi->sb_type;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
     if (dec_handle->frame_header.force_integer_mv)
         allow_hp = MV_SUBPEL_NONE;
     PredictionMode mode;
@@ -1692,20 +1683,20 @@ static AOM_FORCE_INLINE int get_br_ctx_eob(const int c,  // raster order
     return 14;
 }
 
-void update_coeff_ctx(EbDecHandle *dec_handle, int plane, PartitionInfo_t *pi, TxSize tx_size,
+void update_coeff_ctx(ParseCtxt *parse_ctx, int plane, PartitionInfo_t *pi, TxSize tx_size,
     uint32_t blk_row, uint32_t blk_col, int above_off, int left_off, int cul_level, int dc_val)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctxt->parse_nbr4x4_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    ParseNbr4x4Ctxt *ngr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
 
     uint8_t suby = plane ? dec_handle->seq_header.color_config.subsampling_y : 0;
     uint8_t subx = plane ? dec_handle->seq_header.color_config.subsampling_x : 0;
 
     uint8_t *const above_dc_ctx = ngr_ctx->above_dc_ctx[plane] + blk_col;
-    uint8_t *const left_dc_ctx = ngr_ctx->left_dc_ctx[plane] + (blk_row - (parse_ctxt->sb_row_mi >> suby));
+    uint8_t *const left_dc_ctx = ngr_ctx->left_dc_ctx[plane] + (blk_row - (parse_ctx->sb_row_mi >> suby));
 
     uint8_t *const above_level_ctx = ngr_ctx->above_level_ctx[plane] + blk_col;
-    uint8_t *const left_level_ctx = ngr_ctx->left_level_ctx[plane] + (blk_row - (parse_ctxt->sb_row_mi >> suby));
+    uint8_t *const left_level_ctx = ngr_ctx->left_level_ctx[plane] + (blk_row - (parse_ctx->sb_row_mi >> suby));
 
     const int txs_wide = tx_size_wide_unit[tx_size];
     const int txs_high = tx_size_high_unit[tx_size];
@@ -1893,16 +1884,16 @@ static INLINE void read_coeffs_reverse(SvtReader *r, TxSize tx_size,
     }
 }
 
-uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r,
+uint16_t parse_coeffs(ParseCtxt *parse_ctx, PartitionInfo_t *xd, SvtReader *r,
     uint32_t blk_row, uint32_t blk_col, int above_off, int left_off, int plane,
     int txb_skip_ctx, int dc_sign_ctx,
     TxSize tx_size, int32_t *coeff_buf, TransformInfo_t *trans_info)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     const int width = get_txb_wide(tx_size);
     const int height = get_txb_high(tx_size);
 
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
-    FRAME_CONTEXT *frm_ctx = &parse_ctxt->frm_ctx[0];
+    FRAME_CONTEXT *frm_ctx = &parse_ctx->frm_ctx[0];
 
     TxSize txs_ctx = (TxSize)((txsize_sqr_map[tx_size] + txsize_sqr_up_map[tx_size] + 1) >> 1);
     PlaneType plane_type = (plane == 0) ? PLANE_TYPE_Y : PLANE_TYPE_UV;
@@ -1925,14 +1916,14 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
             trans_info->cbf      = 0;
         }
 
-        update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+        update_coeff_ctx(parse_ctx, plane, xd, tx_size, blk_row, blk_col,
             above_off, left_off, cul_level, dc_val);
 
         return 0;
     }
 
     if (plane == AOM_PLANE_Y)
-        parse_transform_type(dec_handle, xd, tx_size, r, trans_info);
+        parse_transform_type(parse_ctx, xd, tx_size, r, trans_info);
 
     uint8_t     *lossless_array = &dec_handle->frame_header.lossless_array[0];
     trans_info->txk_type = compute_tx_type(plane_type, xd, blk_row, blk_col,
@@ -2075,7 +2066,7 @@ uint16_t parse_coeffs(EbDecHandle *dec_handle, PartitionInfo_t *xd, SvtReader *r
 
     cul_level = AOMMIN(COEFF_CONTEXT_MASK, cul_level);
 
-    update_coeff_ctx(dec_handle, plane, xd, tx_size, blk_row, blk_col,
+    update_coeff_ctx(parse_ctx, plane, xd, tx_size, blk_row, blk_col,
         above_off, left_off, cul_level, dc_val);
 
     trans_info->cbf = 1; assert(eob);
@@ -2142,11 +2133,12 @@ int get_reference_mode_context(const PartitionInfo_t *xd) {
     return ctx;
 }
 
-void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const xd,
+void read_ref_frames(ParseCtxt *parse_ctx, PartitionInfo_t *const xd,
     SvtReader *r, int segment_id, MvReferenceFrame ref_frame[2])
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     (void)r;
-    //ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    //ParseCtxt *parse_ctx = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     if (xd->mi->skip_mode)
         return;
@@ -2170,14 +2162,14 @@ void read_ref_frames(EbDecHandle *dec_handle, PartitionInfo_t *const xd,
         {
             const int ctx = get_reference_mode_context(xd);
             const ReferenceMode mode = (ReferenceMode)svt_read_symbol(
-                r, parse_ctxt->frm_ctx[0].comp_inter_cdf[ctx], 2, ACCT_STR);
+                r, parse_ctx->frm_ctx[0].comp_inter_cdf[ctx], 2, ACCT_STR);
         }*/
 
         //if (mode == COMPOUND_REFERENCE) {
         //    const int ctx = get_comp_reference_type_context(xd);
         //    const COMP_REFERENCE_TYPE comp_ref_type =
         //        (COMP_REFERENCE_TYPE)svt_read_symbol(
-        //            r, &parse_ctxt->frm_ctx[0].comp_ref_type_cdf[ctx], 2, ACCT_STR);
+        //            r, &parse_ctx->frm_ctx[0].comp_ref_type_cdf[ctx], 2, ACCT_STR);
 
         //    if (comp_ref_type == UNIDIR_COMP_REFERENCE) {
         //        const int bit = READ_REF_BIT(uni_comp_ref_p);
@@ -2315,25 +2307,24 @@ void partition_gather_vert_alike(AomCdfProb *out,
 }
 
 PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader *reader,
-    BlockSize bsize, int has_rows, int has_cols, EbDecHandle *dec_handle)
+    BlockSize bsize, int has_rows, int has_cols, ParseCtxt *parse_ctx)
 {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     int partition_cdf_length = bsize <= BLOCK_8X8 ? PARTITION_TYPES :
         (bsize == BLOCK_128X128 ? EXT_PARTITION_TYPES - 2 : EXT_PARTITION_TYPES);
-    int ctx = partition_plane_context(blk_row, blk_col, bsize, parse_ctxt);
+    int ctx = partition_plane_context(blk_row, blk_col, bsize, parse_ctx);
 
     if (bsize < BLOCK_8X8) return PARTITION_NONE;
     else if (has_rows && has_cols)
     {
         return (PartitionType)svt_read_symbol(
-            reader, parse_ctxt->frm_ctx[0].partition_cdf[ctx], partition_cdf_length, ACCT_STR);
+            reader, parse_ctx->frm_ctx[0].partition_cdf[ctx], partition_cdf_length, ACCT_STR);
     }
     else if (has_cols)
     {
         assert(bsize > BLOCK_8X8);
         AomCdfProb cdf[2];
-        partition_gather_vert_alike(cdf, parse_ctxt->frm_ctx[0].partition_cdf[ctx], bsize);
+        partition_gather_vert_alike(cdf, parse_ctx->frm_ctx[0].partition_cdf[ctx], bsize);
         assert(cdf[1] == AOM_ICDF(CDF_PROB_TOP));
         return svt_read_cdf(reader, cdf, 2, ACCT_STR) ? PARTITION_SPLIT : PARTITION_HORZ;
     }
@@ -2342,7 +2333,7 @@ PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader
         assert(has_rows && !has_cols);
         assert(bsize > BLOCK_8X8);
         AomCdfProb cdf[2];
-        partition_gather_horz_alike(cdf, parse_ctxt->frm_ctx[0].partition_cdf[ctx], bsize);
+        partition_gather_horz_alike(cdf, parse_ctx->frm_ctx[0].partition_cdf[ctx], bsize);
         assert(cdf[1] == AOM_ICDF(CDF_PROB_TOP));
         return svt_read_cdf(reader, cdf, 2, ACCT_STR) ? PARTITION_SPLIT : PARTITION_VERT;
     }
@@ -2351,11 +2342,11 @@ PartitionType parse_partition_type(uint32_t blk_row, uint32_t blk_col, SvtReader
 
 static INLINE void dec_get_txb_ctx(int plane_bsize, const TxSize tx_size, const int plane,
                                int blk_row, int blk_col,
-                               EbDecHandle *dec_handle, TXB_CTX *const txb_ctx)
+                               ParseCtxt *parse_ctx, TXB_CTX *const txb_ctx)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 #define MAX_TX_SIZE_UNIT 16
 
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
     ParseNbr4x4Ctxt *nbr_ctx = &parse_ctx->parse_nbr4x4_ctxt;
     EbColorConfig *clr_cfg = &dec_handle->seq_header.color_config;
     int txb_w_unit = tx_size_wide_unit[tx_size];
@@ -2446,12 +2437,13 @@ static INLINE void dec_get_txb_ctx(int plane_bsize, const TxSize tx_size, const
 #undef MAX_TX_SIZE_UNIT
 }
 
-uint16_t parse_transform_block(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+uint16_t parse_transform_block(ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
                               int32_t *coeff, TransformInfo_t *trans_info, int plane,
                               int blk_col, int blk_row, int mi_row, int mi_col,
                               TxSize tx_size, int is_inter, int skip)
 {
-    // ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
+    // ParseCtxt *parse_ctx = (ParseCtxt *)dec_handle->pv_parse_ctxt;
     (void)is_inter;
     uint16_t eob = 0 , sub_x, sub_y;
     BlockSize bsize = pi->mi->sb_type;
@@ -2472,13 +2464,13 @@ uint16_t parse_transform_block(EbDecHandle *dec_handle, PartitionInfo_t *pi, Svt
         TXB_CTX txb_ctx;
         dec_get_txb_ctx(plane_bsize, tx_size, plane,
                     start_y, start_x,
-                    dec_handle, &txb_ctx);
+                    parse_ctx, &txb_ctx);
 
-        eob = parse_coeffs(dec_handle, pi, r, start_y, start_x, blk_col, blk_row,
+        eob = parse_coeffs(parse_ctx, pi, r, start_y, start_x, blk_col, blk_row,
             plane, txb_ctx.txb_skip_ctx, txb_ctx.dc_sign_ctx, tx_size, coeff, trans_info);
     }
     else{
-        update_coeff_ctx(dec_handle, plane, pi, tx_size,
+        update_coeff_ctx(parse_ctx, plane, pi, tx_size,
             start_y, start_x, blk_col, blk_row, 0, 0);
     }
     return eob;
@@ -2497,10 +2489,10 @@ static INLINE TxSize av1_get_tx_size(int plane, PartitionInfo_t *pi, int sub_x,
     return av1_get_max_uv_txsize(mbmi->sb_type, sub_x, sub_y);
 }
 
-void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
+void parse_residual(ParseCtxt *parse_ctx, PartitionInfo_t *pi, SvtReader *r,
                     int mi_row, int mi_col, BlockSize mi_size)
 {
-    ParseCtxt   *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     TxSize      tx_size;
     EbColorConfig *color_info = &dec_handle->seq_header.color_config;
     int num_planes = color_info->mono_chrome ? 1 : MAX_MB_PLANE;
@@ -2562,7 +2554,7 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
                             cur_coeff[1] = cur_loc;
                             }
 #endif
-                            int32_t eob = parse_transform_block(dec_handle, pi, r, coeff,
+                            int32_t eob = parse_transform_block(parse_ctx, pi, r, coeff,
                                 trans_info, plane,
                                 blk_col, blk_row, mi_row, mi_col,
                                 tx_size, is_inter, skip);
@@ -2590,13 +2582,13 @@ void parse_residual(EbDecHandle *dec_handle, PartitionInfo_t *pi, SvtReader *r,
     }//intra
 }
 
-void parse_block(EbDecHandle *dec_handle,
+void parse_block(ParseCtxt *parse_ctx,
     uint32_t mi_row, uint32_t mi_col, SvtReader *r,
     BlockSize subsize, TileInfo *tile,
     SBInfo *sb_info,
     PartitionType partition)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 
     ModeInfo_t *mode = parse_ctx->cur_mode_info;
 
@@ -2654,15 +2646,15 @@ void parse_block(EbDecHandle *dec_handle,
     }
 
     if (part_info.up_available)
-        part_info.above_mbmi = get_top_mode_info(dec_handle, mi_row, mi_col, sb_info);
+        part_info.above_mbmi = get_top_mode_info(parse_ctx, mi_row, mi_col, sb_info);
     else
         part_info.above_mbmi = NULL;
     if (part_info.left_available)
-        part_info.left_mbmi = get_left_mode_info(dec_handle, mi_row, mi_col, sb_info);
+        part_info.left_mbmi = get_left_mode_info(parse_ctx, mi_row, mi_col, sb_info);
     else
         part_info.left_mbmi = NULL;
     mode->sb_type = subsize;
-    mode_info(dec_handle, &part_info, mi_row, mi_col, r, cdef_strength);
+    mode_info(parse_ctx, &part_info, mi_row, mi_col, r, cdef_strength);
 
     /* Replicating same chroma mode for block pairs or 4x4 blks when chroma is present in last block*/
     if(0 == parse_ctx->prev_blk_has_chroma)
@@ -2697,12 +2689,12 @@ void parse_block(EbDecHandle *dec_handle,
             palette_tokens(plane);
     }
 
-    read_block_tx_size(dec_handle, r, &part_info, subsize);
+    read_block_tx_size(parse_ctx, r, &part_info, subsize);
 
-    parse_residual(dec_handle, &part_info, r, mi_row, mi_col, subsize);
+    parse_residual(parse_ctx, &part_info, r, mi_row, mi_col, subsize);
 
     /* Update block level MI map */
-    update_block_nbrs(dec_handle, mi_row, mi_col, subsize);
+    update_block_nbrs(parse_ctx, mi_row, mi_col, subsize);
     parse_ctx->cur_mode_info_cnt++;
     parse_ctx->cur_mode_info++;
 }
@@ -2758,10 +2750,10 @@ static INLINE void update_ext_partition_context(ParseCtxt *parse_ctx, int mi_row
     }
 }
 
-void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row,
+void parse_partition(ParseCtxt *parse_ctx, uint32_t blk_row,
     uint32_t blk_col, SvtReader *reader, BlockSize bsize, SBInfo *sb_info)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
 
     if (blk_row >= dec_handle->frame_header.mi_rows ||
         blk_col >= dec_handle->frame_header.mi_cols)
@@ -2777,16 +2769,16 @@ void parse_partition(EbDecHandle *dec_handle, uint32_t blk_row,
     PartitionType partition;
 
     partition = (bsize < BLOCK_8X8) ? PARTITION_NONE
-        : parse_partition_type(blk_row, blk_col, reader, bsize, has_rows, has_cols, dec_handle);
+        : parse_partition_type(blk_row, blk_col, reader, bsize, has_rows, has_cols, parse_ctx);
     int subSize = Partition_Subsize[(int)partition][bsize];
     int splitSize = Partition_Subsize[PARTITION_SPLIT][bsize];
 
 #define PARSE_BLOCK(db_r, db_c, db_subsize)                 \
-parse_block(dec_handle, db_r, db_c, reader, db_subsize,     \
+parse_block(parse_ctx, db_r, db_c, reader, db_subsize,     \
     &parse_ctx->cur_tile_info, sb_info, partition);
 
 #define PARSE_PARTITION(db_r, db_c, db_subsize)                 \
-  parse_partition(dec_handle, (db_r), (db_c), reader,           \
+  parse_partition(parse_ctx, (db_r), (db_c), reader,           \
                    (db_subsize), sb_info)
 
     switch ((int)partition) {
@@ -2844,12 +2836,12 @@ parse_block(dec_handle, db_r, db_c, reader, db_subsize,     \
     update_ext_partition_context(parse_ctx, blk_row, blk_col, subSize, bsize, partition);
 }
 
-void parse_super_block(EbDecHandle *dec_handle,
+void parse_super_block(ParseCtxt *parse_ctx,
     uint32_t blk_row, uint32_t blk_col, SBInfo *sbInfo)
 {
-    ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle->pv_parse_ctxt;
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     SvtReader *reader = &parse_ctx->r;
 
-    parse_partition(dec_handle, blk_row, blk_col, reader,
+    parse_partition(parse_ctx, blk_row, blk_col, reader,
         dec_handle->seq_header.sb_size, sbInfo);
 }
@@ -15,3 +15,329 @@
 
 #include "EbSvtAv1Dec.h"
 #include "EbDecHandle.h"
+#include "EbThreads.h"
+
+#include "EbObuParse.h"
+#include "EbDecProcessFrame.h"
+#include "EbDecParseFrame.h"
+#include "EbDecLF.h"
+#include "EbDecCdef.h"
+
+/* An SB is decoded once the SB row above is WF_SB_LAG SBs ahead of it,
+   which covers the above right SB used by intra prediction */
+#define WF_SB_LAG   2
+
+/* Sets up parse_ctxt for the tile of tile_job */
+static EbErrorType init_tile_job(EbDecHandle *dec_handle_ptr,
+                                 ParseCtxt *parse_ctxt, DecTileJob *tile_job)
+{
+    EbErrorType status;
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+
+    svt_tile_init(&parse_ctxt->cur_tile_info, frame_header,
+                  tile_job->tile_row, tile_job->tile_col);
+
+    status = init_svt_reader(&parse_ctxt->r, tile_job->data, tile_job->data_end,
+        tile_job->tile_size, !(frame_header->disable_cdf_update));
+    if (status != EB_ErrorNone)
+        return status;
+
+    reset_parse_ctx(&parse_ctxt->frm_ctx[0],
+        frame_header->quantization_params.base_q_idx);
+
+    return EB_ErrorNone;
+}
+
+/* Parses and decodes one tile with the contexts of thread thread_idx */
+static EbErrorType decode_tile(EbDecHandle *dec_handle_ptr, uint32_t thread_idx,
+                               DecTileJob *tile_job)
+{
+    EbErrorType status;
+    ParseCtxt   *parse_ctxt   = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt +
+                                thread_idx;
+    DecModCtxt  *dec_mod_ctxt = (DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt +
+                                thread_idx;
+
+    status = init_tile_job(dec_handle_ptr, parse_ctxt, tile_job);
+    if (status != EB_ErrorNone)
+        return status;
+
+    return parse_tile(parse_ctxt, dec_mod_ctxt,
+                      &dec_handle_ptr->frame_header.tiles_info,
+                      tile_job->tile_row, tile_job->tile_col);
+}
+
+/* Takes tiles of the current tile group until there are none left */
+static void run_tile_jobs(EbDecHandle *dec_handle_ptr, uint32_t thread_idx)
+{
+    DecTileJob  *tile_jobs = (DecTileJob *)dec_handle_ptr->pv_tile_jobs;
+    uint32_t    job_idx;
+
+    while ((job_idx = eb_atomic_fetch_add_u32(&dec_handle_ptr->next_tile_job, 1)) <
+           dec_handle_ptr->num_tile_jobs)
+    {
+        tile_jobs[job_idx].status = decode_tile(dec_handle_ptr, thread_idx,
+                                                &tile_jobs[job_idx]);
+    }
+}
+
+/* Waits until *progress reaches target. Returns EB_FALSE if the wavefront
+   was aborted meanwhile. */
+static EbBool wait_sb_progress(EbDecHandle *dec_handle_ptr,
+                               volatile uint32_t *progress, uint32_t target)
+{
+    return eb_wait_cond_var(dec_handle_ptr->wf_cond_var, progress, target,
+                            &dec_handle_ptr->wf_abort);
+}
+
+/* Takes SB rows of the wavefront tile until there are none left. Rows are
+   handed out in order, so the row above is always being decoded. */
+static void run_sb_row_jobs(EbDecHandle *dec_handle_ptr, uint32_t thread_idx)
+{
+    DecModCtxt  *dec_mod_ctxt = (DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt +
+                                thread_idx;
+    TileInfo    *tile_info = dec_handle_ptr->wf_tile_info;
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    int32_t     sb_mi_log2 = seq_header->sb_size_log2 - MI_SIZE_LOG2;
+    uint32_t    sb_row_end = (tile_info->mi_row_end + seq_header->sb_mi_size - 1)
+                             >> sb_mi_log2;
+    uint32_t    sb_col_end = (tile_info->mi_col_end + seq_header->sb_mi_size - 1)
+                             >> sb_mi_log2;
+    uint32_t    sb_row;
+
+    while ((sb_row = eb_atomic_fetch_add_u32(&dec_handle_ptr->next_sb_row, 1)) <
+           sb_row_end)
+    {
+        uint32_t mi_row = sb_row << sb_mi_log2;
+
+        cfl_init(&dec_mod_ctxt->cfl_ctx, &seq_header->color_config);
+
+        for (int32_t mi_col = tile_info->mi_col_start;
+             mi_col < tile_info->mi_col_end; mi_col += seq_header->sb_mi_size)
+        {
+            uint32_t sb_col = mi_col >> sb_mi_log2;
+
+            if (!wait_sb_progress(dec_handle_ptr,
+                    &dec_handle_ptr->sb_row_parsed[sb_row], sb_col + 1))
+                return;
+            if ((int32_t)mi_row != tile_info->mi_row_start &&
+                !wait_sb_progress(dec_handle_ptr,
+                    &dec_handle_ptr->sb_row_decoded[sb_row - 1],
+                    AOMMIN(sb_col + WF_SB_LAG, sb_col_end)))
+                return;
+
+            decode_tile_sb(dec_mod_ctxt, tile_info, mi_row, mi_col);
+
+            eb_atomic_store_u32(&dec_handle_ptr->sb_row_decoded[sb_row],
+                                sb_col + 1);
+            eb_signal_cond_var(dec_handle_ptr->wf_cond_var);
+            post_filter_sb_done(dec_handle_ptr, sb_row);
+        }
+    }
+}
+
+/* Parses the tile of tile_job on the calling thread while all the threads
+   decode its SB rows behind the parse */
+static EbErrorType decode_tile_wavefront(EbDecHandle *dec_handle_ptr,
+                                         DecTileJob *tile_job)
+{
+    EbErrorType status;
+    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    TileInfo    *tile_info = &parse_ctxt->cur_tile_info;
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    int32_t     sb_mi_log2 = seq_header->sb_size_log2 - MI_SIZE_LOG2;
+    uint32_t    num_helpers;
+    uint32_t    sb_row, sb_row_start, sb_row_end;
+    uint32_t    i;
+
+    status = init_tile_job(dec_handle_ptr, parse_ctxt, tile_job);
+    if (status != EB_ErrorNone)
+        return status;
+
+    sb_row_start = tile_info->mi_row_start >> sb_mi_log2;
+    sb_row_end = (tile_info->mi_row_end + seq_header->sb_mi_size - 1) >>
+                 sb_mi_log2;
+    for (sb_row = sb_row_start; sb_row < sb_row_end; sb_row++) {
+        dec_handle_ptr->sb_row_parsed[sb_row] = 0;
+        dec_handle_ptr->sb_row_decoded[sb_row] = 0;
+    }
+    dec_handle_ptr->next_sb_row = sb_row_start;
+    dec_handle_ptr->wf_abort = 0;
+    dec_handle_ptr->wf_tile_info = tile_info;
+
+    /* The calling thread takes SB rows once the tile is parsed */
+    num_helpers = AOMMIN(dec_handle_ptr->num_threads - 1,
+                         sb_row_end - sb_row_start);
+    for (i = 0; i < num_helpers; i++)
+        eb_post_semaphore(dec_handle_ptr->tile_start_semaphore);
+
+    status = parse_tile(parse_ctxt, NULL, &dec_handle_ptr->frame_header.tiles_info,
+                        tile_job->tile_row, tile_job->tile_col);
+    if (status != EB_ErrorNone) {
+        eb_atomic_store_u32(&dec_handle_ptr->wf_abort, 1);
+        eb_signal_cond_var(dec_handle_ptr->wf_cond_var);
+    }
+
+    run_sb_row_jobs(dec_handle_ptr, 0);
+
+    for (i = 0; i < num_helpers; i++)
+        eb_block_on_semaphore(dec_handle_ptr->tile_done_semaphore);
+
+    dec_handle_ptr->wf_tile_info = NULL;
+
+    return status;
+}
+
+/************************************************
+ * Tile Decode Kernel
+ ************************************************/
+void *dec_tile_thread_kernel(void *input_ptr)
+{
+    DecTileThreadCtxt *thread_ctxt = (DecTileThreadCtxt *)input_ptr;
+    EbDecHandle *dec_handle_ptr = thread_ctxt->dec_handle_ptr;
+
+    for (;;) {
+        eb_block_on_semaphore(dec_handle_ptr->tile_start_semaphore);
+
+        if (dec_handle_ptr->wf_tile_info != NULL)
+            run_sb_row_jobs(dec_handle_ptr, thread_ctxt->thread_idx);
+        else
+            run_tile_jobs(dec_handle_ptr, thread_ctxt->thread_idx);
+
+        eb_post_semaphore(dec_handle_ptr->tile_done_semaphore);
+    }
+    return EB_NULL;
+}
+
+EbErrorType decode_tile_jobs(EbDecHandle *dec_handle_ptr)
+{
+    DecTileJob  *tile_jobs = (DecTileJob *)dec_handle_ptr->pv_tile_jobs;
+    uint32_t    num_tile_jobs = dec_handle_ptr->num_tile_jobs;
+    /* The calling thread takes tiles too, only wake the threads needed */
+    uint32_t    num_helpers = AOMMIN(dec_handle_ptr->num_threads,
+                                     num_tile_jobs) - 1;
+    uint32_t    i;
+
+    /* Too few tiles to keep the threads busy, split parse and decode of
+       each tile instead */
+    if (num_tile_jobs < dec_handle_ptr->num_threads) {
+        for (i = 0; i < num_tile_jobs; i++) {
+            EbErrorType status = decode_tile_wavefront(dec_handle_ptr,
+                                                       &tile_jobs[i]);
+            if (status != EB_ErrorNone)
+                return status;
+        }
+        return EB_ErrorNone;
+    }
+
+    eb_atomic_store_u32(&dec_handle_ptr->next_tile_job, 0);
+
+    for (i = 0; i < num_helpers; i++)
+        eb_post_semaphore(dec_handle_ptr->tile_start_semaphore);
+
+    run_tile_jobs(dec_handle_ptr, 0);
+
+    for (i = 0; i < num_helpers; i++)
+        eb_block_on_semaphore(dec_handle_ptr->tile_done_semaphore);
+
+    /* Same error as the serial tile loop would stop at */
+    for (i = 0; i < num_tile_jobs; i++) {
+        if (tile_jobs[i].status != EB_ErrorNone)
+            return tile_jobs[i].status;
+    }
+    return EB_ErrorNone;
+}
+
+/* Runs the next post filter row the reconstruction allows. Returns EB_FALSE
+   if there is none. Only called by the pf_busy holder. */
+static EbBool post_filter_step(EbDecHandle *dec_handle_ptr)
+{
+    FrameHeader *frame_info = &dec_handle_ptr->frame_header;
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    int32_t     sb_mi_log2 = seq_header->sb_size_log2 - MI_SIZE_LOG2;
+    uint32_t    sb_rows = (frame_info->mi_rows + seq_header->sb_mi_size - 1) >>
+                          sb_mi_log2;
+    uint32_t    sb_cols = (frame_info->mi_cols + seq_header->sb_mi_size - 1) >>
+                          sb_mi_log2;
+    uint32_t    nvfb = (frame_info->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    uint32_t    lf_sb_row = dec_handle_ptr->lf_sb_row;
+    uint32_t    cdef_fb_row = dec_handle_ptr->cdef_fb_row;
+
+    /* Intra prediction of SB row r + 1 reads the unfiltered bottom of row r,
+       so row r is deblocked once row r + 1 is reconstructed */
+    if (lf_sb_row < sb_rows &&
+        eb_atomic_load_u32(&dec_handle_ptr->sb_row_recon[lf_sb_row]) == sb_cols &&
+        (lf_sb_row + 1 == sb_rows ||
+         eb_atomic_load_u32(&dec_handle_ptr->sb_row_recon[lf_sb_row + 1]) == sb_cols))
+    {
+        dec_lf_sb_row(dec_handle_ptr, lf_sb_row);
+        dec_handle_ptr->lf_sb_row = lf_sb_row + 1;
+        return EB_TRUE;
+    }
+
+    /* CDEF of a 64x64 row reads the top lines of the next one, which the
+       deblocking of the SB row holding them changes */
+    if (cdef_fb_row < nvfb && (lf_sb_row == sb_rows ||
+        (lf_sb_row << seq_header->sb_size_log2) >= (cdef_fb_row + 2) * 64))
+    {
+        dec_cdef_fb_row(dec_handle_ptr, cdef_fb_row);
+        dec_handle_ptr->cdef_fb_row = cdef_fb_row + 1;
+        return EB_TRUE;
+    }
+    return EB_FALSE;
+}
+
+void post_filter_frame_init(EbDecHandle *dec_handle_ptr)
+{
+    FrameHeader *frame_info = &dec_handle_ptr->frame_header;
+    SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
+    CDEFParams  *cdef_params = &frame_info->CDEF_params;
+    int32_t     sb_mi_log2 = seq_header->sb_size_log2 - MI_SIZE_LOG2;
+    uint32_t    sb_rows = (frame_info->mi_rows + seq_header->sb_mi_size - 1) >>
+                          sb_mi_log2;
+    uint32_t    nvfb = (frame_info->mi_rows + MI_SIZE_64X64 - 1) / MI_SIZE_64X64;
+    /* Chroma is not filtered either when luma is off */
+    int32_t     lf_enabled = frame_info->loop_filter_params.loop_filter_level[0] ||
+                             frame_info->loop_filter_params.loop_filter_level[1];
+    int32_t     cdef_enabled = cdef_params->cdef_bits ||
+                               cdef_params->cdef_y_strength[0] ||
+                               cdef_params->cdef_uv_strength[0];
+
+    for (uint32_t sb_row = 0; sb_row < sb_rows; sb_row++)
+        dec_handle_ptr->sb_row_recon[sb_row] = 0;
+
+    /* A disabled filter starts out done. CDEF still follows the deblocking
+       row by row as that tracks the reconstruction. */
+    dec_handle_ptr->lf_sb_row = (lf_enabled || cdef_enabled) ? 0 : sb_rows;
+    dec_handle_ptr->cdef_fb_row = cdef_enabled ? 0 : nvfb;
+    dec_handle_ptr->pf_busy = 0;
+
+    if (lf_enabled)
+        dec_lf_frame_init(dec_handle_ptr);
+    if (cdef_enabled)
+        dec_cdef_frame_init(dec_handle_ptr);
+}
+
+void post_filter_sb_done(EbDecHandle *dec_handle_ptr, uint32_t sb_row)
+{
+    eb_atomic_fetch_add_u32(&dec_handle_ptr->sb_row_recon[sb_row], 1);
+
+    /* A row this SB unblocks while another thread holds pf_busy may be
+       missed by it, the next SB done or post_filter_frame_end runs it */
+    while (eb_atomic_cas_u32(&dec_handle_ptr->pf_busy, 0, 1)) {
+        EbBool ran = EB_FALSE;
+
+        while (post_filter_step(dec_handle_ptr))
+            ran = EB_TRUE;
+        eb_atomic_store_u32(&dec_handle_ptr->pf_busy, 0);
+        if (!ran)
+            break;
+    }
+}
+
+void post_filter_frame_end(EbDecHandle *dec_handle_ptr)
+{
+    /* All the SBs are reconstructed and no thread holds pf_busy */
+    while (post_filter_step(dec_handle_ptr))
+        ;
+}
@@ -0,0 +1,53 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDecParseFrame_h
+#define EbDecParseFrame_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One tile of the current tile group */
+typedef struct DecTileJob {
+    int32_t         tile_row;
+    int32_t         tile_col;
+
+    /* Tile data, data_end bounds the read as in init_svt_reader */
+    const uint8_t   *data;
+    const uint8_t   *data_end;
+    size_t          tile_size;
+
+    EbErrorType     status;
+} DecTileJob;
+
+/* Tile decode thread context */
+typedef struct DecTileThreadCtxt {
+    EbDecHandle *dec_handle_ptr;
+
+    /* Index of the ParseCtxt / DecModCtxt used by this thread */
+    uint32_t    thread_idx;
+} DecTileThreadCtxt;
+
+void *dec_tile_thread_kernel(void *input_ptr);
+
+/* Parses and decodes the num_tile_jobs tiles of pv_tile_jobs on all the
+   tile decode threads. Returns the first error in tile order. */
+EbErrorType decode_tile_jobs(EbDecHandle *dec_handle_ptr);
+
+/* Post filters of the frame : deblocking and CDEF run in SB rows behind the
+   reconstruction, on whichever thread completes the SB that unblocks a row.
+   post_filter_frame_init is called before the first tile group of the
+   frame, post_filter_sb_done after each SB is reconstructed and
+   post_filter_frame_end, which filters the remaining rows, once all the
+   tiles are. */
+void post_filter_frame_init(EbDecHandle *dec_handle_ptr);
+void post_filter_sb_done(EbDecHandle *dec_handle_ptr, uint32_t sb_row);
+void post_filter_frame_end(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+    }
+#endif
+#endif // EbDecParseFrame_h
@@ -47,15 +47,15 @@ int neg_deinterleave(const int diff, int ref, int max) {
     }
 }
 
-void set_segment_id(EbDecHandle *dec_handle, int mi_offset, int x_mis, int y_mis, int segment_id)
+void set_segment_id(ParseCtxt *parse_ctx, int mi_offset, int x_mis, int y_mis, int segment_id)
 {
+    EbDecHandle *dec_handle = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     assert(segment_id >= 0 && segment_id < MAX_SEGMENTS);
     FrameHeader *frm_header = &dec_handle->frame_header;
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
 
     for (int y = 0; y < y_mis; y++)
         for (int x = 0; x < x_mis; x++)
-            parse_ctxt->parse_nbr4x4_ctxt.segment_maps[mi_offset + y * frm_header->mi_cols + x] = segment_id;
+            parse_ctx->parse_nbr4x4_ctxt.segment_maps[mi_offset + y * frm_header->mi_cols + x] = segment_id;
 }
 
 int bsize_to_max_depth(BlockSize bsize) {
@@ -133,18 +133,17 @@ void update_tx_context(ParseCtxt *parse_ctxt,
     memset(left_ctx, tx_high, bh);
 }
 
-TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r, EbDecHandle *dec_handle) {
-    ParseCtxt *parse_ctxt = (ParseCtxt *)dec_handle->pv_parse_ctxt;
+TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r, ParseCtxt *parse_ctx) {
     const BlockSize bsize = xd->mi->sb_type;
     const int32_t tx_size_cat = bsize_to_tx_size_cat(bsize);
     const int maxTxDepth = bsize_to_max_depth(bsize);
-    const int ctx = get_tx_size_context(xd, parse_ctxt);
+    const int ctx = get_tx_size_context(xd, parse_ctx);
     /*TODO : Change idx */
-    const int depth = svt_read_symbol(r, parse_ctxt->frm_ctx[0].tx_size_cdf[tx_size_cat][ctx],
+    const int depth = svt_read_symbol(r, parse_ctx->frm_ctx[0].tx_size_cdf[tx_size_cat][ctx],
         maxTxDepth + 1, ACCT_STR);
     assert(depth >= 0 && depth <= maxTxDepth);
     const TxSize tx_size = depth_to_tx_size(depth, bsize);
-    update_tx_context(parse_ctxt, xd->mi_row, xd->mi_col, bsize, tx_size);
+    update_tx_context(parse_ctx, xd->mi_row, xd->mi_col, bsize, tx_size);
     return tx_size;
 }
 
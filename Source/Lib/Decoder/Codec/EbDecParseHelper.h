@@ -13,11 +13,11 @@ static const PredictionMode fimode_to_intradir[FILTER_INTRA_MODES] = {
 };
 
 int neg_deinterleave(const int diff, int ref, int max);
-void set_segment_id(EbDecHandle *dec_handle, int mi_offset, int x_mis, int y_mis, int segment_id);
+void set_segment_id(ParseCtxt *parse_ctx, int mi_offset, int x_mis, int y_mis, int segment_id);
 int bsize_to_max_depth(BlockSize bsize);
 int get_tx_size_context(const PartitionInfo_t *xd, ParseCtxt *parse_ctx);
 TxSize depth_to_tx_size(int depth, BlockSize bsize);
-TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r, EbDecHandle *dec_handle);
+TxSize read_selected_tx_size(PartitionInfo_t *xd, SvtReader *r, ParseCtxt *parse_ctx);
 int dec_is_inter_block(const ModeInfo_t *mbmi);
 int is_intrabc_block(const ModeInfo_t *mbmi);
 int max_block_wide(PartitionInfo_t *part_info, int plane_bsize, int subx);
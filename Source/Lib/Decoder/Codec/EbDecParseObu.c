@@ -34,6 +34,8 @@
 #include "EbDecProcessFrame.h"
 
 #include "EbDecNbr.h"
+#include "EbDecParseFrame.h"
+#include "EbThreads.h"
 
 
 #define CONFIG_MAX_DECODE_PROFILE 2
@@ -947,24 +949,34 @@ void read_segmentation_params(bitstrm_t *bs, SegmentationParams *seg_params, Fra
     }
 }
 
+/* Default ref and mode deltas, as set by setup_past_independence() */
+static void set_default_lf_deltas(LoopFilterParams *lf_params)
+{
+    lf_params->loop_filter_ref_deltas[INTRA_FRAME] = 1;
+    lf_params->loop_filter_ref_deltas[LAST_FRAME] = 0;
+    lf_params->loop_filter_ref_deltas[LAST2_FRAME] = 0;
+    lf_params->loop_filter_ref_deltas[LAST3_FRAME] = 0;
+    lf_params->loop_filter_ref_deltas[BWDREF_FRAME] = 0;
+    lf_params->loop_filter_ref_deltas[GOLDEN_FRAME] = -1;
+    lf_params->loop_filter_ref_deltas[ALTREF_FRAME] = -1;
+    lf_params->loop_filter_ref_deltas[ALTREF2_FRAME] = -1;
+    for (int i = 0; i < 2; i++)
+        lf_params->loop_filter_mode_deltas[i] = 0;
+}
+
 void read_loop_filter_params(bitstrm_t *bs, FrameHeader *frame_info, int num_planes)
 {
     int i;
     if (frame_info->coded_lossless || frame_info->allow_intrabc) {
         frame_info->loop_filter_params.loop_filter_level[0] = 0;
         frame_info->loop_filter_params.loop_filter_level[1] = 0;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[INTRA_FRAME] = 1;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[LAST_FRAME] = 0;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[LAST2_FRAME] = 0;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[LAST3_FRAME] = 0;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[BWDREF_FRAME] = 0;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[GOLDEN_FRAME] = -1;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[ALTREF_FRAME] = -1;
-        frame_info->loop_filter_params.loop_filter_ref_deltas[ALTREF2_FRAME] = -1;
-        for (i = 0; i < 2; i++)
-            frame_info->loop_filter_params.loop_filter_mode_deltas[i] = 0;
+        set_default_lf_deltas(&frame_info->loop_filter_params);
         return;
     }
+    /* The deltas are updated from the defaults, or from the primary ref
+       frame deltas once inter frames are supported */
+    if (frame_info->primary_ref_frame == PRIMARY_REF_NONE)
+        set_default_lf_deltas(&frame_info->loop_filter_params);
     frame_info->loop_filter_params.loop_filter_level[0] = dec_get_bits(bs, 6);
     frame_info->loop_filter_params.loop_filter_level[1] = dec_get_bits(bs, 6);
     PRINT_FRAME("loop_filter_level[0]", frame_info->loop_filter_params.loop_filter_level[0]);
@@ -1098,20 +1110,19 @@ void read_frame_cdef_params(bitstrm_t *bs, FrameHeader *frame_info, SeqHeader *s
         frame_info->CDEF_params.cdef_damping = 3;
         return;
     }
-    frame_info->CDEF_params.cdef_damping = dec_get_bits(bs, 2);
+    /* Stored as the damping used by the filter, as when disabled */
+    frame_info->CDEF_params.cdef_damping = dec_get_bits(bs, 2) + 3;
     frame_info->CDEF_params.cdef_bits = dec_get_bits(bs, 2);
-    PRINT_FRAME("cdef_damping", frame_info->CDEF_params.cdef_damping + 3);
+    PRINT_FRAME("cdef_damping", frame_info->CDEF_params.cdef_damping);
     PRINT_FRAME("cdef_bits", frame_info->CDEF_params.cdef_bits);
+    /* Primary strength in the upper 4 bits and secondary in the lower 2,
+       split by the filter */
     for (i = 0; i < (1 << frame_info->CDEF_params.cdef_bits); i++) {
         frame_info->CDEF_params.cdef_y_strength[i] = dec_get_bits(bs, 6);
         PRINT_FRAME("Primary Y cdef", frame_info->CDEF_params.cdef_y_strength[i]);
-        if (frame_info->CDEF_params.cdef_y_strength[i + 8] == 3)
-            frame_info->CDEF_params.cdef_y_strength[i + 8] += 1;
         if (num_planes > 1) {
             frame_info->CDEF_params.cdef_uv_strength[i] = dec_get_bits(bs, 6);
             PRINT_FRAME("Primary UV cdef", frame_info->CDEF_params.cdef_uv_strength[i]);
-            if (frame_info->CDEF_params.cdef_uv_strength[i + 8] == 3)
-                frame_info->CDEF_params.cdef_uv_strength[i + 8] += 1;
         }
     }
 }
@@ -1641,7 +1652,9 @@ void read_uncompressed_header(bitstrm_t *bs, SeqHeader *seq_header,
         seq_header->order_hint_info.order_hint_bits);
     PRINT_FRAME("order_hint", frame_info->order_hint);
     uint16_t opPtIdc; int inTemporalLayer, inSpatialLayer;
-    if (!FrameIsIntra || !frame_info->error_resilient_mode) {
+    if (FrameIsIntra || frame_info->error_resilient_mode)
+        frame_info->primary_ref_frame = PRIMARY_REF_NONE;
+    else {
         frame_info->primary_ref_frame = dec_get_bits(bs, PRIMARY_REF_BITS);
         PRINT_FRAME("primary_ref_frame", frame_info->primary_ref_frame)
     }
@@ -1868,12 +1881,12 @@ EbErrorType read_frame_header_obu(bitstrm_t *bs, SeqHeader *seq_header,
     return status;
 }
 
-void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
+void clear_above_context(ParseCtxt *parse_ctxt, int mi_col_start,
                          int mi_col_end, const int tile_row)
 {
     assert(0 == tile_row);
 
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctxt->dec_handle_ptr;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     int num_planes  = av1_num_planes(&seq_params->color_config);
@@ -1909,9 +1922,9 @@ void clear_above_context(EbDecHandle *dec_handle_ptr, int mi_col_start,
         tx_size_wide[TX_SIZES_LARGEST], width_y * sizeof(uint8_t));
 }
 
-void clear_left_context(EbDecHandle *dec_handle_ptr)
+void clear_left_context(ParseCtxt *parse_ctxt)
 {
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctxt->dec_handle_ptr;
     SeqHeader   *seq_params = &dec_handle_ptr->seq_header;
 
     /* Maintained only for 1 left SB! */
@@ -1932,28 +1945,20 @@ void clear_left_context(EbDecHandle *dec_handle_ptr)
         blk_cnt*sizeof(parse_ctxt->parse_nbr4x4_ctxt.left_tx_ht[0]));
 }
 
-void clear_cdef(int32_t tile_row, int32_t tile_col, CDEFParams *cdefParams)
+/* Marks the cdef_idx of the 4 64x64 blocks of the SB as not read yet */
+void clear_cdef(int8_t *sb_cdef_strength)
 {
-    (void)tile_row;
-    (void)tile_col;
-    for (int i = 0; i < CDEF_MAX_STRENGTHS; i++)
-    {
-        cdefParams->cdef_uv_strength[i] = 0;
-        cdefParams->cdef_y_strength[i] = 0;
-    }
+    for (int i = 0; i < 4; i++)
+        sb_cdef_strength[i] = -1;
 }
 
-void clear_loop_filter_delta(FrameHeader *fr_header, int num_planes)
+/* Resets the running delta q and delta lf at the start of a tile */
+void clear_loop_filter_delta(ParseCtxt *parse_ctx, FrameHeader *fr_header)
 {
-    fr_header->delta_lf_params.delta_lf_res = 0;
+    parse_ctx->cur_qindex = fr_header->quantization_params.base_q_idx;
 
-    const int frame_lf_count =
-        num_planes > 1 ? FRAME_LF_COUNT : FRAME_LF_COUNT - 2;
-    for (int lf_id = 0; lf_id < frame_lf_count; ++lf_id)
-    {
-        fr_header->loop_filter_params.loop_filter_ref_deltas[lf_id] = 0;
-        fr_header->loop_filter_params.loop_filter_mode_deltas[lf_id] = 0;
-    }
+    for (int lf_id = 0; lf_id < FRAME_LF_COUNT; ++lf_id)
+        parse_ctx->delta_lf[lf_id] = 0;
 }
 
 void clear_loop_restoration(int num_planes, PartitionInfo_t *part_info)
@@ -1973,18 +1978,22 @@ EbErrorType reset_parse_ctx(FRAME_CONTEXT *frm_ctx, uint8_t base_qp) {
     return return_error;
 }
 
-EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
+/* Parses and decodes a tile with the parse_ctxt and dec_mod_ctxt of the
+   calling thread. Tiles are independent, so any thread can take any tile.
+   With a NULL dec_mod_ctxt the tile is only parsed, and the SBs parsed in
+   each SB row are published in sb_row_parsed for the row wavefront. */
+EbErrorType parse_tile(ParseCtxt *parse_ctx, struct DecModCtxt *dec_mod_ctxt,
                        TilesInfo *tile_info, int32_t tile_row, int32_t tile_col)
 {
-    (void)bs;
     EbErrorType status = EB_ErrorNone;
 
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)parse_ctx->dec_handle_ptr;
     EbColorConfig *color_config = &dec_handle_ptr->seq_header.color_config;
-    int num_planes = av1_num_planes(color_config);
 
-    clear_above_context(dec_handle_ptr, tile_info->tile_col_start_sb[tile_col],
-                        tile_info->tile_col_start_sb[tile_col + 1], 0 /*TODO: For MultiThread*/);
-    clear_loop_filter_delta(&dec_handle_ptr->frame_header, num_planes);
+    /* Above context is per thread and frame wide, tile_row is always 0 */
+    clear_above_context(parse_ctx, tile_info->tile_col_start_sb[tile_col],
+                        tile_info->tile_col_start_sb[tile_col + 1], 0);
+    clear_loop_filter_delta(parse_ctx, &dec_handle_ptr->frame_header);
 
     // to-do access to wiener info that is currently part of PartitionInfo_t
     //clear_loop_restoration(num_planes, part_info);
@@ -1995,11 +2004,11 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     {
         int32_t sb_row = (mi_row << 2) >> dec_handle_ptr->seq_header.sb_size_log2;
 
-        clear_left_context(dec_handle_ptr);
+        clear_left_context(parse_ctx);
 
-        /*TODO: Move CFL to thread ctxt! We need to access DecModCtxt from parse_tile function */
         /*add tile level cfl init */
-        cfl_init(&((DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt)->cfl_ctx, color_config);
+        if (dec_mod_ctxt != NULL)
+            cfl_init(&dec_mod_ctxt->cfl_ctx, color_config);
 
         for (uint32_t mi_col = tile_info->tile_col_start_sb[tile_col];
             mi_col < tile_info->tile_col_start_sb[tile_col + 1];
@@ -2009,7 +2018,6 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             int32_t sb_col = (mi_col << MI_SIZE_LOG2) >>
                 dec_handle_ptr->seq_header.sb_size_log2;
 
-            clear_cdef(tile_row, tile_col, &dec_handle_ptr->frame_header.CDEF_params);
             //clear_block_decoded_flags(r, c, sbSize4)
             //read_lr(r, c, sbSize)
             MasterFrameBuf *master_frame_buf = &dec_handle_ptr->master_frame_buf;
@@ -2031,6 +2039,10 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                 (sb_row * num_mis_in_sb * master_frame_buf->sb_cols) +
                  sb_col * num_mis_in_sb;
 
+            sb_info->sb_mi_map = frame_buf->mi_map +
+                (sb_row * num_mis_in_sb * master_frame_buf->sb_cols) +
+                 sb_col * num_mis_in_sb;
+
             sb_info->sb_luma_trans_info = frame_buf->luma_trans_info +
                 (sb_row * num_mis_in_sb * master_frame_buf->sb_cols) +
                  sb_col * num_mis_in_sb;
@@ -2050,11 +2062,19 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
                 (16 + 1) * 2) >> (color_config->subsampling_y +
                 color_config->subsampling_x));
 
+            /* 4 cdef_idx per SB, one for each 64x64 of a 128x128 SB */
+            sb_info->sb_cdef_strength = frame_buf->cdef_strength +
+                (((sb_row * master_frame_buf->sb_cols) + sb_col) << 2);
+            clear_cdef(sb_info->sb_cdef_strength);
+
+            sb_info->sb_delta_q = frame_buf->delta_q +
+                (sb_row * master_frame_buf->sb_cols) + sb_col;
+            sb_info->sb_delta_lf = frame_buf->delta_lf +
+                (((sb_row * master_frame_buf->sb_cols) + sb_col) * FRAME_LF_COUNT);
+
             /* TO DO : Populate other structures as well */
 
             /* Init ParseCtxt */
-            ParseCtxt *parse_ctx = (ParseCtxt*)dec_handle_ptr->pv_parse_ctxt;
-
             parse_ctx->first_luma_tu_offset = 0;
             parse_ctx->first_chroma_tu_offset = 0;
             parse_ctx->cur_mode_info = sb_info->sb_mode_info;
@@ -2068,32 +2088,26 @@ EbErrorType parse_tile(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             parse_ctx->above_sb_info= above_sb_info;
             parse_ctx->prev_blk_has_chroma = 1; //default at start of frame / tile
 
-            /* Init DecModCtxt */
-            DecModCtxt *dec_mod_ctxt = (DecModCtxt*)dec_handle_ptr->pv_dec_mod_ctxt;
-
-            dec_mod_ctxt->sb_row_mi = mi_row;
-            dec_mod_ctxt->sb_col_mi = mi_col;
-
-            dec_mod_ctxt->left_sb_info = left_sb_info;
-            dec_mod_ctxt->above_sb_info = above_sb_info;
-
-            dec_mod_ctxt->cur_luma_coeff = sb_info->sb_luma_coeff;
-            dec_mod_ctxt->cur_chroma_coeff = sb_info->sb_chroma_coeff;
-
-            dec_mod_ctxt->cur_tile_info = &parse_ctx->cur_tile_info;
-
             /* nbr updates before SB call */
-            update_nbrs_before_sb(&master_frame_buf->frame_mi_map, sb_col);
+            update_nbrs_before_sb(&parse_ctx->frame_mi_map, sb_col);
 
             // Bit-stream parsing of the superblock
-            parse_super_block(dec_handle_ptr, mi_row, mi_col, sb_info);
-
-            /* TO DO : Will move later */
-            // decoding of the superblock
-            decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
+            parse_super_block(parse_ctx, mi_row, mi_col, sb_info);
 
             /* nbr updates at SB level */
-            update_nbrs_after_sb(&master_frame_buf->frame_mi_map, sb_col);
+            update_nbrs_after_sb(&parse_ctx->frame_mi_map, sb_info, sb_col);
+
+            // decoding of the superblock
+            if (dec_mod_ctxt != NULL) {
+                decode_tile_sb(dec_mod_ctxt, &parse_ctx->cur_tile_info,
+                               mi_row, mi_col);
+                post_filter_sb_done(dec_handle_ptr, sb_row);
+            }
+            else {
+                eb_atomic_store_u32(&dec_handle_ptr->sb_row_parsed[sb_row],
+                                    sb_col + 1);
+                eb_signal_cond_var(dec_handle_ptr->wf_cond_var);
+            }
         }
     }
 
@@ -2154,7 +2168,7 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
 {
     EbErrorType status = EB_ErrorNone;
 
-    ParseCtxt   *parse_ctxt = (ParseCtxt *)dec_handle_ptr->pv_parse_ctxt;
+    DecTileJob  *tile_jobs = (DecTileJob *)dec_handle_ptr->pv_tile_jobs;
 
     int num_tiles, tg_start, tg_end, tile_bits, tile_start_and_end_present_flag = 0;
     int tile_row, tile_col;
@@ -2188,6 +2202,11 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
     header_bytes = (end_position - start_position) / 8;
     obu_header->payload_size -= header_bytes;
 
+    if (tg_start == 0)
+        post_filter_frame_init(dec_handle_ptr);
+
+    /* Collect the tiles first, they are then parsed and decoded in parallel */
+    dec_handle_ptr->num_tile_jobs = 0;
     for (int tile_num = tg_start; tile_num <= tg_end; tile_num++) {
         tile_row = tile_num / tiles_info->tile_cols;
         tile_col = tile_num % tiles_info->tile_cols;
@@ -2200,28 +2219,27 @@ EbErrorType read_tile_group_obu(bitstrm_t *bs, EbDecHandle *dec_handle_ptr,
             PRINT_FRAME("tile_size_minus_1", (tile_size));
         }
 
-        svt_tile_init(&parse_ctxt->cur_tile_info, &dec_handle_ptr->frame_header,
-                        tile_row, tile_col);
-
-        //init_symbol(tileSize)
-
-        status = init_svt_reader(&parse_ctxt->r,
-            (const uint8_t *)get_bitsteam_buf(bs), bs->buf_max, tile_size,
-            !(dec_handle_ptr->frame_header.disable_cdf_update));
-        if (status != EB_ErrorNone)
-            return status;
-
-        reset_parse_ctx(&parse_ctxt->frm_ctx[0],
-            dec_handle_ptr->frame_header.quantization_params.base_q_idx);
+        DecTileJob *tile_job = &tile_jobs[dec_handle_ptr->num_tile_jobs++];
+        tile_job->tile_row  = tile_row;
+        tile_job->tile_col  = tile_col;
+        tile_job->data      = (const uint8_t *)get_bitsteam_buf(bs);
+        tile_job->data_end  = bs->buf_max;
+        tile_job->tile_size = tile_size;
+        tile_job->status    = EB_ErrorNone;
 
-        /* TO DO decode_tile() */
-        status = parse_tile(bs, dec_handle_ptr, tiles_info, tile_row, tile_col);
+        /* Skip to the size of the next tile */
+        if (tile_num != tg_end) {
+            if (tile_size > (size_t)(bs->buf_max - tile_job->data))
+                return EB_Corrupt_Frame;
+            dec_bits_init(bs, tile_job->data + tile_size,
+                          (uint32_t)obu_header->payload_size);
+        }
+    }
 
-        dec_bits_init(bs, (uint8_t *)parse_ctxt->r.ec.bptr, (uint32_t)obu_header->payload_size);
+    status = decode_tile_jobs(dec_handle_ptr);
 
-        if (status != EB_ErrorNone)
-            return status;
-    }
+    if (status == EB_ErrorNone && tg_end == num_tiles - 1)
+        post_filter_frame_end(dec_handle_ptr);
 
     return status;
 }
@@ -2330,3 +2348,59 @@ EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, const uint8_t *data
     }
     return status;
 }
+
+/* Reads the sequence headers of a temporal unit and tells whether its
+   frames are all intra frames, which refer to no other frame */
+EbErrorType scan_temporal_unit(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+    size_t data_size, int *intra_only)
+{
+    bitstrm_t bs;
+    EbErrorType status;
+    ObuHeader obu_header;
+
+    *intra_only = 1;
+    while (data_size) {
+        size_t payload_size = 0, length_size = 0;
+
+        dec_bits_init(&bs, data, data_size);
+
+        status = open_bistream_unit(&bs, &obu_header, data_size, &length_size);
+        if (status != EB_ErrorNone) return status;
+
+        payload_size = obu_header.payload_size;
+
+        data += (obu_header.size + length_size);
+        data_size -= (obu_header.size + length_size);
+
+        if (data_size < payload_size)
+            return EB_Corrupt_Frame;
+
+        dec_bits_init(&bs, data, payload_size);
+
+        if (obu_header.obu_type == OBU_SEQUENCE_HEADER) {
+            status = read_sequence_header_obu(&bs, &dec_handle_ptr->seq_header);
+            if (status != EB_ErrorNone)
+                return status;
+            dec_handle_ptr->seq_header_done = 1;
+        }
+        else if (obu_header.obu_type == OBU_FRAME_HEADER ||
+                 obu_header.obu_type == OBU_FRAME) {
+            if (!dec_handle_ptr->seq_header_done)
+                return EB_Corrupt_Frame;
+            /* show_existing_frame outputs a reference, then frame_type */
+            if (!dec_handle_ptr->seq_header.reduced_still_picture_header) {
+                if (dec_get_bits(&bs, 1))
+                    *intra_only = 0;
+                else {
+                    FrameType frame_type = dec_get_bits(&bs, 2);
+                    if (frame_type != KEY_FRAME && frame_type != INTRA_ONLY_FRAME)
+                        *intra_only = 0;
+                }
+            }
+        }
+
+        data += payload_size;
+        data_size -= payload_size;
+    }
+    return EB_ErrorNone;
+}
@@ -57,7 +57,7 @@ PartitionType get_partition(DecModCtxt *dec_mod_ctxt, FrameHeader *frame_header,
     if (mi_row >= frame_header->mi_rows || mi_col >= frame_header->mi_cols)
         return PARTITION_INVALID;
 
-    ModeInfo_t *mode_info = get_cur_mode_info(dec_mod_ctxt->dec_handle_ptr, mi_row, mi_col, sb_info);
+    ModeInfo_t *mode_info = get_cur_mode_info(dec_mod_ctxt, mi_row, mi_col, sb_info);
 
     const BlockSize subsize = mode_info->sb_type;
 
@@ -73,9 +73,9 @@ PartitionType get_partition(DecModCtxt *dec_mod_ctxt, FrameHeader *frame_header,
     {
         // In this case, the block might be using an extended partition type.
         /* TODO: Fix the nbr access! */
-        const ModeInfo_t *const mbmi_right = get_cur_mode_info(dec_mod_ctxt->dec_handle_ptr,
+        const ModeInfo_t *const mbmi_right = get_cur_mode_info(dec_mod_ctxt,
             mi_row, mi_col + (bwide / 2), sb_info);
-        const ModeInfo_t *const mbmi_below = get_cur_mode_info(dec_mod_ctxt->dec_handle_ptr,
+        const ModeInfo_t *const mbmi_below = get_cur_mode_info(dec_mod_ctxt,
             mi_row + (bhigh / 2), mi_col, sb_info);
 
         if (sswide == bwide) {
@@ -191,7 +191,7 @@ void decode_block(DecModCtxt *dec_mod_ctxt, int32_t mi_row, int32_t mi_col,
 
     int num_planes = av1_num_planes(color_config);
 
-    ModeInfo_t *mode_info = get_cur_mode_info(dec_mod_ctxt->dec_handle_ptr, mi_row, mi_col, sb_info);
+    ModeInfo_t *mode_info = get_cur_mode_info(dec_mod_ctxt, mi_row, mi_col, sb_info);
 #if MODE_INFO_DBG
     assert(mode_info->mi_row == mi_row);
     assert(mode_info->mi_col == mi_col);
@@ -250,22 +250,24 @@ void decode_block(DecModCtxt *dec_mod_ctxt, int32_t mi_row, int32_t mi_col,
     }
 
     if (part_info.up_available)
-        part_info.above_mbmi = get_top_mode_info(dec_handle, mi_row, mi_col, sb_info);
+        part_info.above_mbmi = get_cur_mode_info(dec_mod_ctxt, mi_row - 1,
+            mi_col, sb_info);
     else
         part_info.above_mbmi = NULL;
     if (part_info.left_available)
-        part_info.left_mbmi = get_left_mode_info(dec_handle, mi_row, mi_col, sb_info);
+        part_info.left_mbmi = get_cur_mode_info(dec_mod_ctxt, mi_row,
+            mi_col - 1, sb_info);
     else
         part_info.left_mbmi = NULL;
     if (part_info.chroma_up_available) {
-        part_info.chroma_above_mbmi = get_top_mode_info
-            (dec_handle, (mi_row & (~sub_x)), (mi_col & (~sub_y)), sb_info); // floored to nearest 4x4 based on sub subsampling x & y
+        part_info.chroma_above_mbmi = get_cur_mode_info
+            (dec_mod_ctxt, (mi_row & (~sub_x)) - 1, (mi_col & (~sub_y)), sb_info); // floored to nearest 4x4 based on sub subsampling x & y
     }
     else
         part_info.chroma_above_mbmi = NULL;
     if (part_info.chroma_left_available) {
-        part_info.chroma_left_mbmi = get_left_mode_info
-            (dec_handle, (mi_row & (~sub_x)), (mi_col & (~sub_y)), sb_info); // floored to nearest 4x4 based on sub subsampling x & y
+        part_info.chroma_left_mbmi = get_cur_mode_info
+            (dec_mod_ctxt, (mi_row & (~sub_x)), (mi_col & (~sub_y)) - 1, sb_info); // floored to nearest 4x4 based on sub subsampling x & y
     }
     else
         part_info.chroma_left_mbmi = NULL;
@@ -354,7 +356,8 @@ void decode_block(DecModCtxt *dec_mod_ctxt, int32_t mi_row, int32_t mi_col,
 #endif
                                 tx_type = trans_info->txk_type;
 
-                                n_coeffs = inverse_quantize(dec_handle, &part_info,
+                                n_coeffs = inverse_quantize(dec_handle,
+                                    dec_mod_ctxt->dequants, &part_info,
                                     mode_info, coeffs, qcoeffs, tx_type, tx_size, plane);
                                 if(n_coeffs != 0)
                                 {
@@ -122,9 +122,43 @@ void decode_super_block(DecModCtxt *dec_mod_ctxt,
     /* Pointer updates */
 
     /* SB level dequant update */
-    update_dequant(dec_handle, sb_info);
+    update_dequant(dec_handle, sb_info, &dec_mod_ctxt->dequants,
+                   &dec_mod_ctxt->sb_dequants);
 
     /* Decode partition */
     decode_partition(dec_mod_ctxt, mi_row, mi_col,
                      dec_handle->seq_header.sb_size, sb_info);
 }
+
+/* Decodes the SB at mi_row, mi_col of the tile once it has been parsed.
+   Only reads what parse left in the frame buffers, so it can run on any
+   thread behind the parse. */
+void decode_tile_sb(DecModCtxt *dec_mod_ctxt, TileInfo *tile_info,
+                    uint32_t mi_row, uint32_t mi_col)
+{
+    EbDecHandle *dec_handle = (EbDecHandle *)dec_mod_ctxt->dec_handle_ptr;
+    MasterFrameBuf *master_frame_buf = &dec_handle->master_frame_buf;
+    int32_t sb_size_log2 = dec_handle->seq_header.sb_size_log2;
+    int32_t sb_row = (mi_row << MI_SIZE_LOG2) >> sb_size_log2;
+    int32_t sb_col = (mi_col << MI_SIZE_LOG2) >> sb_size_log2;
+
+    SBInfo *sb_info = master_frame_buf->cur_frame_bufs[0].sb_info +
+        (sb_row * master_frame_buf->sb_cols) + sb_col;
+
+    dec_mod_ctxt->sb_row_mi = mi_row;
+    dec_mod_ctxt->sb_col_mi = mi_col;
+
+    dec_mod_ctxt->left_sb_info = NULL;
+    if ((int32_t)mi_col != tile_info->mi_col_start)
+        dec_mod_ctxt->left_sb_info = sb_info - 1;
+    dec_mod_ctxt->above_sb_info = NULL;
+    if ((int32_t)mi_row != tile_info->mi_row_start)
+        dec_mod_ctxt->above_sb_info = sb_info - master_frame_buf->sb_cols;
+
+    dec_mod_ctxt->cur_luma_coeff = sb_info->sb_luma_coeff;
+    dec_mod_ctxt->cur_chroma_coeff = sb_info->sb_chroma_coeff;
+
+    dec_mod_ctxt->cur_tile_info = tile_info;
+
+    decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
+}
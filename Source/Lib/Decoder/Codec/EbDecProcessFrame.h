@@ -35,6 +35,11 @@ typedef struct DecModCtxt {
     /* Current tile info */
     TileInfo    *cur_tile_info;
 
+    /* Dequant of the current SB : frame dequants, or sb_dequants
+       when delta q is present */
+    Dequants    *dequants;
+    Dequants    sb_dequants;
+
     /* CFL context */
     CflCtx  cfl_ctx;
 
@@ -47,6 +52,9 @@ void decode_super_block(DecModCtxt *dec_mod_ctxt,
                         uint32_t mi_row, uint32_t mi_col,
                         SBInfo *sbInfo);
 
+void decode_tile_sb(DecModCtxt *dec_mod_ctxt, TileInfo *tile_info,
+                    uint32_t mi_row, uint32_t mi_col);
+
 /* TODO: Should be moved out once decode tile is moved out from parse_tile */
 void cfl_init(CflCtx *cfl, EbColorConfig *cc);
 
@@ -519,9 +519,6 @@ typedef struct FrameHeader {
     /* Dequantization context */
     Dequants                dequants;
 
-    /* This need to be moved to thread context */
-    Dequants                *dequants_delta_q;
-
     /* Inverse Quantization Matrix */
     const QmVal          *giqmatrix[NUM_QM_LEVELS][3][TX_SIZES_ALL];
 } FrameHeader;
@@ -118,6 +118,9 @@ typedef struct ParseCtxt {
 
     TileInfo        cur_tile_info;
 
+    /* MI map of the current SB and of the SB row above */
+    FrameMiMap      frame_mi_map;
+
     /* Stored here for current block and should be updated to next block modeinfo */
     /*!< Offset of first Luma transform info from strat of SB pointer */
     uint16_t        first_luma_tu_offset;
@@ -145,13 +148,32 @@ typedef struct ParseCtxt {
      * if Prev block does not have chroma info then this state is remembered in this variable to be used in next block
     */
     int32_t  prev_blk_has_chroma;
+
+    /* Running qindex and loop filter deltas of the tile, updated by the
+       delta q / delta lf of each SB */
+    int32_t  cur_qindex;
+    int32_t  delta_lf[FRAME_LF_COUNT];
 } ParseCtxt;
 
+int seg_feature_active_idx(SegmentationParams *seg_params, int segment_id,
+    SEG_LVL_FEATURES feature_id);
 int get_qindex(SegmentationParams *seg_params, int segment_id, int base_q_idx);
-void parse_super_block(EbDecHandle *dec_handle,
+void parse_super_block(ParseCtxt *parse_ctx,
     uint32_t blk_row, uint32_t blk_col, SBInfo *sbInfo);
 
+/* Tile level, called from the tile decode threads */
+struct DecModCtxt;
+void svt_tile_init(TileInfo *cur_tile_info, FrameHeader *frame_header,
+    int32_t tile_row, int32_t tile_col);
+EbErrorType init_svt_reader(SvtReader *r, const uint8_t *data,
+    const uint8_t *data_end, const size_t read_size, uint8_t allow_update_cdf);
+EbErrorType reset_parse_ctx(FRAME_CONTEXT *frm_ctx, uint8_t base_qp);
+EbErrorType parse_tile(ParseCtxt *parse_ctxt, struct DecModCtxt *dec_mod_ctxt,
+    TilesInfo *tile_info, int32_t tile_row, int32_t tile_col);
+
 EbErrorType decode_obu(EbDecHandle *dec_handle_ptr, uint8_t *data, uint32_t data_size);
 EbErrorType decode_multiple_obu(EbDecHandle *dec_handle_ptr, const uint8_t *data, size_t data_size);
+EbErrorType scan_temporal_unit(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+    size_t data_size, int *intra_only);
 
 #endif  // EbDecObuParser_h
@@ -33,6 +33,8 @@
 #include "EbSourceBasedOperationsProcess.h"
 #include "EbPictureManagerProcess.h"
 #include "EbRateControlProcess.h"
+#include "RateControlTwoPass.h"
+#include "EbMeHints.h"
 #include "EbModeDecisionConfigurationProcess.h"
 #include "EbEncDecProcess.h"
 #include "EbEntropyCodingProcess.h"
@@ -52,6 +54,7 @@
 #include "EbDlfProcess.h"
 #include "EbCdefProcess.h"
 #include "EbRestProcess.h"
+#include "EbTime.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -86,10 +89,9 @@
 
 // Output Buffer Transfer Parameters
 #define EB_OUTPUTSTREAMBUFFERSIZE                                       0x2DC6C0   //0x7D00        // match MTU Size
-#define EB_OUTPUTRECONBUFFERSIZE                                        (MAX_PICTURE_WIDTH_SIZE*MAX_PICTURE_HEIGHT_SIZE*2)   // Recon Slice Size
 #define EB_OUTPUTSTATISTICSBUFFERSIZE                                   0x30            // 6X8 (8 Bytes for Y, U, V, number of bits, picture number, QP)
 #define EOS_NAL_BUFFER_SIZE                                             0x0010 // Bitstream used to code EOS NAL
-#define EB_OUTPUTSTREAMBUFFERSIZE_MACRO(ResolutionSize)                ((ResolutionSize) < (INPUT_SIZE_1080i_TH) ? 0x1E8480 : (ResolutionSize) < (INPUT_SIZE_1080p_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_4K_TH) ? 0x2DC6C0 : 0x2DC6C0  )
+#define EB_OUTPUTSTREAMBUFFERSIZE_MACRO(ResolutionSize)                ((ResolutionSize) < (INPUT_SIZE_1080i_TH) ? 0x1E8480 : (ResolutionSize) < (INPUT_SIZE_1080p_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_4K_TH) ? 0x2DC6C0 : (ResolutionSize) < (INPUT_SIZE_8K_TH) ? 0x2DC6C0 : 0xB71B00  )
 
 #define ENCDEC_INPUT_PORT_MDC                                0
 #define ENCDEC_INPUT_PORT_ENCDEC                             1
@@ -97,33 +99,66 @@
 
 #define SCD_LAD                                              6
 
-/**************************************
- * Globals
- **************************************/
-
-EbMemoryMapEntry                 *memory_map;
-uint32_t                         *memory_map_index;
-uint64_t                         *total_lib_memory;
+#if PIPELINE_STATS
+// Name of each kernel in EbPipelineStats, in pipeline order
+static const struct {
+    void       *(*kernel)(void *);
+    const char   *name;
+} pipeline_stats_kernels[] = {
+    { resource_coordination_kernel,         "resource_coordination" },
+    { picture_analysis_kernel,              "picture_analysis" },
+    { picture_decision_kernel,              "picture_decision" },
+    { motion_estimation_kernel,             "motion_estimation" },
+    { initial_rate_control_kernel,          "initial_rate_control" },
+    { source_based_operations_kernel,       "source_based_operations" },
+    { picture_manager_kernel,               "picture_manager" },
+    { rate_control_kernel,                  "rate_control" },
+    { mode_decision_configuration_kernel,   "mode_decision_configuration" },
+    { enc_dec_kernel,                       "enc_dec" },
+    { dlf_kernel,                           "dlf" },
+    { cdef_kernel,                          "cdef" },
+    { rest_kernel,                          "rest" },
+    { entropy_coding_kernel,                "entropy_coding" },
+    { packetization_kernel,                 "packetization" },
+};
+#define PIPELINE_STATS_KERNEL_COUNT (uint32_t)(sizeof(pipeline_stats_kernels) / sizeof(pipeline_stats_kernels[0]))
+
+/* Binds the next thread stats of the handle to the kernel thread. A thread
+   of a kernel not listed, or beyond the threads counted, is not bound. */
+static void bind_kernel_thread_stats(
+    EbEncHandle   *enc_handle_ptr,
+    void        *(**thread_function)(void *),
+    void         **thread_context)
+{
+    EbThreadStats *stats_ptr;
+    uint32_t       kernel_index = 0;
 
-uint32_t                         lib_malloc_count = 0;
-uint32_t                         lib_thread_count = 0;
-uint32_t                         lib_semaphore_count = 0;
-uint32_t                         lib_mutex_count = 0;
+    while (kernel_index < PIPELINE_STATS_KERNEL_COUNT && pipeline_stats_kernels[kernel_index].kernel != *thread_function)
+        kernel_index++;
+    if (kernel_index == PIPELINE_STATS_KERNEL_COUNT || enc_handle_ptr->thread_stats_count == enc_handle_ptr->thread_stats_size)
+        return;
 
-uint8_t                          num_groups = 0;
-#ifdef _WIN32
-GROUP_AFFINITY                   group_affinity;
-EbBool                           alternate_groups = 0;
-#elif defined(__linux__)
-cpu_set_t                        group_affinity;
-typedef struct logicalProcessorGroup {
-    uint32_t num;
-    uint32_t group[1024];
-}processorGroup;
-#define MAX_PROCESSOR_GROUP 16
-processorGroup                   lp_group[MAX_PROCESSOR_GROUP];
+    stats_ptr = &enc_handle_ptr->thread_stats_array[enc_handle_ptr->thread_stats_count++];
+    stats_ptr->kernel_index = kernel_index;
+    eb_thread_stats_bind(stats_ptr, thread_function, thread_context);
+}
+#define EB_BIND_KERNEL_THREAD_STATS(thread_function, thread_context) \
+    bind_kernel_thread_stats(enc_handle_ptr, &thread_function, &thread_context)
+#else
+#define EB_BIND_KERNEL_THREAD_STATS(thread_function, thread_context)
 #endif
 
+// Kernel threads are bound to the encoder thread pool (if any) before they are created
+#define EB_CREATE_KERNEL_THREAD(pointer, thread_function, thread_context) \
+    do { \
+        void *(*bound_function)(void *) = thread_function; \
+        void  *bound_context = thread_context; \
+        EB_BIND_KERNEL_THREAD_STATS(bound_function, bound_context); \
+        if (eb_thread_pool_bind(enc_handle_ptr->thread_pool_ptr, &bound_function, &bound_context) != EB_ErrorNone) \
+            return EB_ErrorInsufficientResources; \
+        EB_CREATETHREAD(EbHandle, pointer, sizeof(EbHandle), EB_THREAD, bound_function, bound_context, &enc_handle_ptr->thread_affinity); \
+    } while (0)
+
 /**************************************
 * Instruction Set Support
 **************************************/
@@ -207,21 +242,23 @@ EbAsm GetCpuAsmType()
 }
 
 //Get Number of logical processors
-uint32_t GetNumProcessors() {
+uint32_t GetNumProcessors(const EbThreadAffinity *thread_affinity) {
 #ifdef _WIN32
     SYSTEM_INFO sysinfo;
     GetSystemInfo(&sysinfo);
-    return num_groups == 1 ? sysinfo.dwNumberOfProcessors : sysinfo.dwNumberOfProcessors << 1;
+    return thread_affinity->num_groups == 1 ? sysinfo.dwNumberOfProcessors : sysinfo.dwNumberOfProcessors << 1;
 #else
+    UNUSED(thread_affinity);
     return sysconf(_SC_NPROCESSORS_ONLN);
 #endif
 }
 
-EbErrorType InitThreadManagmentParams() {
+EbErrorType InitThreadManagmentParams(EbThreadAffinity *thread_affinity) {
 #ifdef _WIN32
-    // Initialize group_affinity structure with Current thread info
-    GetThreadGroupAffinity(GetCurrentThread(), &group_affinity);
-    num_groups = (uint8_t)GetActiveProcessorGroupCount();
+    // Initialize the group affinity of the instance with Current thread info
+    GetThreadGroupAffinity(GetCurrentThread(), &thread_affinity->group_affinity);
+    thread_affinity->num_groups = (uint8_t)GetActiveProcessorGroupCount();
+    thread_affinity->alternate_groups = EB_FALSE;
 #elif defined(__linux__)
     const char* PROCESSORID = "processor";
     const char* PHYSICALID = "physical id";
@@ -231,7 +268,8 @@ EbErrorType InitThreadManagmentParams() {
         return EB_ErrorInsufficientResources;
     if (physical_id_len < 0 || physical_id_len >= 128)
         return EB_ErrorInsufficientResources;
-    memset(lp_group, 0, sizeof(lp_group));
+    thread_affinity->num_groups = 0;
+    memset(thread_affinity->lp_group, 0, sizeof(thread_affinity->lp_group));
 
     FILE *fin = fopen("/proc/cpuinfo", "r");
     if (fin) {
@@ -251,9 +289,9 @@ EbErrorType InitThreadManagmentParams() {
                     fclose(fin);
                     return EB_ErrorInsufficientResources;
                 }
-                if (socket_id + 1 > num_groups)
-                    num_groups = socket_id + 1;
-                lp_group[socket_id].group[lp_group[socket_id].num++] = processor_id;
+                if (socket_id + 1 > thread_affinity->num_groups)
+                    thread_affinity->num_groups = socket_id + 1;
+                thread_affinity->lp_group[socket_id].group[thread_affinity->lp_group[socket_id].num++] = processor_id;
             }
         }
         fclose(fin);
@@ -262,6 +300,64 @@ EbErrorType InitThreadManagmentParams() {
     return EB_ErrorNone;
 }
 
+/* Logical processors of a NUMA node, from its cpulist ("0-15,32-47") on
+   Linux. Returns their count, 0 for nodes that do not exist or have no
+   processors. */
+#ifdef _WIN32
+static uint32_t GetNumaNodeAffinity(int32_t numa_node, GROUP_AFFINITY *node_affinity) {
+    ULONG highest_node;
+    uint32_t count = 0;
+
+    if (!GetNumaHighestNodeNumber(&highest_node) || (ULONG)numa_node > highest_node)
+        return 0;
+    if (!GetNumaNodeProcessorMaskEx((USHORT)numa_node, node_affinity))
+        return 0;
+    for (KAFFINITY mask = node_affinity->Mask; mask; mask &= mask - 1)
+        count++;
+    return count;
+}
+#elif defined(__linux__)
+static uint32_t GetNumaNodeAffinity(int32_t numa_node, cpu_set_t *node_affinity) {
+    char path[64];
+    char cpu_list[4096];
+    FILE *fin;
+
+    CPU_ZERO(node_affinity);
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", numa_node);
+    fin = fopen(path, "r");
+    if (fin == NULL)
+        return 0;
+    if (fgets(cpu_list, sizeof(cpu_list), fin)) {
+        char *p = cpu_list;
+        while (*p >= '0' && *p <= '9') {
+            long first = strtol(p, &p, 10);
+            long last = first;
+            if (*p == '-')
+                last = strtol(p + 1, &p, 10);
+            for (long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+                CPU_SET(cpu, node_affinity);
+            if (*p == ',')
+                p++;
+        }
+    }
+    fclose(fin);
+    return (uint32_t)CPU_COUNT(node_affinity);
+}
+#endif
+
+static uint32_t GetNumaNodeProcessors(int32_t numa_node) {
+#ifdef _WIN32
+    GROUP_AFFINITY node_affinity;
+    return GetNumaNodeAffinity(numa_node, &node_affinity);
+#elif defined(__linux__)
+    cpu_set_t node_affinity;
+    return GetNumaNodeAffinity(numa_node, &node_affinity);
+#else
+    UNUSED(numa_node);
+    return 0;
+#endif
+}
+
 #ifdef _WIN32
 uint64_t GetAffinityMask(uint32_t lpnum) {
     uint64_t mask = 0x1;
@@ -271,56 +367,90 @@ uint64_t GetAffinityMask(uint32_t lpnum) {
 }
 #endif
 
-void EbSetThreadManagementParameters(EbSvtAv1EncConfiguration *config_ptr)
+void EbSetThreadManagementParameters(
+    EbThreadAffinity         *thread_affinity,
+    EbSvtAv1EncConfiguration *config_ptr)
 {
+    // Threads of a NUMA node, the first logical_processors of them if set
+    if (config_ptr->numa_node != -1) {
+#ifdef _WIN32
+        GetNumaNodeAffinity(config_ptr->numa_node, &thread_affinity->group_affinity);
+        if (config_ptr->logical_processors != 0) {
+            KAFFINITY mask = 0;
+            uint32_t lps = 0;
+            for (KAFFINITY bit = 1; bit && lps < config_ptr->logical_processors; bit <<= 1) {
+                if (thread_affinity->group_affinity.Mask & bit) {
+                    mask |= bit;
+                    lps++;
+                }
+            }
+            thread_affinity->group_affinity.Mask = mask;
+        }
+        thread_affinity->alternate_groups = EB_FALSE;
+#elif defined(__linux__)
+        uint32_t lps = 0;
+        cpu_set_t node_affinity;
+        GetNumaNodeAffinity(config_ptr->numa_node, &node_affinity);
+        CPU_ZERO(&thread_affinity->group_affinity);
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (!CPU_ISSET(cpu, &node_affinity))
+                continue;
+            if (config_ptr->logical_processors != 0 && lps == config_ptr->logical_processors)
+                break;
+            CPU_SET(cpu, &thread_affinity->group_affinity);
+            lps++;
+        }
+#endif
+        return;
+    }
 #ifdef _WIN32
-    uint32_t num_logical_processors = GetNumProcessors();
+    uint32_t num_logical_processors = GetNumProcessors(thread_affinity);
     // For system with a single processor group(no more than 64 logic processors all together)
     // Affinity of the thread can be set to one or more logical processors
-    if (num_groups == 1) {
+    if (thread_affinity->num_groups == 1) {
         uint32_t lps = config_ptr->logical_processors == 0 ? num_logical_processors :
             config_ptr->logical_processors < num_logical_processors ? config_ptr->logical_processors : num_logical_processors;
-        group_affinity.Mask = GetAffinityMask(lps);
+        thread_affinity->group_affinity.Mask = GetAffinityMask(lps);
     }
-    else if (num_groups > 1) { // For system with multiple processor group
+    else if (thread_affinity->num_groups > 1) { // For system with multiple processor group
         if (config_ptr->logical_processors == 0) {
             if (config_ptr->target_socket != -1)
-                group_affinity.Group = config_ptr->target_socket;
+                thread_affinity->group_affinity.Group = config_ptr->target_socket;
         }
         else {
-            uint32_t num_lp_per_group = num_logical_processors / num_groups;
+            uint32_t num_lp_per_group = num_logical_processors / thread_affinity->num_groups;
             if (config_ptr->target_socket == -1) {
                 if (config_ptr->logical_processors > num_lp_per_group) {
-                    alternate_groups = EB_TRUE;
+                    thread_affinity->alternate_groups = EB_TRUE;
                     SVT_LOG("SVT [WARNING]: -lp(logical processors) setting is ignored. Run on both sockets. \n");
                 }
                 else
-                    group_affinity.Mask = GetAffinityMask(config_ptr->logical_processors);
+                    thread_affinity->group_affinity.Mask = GetAffinityMask(config_ptr->logical_processors);
             }
             else {
                 uint32_t lps = config_ptr->logical_processors == 0 ? num_lp_per_group :
                     config_ptr->logical_processors < num_lp_per_group ? config_ptr->logical_processors : num_lp_per_group;
-                group_affinity.Mask = GetAffinityMask(lps);
-                group_affinity.Group = config_ptr->target_socket;
+                thread_affinity->group_affinity.Mask = GetAffinityMask(lps);
+                thread_affinity->group_affinity.Group = config_ptr->target_socket;
             }
         }
     }
 #elif defined(__linux__)
-    uint32_t num_logical_processors = GetNumProcessors();
-    CPU_ZERO(&group_affinity);
+    uint32_t num_logical_processors = GetNumProcessors(thread_affinity);
+    CPU_ZERO(&thread_affinity->group_affinity);
 
-    if (num_groups == 1) {
+    if (thread_affinity->num_groups == 1) {
         uint32_t lps = config_ptr->logical_processors == 0 ? num_logical_processors :
             config_ptr->logical_processors < num_logical_processors ? config_ptr->logical_processors : num_logical_processors;
         for (uint32_t i = 0; i < lps; i++)
-            CPU_SET(lp_group[0].group[i], &group_affinity);
+            CPU_SET(thread_affinity->lp_group[0].group[i], &thread_affinity->group_affinity);
     }
-    else if (num_groups > 1) {
-        uint32_t num_lp_per_group = num_logical_processors / num_groups;
+    else if (thread_affinity->num_groups > 1) {
+        uint32_t num_lp_per_group = num_logical_processors / thread_affinity->num_groups;
         if (config_ptr->logical_processors == 0) {
             if (config_ptr->target_socket != -1) {
-                for (uint32_t i = 0; i < lp_group[config_ptr->target_socket].num; i++)
-                    CPU_SET(lp_group[config_ptr->target_socket].group[i], &group_affinity);
+                for (uint32_t i = 0; i < thread_affinity->lp_group[config_ptr->target_socket].num; i++)
+                    CPU_SET(thread_affinity->lp_group[config_ptr->target_socket].group[i], &thread_affinity->group_affinity);
             }
         }
         else {
@@ -328,21 +458,21 @@ void EbSetThreadManagementParameters(EbSvtAv1EncConfiguration *config_ptr)
                 uint32_t lps = config_ptr->logical_processors == 0 ? num_logical_processors :
                     config_ptr->logical_processors < num_logical_processors ? config_ptr->logical_processors : num_logical_processors;
                 if (lps > num_lp_per_group) {
-                    for (uint32_t i = 0; i < lp_group[0].num; i++)
-                        CPU_SET(lp_group[0].group[i], &group_affinity);
-                    for (uint32_t i = 0; i < (lps - lp_group[0].num); i++)
-                        CPU_SET(lp_group[1].group[i], &group_affinity);
+                    for (uint32_t i = 0; i < thread_affinity->lp_group[0].num; i++)
+                        CPU_SET(thread_affinity->lp_group[0].group[i], &thread_affinity->group_affinity);
+                    for (uint32_t i = 0; i < (lps - thread_affinity->lp_group[0].num); i++)
+                        CPU_SET(thread_affinity->lp_group[1].group[i], &thread_affinity->group_affinity);
                 }
                 else {
                     for (uint32_t i = 0; i < lps; i++)
-                        CPU_SET(lp_group[0].group[i], &group_affinity);
+                        CPU_SET(thread_affinity->lp_group[0].group[i], &thread_affinity->group_affinity);
                 }
             }
             else {
                 uint32_t lps = config_ptr->logical_processors == 0 ? num_lp_per_group :
                     config_ptr->logical_processors < num_lp_per_group ? config_ptr->logical_processors : num_lp_per_group;
                 for (uint32_t i = 0; i < lps; i++)
-                    CPU_SET(lp_group[config_ptr->target_socket].group[i], &group_affinity);
+                    CPU_SET(thread_affinity->lp_group[config_ptr->target_socket].group[i], &thread_affinity->group_affinity);
             }
         }
     }
@@ -385,7 +515,7 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         fps        = fps < 24  ? 24    : fps;
 
         ppcs_count = MAX(min_ppcs_count, fps);
-        if (core_count <= SINGLE_CORE_COUNT)
+        if (core_count <= SINGLE_CORE_COUNT || config->pred_structure != EB_PRED_RANDOM_ACCESS)
             ppcs_count = min_ppcs_count;
         else{
             if (res_class < INPUT_SIZE_1080i_RANGE){
@@ -425,8 +555,34 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         return -1;
     }
 }
-EbErrorType load_default_buffer_configuration_settings(
+// Pictures held by the scene change detection window of picture decision,
+// none in low delay
+static uint32_t get_scd_lad(
     SequenceControlSet       *sequence_control_set_ptr){
+    return sequence_control_set_ptr->static_config.pred_structure == EB_PRED_RANDOM_ACCESS ? SCD_LAD : 0;
+}
+static uint32_t get_picture_control_set_pool_count(
+    SequenceControlSet       *sequence_control_set_ptr,
+    uint32_t                  input_pic){
+    uint32_t ppcs_count = input_pic + get_scd_lad(sequence_control_set_ptr) + sequence_control_set_ptr->static_config.look_ahead_distance;
+    if (sequence_control_set_ptr->static_config.enable_overlays)
+        ppcs_count = MAX(ppcs_count,
+            sequence_control_set_ptr->static_config.look_ahead_distance + // frames in the LAD
+            sequence_control_set_ptr->static_config.look_ahead_distance / (1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1 +  // number of overlayes in the LAD
+            ((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
+            (1 << sequence_control_set_ptr->static_config.hierarchical_levels)); // minigop in PM
+    return ppcs_count;
+}
+static uint32_t get_reference_picture_buffer_count(
+    SequenceControlSet       *sequence_control_set_ptr,
+    uint32_t                  input_pic){
+    return MAX((uint32_t)(input_pic >> 1),
+               (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
+           sequence_control_set_ptr->static_config.look_ahead_distance + get_scd_lad(sequence_control_set_ptr);
+}
+EbErrorType load_default_buffer_configuration_settings(
+    SequenceControlSet       *sequence_control_set_ptr,
+    const EbThreadAffinity   *thread_affinity){
     EbErrorType           return_error = EB_ErrorNone;
     uint32_t encDecSegH = (sequence_control_set_ptr->static_config.super_block_size == 128) ?
         ((sequence_control_set_ptr->max_input_luma_height + 64) / 128) :
@@ -443,27 +599,34 @@ EbErrorType load_default_buffer_configuration_settings(
     uint32_t meSegH     = (((sequence_control_set_ptr->max_input_luma_height + 32) / BLOCK_SIZE_64) < 6) ? 1 : 6;
     uint32_t meSegW     = (((sequence_control_set_ptr->max_input_luma_width + 32) / BLOCK_SIZE_64) < 10) ? 1 : 10;
 
-    unsigned int lp_count   = GetNumProcessors();
+    unsigned int lp_count   = GetNumProcessors(thread_affinity);
     unsigned int core_count = lp_count;
 #if defined(_WIN32) || defined(__linux__)
     if (sequence_control_set_ptr->static_config.target_socket != -1)
-        core_count /= num_groups;
+        core_count /= thread_affinity->num_groups;
     if (sequence_control_set_ptr->static_config.logical_processors != 0)
         core_count = sequence_control_set_ptr->static_config.logical_processors < core_count ?
             sequence_control_set_ptr->static_config.logical_processors: core_count;
 #endif
+    if (sequence_control_set_ptr->static_config.numa_node != -1) {
+        core_count = GetNumaNodeProcessors(sequence_control_set_ptr->static_config.numa_node);
+        if (sequence_control_set_ptr->static_config.logical_processors != 0)
+            core_count = MIN(core_count, sequence_control_set_ptr->static_config.logical_processors);
+    }
 
 #ifdef _WIN32
     //Handle special case on Windows
     //By default, on Windows an application is constrained to a single group
     if (sequence_control_set_ptr->static_config.target_socket == -1 &&
+        sequence_control_set_ptr->static_config.numa_node == -1 &&
         sequence_control_set_ptr->static_config.logical_processors == 0)
-        core_count /= num_groups;
+        core_count /= thread_affinity->num_groups;
 
     //Affininty can only be set by group on Windows.
     //Run on both sockets if -lp is larger than logical processor per group.
     if (sequence_control_set_ptr->static_config.target_socket == -1 &&
-        sequence_control_set_ptr->static_config.logical_processors > lp_count / num_groups)
+        sequence_control_set_ptr->static_config.numa_node == -1 &&
+        sequence_control_set_ptr->static_config.logical_processors > lp_count / thread_affinity->num_groups)
         core_count = lp_count;
 #endif
     int32_t return_ppcs = set_parent_pcs(&sequence_control_set_ptr->static_config,
@@ -471,9 +634,17 @@ EbErrorType load_default_buffer_configuration_settings(
     if (return_ppcs == -1)
         return EB_ErrorInsufficientResources;
     uint32_t input_pic = (uint32_t)return_ppcs;
-    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
+    // Adaptive pools start at the single core size and grow toward input_pic
+    uint32_t start_pic = input_pic;
+    if (sequence_control_set_ptr->static_config.adaptive_pool_sizing)
+        start_pic = MIN((uint32_t)set_parent_pcs(&sequence_control_set_ptr->static_config,
+            SINGLE_CORE_COUNT, sequence_control_set_ptr->input_resolution), input_pic);
+    sequence_control_set_ptr->input_buffer_fifo_init_count = input_pic + get_scd_lad(sequence_control_set_ptr) + sequence_control_set_ptr->static_config.look_ahead_distance;
     sequence_control_set_ptr->output_stream_buffer_fifo_init_count =
         sequence_control_set_ptr->input_buffer_fifo_init_count + 4;
+    sequence_control_set_ptr->input_buffer_fifo_start_count = start_pic + get_scd_lad(sequence_control_set_ptr) + sequence_control_set_ptr->static_config.look_ahead_distance;
+    sequence_control_set_ptr->output_stream_buffer_fifo_start_count =
+        sequence_control_set_ptr->input_buffer_fifo_start_count + 4;
 
     // ME segments
     sequence_control_set_ptr->me_segment_row_count_array[0] = meSegH;
@@ -519,20 +690,13 @@ EbErrorType load_default_buffer_configuration_settings(
     sequence_control_set_ptr->tf_segment_column_count = meSegW;//1;//
     sequence_control_set_ptr->tf_segment_row_count =  meSegH;//1;//
     //#====================== Data Structures and Picture Buffers ======================
-    sequence_control_set_ptr->picture_control_set_pool_init_count       = input_pic + SCD_LAD + sequence_control_set_ptr->static_config.look_ahead_distance;
-    if (sequence_control_set_ptr->static_config.enable_overlays)
-        sequence_control_set_ptr->picture_control_set_pool_init_count = MAX(sequence_control_set_ptr->picture_control_set_pool_init_count,
-            sequence_control_set_ptr->static_config.look_ahead_distance + // frames in the LAD
-            sequence_control_set_ptr->static_config.look_ahead_distance / (1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 1 +  // number of overlayes in the LAD
-            ((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD) * 2 +// minigop formation in PD + SCD_LAD *(normal pictures + potential pictures )
-            (1 << sequence_control_set_ptr->static_config.hierarchical_levels)); // minigop in PM
+    sequence_control_set_ptr->picture_control_set_pool_init_count       = get_picture_control_set_pool_count(sequence_control_set_ptr, input_pic);
+    sequence_control_set_ptr->picture_control_set_pool_start_count      = get_picture_control_set_pool_count(sequence_control_set_ptr, start_pic);
     sequence_control_set_ptr->picture_control_set_pool_init_count_child = MAX(MAX(MIN(3, core_count/2), core_count / 6), 1);
-    sequence_control_set_ptr->reference_picture_buffer_init_count       = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
-    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = MAX((uint32_t)(input_pic >> 1),
-                                                                          (uint32_t)((1 << sequence_control_set_ptr->static_config.hierarchical_levels) + 2)) +
-                                                                          sequence_control_set_ptr->static_config.look_ahead_distance + SCD_LAD;
+    sequence_control_set_ptr->reference_picture_buffer_init_count       = get_reference_picture_buffer_count(sequence_control_set_ptr, input_pic);
+    sequence_control_set_ptr->reference_picture_buffer_start_count      = get_reference_picture_buffer_count(sequence_control_set_ptr, start_pic);
+    sequence_control_set_ptr->pa_reference_picture_buffer_init_count    = get_reference_picture_buffer_count(sequence_control_set_ptr, input_pic);
+    sequence_control_set_ptr->pa_reference_picture_buffer_start_count   = get_reference_picture_buffer_count(sequence_control_set_ptr, start_pic);
     sequence_control_set_ptr->output_recon_buffer_fifo_init_count       = sequence_control_set_ptr->reference_picture_buffer_init_count;
     sequence_control_set_ptr->overlay_input_picture_buffer_init_count   = sequence_control_set_ptr->static_config.enable_overlays ?
                                                                           (2 << sequence_control_set_ptr->static_config.hierarchical_levels) + SCD_LAD : 1;
@@ -575,8 +739,16 @@ EbErrorType load_default_buffer_configuration_settings(
         sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->cdef_process_init_count                        = 1);
         sequence_control_set_ptr->total_process_init_count += (sequence_control_set_ptr->rest_process_init_count                        = 1);
     }
+    // The tiles of a picture are entropy coded concurrently, give them the threads
+    if (core_count > 1 && (sequence_control_set_ptr->static_config.tile_rows || sequence_control_set_ptr->static_config.tile_columns)) {
+        const uint32_t tile_count = (1 << sequence_control_set_ptr->static_config.tile_rows) * (1 << sequence_control_set_ptr->static_config.tile_columns);
+        const uint32_t entropy_coding_process_init_count = MAX(sequence_control_set_ptr->entropy_coding_process_init_count, MIN(tile_count, core_count >> 1));
+        sequence_control_set_ptr->total_process_init_count += entropy_coding_process_init_count - sequence_control_set_ptr->entropy_coding_process_init_count;
+        sequence_control_set_ptr->entropy_coding_process_init_count = entropy_coding_process_init_count;
+    }
 
     sequence_control_set_ptr->total_process_init_count += 6; // single processes count
+    sequence_control_set_ptr->core_count = core_count;
     printf("Number of logical cores available: %u\nNumber of PPCS %u\n", core_count, sequence_control_set_ptr->picture_control_set_pool_init_count);
 
     return return_error;
@@ -666,27 +838,16 @@ static EbErrorType eb_enc_handle_ctor(
     *encHandleDblPtr          = enc_handle_ptr;
     if (enc_handle_ptr == (EbEncHandle*)EB_NULL)
         return EB_ErrorInsufficientResources;
-    enc_handle_ptr->memory_map                = (EbMemoryMapEntry*)malloc(sizeof(EbMemoryMapEntry));
-    enc_handle_ptr->memory_map_index          = 0;
-    enc_handle_ptr->total_lib_memory          = sizeof(EbComponentType) + sizeof(EbEncHandle) + sizeof(EbMemoryMapEntry);
-    enc_handle_ptr->memory_map_init_address   = enc_handle_ptr->memory_map;
-    // Save Memory Map Pointers
-    total_lib_memory                        = &enc_handle_ptr->total_lib_memory;
-    memory_map                              = enc_handle_ptr->memory_map;
-    memory_map_index                        = &enc_handle_ptr->memory_map_index;
-    lib_malloc_count                        = 0;
-    lib_thread_count                        = 0;
-    lib_mutex_count                         = 0;
-    lib_semaphore_count                     = 0;
-
-    if (memory_map == (EbMemoryMapEntry*)EB_NULL)
+    // All the allocations of the instance go to its arena
+    return_error = eb_memory_arena_ctor(&enc_handle_ptr->memory_arena);
+    if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
+    eb_memory_arena_set_current(enc_handle_ptr->memory_arena);
 
-    return_error = InitThreadManagmentParams();
+    return_error = InitThreadManagmentParams(&enc_handle_ptr->thread_affinity);
 
     if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
-    enc_handle_ptr->memory_map->prev_entry                                = EB_NULL;
     enc_handle_ptr->encode_instance_total_count                           = EB_EncodeInstancesTotalCount;
     enc_handle_ptr->compute_segments_total_count_array                    = EB_ComputeSegmentInitCount;
     // Config Set Count
@@ -703,6 +864,30 @@ static EbErrorType eb_enc_handle_ctor(
     // Overlay input picture
     enc_handle_ptr->overlay_input_picture_pool_ptr_array = (EbSystemResource**)EB_NULL;
     enc_handle_ptr->overlay_input_picture_pool_producer_fifo_ptr_dbl_array = (EbFifo***)EB_NULL;
+
+    // Zero copy input
+    enc_handle_ptr->input_release_cb = NULL;
+    enc_handle_ptr->input_release_data_ptr = EB_NULL;
+    enc_handle_ptr->zero_copy_input = EB_FALSE;
+    enc_handle_ptr->input_blank_picture_ptr = (EbPictureBufferDesc*)EB_NULL;
+    enc_handle_ptr->input_stride_y = 0;
+    enc_handle_ptr->input_stride_ch = 0;
+    // Output packet allocator
+    enc_handle_ptr->packet_alloc_cb = NULL;
+    enc_handle_ptr->packet_release_cb = NULL;
+    enc_handle_ptr->packet_buf_priv_ptr = EB_NULL;
+    // First pass statistics
+    enc_handle_ptr->first_pass_stats = (uint8_t*)EB_NULL;
+    enc_handle_ptr->first_pass_stats_size = 0;
+    // Motion estimation hints
+    enc_handle_ptr->me_hints_write_cb = NULL;
+    enc_handle_ptr->me_hints_read_cb = NULL;
+    enc_handle_ptr->me_hints_priv_ptr = EB_NULL;
+#if PIPELINE_STATS
+    enc_handle_ptr->thread_stats_array = (EbThreadStats*)EB_NULL;
+    enc_handle_ptr->thread_stats_size = 0;
+    enc_handle_ptr->thread_stats_count = 0;
+#endif
     // Picture Buffer Producer Fifos
     enc_handle_ptr->reference_picture_pool_producer_fifo_ptr_dbl_array    = (EbFifo***)EB_NULL;
     enc_handle_ptr->pa_reference_picture_pool_producer_fifo_ptr_dbl_array = (EbFifo***)EB_NULL;
@@ -803,6 +988,61 @@ EbErrorType EbInputBufferHeaderCtor(
     EbPtr *objectDblPtr,
     EbPtr  objectInitDataPtr);
 
+EbErrorType EbZeroCopyInputBufferHeaderCtor(
+    EbPtr *objectDblPtr,
+    EbPtr  objectInitDataPtr);
+
+/* Zero copy input : the input picture is handed back to the application once
+   the pipeline and the PA reference made from it are done with it */
+static void release_zero_copy_input(
+    EbPtr object_ptr,
+    EbPtr release_data_ptr)
+{
+    EbEncHandle         *enc_handle_ptr = (EbEncHandle*)release_data_ptr;
+    EbBufferHeaderType  *input_ptr = (EbBufferHeaderType*)object_ptr;
+    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)input_ptr->p_buffer;
+
+    if (input_picture_ptr->buffer_y == enc_handle_ptr->input_blank_picture_ptr->buffer_y)
+        return;
+    input_picture_ptr->buffer_y = enc_handle_ptr->input_blank_picture_ptr->buffer_y;
+    input_picture_ptr->buffer_cb = enc_handle_ptr->input_blank_picture_ptr->buffer_cb;
+    input_picture_ptr->buffer_cr = enc_handle_ptr->input_blank_picture_ptr->buffer_cr;
+    enc_handle_ptr->input_release_cb(
+        input_ptr->p_app_private,
+        enc_handle_ptr->input_release_data_ptr);
+}
+
+static void release_pa_reference_input(
+    EbPtr object_ptr,
+    EbPtr release_data_ptr)
+{
+    EbPaReferenceObject *pa_reference_ptr = (EbPaReferenceObject*)object_ptr;
+
+    (void)release_data_ptr;
+    if (pa_reference_ptr->input_picture_wrapper_ptr) {
+        eb_release_object(pa_reference_ptr->input_picture_wrapper_ptr);
+        pa_reference_ptr->input_picture_wrapper_ptr = (EbObjectWrapper*)EB_NULL;
+    }
+}
+
+static void release_ext_packet_buffer(
+    EbPtr object_ptr,
+    EbPtr release_data_ptr)
+{
+    EbEncHandle          *enc_handle_ptr = (EbEncHandle*)release_data_ptr;
+    EbOutputStreamBuffer *output_stream_ptr = (EbOutputStreamBuffer*)object_ptr;
+
+    if (output_stream_ptr->ext_buf.buffer == NULL)
+        return;
+    enc_handle_ptr->packet_release_cb(
+        &output_stream_ptr->ext_buf,
+        enc_handle_ptr->packet_buf_priv_ptr);
+    output_stream_ptr->ext_buf.buffer = NULL;
+    output_stream_ptr->ext_buf.buffer_size = 0;
+    output_stream_ptr->header.p_buffer = NULL;
+    output_stream_ptr->header.n_alloc_len = 0;
+}
+
 EbErrorType EbOutputReconBufferHeaderCtor(
     EbPtr *objectDblPtr,
     EbPtr  objectInitDataPtr);
@@ -872,6 +1112,12 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     EbBool is16bit = (EbBool)(enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT);
     EbColorFormat color_format = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.encoder_color_format;
 
+    eb_memory_arena_set_current(enc_handle_ptr->memory_arena);
+    // The pictures and all the buffers below go to the memory of the node
+    eb_memory_arena_set_numa_node(
+        enc_handle_ptr->memory_arena,
+        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.numa_node);
+
     /************************************
     * Plateform detection
     ************************************/
@@ -895,6 +1141,46 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     av1_init_me_luts();
     init_fn_ptr();
 
+    // Zero copy input, for the formats whose planes are used as sent
+    enc_handle_ptr->zero_copy_input = (EbBool)(enc_handle_ptr->input_release_cb != NULL &&
+        (!is16bit || enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.compressed_ten_bit_format == 1));
+    enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->zero_copy_input = enc_handle_ptr->zero_copy_input;
+    enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->packet_alloc_cb = enc_handle_ptr->packet_alloc_cb;
+    enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->packet_buf_priv_ptr = enc_handle_ptr->packet_buf_priv_ptr;
+
+    // Two pass statistics, written by the packetization of the first pass or
+    // read by the rate control of the second pass
+    if (enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.pass == 1) {
+        return_error = first_pass_stats_ctor(
+            &enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->first_pass_stats,
+            &enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->first_pass_stats_size,
+            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+    else if (enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.pass == 2) {
+        return_error = first_pass_stats_check(
+            enc_handle_ptr->first_pass_stats,
+            enc_handle_ptr->first_pass_stats_size,
+            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+        enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->first_pass_stats = enc_handle_ptr->first_pass_stats;
+        enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->first_pass_stats_size = enc_handle_ptr->first_pass_stats_size;
+    }
+
+    // Motion estimation hints, read by the picture decision and written by
+    // the initial rate control
+    if (enc_handle_ptr->me_hints_write_cb || enc_handle_ptr->me_hints_read_cb) {
+        return_error = me_hints_ctor(
+            &enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->me_hints,
+            enc_handle_ptr->me_hints_write_cb,
+            enc_handle_ptr->me_hints_read_cb,
+            enc_handle_ptr->me_hints_priv_ptr);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+
     /************************************
     * Sequence Control Set
     ************************************/
@@ -944,8 +1230,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         inputData.in_loop_me_flag = (uint8_t)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.in_loop_me_flag;
         inputData.mrp_mode = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->mrp_mode;
         inputData.nsq_present = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->nsq_present;
-        return_error = eb_system_resource_ctor(
+        return_error = eb_system_resource_growable_ctor(
             &(enc_handle_ptr->picture_parent_control_set_pool_ptr_array[instance_index]),
+            enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->picture_control_set_pool_start_count,
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->picture_control_set_pool_init_count,//enc_handle_ptr->picture_control_set_pool_total_count,
             1,
             0,
@@ -953,7 +1240,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo ***)EB_NULL,
             EB_FALSE,
             picture_parent_control_set_ctor,
-            &inputData);
+            &inputData,
+            sizeof(inputData),
+            (uint64_t)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.memory_budget << 20);
         if (return_error == EB_ErrorInsufficientResources)
             return EB_ErrorInsufficientResources;
     }
@@ -993,6 +1282,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         inputData.sb_size_pix = scs_init.sb_size;
         inputData.max_depth = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->max_sb_depth;
         inputData.cdf_mode = enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->cdf_mode;
+        inputData.tile_row_count = (uint16_t)(1 << enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.tile_rows);
+        inputData.tile_column_count = (uint16_t)(1 << enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.tile_columns);
         return_error = eb_system_resource_ctor(
             &(enc_handle_ptr->picture_control_set_pool_ptr_array[instance_index]),
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->picture_control_set_pool_init_count_child, //EB_PictureControlSetPoolInitCountChild,
@@ -1055,8 +1346,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbReferenceObjectDescInitDataStructure.reference_picture_desc_init_data = referencePictureBufferDescInitData;
 
         // Reference Picture Buffers
-        return_error = eb_system_resource_ctor(
+        return_error = eb_system_resource_growable_ctor(
             &enc_handle_ptr->reference_picture_pool_ptr_array[instance_index],
+            enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->reference_picture_buffer_start_count,
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->reference_picture_buffer_init_count,//enc_handle_ptr->reference_picture_pool_total_count,
             EB_PictureManagerProcessInitCount,
             0,
@@ -1064,7 +1356,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo ***)EB_NULL,
             EB_FALSE,
             eb_reference_object_ctor,
-            &(EbReferenceObjectDescInitDataStructure));
+            &(EbReferenceObjectDescInitDataStructure),
+            sizeof(EbReferenceObjectDescInitDataStructure),
+            (uint64_t)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.memory_budget << 20);
 
         if (return_error == EB_ErrorInsufficientResources)
             return EB_ErrorInsufficientResources;
@@ -1108,8 +1402,9 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
         EbPaReferenceObjectDescInitDataStructure.quarter_picture_desc_init_data = quarterPictureBufferDescInitData;
         EbPaReferenceObjectDescInitDataStructure.sixteenth_picture_desc_init_data = sixteenthPictureBufferDescInitData;
         // Reference Picture Buffers
-        return_error = eb_system_resource_ctor(
+        return_error = eb_system_resource_growable_ctor(
             &enc_handle_ptr->pa_reference_picture_pool_ptr_array[instance_index],
+            enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->pa_reference_picture_buffer_start_count,
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->pa_reference_picture_buffer_init_count,
             EB_PictureDecisionProcessInitCount,
             0,
@@ -1117,9 +1412,17 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             (EbFifo ***)EB_NULL,
             EB_FALSE,
             eb_pa_reference_object_ctor,
-            &(EbPaReferenceObjectDescInitDataStructure));
+            &(EbPaReferenceObjectDescInitDataStructure),
+            sizeof(EbPaReferenceObjectDescInitDataStructure),
+            (uint64_t)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.memory_budget << 20);
         if (return_error == EB_ErrorInsufficientResources)
             return EB_ErrorInsufficientResources;
+        if (enc_handle_ptr->zero_copy_input) {
+            eb_system_resource_set_release_callback(
+                enc_handle_ptr->pa_reference_picture_pool_ptr_array[instance_index],
+                release_pa_reference_input,
+                EB_NULL);
+        }
         // Set the SequenceControlSet Picture Pool Fifo Ptrs
         enc_handle_ptr->sequence_control_set_instance_array[instance_index]->encode_context_ptr->reference_picture_pool_fifo_ptr = (enc_handle_ptr->reference_picture_pool_producer_fifo_ptr_dbl_array[instance_index])[0];
         enc_handle_ptr->sequence_control_set_instance_array[instance_index]->encode_context_ptr->pa_reference_picture_pool_fifo_ptr = (enc_handle_ptr->pa_reference_picture_pool_producer_fifo_ptr_dbl_array[instance_index])[0];
@@ -1149,27 +1452,60 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     ************************************/
 
     // EbBufferHeaderType Input
-    return_error = eb_system_resource_ctor(
+    // In zero copy mode the buffers hold no planes, and a PA reference keeps
+    // its input buffer : one more buffer per PA reference
+    return_error = eb_system_resource_growable_ctor(
         &enc_handle_ptr->input_buffer_resource_ptr,
-        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->input_buffer_fifo_init_count,
+        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->input_buffer_fifo_start_count +
+        (enc_handle_ptr->zero_copy_input ? enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->pa_reference_picture_buffer_start_count : 0),
+        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->input_buffer_fifo_init_count +
+        (enc_handle_ptr->zero_copy_input ? enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->pa_reference_picture_buffer_init_count : 0),
         1,
         EB_ResourceCoordinationProcessInitCount,
         &enc_handle_ptr->input_buffer_producer_fifo_ptr_array,
         &enc_handle_ptr->input_buffer_consumer_fifo_ptr_array,
         EB_TRUE,
-        EbInputBufferHeaderCtor,
-        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr);
+        enc_handle_ptr->zero_copy_input ? EbZeroCopyInputBufferHeaderCtor : EbInputBufferHeaderCtor,
+        enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr,
+        0,
+        (uint64_t)enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.memory_budget << 20);
 
     if (return_error == EB_ErrorInsufficientResources)
         return EB_ErrorInsufficientResources;
+    if (enc_handle_ptr->zero_copy_input) {
+        EbPictureBufferDescInitData blank_picture_init_data;
+
+        blank_picture_init_data.max_width = (uint16_t)enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_width;
+        blank_picture_init_data.max_height = (uint16_t)enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height;
+        blank_picture_init_data.bit_depth = EB_8BIT;
+        blank_picture_init_data.color_format = color_format;
+        blank_picture_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+        blank_picture_init_data.left_padding = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->left_padding;
+        blank_picture_init_data.right_padding = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->right_padding;
+        blank_picture_init_data.top_padding = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->top_padding;
+        blank_picture_init_data.bot_padding = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->bot_padding;
+        blank_picture_init_data.split_mode = EB_FALSE;
+        blank_picture_init_data.down_sampled_filtered = EB_FALSE;
+        return_error = eb_picture_buffer_desc_ctor(
+            (EbPtr*)&enc_handle_ptr->input_blank_picture_ptr,
+            (EbPtr)&blank_picture_init_data);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+
+        eb_system_resource_set_release_callback(
+            enc_handle_ptr->input_buffer_resource_ptr,
+            release_zero_copy_input,
+            enc_handle_ptr);
+    }
     // EbBufferHeaderType Output Stream
     EB_MALLOC(EbSystemResource**, enc_handle_ptr->output_stream_buffer_resource_ptr_array, sizeof(EbSystemResource*) * enc_handle_ptr->encode_instance_total_count, EB_N_PTR);
     EB_MALLOC(EbFifo***, enc_handle_ptr->output_stream_buffer_producer_fifo_ptr_dbl_array, sizeof(EbFifo**)          * enc_handle_ptr->encode_instance_total_count, EB_N_PTR);
     EB_MALLOC(EbFifo***, enc_handle_ptr->output_stream_buffer_consumer_fifo_ptr_dbl_array, sizeof(EbFifo**)          * enc_handle_ptr->encode_instance_total_count, EB_N_PTR);
 
     for (instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
-        return_error = eb_system_resource_ctor(
+        return_error = eb_system_resource_growable_ctor(
             &enc_handle_ptr->output_stream_buffer_resource_ptr_array[instance_index],
+            enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->output_stream_buffer_fifo_start_count,
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->output_stream_buffer_fifo_init_count,
             enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->total_process_init_count,//EB_PacketizationProcessInitCount,
             1,
@@ -1177,9 +1513,18 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             &enc_handle_ptr->output_stream_buffer_consumer_fifo_ptr_dbl_array[instance_index],
             EB_TRUE,
             EbOutputBufferHeaderCtor,
-            &enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config);
+            enc_handle_ptr,
+            0,
+            (uint64_t)enc_handle_ptr->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->static_config.memory_budget << 20);
         if (return_error == EB_ErrorInsufficientResources)
             return EB_ErrorInsufficientResources;
+        // The payload goes back to the application with the packet
+        if (enc_handle_ptr->packet_alloc_cb) {
+            eb_system_resource_set_release_callback(
+                enc_handle_ptr->output_stream_buffer_resource_ptr_array[instance_index],
+                release_ext_packet_buffer,
+                enc_handle_ptr);
+        }
     }
     if (enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.recon_enabled) {
         // EbBufferHeaderType Output Recon
@@ -1644,7 +1989,8 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
             is16bit,
             color_format,
             enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_width,
-            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height
+            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->max_input_luma_height,
+            (EbBool)enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.enable_fused_loop_filter
         );
 
         if (return_error == EB_ErrorInsufficientResources)
@@ -1714,88 +2060,119 @@ EB_API EbErrorType eb_init_encoder(EbComponentType *svt_enc_component)
     ************************************/
     EbSvtAv1EncConfiguration   *config_ptr = &enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config;
 
-    EbSetThreadManagementParameters(config_ptr);
+    EbSetThreadManagementParameters(&enc_handle_ptr->thread_affinity, config_ptr);
+
+    enc_handle_ptr->thread_pool_ptr = NULL;
+    if (config_ptr->enable_thread_pool) {
+        return_error = eb_thread_pool_ctor(
+            &enc_handle_ptr->thread_pool_ptr,
+            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->core_count);
+        if (return_error == EB_ErrorInsufficientResources)
+            return EB_ErrorInsufficientResources;
+    }
+
+#if PIPELINE_STATS
+    {
+        SequenceControlSet *scs_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+        // The single thread kernels, then the multi thread ones
+        uint32_t thread_count = 6 +
+            scs_ptr->picture_analysis_process_init_count +
+            scs_ptr->motion_estimation_process_init_count +
+            scs_ptr->source_based_operations_process_init_count +
+            scs_ptr->mode_decision_configuration_process_init_count +
+            scs_ptr->enc_dec_process_init_count +
+            scs_ptr->dlf_process_init_count +
+            scs_ptr->cdef_process_init_count +
+            scs_ptr->rest_process_init_count +
+            scs_ptr->entropy_coding_process_init_count;
+
+        EB_CALLOC(EbThreadStats*, enc_handle_ptr->thread_stats_array, thread_count, sizeof(EbThreadStats), EB_N_PTR);
+        enc_handle_ptr->thread_stats_size = thread_count;
+        enc_handle_ptr->thread_stats_count = 0;
+        enc_handle_ptr->pipeline_start_time = eb_pipeline_stats_time();
+    }
+#endif
 
     // Resource Coordination
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->resource_coordination_thread_handle, sizeof(EbHandle), EB_THREAD, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->resource_coordination_thread_handle, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
 
     // Picture Analysis
     EB_MALLOC(EbHandle*, enc_handle_ptr->picture_analysis_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->picture_analysis_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->picture_analysis_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->picture_analysis_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, picture_analysis_kernel, enc_handle_ptr->picture_analysis_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->picture_analysis_thread_handle_array[processIndex], picture_analysis_kernel, enc_handle_ptr->picture_analysis_context_ptr_array[processIndex]);
     }
 
     // Picture Decision
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->picture_decision_thread_handle, sizeof(EbHandle), EB_THREAD, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->picture_decision_thread_handle, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
 
     // Motion Estimation
     EB_MALLOC(EbHandle*, enc_handle_ptr->motion_estimation_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->motion_estimation_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->motion_estimation_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->motion_estimation_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, motion_estimation_kernel, enc_handle_ptr->motion_estimation_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->motion_estimation_thread_handle_array[processIndex], motion_estimation_kernel, enc_handle_ptr->motion_estimation_context_ptr_array[processIndex]);
     }
 
     // Initial Rate Control
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->initial_rate_control_thread_handle, sizeof(EbHandle), EB_THREAD, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->initial_rate_control_thread_handle, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
 
     // Source Based Oprations
     EB_MALLOC(EbHandle*, enc_handle_ptr->source_based_operations_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->source_based_operations_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->source_based_operations_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->source_based_operations_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, source_based_operations_kernel, enc_handle_ptr->source_based_operations_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->source_based_operations_thread_handle_array[processIndex], source_based_operations_kernel, enc_handle_ptr->source_based_operations_context_ptr_array[processIndex]);
     }
 
     // Picture Manager
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->picture_manager_thread_handle, sizeof(EbHandle), EB_THREAD, picture_manager_kernel, enc_handle_ptr->picture_manager_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->picture_manager_thread_handle, picture_manager_kernel, enc_handle_ptr->picture_manager_context_ptr);
 
     // Rate Control
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->rate_control_thread_handle, sizeof(EbHandle), EB_THREAD, rate_control_kernel, enc_handle_ptr->rate_control_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->rate_control_thread_handle, rate_control_kernel, enc_handle_ptr->rate_control_context_ptr);
 
     // Mode Decision Configuration Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->mode_decision_configuration_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->mode_decision_configuration_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->mode_decision_configuration_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, mode_decision_configuration_kernel, enc_handle_ptr->mode_decision_configuration_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->mode_decision_configuration_thread_handle_array[processIndex], mode_decision_configuration_kernel, enc_handle_ptr->mode_decision_configuration_context_ptr_array[processIndex]);
     }
 
     // EncDec Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->enc_dec_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->enc_dec_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->enc_dec_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->enc_dec_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, enc_dec_kernel, enc_handle_ptr->enc_dec_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->enc_dec_thread_handle_array[processIndex], enc_dec_kernel, enc_handle_ptr->enc_dec_context_ptr_array[processIndex]);
     }
 
     // Dlf Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->dlf_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->dlf_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->dlf_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->dlf_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, dlf_kernel, enc_handle_ptr->dlf_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->dlf_thread_handle_array[processIndex], dlf_kernel, enc_handle_ptr->dlf_context_ptr_array[processIndex]);
     }
 
     // Cdef Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->cdef_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->cdef_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->cdef_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->cdef_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, cdef_kernel, enc_handle_ptr->cdef_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->cdef_thread_handle_array[processIndex], cdef_kernel, enc_handle_ptr->cdef_context_ptr_array[processIndex]);
     }
 
     // Rest Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->rest_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->rest_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->rest_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->rest_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, rest_kernel, enc_handle_ptr->rest_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->rest_thread_handle_array[processIndex], rest_kernel, enc_handle_ptr->rest_context_ptr_array[processIndex]);
     }
 
     // Entropy Coding Process
     EB_MALLOC(EbHandle*, enc_handle_ptr->entropy_coding_thread_handle_array, sizeof(EbHandle) * enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->entropy_coding_process_init_count, EB_N_PTR);
 
     for (processIndex = 0; processIndex < enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->entropy_coding_process_init_count; ++processIndex) {
-        EB_CREATETHREAD(EbHandle, enc_handle_ptr->entropy_coding_thread_handle_array[processIndex], sizeof(EbHandle), EB_THREAD, entropy_coding_kernel, enc_handle_ptr->entropy_coding_context_ptr_array[processIndex]);
+        EB_CREATE_KERNEL_THREAD(enc_handle_ptr->entropy_coding_thread_handle_array[processIndex], entropy_coding_kernel, enc_handle_ptr->entropy_coding_context_ptr_array[processIndex]);
     }
 
     // Packetization
-    EB_CREATETHREAD(EbHandle, enc_handle_ptr->packetization_thread_handle, sizeof(EbHandle), EB_THREAD, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
+    EB_CREATE_KERNEL_THREAD(enc_handle_ptr->packetization_thread_handle, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
 
 #if DISPLAY_MEMORY
     EB_MEMORY();
@@ -1816,42 +2193,35 @@ EB_API EbErrorType eb_deinit_encoder(EbComponentType *svt_enc_component){
     EbErrorType          return_error = EB_ErrorNone;
 
     if (enc_handle_ptr) {
-        if (memory_map) {
-            // Loop through the ptr table and free all malloc'd pointers per channel
-            EbMemoryMapEntry*    memory_entry = memory_map;
-            if (memory_entry){
-                do {
-                    switch (memory_entry->ptr_type) {
-                        case EB_N_PTR:
-                            free(memory_entry->ptr);
-                            break;
-                        case EB_A_PTR:
-#ifdef _WIN32
-                            _aligned_free(memory_entry->ptr);
-#else
-                            free(memory_entry->ptr);
-#endif
-                            break;
-                        case EB_SEMAPHORE:
-                            eb_destroy_semaphore(memory_entry->ptr);
-                            break;
-                        case EB_THREAD:
-                            eb_destroy_thread(memory_entry->ptr);
-                            break;
-                        case EB_MUTEX:
-                            eb_destroy_mutex(memory_entry->ptr);
-                            break;
-                        default:
-                            return_error = EB_ErrorMax;
-                            break;
-                    }
-                    EbMemoryMapEntry*    tmp_memory_entry = memory_entry;
-                    memory_entry = (EbMemoryMapEntry*)tmp_memory_entry->prev_entry;
-                    if (tmp_memory_entry) free(tmp_memory_entry);
-                } while(memory_entry != enc_handle_ptr->memory_map_init_address && memory_entry);
-                if (enc_handle_ptr->memory_map_init_address) free(enc_handle_ptr->memory_map_init_address);
+        // Hand back the input pictures still held by the encoder, the
+        // pictures of the last references are never released otherwise
+        if (enc_handle_ptr->zero_copy_input && enc_handle_ptr->input_blank_picture_ptr) {
+            EbSystemResource *input_resource_ptr = enc_handle_ptr->input_buffer_resource_ptr;
+            for (uint32_t i = 0; i < input_resource_ptr->object_count; ++i) {
+                EbBufferHeaderType  *input_ptr = (EbBufferHeaderType*)input_resource_ptr->wrapper_ptr_pool[i]->object_ptr;
+                EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)input_ptr->p_buffer;
+                if (input_picture_ptr->buffer_y)
+                    release_zero_copy_input(input_ptr, enc_handle_ptr);
+            }
+        }
+        // Same for the packets not released by the application
+        if (enc_handle_ptr->packet_alloc_cb && enc_handle_ptr->output_stream_buffer_resource_ptr_array) {
+            for (uint32_t instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; ++instance_index) {
+                EbSystemResource *output_resource_ptr = enc_handle_ptr->output_stream_buffer_resource_ptr_array[instance_index];
+                for (uint32_t i = 0; output_resource_ptr && i < output_resource_ptr->object_count; ++i)
+                    release_ext_packet_buffer(output_resource_ptr->wrapper_ptr_pool[i]->object_ptr, enc_handle_ptr);
             }
         }
+        // The renditions of a lead going away search on their own
+        LadderAnalysis *ladder_analysis_ptr = enc_handle_ptr->sequence_control_set_instance_array ?
+            enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->ladder_analysis : (LadderAnalysis*)EB_NULL;
+        if (ladder_analysis_ptr && enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr->ladder_lead)
+            ladder_analysis_stop(ladder_analysis_ptr);
+        // Threads first, then all the memory at once
+        eb_memory_arena_dtor(enc_handle_ptr->memory_arena);
+        enc_handle_ptr->memory_arena = NULL;
+        if (ladder_analysis_ptr)
+            ladder_analysis_release(ladder_analysis_ptr);
     }
     return return_error;
 }
@@ -1908,8 +2278,11 @@ EbErrorType eb_h265_enc_component_de_init(EbComponentType  *svt_enc_component)
 {
     EbErrorType       return_error = EB_ErrorNone;
 
-    if (svt_enc_component->p_component_private)
+    if (svt_enc_component->p_component_private) {
+        // Left by a handle never deinitialized
+        eb_memory_arena_dtor(((EbEncHandle *)svt_enc_component->p_component_private)->memory_arena);
         free((EbEncHandle *)svt_enc_component->p_component_private);
+    }
     else
         return_error = EB_ErrorUndefined;
     return return_error;
@@ -1980,7 +2353,7 @@ void SetDefaultConfigurationParameters(
 static uint32_t compute_default_look_ahead(
     EbSvtAv1EncConfiguration*   config){
     int32_t lad = 0;
-    if (config->rate_control_mode == 0)
+    if (rc_is_qp_based(config->rate_control_mode))
         lad = (2 << config->hierarchical_levels)+1;
     else
         lad = config->intra_period_length;
@@ -2000,9 +2373,9 @@ static uint32_t cap_look_ahead_distance(
         uint32_t max_cqp_lad = (2 << config->hierarchical_levels) + 1;
         uint32_t max_rc_lad  = fps << 1;
         lad = config->look_ahead_distance;
-        if (config->rate_control_mode == 0 && lad > max_cqp_lad)
+        if (rc_is_qp_based(config->rate_control_mode) && lad > max_cqp_lad)
             lad = max_cqp_lad;
-        else if (config->rate_control_mode != 0 && lad > max_rc_lad)
+        else if (!rc_is_qp_based(config->rate_control_mode) && lad > max_rc_lad)
             lad = max_rc_lad;
     }
 
@@ -2054,7 +2427,7 @@ void SetParamBasedOnInput(SequenceControlSet *sequence_control_set_ptr)
         sequence_control_set_ptr,
         sequence_control_set_ptr->seq_header.max_frame_width*sequence_control_set_ptr->seq_header.max_frame_height);
     sequence_control_set_ptr->static_config.super_block_size       = (sequence_control_set_ptr->static_config.enc_mode == ENC_M0 && sequence_control_set_ptr->input_resolution >= INPUT_SIZE_1080i_RANGE) ? 128 : 64;
-    sequence_control_set_ptr->static_config.super_block_size = (sequence_control_set_ptr->static_config.rate_control_mode > 1) ? 64 : sequence_control_set_ptr->static_config.super_block_size;
+    sequence_control_set_ptr->static_config.super_block_size = (sequence_control_set_ptr->static_config.rate_control_mode == 2 || sequence_control_set_ptr->static_config.rate_control_mode == 3) ? 64 : sequence_control_set_ptr->static_config.super_block_size;
    // sequence_control_set_ptr->static_config.hierarchical_levels = (sequence_control_set_ptr->static_config.rate_control_mode > 1) ? 3 : sequence_control_set_ptr->static_config.hierarchical_levels;
 #if INCOMPLETE_SB_FIX
     // Configure the padding
@@ -2065,7 +2438,7 @@ void SetParamBasedOnInput(SequenceControlSet *sequence_control_set_ptr)
 #endif
     sequence_control_set_ptr->static_config.enable_overlays = sequence_control_set_ptr->static_config.enable_altrefs == EB_FALSE ||
         (sequence_control_set_ptr->static_config.altref_nframes <= 1) ||
-        (sequence_control_set_ptr->static_config.rate_control_mode > 0) ||
+        !rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) ||
         sequence_control_set_ptr->static_config.encoder_bit_depth != EB_8BIT ?
         0 : sequence_control_set_ptr->static_config.enable_overlays;
 
@@ -2112,7 +2485,7 @@ void CopyApiFromApp(
     sequence_control_set_ptr->general_interlaced_source_flag = 0;
 
     // SB Definitions
-    sequence_control_set_ptr->static_config.pred_structure = 2; // Hardcoded(Cleanup)
+    sequence_control_set_ptr->static_config.pred_structure = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->pred_structure;
     sequence_control_set_ptr->static_config.enable_qp_scaling_flag = 1;
 
     sequence_control_set_ptr->max_cu_size = (uint8_t)64;
@@ -2161,6 +2534,7 @@ void CopyApiFromApp(
 
     // Deblock Filter
     sequence_control_set_ptr->static_config.disable_dlf_flag = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->disable_dlf_flag;
+    sequence_control_set_ptr->static_config.enable_fused_loop_filter = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_fused_loop_filter;
 
     // Local Warped Motion
     sequence_control_set_ptr->static_config.enable_warped_motion = EB_TRUE;
@@ -2217,13 +2591,19 @@ void CopyApiFromApp(
 
     sequence_control_set_ptr->static_config.target_bit_rate = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->target_bit_rate;
 
-    sequence_control_set_ptr->static_config.max_qp_allowed = (sequence_control_set_ptr->static_config.rate_control_mode) ?
+    // CRF keeps the QP range of CQP
+    sequence_control_set_ptr->static_config.max_qp_allowed = !rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) ?
         ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->max_qp_allowed :
         63;
 
-    sequence_control_set_ptr->static_config.min_qp_allowed = (sequence_control_set_ptr->static_config.rate_control_mode) ?
+    sequence_control_set_ptr->static_config.min_qp_allowed = !rc_is_qp_based(sequence_control_set_ptr->static_config.rate_control_mode) ?
         ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->min_qp_allowed :
         1; // lossless coding not supported
+    sequence_control_set_ptr->static_config.pass = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->pass;
+    sequence_control_set_ptr->static_config.vbv_max_rate = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->vbv_max_rate;
+    sequence_control_set_ptr->static_config.vbv_buffer_size = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->vbv_buffer_size ?
+        ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->vbv_buffer_size :
+        sequence_control_set_ptr->static_config.vbv_max_rate;
 
     //Segmentation
     //TODO: check RC mode and set only when RC is enabled in the final version.
@@ -2265,9 +2645,41 @@ void CopyApiFromApp(
     sequence_control_set_ptr->static_config.active_channel_count = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->active_channel_count;
     sequence_control_set_ptr->static_config.logical_processors = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->logical_processors;
     sequence_control_set_ptr->static_config.target_socket = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->target_socket;
+    sequence_control_set_ptr->static_config.enable_thread_pool = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->enable_thread_pool;
+    sequence_control_set_ptr->static_config.numa_node = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->numa_node;
+    sequence_control_set_ptr->static_config.adaptive_pool_sizing = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->adaptive_pool_sizing;
+    sequence_control_set_ptr->static_config.memory_budget = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->memory_budget;
     sequence_control_set_ptr->qp = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->qp;
     sequence_control_set_ptr->static_config.recon_enabled = ((EbSvtAv1EncConfiguration*)pComponentParameterStructure)->recon_enabled;
 
+    sequence_control_set_ptr->static_config.enable_altrefs = pComponentParameterStructure->enable_altrefs;
+    sequence_control_set_ptr->static_config.altref_strength = pComponentParameterStructure->altref_strength;
+    sequence_control_set_ptr->static_config.altref_nframes = pComponentParameterStructure->altref_nframes;
+    sequence_control_set_ptr->static_config.enable_overlays = pComponentParameterStructure->enable_overlays;
+
+    // Low delay : flat prediction structure, every picture is coded as soon as
+    // it is received and output right after. Nothing may wait on the future
+    // pictures : no look ahead, no scene change detection and no alt-refs.
+    if (sequence_control_set_ptr->static_config.pred_structure != EB_PRED_RANDOM_ACCESS) {
+        sequence_control_set_ptr->static_config.hierarchical_levels = 0;
+        sequence_control_set_ptr->max_temporal_layers = 0;
+        sequence_control_set_ptr->reference_count = 1;
+        sequence_control_set_ptr->static_config.look_ahead_distance = 0;
+        sequence_control_set_ptr->static_config.scene_change_detection = 0;
+        sequence_control_set_ptr->static_config.enable_altrefs = EB_FALSE;
+        sequence_control_set_ptr->static_config.enable_overlays = EB_FALSE;
+    }
+
+    // First pass : only the statistics of the pictures are kept, they are
+    // coded in constant QP at the fastest preset.
+    if (sequence_control_set_ptr->static_config.pass == 1) {
+        sequence_control_set_ptr->static_config.enc_mode = MAX_ENC_PRESET;
+        sequence_control_set_ptr->static_config.rate_control_mode = 0;
+        sequence_control_set_ptr->static_config.max_qp_allowed = 63;
+        sequence_control_set_ptr->static_config.min_qp_allowed = 1;
+        sequence_control_set_ptr->static_config.enable_overlays = EB_FALSE;
+    }
+
     // Extract frame rate from Numerator and Denominator if not 0
     if (sequence_control_set_ptr->static_config.frame_rate_numerator != 0 && sequence_control_set_ptr->static_config.frame_rate_denominator != 0)
         sequence_control_set_ptr->frame_rate = sequence_control_set_ptr->static_config.frame_rate = (((sequence_control_set_ptr->static_config.frame_rate_numerator << 8) / (sequence_control_set_ptr->static_config.frame_rate_denominator)) << 8);
@@ -2279,11 +2691,6 @@ void CopyApiFromApp(
     else
         sequence_control_set_ptr->static_config.look_ahead_distance = cap_look_ahead_distance(&sequence_control_set_ptr->static_config);
 
-    sequence_control_set_ptr->static_config.enable_altrefs = pComponentParameterStructure->enable_altrefs;
-    sequence_control_set_ptr->static_config.altref_strength = pComponentParameterStructure->altref_strength;
-    sequence_control_set_ptr->static_config.altref_nframes = pComponentParameterStructure->altref_nframes;
-    sequence_control_set_ptr->static_config.enable_overlays = pComponentParameterStructure->enable_overlays;
-
     return;
 }
 
@@ -2355,8 +2762,13 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->pred_structure != 2) {
-        SVT_LOG("Error instance %u: Pred Structure must be [2]\n", channelNumber + 1);
+    if (config->pred_structure > EB_PRED_RANDOM_ACCESS) {
+        SVT_LOG("Error instance %u: Pred Structure must be [0-2]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->pred_structure != EB_PRED_RANDOM_ACCESS && !rc_is_qp_based(config->rate_control_mode)) {
+        SVT_LOG("Error instance %u: Low delay Pred Structures [0-1] only support RateControlMode 0 and 4\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
@@ -2384,13 +2796,13 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
-    if (sequence_control_set_ptr->max_input_luma_width > 4096) {
-        SVT_LOG("Error instance %u: Source Width must be less than 4096\n", channelNumber + 1);
+    if (sequence_control_set_ptr->max_input_luma_width > MAX_PICTURE_WIDTH_SIZE) {
+        SVT_LOG("Error instance %u: Source Width must be at most %u\n", channelNumber + 1, MAX_PICTURE_WIDTH_SIZE);
         return_error = EB_ErrorBadParameter;
     }
 
-    if (sequence_control_set_ptr->max_input_luma_height > 2160) {
-        SVT_LOG("Error instance %u: Source Height must be less than 2160\n", channelNumber + 1);
+    if (sequence_control_set_ptr->max_input_luma_height > MAX_PICTURE_HEIGHT_SIZE) {
+        SVT_LOG("Error instance %u: Source Height must be at most %u\n", channelNumber + 1, MAX_PICTURE_HEIGHT_SIZE);
         return_error = EB_ErrorBadParameter;
     }
 
@@ -2398,7 +2810,7 @@ static EbErrorType VerifySettings(
         SVT_LOG("Error instance %u: QP must be [0 - %d]\n", channelNumber + 1, MAX_QP_VALUE);
         return_error = EB_ErrorBadParameter;
     }
-    if (config->hierarchical_levels != 3 && config->hierarchical_levels != 4) {
+    if (config->pred_structure == EB_PRED_RANDOM_ACCESS && config->hierarchical_levels != 3 && config->hierarchical_levels != 4) {
         SVT_LOG("Error instance %u: Hierarchical Levels supported [3-4]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
@@ -2421,6 +2833,11 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->enable_fused_loop_filter > 1) {
+        SVT_LOG("Error Instance %u: Invalid FusedLoopFilter. FusedLoopFilter must be [0 - 1]\n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->use_default_me_hme > 1) {
         SVT_LOG("Error Instance %u: invalid use_default_me_hme. use_default_me_hme must be [0 - 1]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
@@ -2511,12 +2928,32 @@ static EbErrorType VerifySettings(
         SVT_LOG("Error Instance %u: The constrained intra must be [0 - 1] \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
-    if (config->rate_control_mode > 3) {
-        SVT_LOG("Error Instance %u: The rate control mode must be [0 - 3] \n", channelNumber + 1);
+    if (config->rate_control_mode > 4) {
+        SVT_LOG("Error Instance %u: The rate control mode must be [0 - 4] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->vbv_max_rate != 0 && config->rate_control_mode != 4) {
+        SVT_LOG("Error Instance %u: The VBV max rate is only supported with the rate control mode 4 \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->vbv_buffer_size != 0 && config->vbv_max_rate == 0) {
+        SVT_LOG("Error Instance %u: The VBV buffer size needs the VBV max rate \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
-    if (config->rate_control_mode == 1) {
-        SVT_LOG("Error Instance %u: The rate control mode 1 is currently not supported \n", channelNumber + 1);
+    if (config->rate_control_mode == 1 && config->pass != 2) {
+        SVT_LOG("Error Instance %u: The rate control mode 1 is currently only supported in the second pass \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->pass > 2) {
+        SVT_LOG("Error Instance %u: The pass must be [0 - 2] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->pass == 2 && config->rate_control_mode != 1) {
+        SVT_LOG("Error Instance %u: The second pass needs the rate control mode 1 \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->pass != 0 && config->frames_to_be_encoded == 0) {
+        SVT_LOG("Error Instance %u: The two pass encoding needs the number of frames to be encoded \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
     if ((config->rate_control_mode == 3|| config->rate_control_mode == 2) && config->look_ahead_distance != (uint32_t)config->intra_period_length) {
@@ -2570,8 +3007,8 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
-    if(sequence_control_set_ptr->static_config.enable_adaptive_quantization>1){
-        SVT_LOG("Error instance %u : Invalid enable_adaptive_quantization. enable_adaptive_quantization must be [0/1]\n", channelNumber + 1);
+    if(sequence_control_set_ptr->static_config.enable_adaptive_quantization>2){
+        SVT_LOG("Error instance %u : Invalid enable_adaptive_quantization. enable_adaptive_quantization must be [0 - 2]\n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
     }
 
@@ -2624,6 +3061,31 @@ static EbErrorType VerifySettings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->enable_thread_pool != 0 && config->enable_thread_pool != 1) {
+        SVT_LOG("Error instance %u: Invalid enable_thread_pool. enable_thread_pool must be [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->numa_node != -1 && (config->numa_node < 0 || GetNumaNodeProcessors(config->numa_node) == 0)) {
+        SVT_LOG("Error instance %u: Invalid numa_node. numa_node must be -1 or a node with logical processors \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->numa_node != -1 && config->target_socket != -1) {
+        SVT_LOG("Error instance %u: numa_node and target_socket cannot be both set \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->adaptive_pool_sizing != 0 && config->adaptive_pool_sizing != 1) {
+        SVT_LOG("Error instance %u: Invalid adaptive_pool_sizing. adaptive_pool_sizing must be [0 - 1] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->memory_budget != 0 && config->adaptive_pool_sizing == 0) {
+        SVT_LOG("Error instance %u: memory_budget requires adaptive_pool_sizing \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // alt-ref frames related
     if (config->altref_strength > ALTREF_MAX_STRENGTH ) {
         SVT_LOG("Error instance %u: invalid altref-strength, should be in the range [0 - %d] \n", channelNumber + 1, ALTREF_MAX_STRENGTH);
@@ -2672,6 +3134,9 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->target_bit_rate = 7000000;
     config_ptr->max_qp_allowed = 63;
     config_ptr->min_qp_allowed = 10;
+    config_ptr->pass = 0;
+    config_ptr->vbv_max_rate = 0;
+    config_ptr->vbv_buffer_size = 0;
     config_ptr->base_layer_switch_mode = 0;
     config_ptr->enc_mode = MAX_ENC_PRESET;
     config_ptr->intra_period_length = -2;
@@ -2679,6 +3144,7 @@ EbErrorType eb_svt_enc_init_parameter(
     config_ptr->hierarchical_levels = 4;
     config_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
     config_ptr->disable_dlf_flag = EB_FALSE;
+    config_ptr->enable_fused_loop_filter = EB_FALSE;
     config_ptr->enable_warped_motion = EB_TRUE;
     config_ptr->in_loop_me_flag = EB_TRUE;
     config_ptr->ext_block_flag = EB_FALSE;
@@ -2737,6 +3203,10 @@ EbErrorType eb_svt_enc_init_parameter(
     // Channel info
     config_ptr->logical_processors = 0;
     config_ptr->target_socket = -1;
+    config_ptr->enable_thread_pool = EB_FALSE;
+    config_ptr->numa_node = -1;
+    config_ptr->adaptive_pool_sizing = EB_FALSE;
+    config_ptr->memory_budget = 0;
     config_ptr->channel_id = 0;
     config_ptr->active_channel_count = 1;
 
@@ -2792,8 +3262,12 @@ static void print_lib_params(
         SVT_LOG("\nSVT [config]: RCMode / TargetBitrate / LookaheadDistance / SceneChange\t\t: VBR / %d / %d / %d ", config->target_bit_rate, config->look_ahead_distance, config->scene_change_detection);
     else if (config->rate_control_mode == 3)
         SVT_LOG("\nSVT [config]: RCMode / TargetBitrate / LookaheadDistance / SceneChange\t\t: Constraint VBR / %d / %d / %d ", config->target_bit_rate, config->look_ahead_distance, config->scene_change_detection);
+    else if (config->rate_control_mode == 4)
+        SVT_LOG("\nSVT [config]: RCMode / QP / VbvMaxRate / VbvBufferSize / LookaheadDistance\t: CRF / %d / %d / %d / %d ", scs->qp, config->vbv_max_rate, config->vbv_buffer_size, config->look_ahead_distance);
     else
         SVT_LOG("\nSVT [config]: BRC Mode / QP  / LookaheadDistance / SceneChange\t\t\t: CQP / %d / %d / %d ", scs->qp, config->look_ahead_distance, config->scene_change_detection);
+    if (config->pass != 0)
+        SVT_LOG("\nSVT [config]: Pass \t\t\t\t\t\t\t\t: %d ", config->pass);
 #ifdef DEBUG_BUFFERS
     SVT_LOG("\nSVT [config]: INPUT / OUTPUT \t\t\t\t\t\t\t: %d / %d", scs->input_buffer_fifo_init_count, scs->output_stream_buffer_fifo_init_count);
     SVT_LOG("\nSVT [config]: CPCS / PAREF / REF \t\t\t\t\t\t: %d / %d / %d", scs->picture_control_set_pool_init_count_child, scs->pa_reference_picture_buffer_init_count, scs->reference_picture_buffer_init_count);
@@ -2852,6 +3326,8 @@ EB_API EbErrorType eb_svt_enc_set_parameter(
     EbEncHandle        *pEncCompData  = (EbEncHandle*)svt_enc_component->p_component_private;
     uint32_t              instance_index = 0;
 
+    eb_memory_arena_set_current(pEncCompData->memory_arena);
+
     // Acquire Config Mutex
     eb_block_on_mutex(pEncCompData->sequence_control_set_instance_array[instance_index]->config_mutex);
 
@@ -2886,7 +3362,8 @@ EB_API EbErrorType eb_svt_enc_set_parameter(
         pEncCompData->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr->max_temporal_layers);
 
     return_error = load_default_buffer_configuration_settings(
-        pEncCompData->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr);
+        pEncCompData->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr,
+        &pEncCompData->thread_affinity);
 
     print_lib_params(
         pEncCompData->sequence_control_set_instance_array[instance_index]->sequence_control_set_ptr);
@@ -2896,6 +3373,183 @@ EB_API EbErrorType eb_svt_enc_set_parameter(
 
     return return_error;
 }
+
+/**********************************
+* Set the zero copy input callback
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_set_input_buffer_callback(
+    EbComponentType           *svt_enc_component,
+    eb_release_input_buffer    release_buffer,
+    void                      *priv_data)
+{
+    if (svt_enc_component == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    enc_handle_ptr->input_release_cb = release_buffer;
+    enc_handle_ptr->input_release_data_ptr = priv_data;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Set the output packet allocator
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_set_packet_buffer_callbacks(
+    EbComponentType           *svt_enc_component,
+    eb_allocate_frame_buffer   allocate_buffer,
+    eb_release_frame_buffer    release_buffer,
+    void                      *priv_data)
+{
+    if (svt_enc_component == NULL)
+        return EB_ErrorBadParameter;
+    // Both or none
+    if ((allocate_buffer == NULL) != (release_buffer == NULL))
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    enc_handle_ptr->packet_alloc_cb = allocate_buffer;
+    enc_handle_ptr->packet_release_cb = release_buffer;
+    enc_handle_ptr->packet_buf_priv_ptr = priv_data;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Set the first pass statistics
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_set_first_pass_stats(
+    EbComponentType           *svt_enc_component,
+    const uint8_t             *stats,
+    uint32_t                   size)
+{
+    if (svt_enc_component == NULL || stats == NULL || size == 0)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    eb_memory_arena_set_current(enc_handle_ptr->memory_arena);
+
+    // The copy is released with the arena in eb_deinit_encoder
+    EB_MALLOC(uint8_t*, enc_handle_ptr->first_pass_stats, size, EB_N_PTR);
+    EB_MEMCPY(enc_handle_ptr->first_pass_stats, (void*)stats, size);
+    enc_handle_ptr->first_pass_stats_size = size;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Set the lead of a ladder
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_set_ladder_lead(
+    EbComponentType           *svt_enc_component,
+    EbComponentType           *lead_component)
+{
+    if (svt_enc_component == NULL || lead_component == NULL || svt_enc_component == lead_component)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle         *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    EbEncHandle         *lead_handle_ptr = (EbEncHandle*)lead_component->p_component_private;
+    SequenceControlSet  *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    SequenceControlSet  *lead_sequence_control_set_ptr = lead_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EncodeContext       *encode_context_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr;
+    EncodeContext       *lead_encode_context_ptr = lead_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr;
+
+    // Both configured, a lead can not follow another lead
+    if (sequence_control_set_ptr->seq_header.max_frame_width == 0 || lead_sequence_control_set_ptr->seq_header.max_frame_width == 0 ||
+        encode_context_ptr->ladder_analysis || (lead_encode_context_ptr->ladder_analysis && !lead_encode_context_ptr->ladder_lead)) {
+        SVT_LOG("Error: The ladder lead must be configured and can not be a rendition, a rendition has a single lead\n");
+        return EB_ErrorBadParameter;
+    }
+    if (lead_sequence_control_set_ptr->static_config.frames_to_be_encoded == 0 ||
+        sequence_control_set_ptr->static_config.frames_to_be_encoded != lead_sequence_control_set_ptr->static_config.frames_to_be_encoded) {
+        SVT_LOG("Error: The ladder lead and its renditions need the same number of frames to be encoded\n");
+        return EB_ErrorBadParameter;
+    }
+
+    // The analysis is released by the last of the lead and its renditions
+    // to be deinitialized
+    if (lead_encode_context_ptr->ladder_analysis == NULL) {
+        if (ladder_analysis_ctor(
+            &lead_encode_context_ptr->ladder_analysis,
+            (uint32_t)lead_sequence_control_set_ptr->static_config.frames_to_be_encoded,
+            lead_sequence_control_set_ptr->seq_header.max_frame_width,
+            lead_sequence_control_set_ptr->seq_header.max_frame_height,
+            lead_sequence_control_set_ptr->sb_sz) != EB_ErrorNone)
+            return EB_ErrorInsufficientResources;
+        lead_encode_context_ptr->ladder_lead = EB_TRUE;
+    }
+    ladder_analysis_add_user(lead_encode_context_ptr->ladder_analysis);
+    encode_context_ptr->ladder_analysis = lead_encode_context_ptr->ladder_analysis;
+    encode_context_ptr->ladder_lead = EB_FALSE;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Set the motion estimation hints callbacks
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_set_me_hints_callbacks(
+    EbComponentType           *svt_enc_component,
+    eb_write_me_hints          write_hints,
+    eb_read_me_hints           read_hints,
+    void                      *priv_data)
+{
+    if (svt_enc_component == NULL || (write_hints == NULL && read_hints == NULL))
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    enc_handle_ptr->me_hints_write_cb = write_hints;
+    enc_handle_ptr->me_hints_read_cb = read_hints;
+    enc_handle_ptr->me_hints_priv_ptr = priv_data;
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Get the first pass statistics
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_get_first_pass_stats(
+    EbComponentType           *svt_enc_component,
+    const uint8_t            **stats,
+    uint32_t                  *size)
+{
+    if (svt_enc_component == NULL || stats == NULL || size == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle   *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    EncodeContext *encode_context_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->encode_context_ptr;
+
+    if (enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config.pass != 1 ||
+        encode_context_ptr->first_pass_stats == NULL)
+        return EB_ErrorBadParameter;
+
+    *stats = encode_context_ptr->first_pass_stats;
+    *size = encode_context_ptr->first_pass_stats_size;
+
+    return EB_ErrorNone;
+}
 #if defined(__linux__) || defined(__APPLE__)
 __attribute__((visibility("default")))
 #endif
@@ -2976,6 +3630,33 @@ EB_API EbErrorType eb_svt_enc_eos_nal(
     return return_error;
 }
 
+/***********************************************
+**** Copy the 2 bit planes of the compressed
+**** 10 bit format to the library buffers
+************************************************/
+static void CopyCompressed2BitBuffer(
+    SequenceControlSet            *sequence_control_set_ptr,
+    EbPictureBufferDesc           *input_picture_ptr,
+    EbSvtIOFormat                 *inputPtr)
+{
+    uint16_t inputRowIndex;
+    uint16_t luma2BitWidth = sequence_control_set_ptr->max_input_luma_width / 4;
+    uint16_t lumaHeight = sequence_control_set_ptr->max_input_luma_height;
+
+    uint16_t sourceLuma2BitStride = (uint16_t)(inputPtr->y_stride / 4);
+    uint16_t sourceChroma2BitStride = sourceLuma2BitStride >> 1;
+
+    for (inputRowIndex = 0; inputRowIndex < lumaHeight; inputRowIndex++) {
+        EB_MEMCPY(input_picture_ptr->buffer_bit_inc_y + luma2BitWidth * inputRowIndex, inputPtr->luma_ext + sourceLuma2BitStride * inputRowIndex, luma2BitWidth);
+    }
+    for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
+        EB_MEMCPY(input_picture_ptr->buffer_bit_inc_cb + (luma2BitWidth >> 1)*inputRowIndex, inputPtr->cb_ext + sourceChroma2BitStride * inputRowIndex, luma2BitWidth >> 1);
+    }
+    for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
+        EB_MEMCPY(input_picture_ptr->buffer_bit_inc_cr + (luma2BitWidth >> 1)*inputRowIndex, inputPtr->cr_ext + sourceChroma2BitStride * inputRowIndex, luma2BitWidth >> 1);
+    }
+}
+
 /***********************************************
 **** Copy the input buffer from the
 **** sample application to the library buffers
@@ -3068,23 +3749,10 @@ static EbErrorType CopyFrameBuffer(
 
             //efficient copy - final
             //compressed 2Bit in 1D format
-            {
-                uint16_t luma2BitWidth = sequence_control_set_ptr->max_input_luma_width / 4;
-                uint16_t lumaHeight = sequence_control_set_ptr->max_input_luma_height;
-
-                uint16_t sourceLuma2BitStride = sourceLumaStride / 4;
-                uint16_t sourceChroma2BitStride = sourceLuma2BitStride >> 1;
-
-                for (inputRowIndex = 0; inputRowIndex < lumaHeight; inputRowIndex++) {
-                    EB_MEMCPY(input_picture_ptr->buffer_bit_inc_y + luma2BitWidth * inputRowIndex, inputPtr->luma_ext + sourceLuma2BitStride * inputRowIndex, luma2BitWidth);
-                }
-                for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
-                    EB_MEMCPY(input_picture_ptr->buffer_bit_inc_cb + (luma2BitWidth >> 1)*inputRowIndex, inputPtr->cb_ext + sourceChroma2BitStride * inputRowIndex, luma2BitWidth >> 1);
-                }
-                for (inputRowIndex = 0; inputRowIndex < lumaHeight >> 1; inputRowIndex++) {
-                    EB_MEMCPY(input_picture_ptr->buffer_bit_inc_cr + (luma2BitWidth >> 1)*inputRowIndex, inputPtr->cr_ext + sourceChroma2BitStride * inputRowIndex, luma2BitWidth >> 1);
-                }
-            }
+            CopyCompressed2BitBuffer(
+                sequence_control_set_ptr,
+                input_picture_ptr,
+                inputPtr);
         }
     }
     else { // 10bit packed
@@ -3135,8 +3803,7 @@ static EbErrorType CopyFrameBuffer(
     }
     return return_error;
 }
-static void CopyInputBuffer(
-    SequenceControlSet*    sequenceControlSet,
+static void CopyInputBufferHeader(
     EbBufferHeaderType*     dst,
     EbBufferHeaderType*     src
 )
@@ -3150,12 +3817,100 @@ static void CopyInputBuffer(
     dst->size = src->size;
     dst->qp = src->qp;
     dst->pic_type = src->pic_type;
+}
+static void CopyInputBuffer(
+    SequenceControlSet*    sequenceControlSet,
+    EbBufferHeaderType*     dst,
+    EbBufferHeaderType*     src
+)
+{
+    CopyInputBufferHeader(dst, src);
 
     // Copy the picture buffer
     if (src->p_buffer != NULL)
         CopyFrameBuffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
 }
 
+/***********************************************
+**** Zero copy input : check the planes sent
+**** can be used in place
+************************************************/
+static EbErrorType CheckZeroCopyInput(
+    EbEncHandle            *enc_handle_ptr,
+    EbBufferHeaderType     *src)
+{
+    SequenceControlSet  *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EbSvtIOFormat       *inputPtr = (EbSvtIOFormat*)src->p_buffer;
+    uint32_t             minLumaStride = sequence_control_set_ptr->max_input_luma_width + sequence_control_set_ptr->left_padding + sequence_control_set_ptr->right_padding;
+
+    if (inputPtr->luma == NULL || inputPtr->cb == NULL || inputPtr->cr == NULL)
+        return EB_ErrorBadParameter;
+    if (inputPtr->cb_stride != inputPtr->cr_stride)
+        return EB_ErrorBadParameter;
+    if (inputPtr->y_stride < minLumaStride || inputPtr->y_stride > 0xFFFF ||
+        inputPtr->cb_stride < (minLumaStride >> 1) || inputPtr->cb_stride > 0xFFFF)
+        return EB_ErrorBadParameter;
+
+    // All the pictures have the strides of the first one
+    if (enc_handle_ptr->input_stride_y == 0) {
+        enc_handle_ptr->input_stride_y = (uint16_t)inputPtr->y_stride;
+        enc_handle_ptr->input_stride_ch = (uint16_t)inputPtr->cb_stride;
+    }
+    if (inputPtr->y_stride != enc_handle_ptr->input_stride_y ||
+        inputPtr->cb_stride != enc_handle_ptr->input_stride_ch)
+        return EB_ErrorBadParameter;
+
+    return EB_ErrorNone;
+}
+
+/***********************************************
+**** Zero copy input : point the library buffer
+**** at the planes of the application
+************************************************/
+static void ReferenceInputBuffer(
+    EbEncHandle            *enc_handle_ptr,
+    EbBufferHeaderType     *dst,
+    EbBufferHeaderType     *src)
+{
+    SequenceControlSet  *sequence_control_set_ptr = enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr;
+    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)dst->p_buffer;
+    EbPictureBufferDesc *blank_picture_ptr = enc_handle_ptr->input_blank_picture_ptr;
+    EbSvtIOFormat       *inputPtr = (EbSvtIOFormat*)src->p_buffer;
+    uint32_t             paddedHeight = input_picture_ptr->max_height + sequence_control_set_ptr->top_padding + sequence_control_set_ptr->bot_padding;
+
+    CopyInputBufferHeader(dst, src);
+    dst->p_app_private = src->p_app_private;
+
+    // Buffers sent without a picture get the planes of the blank picture
+    if (inputPtr == NULL) {
+        input_picture_ptr->buffer_y = blank_picture_ptr->buffer_y;
+        input_picture_ptr->buffer_cb = blank_picture_ptr->buffer_cb;
+        input_picture_ptr->buffer_cr = blank_picture_ptr->buffer_cr;
+        input_picture_ptr->stride_y = blank_picture_ptr->stride_y;
+        input_picture_ptr->stride_cb = blank_picture_ptr->stride_cb;
+        input_picture_ptr->stride_cr = blank_picture_ptr->stride_cr;
+        input_picture_ptr->luma_size = blank_picture_ptr->luma_size;
+        input_picture_ptr->chroma_size = blank_picture_ptr->chroma_size;
+        return;
+    }
+
+    input_picture_ptr->stride_y = enc_handle_ptr->input_stride_y;
+    input_picture_ptr->stride_cb = enc_handle_ptr->input_stride_ch;
+    input_picture_ptr->stride_cr = enc_handle_ptr->input_stride_ch;
+    input_picture_ptr->buffer_y = inputPtr->luma -
+        (input_picture_ptr->stride_y * sequence_control_set_ptr->top_padding + sequence_control_set_ptr->left_padding);
+    input_picture_ptr->buffer_cb = inputPtr->cb -
+        (input_picture_ptr->stride_cb * (sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1));
+    input_picture_ptr->buffer_cr = inputPtr->cr -
+        (input_picture_ptr->stride_cr * (sequence_control_set_ptr->top_padding >> 1) + (sequence_control_set_ptr->left_padding >> 1));
+    input_picture_ptr->luma_size = input_picture_ptr->stride_y * paddedHeight;
+    input_picture_ptr->chroma_size = input_picture_ptr->stride_cb * (paddedHeight >> 1);
+
+    // The 2 bit planes of the compressed 10 bit format are still copied
+    if (sequence_control_set_ptr->static_config.encoder_bit_depth > EB_8BIT)
+        CopyCompressed2BitBuffer(sequence_control_set_ptr, input_picture_ptr, inputPtr);
+}
+
 /**********************************
 * Empty This Buffer
 **********************************/
@@ -3169,20 +3924,48 @@ EB_API EbErrorType eb_svt_enc_send_picture(
     EbEncHandle          *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
     EbObjectWrapper      *ebWrapperPtr;
 
+    if (enc_handle_ptr->zero_copy_input && p_buffer != NULL && p_buffer->p_buffer != NULL) {
+        EbErrorType return_error = CheckZeroCopyInput(enc_handle_ptr, p_buffer);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
+    // The input dts is not used by the encoder, it carries the time the picture
+    // was sent so the reported latency also covers the wait for a free input
+    // buffer below and the input queue
+    uint64_t send_time_seconds = 0;
+    uint64_t send_time_u_seconds = 0;
+    EbStartTime(&send_time_seconds, &send_time_u_seconds);
+
     // Take the buffer and put it into our internal queue structure
     eb_get_empty_object(
         enc_handle_ptr->input_buffer_producer_fifo_ptr_array[0],
         &ebWrapperPtr);
 
     if (p_buffer != NULL) {
-        CopyInputBuffer(
-            enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr,
-            (EbBufferHeaderType*)ebWrapperPtr->object_ptr,
-            p_buffer);
+        if (enc_handle_ptr->zero_copy_input) {
+            ReferenceInputBuffer(
+                enc_handle_ptr,
+                (EbBufferHeaderType*)ebWrapperPtr->object_ptr,
+                p_buffer);
+        }
+        else {
+            CopyInputBuffer(
+                enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr,
+                (EbBufferHeaderType*)ebWrapperPtr->object_ptr,
+                p_buffer);
+        }
     }
 
+    ((EbBufferHeaderType*)ebWrapperPtr->object_ptr)->dts = (int64_t)(send_time_seconds * 1000000 + send_time_u_seconds);
+
     eb_post_full_object(ebWrapperPtr);
 
+    // The picture was copied, the application gets its planes back right away
+    if (!enc_handle_ptr->zero_copy_input && enc_handle_ptr->input_release_cb &&
+        p_buffer != NULL && p_buffer->p_buffer != NULL)
+        enc_handle_ptr->input_release_cb(p_buffer->p_app_private, enc_handle_ptr->input_release_data_ptr);
+
     return EB_ErrorNone;
 }
 static void CopyOutputReconBuffer(
@@ -3297,6 +4080,64 @@ EB_API EbErrorType eb_svt_get_recon(
     return return_error;
 }
 
+/**********************************
+* Get the pipeline counters
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_get_pipeline_stats(
+    EbComponentType      *svt_enc_component,
+    EbPipelineStats      *stats)
+{
+    if (svt_enc_component == NULL || stats == NULL)
+        return EB_ErrorBadParameter;
+
+    memset(stats, 0, sizeof(EbPipelineStats));
+#if PIPELINE_STATS
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    if (enc_handle_ptr->thread_stats_array == NULL)
+        return EB_ErrorNone;
+
+    stats->elapsed_time = eb_pipeline_stats_time() - enc_handle_ptr->pipeline_start_time;
+    stats->kernel_count = PIPELINE_STATS_KERNEL_COUNT;
+    for (uint32_t kernel_index = 0; kernel_index < stats->kernel_count; ++kernel_index)
+        stats->kernels[kernel_index].kernel_name = pipeline_stats_kernels[kernel_index].name;
+    for (uint32_t thread_index = 0; thread_index < enc_handle_ptr->thread_stats_count; ++thread_index) {
+        EbThreadStats *thread_stats_ptr = &enc_handle_ptr->thread_stats_array[thread_index];
+        eb_thread_stats_accumulate(
+            &stats->kernels[thread_stats_ptr->kernel_index],
+            thread_stats_ptr);
+    }
+#endif
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Memory footprint of the instance
+**********************************/
+#if defined(__linux__) || defined(__APPLE__)
+__attribute__((visibility("default")))
+#endif
+EB_API EbErrorType eb_svt_enc_get_memory_footprint(
+    EbComponentType      *svt_enc_component,
+    EbMemoryFootprint    *footprint)
+{
+    if (svt_enc_component == NULL || footprint == NULL)
+        return EB_ErrorBadParameter;
+
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+
+    memset(footprint, 0, sizeof(EbMemoryFootprint));
+    if (enc_handle_ptr == NULL || enc_handle_ptr->memory_arena == NULL)
+        return EB_ErrorNone;
+    eb_memory_arena_get_footprint(enc_handle_ptr->memory_arena, footprint);
+
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Encoder Error Handling
 **********************************/
@@ -3358,7 +4199,8 @@ EbErrorType init_svt_av1_encoder_handle(
 }
 static EbErrorType allocate_frame_buffer(
     SequenceControlSet       *sequence_control_set_ptr,
-    EbBufferHeaderType        *inputBuffer)
+    EbBufferHeaderType        *inputBuffer,
+    EbBool                     zero_copy)
 {
     EbErrorType   return_error = EB_ErrorNone;
     EbPictureBufferDescInitData input_picture_buffer_desc_init_data;
@@ -3382,6 +4224,9 @@ static EbErrorType allocate_frame_buffer(
     input_picture_buffer_desc_init_data.split_mode = is16bit ? EB_TRUE : EB_FALSE;
 
     input_picture_buffer_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+    // Zero copy input : the luma and chroma planes are those of the application
+    if (zero_copy)
+        input_picture_buffer_desc_init_data.buffer_enable_mask = 0;
 
     if (is16bit && config->compressed_ten_bit_format == 1)
         input_picture_buffer_desc_init_data.split_mode = EB_FALSE;  //do special allocation for 2bit data down below.
@@ -3417,7 +4262,32 @@ EbErrorType EbInputBufferHeaderCtor(
 
     allocate_frame_buffer(
         sequence_control_set_ptr,
-        inputBuffer);
+        inputBuffer,
+        EB_FALSE);
+
+    inputBuffer->p_app_private = NULL;
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+* EbBufferHeaderType Constructor, zero copy input
+**************************************/
+EbErrorType EbZeroCopyInputBufferHeaderCtor(
+    EbPtr *objectDblPtr,
+    EbPtr  objectInitDataPtr)
+{
+    EbBufferHeaderType* inputBuffer;
+    SequenceControlSet        *sequence_control_set_ptr = (SequenceControlSet*)objectInitDataPtr;
+    EB_MALLOC(EbBufferHeaderType*, inputBuffer, sizeof(EbBufferHeaderType), EB_N_PTR);
+    *objectDblPtr = (EbPtr)inputBuffer;
+    // Initialize Header
+    inputBuffer->size = sizeof(EbBufferHeaderType);
+
+    allocate_frame_buffer(
+        sequence_control_set_ptr,
+        inputBuffer,
+        EB_TRUE);
 
     inputBuffer->p_app_private = NULL;
 
@@ -3431,23 +4301,34 @@ EbErrorType EbOutputBufferHeaderCtor(
     EbPtr *objectDblPtr,
     EbPtr objectInitDataPtr)
 {
-    EbSvtAv1EncConfiguration   * config = (EbSvtAv1EncConfiguration*)objectInitDataPtr;
+    EbEncHandle                * enc_handle_ptr = (EbEncHandle*)objectInitDataPtr;
+    EbSvtAv1EncConfiguration   * config = &enc_handle_ptr->sequence_control_set_instance_array[0]->sequence_control_set_ptr->static_config;
     uint32_t n_stride = (uint32_t)(EB_OUTPUTSTREAMBUFFERSIZE_MACRO(config->source_width * config->source_height));  //TBC
+    EbOutputStreamBuffer* outStreamPtr;
     EbBufferHeaderType* outBufPtr;
 
-    EB_MALLOC(EbBufferHeaderType*, outBufPtr, sizeof(EbBufferHeaderType), EB_N_PTR);
-    *objectDblPtr = (EbPtr)outBufPtr;
+    EB_MALLOC(EbOutputStreamBuffer*, outStreamPtr, sizeof(EbOutputStreamBuffer), EB_N_PTR);
+    *objectDblPtr = (EbPtr)outStreamPtr;
+    outBufPtr = &outStreamPtr->header;
 
     // Initialize Header
     outBufPtr->size = sizeof(EbBufferHeaderType);
 
-    EB_MALLOC(uint8_t*, outBufPtr->p_buffer, n_stride, EB_N_PTR);
+    // The payload comes from the application packet allocator, per packet
+    outStreamPtr->ext_buf.buffer = NULL;
+    outStreamPtr->ext_buf.buffer_size = 0;
+    outStreamPtr->ext_buf.private_data = NULL;
+    if (enc_handle_ptr->packet_alloc_cb) {
+        outBufPtr->p_buffer = NULL;
+        n_stride = 0;
+    }
+    else {
+        EB_MALLOC(uint8_t*, outBufPtr->p_buffer, n_stride, EB_N_PTR);
+    }
 
     outBufPtr->n_alloc_len = n_stride;
     outBufPtr->p_app_private = NULL;
 
-    (void)objectInitDataPtr;
-
     return EB_ErrorNone;
 }
 
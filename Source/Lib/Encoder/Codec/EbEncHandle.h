@@ -10,6 +10,8 @@
 #include "EbSvtAv1Enc.h"
 #include "EbPictureBufferDesc.h"
 #include "EbSystemResourceManager.h"
+#include "EbPipelineStats.h"
+#include "EbMemoryArena.h"
 #include "EbSequenceControlSet.h"
 
 #include "EbResourceCoordinationResults.h"
@@ -76,6 +78,39 @@ typedef struct EbEncHandle
 
     EbHandle                               packetization_thread_handle;
 
+    // Where the kernel threads of the instance run
+    EbThreadAffinity                       thread_affinity;
+
+    // Run slots shared by the kernel threads, NULL unless enable_thread_pool is set
+    EbThreadPool                          *thread_pool_ptr;
+#if PIPELINE_STATS
+    // Counters of each kernel thread, in creation order
+    EbThreadStats                         *thread_stats_array;
+    uint32_t                               thread_stats_size;
+    uint32_t                               thread_stats_count;
+    uint64_t                               pipeline_start_time;
+#endif
+    // Zero copy input, set with eb_svt_enc_set_input_buffer_callback
+    eb_release_input_buffer                input_release_cb;
+    EbPtr                                  input_release_data_ptr;
+    EbBool                                 zero_copy_input;
+    // Planes of the input buffers sent without a picture in zero copy mode
+    EbPictureBufferDesc                   *input_blank_picture_ptr;
+    // Strides of the first picture, all the referenced pictures use them
+    uint16_t                               input_stride_y;
+    uint16_t                               input_stride_ch;
+    // Output packet allocator, set with eb_svt_enc_set_packet_buffer_callbacks
+    eb_allocate_frame_buffer               packet_alloc_cb;
+    eb_release_frame_buffer                packet_release_cb;
+    EbPtr                                  packet_buf_priv_ptr;
+    // Statistics of the first pass, set with eb_svt_enc_set_first_pass_stats
+    uint8_t                               *first_pass_stats;
+    uint32_t                               first_pass_stats_size;
+    // Motion estimation hints, set with eb_svt_enc_set_me_hints_callbacks
+    eb_write_me_hints                      me_hints_write_cb;
+    eb_read_me_hints                       me_hints_read_cb;
+    EbPtr                                  me_hints_priv_ptr;
+
     // Contexts
     EbPtr                                  resource_coordination_context_ptr;
     EbPtr                                 *picture_analysis_context_ptr_array;
@@ -157,11 +192,8 @@ typedef struct EbEncHandle
     // Callbacks
     EbCallback                          **app_callback_ptr_array;
 
-    // Memory Map
-    EbMemoryMapEntry                       *memory_map_init_address;
-    EbMemoryMapEntry                       *memory_map;
-    uint32_t                                memory_map_index;
-    uint64_t                                total_lib_memory;
+    // Memory of the instance
+    EbMemoryArena                          *memory_arena;
 } EbEncHandle;
 
 #endif // EbEncHandle_h
@@ -0,0 +1,371 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file AdaptiveQuantizationTest.cc
+ *
+ * @brief Unit test for the adaptive quantization of the temporal dependency
+ * model (enable_adaptive_quantization 2):
+ * - the cost of the blocks is propagated along the motion to the blocks of
+ *   their references they overlap, through the whole look ahead window
+ * - the importance of the SBs of the mini GOP is set from the propagated cost
+ * - the importance is binned into segments, neighbour bins of the same QP
+ *   share a segment
+ * - a picture of uniform importance is coded without segmentation
+ *
+ ******************************************************************************/
+#include "gtest/gtest.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbDefinitions.h"
+#include "EbInitialRateControlProcess.h"
+#include "EbMotionEstimationContext.h"
+#include "EbSegmentation.h"
+
+namespace {
+
+// Variance of all the 16x16 blocks, their intra cost is then
+// 16 * 16 * 3 / 4 * sqrt(64)
+static const uint16_t block_variance = 64;
+static const uint64_t block_intra_cost = 1536;
+static const uint32_t unit_importance = 1 << TPL_IMPORTANCE_PRECISION;
+// Motion vector slots of a PU, [list << 2 + ref_idx] in MRP mode 0
+static const uint32_t mv_count = 8;
+
+/** TplPicture holds a picture of the look ahead and its ME results */
+struct TplPicture {
+    PictureParentControlSet *pcs;
+    std::vector<uint16_t> variance;
+    std::vector<uint16_t *> variance_ptrs;
+    std::vector<MeLcuResults> me_results;
+    std::vector<MeLcuResults *> me_results_ptrs;
+    std::vector<uint8_t> candidate_count;
+    std::vector<MeCandidate> candidates;
+    std::vector<MeCandidate *> candidate_ptrs;
+    std::vector<MvCandidate> mvs;
+    std::vector<MvCandidate *> mv_ptrs;
+    std::vector<uint64_t> propagate_cost;
+    std::vector<uint32_t> sb_importance;
+    EbObjectWrapper wrapper;
+    InitialRateControlReorderEntry entry;
+};
+
+class TemporalDependencyTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        memset(&context_, 0, sizeof(context_));
+        scs_ = (SequenceControlSet *)calloc(1, sizeof(SequenceControlSet));
+        encode_context_ = (EncodeContext *)calloc(1, sizeof(EncodeContext));
+        ASSERT_TRUE(scs_ != nullptr && encode_context_ != nullptr);
+        queue_.assign(INITIAL_RATE_CONTROL_REORDER_QUEUE_MAX_DEPTH, nullptr);
+        encode_context_->initial_rate_control_reorder_queue = queue_.data();
+        encode_context_->initial_rate_control_reorder_queue_head_index = 0;
+    }
+
+    void TearDown() override {
+        for (TplPicture *picture : pictures_) {
+            free(picture->pcs);
+            delete picture;
+        }
+        free(encode_context_);
+        free(scs_);
+    }
+
+    void setup_sequence(uint16_t width, uint16_t height) {
+        const uint16_t width_in_sb = (width + 63) / 64;
+        const uint16_t height_in_sb = (height + 63) / 64;
+
+        scs_->seq_header.max_frame_width = width;
+        scs_->seq_header.max_frame_height = height;
+        scs_->picture_width_in_sb = (uint8_t)width_in_sb;
+        scs_->picture_height_in_sb = (uint8_t)height_in_sb;
+        scs_->sb_total_count = width_in_sb * height_in_sb;
+        scs_->mrp_mode = 0;
+        sb_params_.assign(scs_->sb_total_count, SbParams());
+        for (uint16_t sb_index = 0; sb_index < scs_->sb_total_count;
+             ++sb_index) {
+            memset(&sb_params_[sb_index], 0, sizeof(SbParams));
+            sb_params_[sb_index].origin_x = (sb_index % width_in_sb) * 64;
+            sb_params_[sb_index].origin_y = (sb_index / width_in_sb) * 64;
+        }
+        scs_->sb_params_array = sb_params_.data();
+    }
+
+    /** Queue the next picture of the window, in picture number order */
+    TplPicture *add_picture(uint64_t decode_order, EB_SLICE slice_type,
+                            uint8_t temporal_layer_index) {
+        const uint32_t sb_count = scs_->sb_total_count;
+        const uint32_t pu_count = sb_count * MAX_ME_PU_COUNT;
+        TplPicture *picture = new TplPicture;
+        PictureParentControlSet *pcs = (PictureParentControlSet *)calloc(
+            1, sizeof(PictureParentControlSet));
+
+        picture->pcs = pcs;
+        pcs->picture_number = pictures_.size();
+        pcs->decode_order = decode_order;
+        pcs->slice_type = slice_type;
+        pcs->temporal_layer_index = temporal_layer_index;
+        pcs->sb_total_count = (uint16_t)sb_count;
+
+        picture->variance.assign(pu_count, block_variance);
+        picture->candidate_count.assign(pu_count, 0);
+        picture->candidates.assign(pu_count, MeCandidate());
+        picture->mvs.assign(pu_count * mv_count, MvCandidate());
+        memset(picture->candidates.data(), 0,
+               sizeof(MeCandidate) * picture->candidates.size());
+        memset(picture->mvs.data(), 0,
+               sizeof(MvCandidate) * picture->mvs.size());
+        for (uint32_t pu_index = 0; pu_index < pu_count; ++pu_index) {
+            picture->candidate_ptrs.push_back(&picture->candidates[pu_index]);
+            picture->mv_ptrs.push_back(&picture->mvs[pu_index * mv_count]);
+        }
+        picture->me_results.assign(sb_count, MeLcuResults());
+        for (uint32_t sb_index = 0; sb_index < sb_count; ++sb_index) {
+            const uint32_t pu_offset = sb_index * MAX_ME_PU_COUNT;
+            MeLcuResults *me_results = &picture->me_results[sb_index];
+
+            memset(me_results, 0, sizeof(MeLcuResults));
+            me_results->total_me_candidate_index =
+                &picture->candidate_count[pu_offset];
+            me_results->me_candidate = &picture->candidate_ptrs[pu_offset];
+            me_results->me_mv_array = &picture->mv_ptrs[pu_offset];
+            picture->me_results_ptrs.push_back(me_results);
+            picture->variance_ptrs.push_back(&picture->variance[pu_offset]);
+        }
+        pcs->variance = picture->variance_ptrs.data();
+        pcs->me_results = picture->me_results_ptrs.data();
+
+        picture->propagate_cost.assign(sb_count * TPL_BLOCK_COUNT_PER_SB, 0);
+        picture->sb_importance.assign(sb_count, 0);
+        pcs->tpl_propagate_cost = picture->propagate_cost.data();
+        pcs->tpl_sb_importance = picture->sb_importance.data();
+
+        memset(&picture->wrapper, 0, sizeof(picture->wrapper));
+        picture->wrapper.object_ptr = pcs;
+        picture->entry.picture_number = pcs->picture_number;
+        picture->entry.parent_pcs_wrapper_ptr = &picture->wrapper;
+        queue_[pictures_.size()] = &picture->entry;
+
+        pictures_.push_back(picture);
+        return picture;
+    }
+
+    /** Predict a 16x16 block of the picture from the first reference of
+     * list 0, displaced by (mv_x, mv_y) full pels */
+    void predict_block(TplPicture *picture, uint32_t sb_index,
+                       uint32_t block_index, uint64_t ref_poc, int16_t mv_x,
+                       int16_t mv_y, uint32_t distortion) {
+        const uint32_t pu_index = ME_TIER_ZERO_PU_16x16_0 + block_index;
+        MeLcuResults *me_results = &picture->me_results[sb_index];
+
+        picture->pcs->ref_pic_poc_array[REF_LIST_0][0] = ref_poc;
+        me_results->total_me_candidate_index[pu_index] = 1;
+        me_results->me_candidate[pu_index][0].distortion = distortion;
+        me_results->me_candidate[pu_index][0].direction = UNI_PRED_LIST_0;
+        me_results->me_candidate[pu_index][0].ref_idx_l0 = 0;
+        me_results->me_mv_array[pu_index][0].x_mv = mv_x * 4;
+        me_results->me_mv_array[pu_index][0].y_mv = mv_y * 4;
+    }
+
+    /** Run the model with the first picture at the head of the window */
+    void run_model() {
+        pictures_[0]->pcs->frames_in_sw = (uint8_t)pictures_.size();
+        UpdateTemporalDependencyOverTime(
+            &context_, encode_context_, scs_, pictures_[0]->pcs);
+    }
+
+    InitialRateControlContext context_;
+    SequenceControlSet *scs_;
+    EncodeContext *encode_context_;
+    std::vector<SbParams> sb_params_;
+    std::vector<InitialRateControlReorderEntry *> queue_;
+    std::vector<TplPicture *> pictures_;
+};
+
+/**
+ * The cost a block takes from its reference is split over the 16x16 blocks
+ * it overlaps, and costs propagate through the references of the window
+ */
+TEST_F(TemporalDependencyTest, PropagatesAlongTheMotion) {
+    setup_sequence(64, 64);
+    TplPicture *picture0 = add_picture(0, I_SLICE, 0);
+    TplPicture *picture1 = add_picture(1, P_SLICE, 0);
+    TplPicture *picture2 = add_picture(2, P_SLICE, 0);
+
+    // Block 0 of picture 1 straddles blocks 0 and 1 of picture 0, block 5
+    // is predicted at half its intra cost
+    predict_block(picture1, 0, 0, 0, 8, 0, 0);
+    predict_block(picture1, 0, 5, 0, 0, 0, block_intra_cost / 2);
+    // Block 0 of picture 2 is fully predicted by block 0 of picture 1
+    predict_block(picture2, 0, 0, 1, 0, 0, 0);
+    run_model();
+
+    EXPECT_EQ(block_intra_cost, picture1->propagate_cost[0]);
+    for (uint32_t block_index = 1; block_index < TPL_BLOCK_COUNT_PER_SB;
+         ++block_index)
+        EXPECT_EQ(0u, picture1->propagate_cost[block_index]) << block_index;
+    // Block 0 of picture 1 passes on its own cost and the one of picture 2,
+    // half to each block of picture 0 it overlaps
+    EXPECT_EQ(block_intra_cost, picture0->propagate_cost[0]);
+    EXPECT_EQ(block_intra_cost, picture0->propagate_cost[1]);
+    EXPECT_EQ(block_intra_cost / 2, picture0->propagate_cost[5]);
+    for (uint32_t block_index = 2; block_index < TPL_BLOCK_COUNT_PER_SB;
+         ++block_index) {
+        if (block_index != 5) {
+            EXPECT_EQ(0u, picture0->propagate_cost[block_index])
+                << block_index;
+        }
+    }
+}
+
+/**
+ * The importance of an SB is (intra cost + propagated cost) / intra cost,
+ * it is set for the pictures up to the base layer picture of the mini GOP
+ */
+TEST_F(TemporalDependencyTest, SetsTheImportanceOfTheMiniGop) {
+    setup_sequence(128, 64);
+    TplPicture *picture0 = add_picture(0, I_SLICE, 0);
+    TplPicture *picture1 = add_picture(1, P_SLICE, 0);
+
+    // The first SB of picture 0 is fully predicted, the second is not
+    // referenced at all
+    for (uint32_t block_index = 0; block_index < TPL_BLOCK_COUNT_PER_SB;
+         ++block_index)
+        predict_block(picture1, 0, block_index, 0, 0, 0, 0);
+    run_model();
+
+    EXPECT_EQ(2 * unit_importance, picture0->sb_importance[0]);
+    EXPECT_EQ(unit_importance, picture0->sb_importance[1]);
+    EXPECT_EQ(3 * unit_importance / 2, picture0->pcs->tpl_frame_importance);
+    // The mini GOP ends at picture 0, picture 1 is modeled with the next
+    EXPECT_EQ(0u, picture1->sb_importance[0]);
+    EXPECT_EQ(1u, context_.tpl_next_picture_number);
+}
+
+class SegmentationTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        scs_ = (SequenceControlSet *)calloc(1, sizeof(SequenceControlSet));
+        parent_ = (PictureParentControlSet *)calloc(
+            1, sizeof(PictureParentControlSet));
+        pcs_ = (PictureControlSet *)calloc(1, sizeof(PictureControlSet));
+        ASSERT_TRUE(scs_ != nullptr && parent_ != nullptr && pcs_ != nullptr);
+        memset(&layer_, 0, sizeof(layer_));
+        scs_->static_config.enable_adaptive_quantization = 2;
+        scs_->static_config.encoder_bit_depth = 8;
+        scs_->static_config.min_qp_allowed = 1;
+        scs_->static_config.max_qp_allowed = 63;
+        parent_->base_qindex = 128;
+        pcs_->parent_pcs_ptr = parent_;
+    }
+
+    void TearDown() override {
+        free(pcs_);
+        free(parent_);
+        free(scs_);
+    }
+
+    /** Set the importance of the SBs and of the picture */
+    void set_importance(const std::vector<uint32_t> &sb_importance,
+                        uint32_t frame_importance) {
+        sb_importance_ = sb_importance;
+        parent_->tpl_sb_importance = sb_importance_.data();
+        parent_->tpl_frame_importance = frame_importance;
+        parent_->sb_total_count = (uint16_t)sb_importance_.size();
+        pcs_->sb_total_count = (uint16_t)sb_importance_.size();
+    }
+
+    SequenceControlSet *scs_;
+    PictureParentControlSet *parent_;
+    PictureControlSet *pcs_;
+    RateControlLayerContext layer_;
+    std::vector<uint32_t> sb_importance_;
+};
+
+/**
+ * SBs of the importance of the picture all get its QP, the segment map is
+ * then not worth coding
+ */
+TEST_F(SegmentationTest, UniformImportanceDisablesSegmentation) {
+    set_importance(std::vector<uint32_t>(6, 3 * unit_importance / 2),
+                   3 * unit_importance / 2);
+
+    EXPECT_EQ(1, find_segment_qps_tpl(&parent_->segmentation_params, pcs_,
+                                      scs_));
+    EXPECT_EQ(0, parent_->segmentation_params.feature_data[0][SEG_LVL_ALT_Q]);
+
+    setup_segmentation(pcs_, scs_, &layer_);
+    EXPECT_FALSE(parent_->segmentation_params.segmentation_enabled);
+}
+
+/**
+ * The range of importance is split in MAX_SEGMENTS bins, the more important
+ * bins get the lower QPs and neighbour bins of the same QP are merged
+ */
+TEST_F(SegmentationTest, BinsTheImportance) {
+    // 1/4, 1, 1 and 4 times the importance of the picture
+    set_importance({96, 384, 384, 1536}, 384);
+    SegmentationParams *params = &parent_->segmentation_params;
+    const uint8_t segment_count = find_segment_qps_tpl(params, pcs_, scs_);
+
+    ASSERT_GT(segment_count, 1);
+    ASSERT_LE(segment_count, MAX_SEGMENTS);
+    EXPECT_GT(params->feature_data[0][SEG_LVL_ALT_Q], 0);
+    EXPECT_LT(params->feature_data[segment_count - 1][SEG_LVL_ALT_Q], 0);
+    for (uint8_t i = 1; i < segment_count; ++i) {
+        EXPECT_LT(params->feature_data[i][SEG_LVL_ALT_Q],
+                  params->feature_data[i - 1][SEG_LVL_ALT_Q])
+            << "segment " << (int)i;
+        EXPECT_GT(params->importance_bin_edge[i],
+                  params->importance_bin_edge[i - 1])
+            << "segment " << (int)i;
+    }
+    EXPECT_EQ(~0u, params->importance_bin_edge[segment_count - 1]);
+
+    // Each SB falls in the segment of its importance
+    EXPECT_EQ(0, get_sb_segment_id(parent_, 0));
+    EXPECT_EQ(segment_count - 1, get_sb_segment_id(parent_, 3));
+    const uint8_t middle_segment = get_sb_segment_id(parent_, 1);
+    EXPECT_GT(middle_segment, 0);
+    EXPECT_LT(middle_segment, segment_count - 1);
+    EXPECT_EQ(middle_segment, get_sb_segment_id(parent_, 2));
+
+    setup_segmentation(pcs_, scs_, &layer_);
+    EXPECT_TRUE(params->segmentation_enabled);
+    for (uint8_t i = 0; i < MAX_SEGMENTS; ++i)
+        EXPECT_EQ(i < segment_count ? 1 : 0,
+                  (int)params->feature_enabled[i][SEG_LVL_ALT_Q])
+            << "segment " << (int)i;
+}
+
+/**
+ * A narrow range of importance gives neighbour bins the same QP, they share
+ * a segment
+ */
+TEST_F(SegmentationTest, MergesTheBinsOfTheSameQp) {
+    // 2 ^ -0.1, 1, 1 and 2 ^ 0.1 times the importance of the picture
+    set_importance({239, 256, 256, 274}, 256);
+    SegmentationParams *params = &parent_->segmentation_params;
+    const uint8_t segment_count = find_segment_qps_tpl(params, pcs_, scs_);
+
+    ASSERT_GT(segment_count, 1);
+    EXPECT_LT(segment_count, MAX_SEGMENTS);
+    for (uint8_t i = 1; i < segment_count; ++i)
+        EXPECT_NE(params->feature_data[i][SEG_LVL_ALT_Q],
+                  params->feature_data[i - 1][SEG_LVL_ALT_Q])
+            << "segment " << (int)i;
+}
+
+}  // namespace
@@ -0,0 +1,334 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file MemoryArenaTest.cc
+ *
+ * @brief Unit test for the per instance memory arena:
+ * - alignment and zeroing of the blocks
+ * - small blocks share chunks, large blocks get their own
+ * - aligned blocks stay within chunks whose end is not aligned
+ * - threads created by eb_create_thread allocate from the arena of their
+ *   creator
+ * - arenas of two instances are independent
+ * - chunks placed on a NUMA node
+ *
+ ******************************************************************************/
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbMemoryArena.h"
+
+namespace {
+
+class MemoryArenaTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&arena_));
+        eb_memory_arena_set_current(arena_);
+    }
+
+    void TearDown() override {
+        eb_memory_arena_dtor(arena_);
+        eb_memory_arena_set_current(nullptr);
+    }
+
+    EbMemoryFootprint footprint() {
+        EbMemoryFootprint footprint;
+        eb_memory_arena_get_footprint(arena_, &footprint);
+        return footprint;
+    }
+
+    EbMemoryArena *arena_;
+};
+
+/**
+ * @brief Alignment, zeroing and accounting of the blocks
+ *
+ * Test strategy:
+ * Allocate blocks of many sizes with both the EB_MALLOC and the
+ * EB_ALLIGN_MALLOC alignments, some of them zeroed, and fill them.
+ *
+ * Expect result:
+ * Blocks are aligned as asked, zeroed ones read back as 0, no block
+ * overwrites another one, and the footprint counts all of them in a few
+ * chunks.
+ */
+TEST_F(MemoryArenaTest, alignment_and_zeroing) {
+    std::vector<std::pair<uint8_t *, size_t>> blocks;
+    uint64_t allocated_size = 0;
+
+    for (uint32_t i = 0; i < 2000; ++i) {
+        const size_t size = 1 + (i * 7919) % 3000;
+        const size_t alignment = (i & 1) ? ALVALUE : 2 * sizeof(EbPtr);
+        const EbBool zero = (i % 3) == 0 ? EB_TRUE : EB_FALSE;
+        uint8_t *block =
+            (uint8_t *)eb_memory_arena_alloc(size, alignment, zero);
+
+        ASSERT_TRUE(block != nullptr);
+        EXPECT_EQ(0u, (uintptr_t)block % alignment);
+        if (zero) {
+            for (size_t j = 0; j < size; ++j)
+                ASSERT_EQ(0, block[j]);
+        }
+        memset(block, (int)(i & 0xff), size);
+        blocks.push_back(std::make_pair(block, size));
+        allocated_size += size;
+    }
+    for (uint32_t i = 0; i < blocks.size(); ++i) {
+        for (size_t j = 0; j < blocks[i].second; ++j)
+            ASSERT_EQ((uint8_t)(i & 0xff), blocks[i].first[j]);
+    }
+
+    const EbMemoryFootprint f = footprint();
+    EXPECT_EQ(2000u, f.allocation_count);
+    EXPECT_EQ(allocated_size, f.allocated_size);
+    EXPECT_GE(f.reserved_size, f.allocated_size);
+    EXPECT_LE(f.chunk_count, 4u);
+}
+
+/**
+ * @brief Large blocks
+ *
+ * Test strategy:
+ * Allocate a small block, then blocks larger than a chunk, then a small
+ * block again.
+ *
+ * Expect result:
+ * Each large block gets a chunk of its own, zeroed when asked, and the
+ * small blocks keep sharing the first chunk.
+ */
+TEST_F(MemoryArenaTest, large_blocks) {
+    const size_t large_size = 8 << 20;
+    uint8_t *small = (uint8_t *)eb_memory_arena_alloc(64, ALVALUE, EB_FALSE);
+    ASSERT_TRUE(small != nullptr);
+    EXPECT_EQ(1u, footprint().chunk_count);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        uint8_t *large =
+            (uint8_t *)eb_memory_arena_alloc(large_size, ALVALUE, EB_TRUE);
+        ASSERT_TRUE(large != nullptr);
+        EXPECT_EQ(0u, (uintptr_t)large % ALVALUE);
+        EXPECT_EQ(0, large[0]);
+        EXPECT_EQ(0, large[large_size - 1]);
+        memset(large, 0xff, large_size);
+    }
+    EXPECT_EQ(4u, footprint().chunk_count);
+
+    uint8_t *small_next =
+        (uint8_t *)eb_memory_arena_alloc(64, ALVALUE, EB_FALSE);
+    EXPECT_EQ(small + 64, small_next);
+    EXPECT_EQ(4u, footprint().chunk_count);
+}
+
+/**
+ * @brief Aligned blocks at the end of a chunk
+ *
+ * Test strategy:
+ * Allocate a large block of an odd size, so that the chunks grown from the
+ * reserved size end at an address which is not aligned. Then fill chunks
+ * with 1 byte blocks, every other one aligned, so that the alignment takes
+ * the free space of a chunk past its end.
+ *
+ * Expect result:
+ * Every small block lies within the chunk it was taken from.
+ */
+TEST_F(MemoryArenaTest, unaligned_chunk_end) {
+    ASSERT_TRUE(eb_memory_arena_alloc((8 << 20) + 1, ALVALUE, EB_FALSE) !=
+                nullptr);
+    ASSERT_TRUE(eb_memory_arena_alloc(1, 1, EB_FALSE) != nullptr);
+
+    // Up to the end of the chunk grown after the large block
+    while (footprint().chunk_count < 4) {
+        for (size_t alignment = 1; alignment <= ALVALUE;
+             alignment += ALVALUE - 1) {
+            uint8_t *block =
+                (uint8_t *)eb_memory_arena_alloc(1, alignment, EB_FALSE);
+            ASSERT_TRUE(block != nullptr);
+            ASSERT_LE(block + 1, arena_->chunk_end_ptr);
+        }
+        if (footprint().chunk_count == 3) {
+            ASSERT_NE(0u, (uintptr_t)arena_->chunk_end_ptr % ALVALUE);
+        }
+    }
+}
+
+struct AllocContext {
+    EbMemoryArena *arena;
+    EbBool same_arena;
+    EbHandle done_semaphore;
+    EbHandle park_semaphore;
+    std::vector<uint8_t *> blocks;
+};
+
+static void *alloc_thread(void *context_ptr) {
+    AllocContext *context = (AllocContext *)context_ptr;
+
+    context->same_arena =
+        eb_memory_arena_get_current() == context->arena ? EB_TRUE : EB_FALSE;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        uint8_t *block =
+            (uint8_t *)eb_memory_arena_alloc(48, sizeof(EbPtr), EB_FALSE);
+        if (block == nullptr)
+            break;
+        memset(block, (int)(uintptr_t)context & 0xff, 48);
+        context->blocks.push_back(block);
+    }
+    eb_post_semaphore(context->done_semaphore);
+    // Parked until the arena destroys the thread
+    for (;;)
+        eb_block_on_semaphore(context->park_semaphore);
+    return nullptr;
+}
+
+/**
+ * @brief Allocations from several threads
+ *
+ * Test strategy:
+ * Start threads with eb_create_thread, tracked by the arena as
+ * EB_CREATETHREAD does, each allocating and filling many small blocks at
+ * once.
+ *
+ * Expect result:
+ * The threads see the arena of their creator, get all their blocks, no
+ * block is shared, and the threads are destroyed with the arena.
+ */
+TEST_F(MemoryArenaTest, thread_allocations) {
+    const uint32_t thread_count = 4;
+    std::vector<AllocContext> contexts(thread_count);
+
+    for (AllocContext &context : contexts) {
+        context.arena = arena_;
+        context.same_arena = EB_FALSE;
+        context.done_semaphore = eb_create_semaphore(0, 1);
+        context.park_semaphore = eb_create_semaphore(0, 1);
+        ASSERT_TRUE(context.done_semaphore != nullptr);
+        ASSERT_TRUE(context.park_semaphore != nullptr);
+    }
+    for (AllocContext &context : contexts) {
+        EbHandle thread = eb_create_thread(alloc_thread, &context);
+        ASSERT_TRUE(thread != nullptr);
+        ASSERT_EQ(EB_ErrorNone, eb_memory_arena_add_object(thread, EB_THREAD));
+    }
+    for (AllocContext &context : contexts)
+        eb_block_on_semaphore(context.done_semaphore);
+
+    std::vector<uint8_t *> all_blocks;
+    for (AllocContext &context : contexts) {
+        EXPECT_EQ(EB_TRUE, context.same_arena);
+        ASSERT_EQ(1000u, context.blocks.size());
+        for (uint8_t *block : context.blocks) {
+            for (uint32_t j = 0; j < 48; ++j)
+                ASSERT_EQ((uint8_t)((uintptr_t)&context & 0xff), block[j]);
+            all_blocks.push_back(block);
+        }
+    }
+    std::sort(all_blocks.begin(), all_blocks.end());
+    for (size_t i = 1; i < all_blocks.size(); ++i)
+        ASSERT_GE(all_blocks[i] - all_blocks[i - 1], 48);
+
+    const EbMemoryFootprint f = footprint();
+    EXPECT_EQ(thread_count, f.thread_count);
+    // The blocks and the start contexts of the threads and their map entries
+    EXPECT_EQ(thread_count * 1000 + 2 * thread_count, f.allocation_count);
+
+    // The arena stops the threads before freeing their blocks
+    eb_memory_arena_dtor(arena_);
+    ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&arena_));
+    for (AllocContext &context : contexts) {
+        eb_destroy_semaphore(context.done_semaphore);
+        eb_destroy_semaphore(context.park_semaphore);
+    }
+}
+
+/**
+ * @brief Independent instances
+ *
+ * Test strategy:
+ * Allocate from two arenas in turn, then destroy the first one.
+ *
+ * Expect result:
+ * Each arena only counts its own blocks, the blocks of the second arena
+ * survive the first one, and nothing is allocated without a current arena.
+ */
+TEST_F(MemoryArenaTest, independent_instances) {
+    EbMemoryArena *other_arena;
+    EbMemoryFootprint f;
+    ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&other_arena));
+
+    ASSERT_TRUE(eb_memory_arena_alloc(100, ALVALUE, EB_FALSE) != nullptr);
+    eb_memory_arena_set_current(other_arena);
+    uint8_t *block = (uint8_t *)eb_memory_arena_alloc(200, ALVALUE, EB_FALSE);
+    ASSERT_TRUE(block != nullptr);
+    memset(block, 0x5a, 200);
+    ASSERT_TRUE(eb_memory_arena_alloc(300, ALVALUE, EB_FALSE) != nullptr);
+
+    EXPECT_EQ(100u, footprint().allocated_size);
+    eb_memory_arena_get_footprint(other_arena, &f);
+    EXPECT_EQ(500u, f.allocated_size);
+    EXPECT_EQ(2u, f.allocation_count);
+
+    eb_memory_arena_dtor(arena_);
+    ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&arena_));
+    for (uint32_t i = 0; i < 200; ++i)
+        ASSERT_EQ(0x5a, block[i]);
+
+    eb_memory_arena_dtor(other_arena);
+    EXPECT_TRUE(eb_memory_arena_get_current() == nullptr);
+    EXPECT_TRUE(eb_memory_arena_alloc(16, ALVALUE, EB_FALSE) == nullptr);
+}
+
+/**
+ * @brief Chunks of a NUMA node
+ *
+ * Test strategy:
+ * Allocate a block, place the arena on node 0, which every system has, then
+ * allocate small and large blocks, some of them zeroed.
+ *
+ * Expect result:
+ * The node starts a new chunk, its blocks are aligned, zeroed when asked and
+ * usable, and the arena frees its mapped and malloc'd chunks alike.
+ */
+TEST_F(MemoryArenaTest, numa_node_chunks) {
+    const size_t large_size = 8 << 20;
+    uint8_t *block = (uint8_t *)eb_memory_arena_alloc(64, ALVALUE, EB_FALSE);
+    ASSERT_TRUE(block != nullptr);
+    EXPECT_EQ(1u, footprint().chunk_count);
+
+    eb_memory_arena_set_numa_node(arena_, 0);
+    uint8_t *small = (uint8_t *)eb_memory_arena_alloc(64, ALVALUE, EB_TRUE);
+    ASSERT_TRUE(small != nullptr);
+    EXPECT_NE(block + 64, small);
+    EXPECT_EQ(2u, footprint().chunk_count);
+    for (uint32_t i = 0; i < 64; ++i)
+        ASSERT_EQ(0, small[i]);
+
+    uint8_t *large =
+        (uint8_t *)eb_memory_arena_alloc(large_size, ALVALUE, EB_TRUE);
+    ASSERT_TRUE(large != nullptr);
+    EXPECT_EQ(0u, (uintptr_t)large % ALVALUE);
+    EXPECT_EQ(0, large[0]);
+    EXPECT_EQ(0, large[large_size - 1]);
+    memset(large, 0xff, large_size);
+    EXPECT_EQ(3u, footprint().chunk_count);
+
+    eb_memory_arena_set_numa_node(arena_, -1);
+    ASSERT_TRUE(eb_memory_arena_alloc(64, ALVALUE, EB_FALSE) != nullptr);
+    EXPECT_EQ(4u, footprint().chunk_count);
+}
+
+}  // namespace
@@ -0,0 +1,391 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SystemResourceTest.cc
+ *
+ * @brief Unit test for the system resource manager fifos:
+ * - producers/consumers handoff through eb_get_empty_object,
+ *   eb_post_full_object, eb_get_full_object and eb_release_object
+ * - live_count handling of eb_release_object
+ * - growth of the growable SystemResources on exhaustion, within their
+ *   object_total_count and memory budget
+ * - handoff between the threads of a thread pool sharing a single run slot
+ *
+ * SvtAv1UnitTests runs it against the fifo implementation the library is
+ * built with (mutex based or LOCK_FREE_FIFO), SvtAv1FifoTests against the
+ * other one.
+ *
+ ******************************************************************************/
+#include "gtest/gtest.h"
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbDefinitions.h"
+#include "EbSystemResourceManager.h"
+#include "EbMemoryArena.h"
+
+namespace {
+
+// Objects are freed by the fixture, not allocated from the library arena
+static EbErrorType counter_ctor(EbPtr *object_dbl_ptr, EbPtr object_init_data_ptr) {
+    (void)object_init_data_ptr;
+    uint64_t *counter = (uint64_t *)calloc(1, sizeof(uint64_t));
+    if (counter == nullptr)
+        return EB_ErrorInsufficientResources;
+    *object_dbl_ptr = counter;
+    return EB_ErrorNone;
+}
+
+// Objects of the growable SystemResources live in the library arena
+static EbErrorType block_ctor(EbPtr *object_dbl_ptr, EbPtr object_init_data_ptr) {
+    EbPtr block;
+    EB_MALLOC(EbPtr, block, *(uint32_t *)object_init_data_ptr, EB_N_PTR);
+    *object_dbl_ptr = block;
+    return EB_ErrorNone;
+}
+
+class SystemResourceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&arena_));
+        eb_memory_arena_set_current(arena_);
+        resource_ = nullptr;
+    }
+
+    void TearDown() override {
+        if (resource_ != nullptr) {
+            for (uint32_t i = 0; i < resource_->object_count; ++i)
+                free(resource_->wrapper_ptr_pool[i]->object_ptr);
+        }
+        eb_memory_arena_dtor(arena_);
+    }
+
+    EbMemoryArena *arena_;
+    EbSystemResource *resource_;
+};
+
+/**
+ * @brief Multi-producer/multi-consumer handoff
+ *
+ * Test strategy:
+ * Several producer threads fill objects from a small pool and post them,
+ * several consumer threads get and release them. The pool is much smaller
+ * than the number of handoffs so both the empty and the full queues run
+ * dry and the waiters have to block and be woken.
+ *
+ * Expect result:
+ * Every posted value is consumed exactly once and every object is back in
+ * the empty queue at the end.
+ */
+TEST_F(SystemResourceTest, mpmc_handoff) {
+    const uint32_t object_count = 8;
+    const uint32_t producer_count = 4;
+    const uint32_t consumer_count = 4;
+    const uint32_t items_per_producer = 20000;
+    EbFifo **producer_fifos;
+    EbFifo **consumer_fifos;
+
+    ASSERT_EQ(EB_ErrorNone,
+              eb_system_resource_ctor(&resource_,
+                                      object_count,
+                                      producer_count,
+                                      consumer_count,
+                                      &producer_fifos,
+                                      &consumer_fifos,
+                                      EB_TRUE,
+                                      counter_ctor,
+                                      nullptr));
+
+    std::vector<uint64_t> consumed_sum(consumer_count, 0);
+    std::vector<uint32_t> consumed_count(consumer_count, 0);
+    std::vector<std::thread> threads;
+    const uint32_t total_items = producer_count * items_per_producer;
+
+    for (uint32_t p = 0; p < producer_count; ++p) {
+        threads.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < items_per_producer; ++i) {
+                EbObjectWrapper *wrapper;
+                eb_get_empty_object(producer_fifos[p], &wrapper);
+                *(uint64_t *)wrapper->object_ptr = (uint64_t)p * items_per_producer + i + 1;
+                eb_post_full_object(wrapper);
+            }
+        });
+    }
+    for (uint32_t c = 0; c < consumer_count; ++c) {
+        threads.emplace_back([&, c]() {
+            // Consumers split the work evenly so each one knows when to stop
+            for (uint32_t i = 0; i < total_items / consumer_count; ++i) {
+                EbObjectWrapper *wrapper;
+                eb_get_full_object(consumer_fifos[c], &wrapper);
+                consumed_sum[c] += *(uint64_t *)wrapper->object_ptr;
+                ++consumed_count[c];
+                eb_release_object(wrapper);
+            }
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+
+    uint64_t sum = 0;
+    uint32_t count = 0;
+    for (uint32_t c = 0; c < consumer_count; ++c) {
+        sum += consumed_sum[c];
+        count += consumed_count[c];
+    }
+    EXPECT_EQ(total_items, count);
+    EXPECT_EQ((uint64_t)total_items * (total_items + 1) / 2, sum);
+
+    // Every object must be available again
+    for (uint32_t i = 0; i < object_count; ++i) {
+        EbObjectWrapper *wrapper;
+        eb_get_empty_object(producer_fifos[0], &wrapper);
+        EXPECT_EQ(0u, wrapper->live_count);
+    }
+}
+
+/**
+ * @brief live_count handling
+ *
+ * Test strategy:
+ * Take an object, add two extra users with eb_object_inc_live_count and
+ * release it from each user. Check the full queue stays empty while the
+ * object is used and that the object only returns to the empty queue on
+ * the last release.
+ *
+ * Expect result:
+ * live_count reaches EB_ObjectWrapperReleasedValue on the last release,
+ * and the object is handed out again by eb_get_empty_object.
+ */
+TEST_F(SystemResourceTest, live_count_release) {
+    EbFifo **producer_fifos;
+    EbFifo **consumer_fifos;
+    EbObjectWrapper *wrapper;
+    EbObjectWrapper *full_wrapper;
+
+    ASSERT_EQ(EB_ErrorNone,
+              eb_system_resource_ctor(&resource_,
+                                      1,
+                                      1,
+                                      1,
+                                      &producer_fifos,
+                                      &consumer_fifos,
+                                      EB_TRUE,
+                                      counter_ctor,
+                                      nullptr));
+
+    eb_get_empty_object(producer_fifos[0], &wrapper);
+    eb_object_inc_live_count(wrapper, 2);
+    EXPECT_EQ(2u, wrapper->live_count);
+
+    eb_get_full_object_non_blocking(consumer_fifos[0], &full_wrapper);
+    EXPECT_TRUE(full_wrapper == nullptr);
+
+    eb_release_object(wrapper);
+    EXPECT_EQ(1u, wrapper->live_count);
+    eb_release_object(wrapper);
+    EXPECT_EQ(EB_ObjectWrapperReleasedValue, wrapper->live_count);
+
+    EbObjectWrapper *again;
+    eb_get_empty_object(producer_fifos[0], &again);
+    EXPECT_EQ(wrapper, again);
+    EXPECT_EQ(0u, again->live_count);
+    EXPECT_EQ(EB_TRUE, again->release_enable);
+}
+
+/**
+ * @brief Growth of a growable SystemResource
+ *
+ * Test strategy:
+ * Build a SystemResource with 2 of its 5 objects and take objects without
+ * releasing them, then release one and take it again.
+ *
+ * Expect result:
+ * Each get past the constructed objects constructs one more, up to
+ * object_total_count, and a released object is reused instead of growing.
+ */
+TEST_F(SystemResourceTest, growable_grow_on_exhaustion) {
+    EbSystemResource *resource;
+    EbFifo **producer_fifos;
+    EbObjectWrapper *wrappers[5];
+    uint32_t block_size = 4096;
+
+    ASSERT_EQ(EB_ErrorNone,
+              eb_system_resource_growable_ctor(&resource,
+                                               2,
+                                               5,
+                                               1,
+                                               0,
+                                               &producer_fifos,
+                                               nullptr,
+                                               EB_FALSE,
+                                               block_ctor,
+                                               &block_size,
+                                               sizeof(block_size),
+                                               0));
+    EXPECT_EQ(2u, resource->object_count);
+    EXPECT_GE(resource->object_size, (uint64_t)block_size);
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        eb_get_empty_object(producer_fifos[0], &wrappers[i]);
+        EXPECT_EQ(i < 2 ? 2u : i + 1, resource->object_count);
+    }
+
+    eb_release_object(wrappers[3]);
+    EbObjectWrapper *again;
+    eb_get_empty_object(producer_fifos[0], &again);
+    EXPECT_EQ(wrappers[3], again);
+    EXPECT_EQ(5u, resource->object_count);
+}
+
+/**
+ * @brief Memory budget of a growable SystemResource
+ *
+ * Test strategy:
+ * Leave room for two more objects under the memory budget, take all the
+ * objects that fit and block a thread on the next get. Release an object
+ * from the main thread after a while.
+ *
+ * Expect result:
+ * The SystemResource stops growing at the budget, well below
+ * object_total_count, and the blocked thread gets the released object.
+ */
+TEST_F(SystemResourceTest, growable_memory_budget) {
+    EbSystemResource *resource;
+    EbFifo **producer_fifos;
+    EbObjectWrapper *wrappers[4];
+    EbObjectWrapper *waited = nullptr;
+    EbMemoryFootprint footprint;
+    uint32_t block_size = 4096;
+
+    ASSERT_EQ(EB_ErrorNone,
+              eb_system_resource_growable_ctor(&resource,
+                                               2,
+                                               16,
+                                               1,
+                                               0,
+                                               &producer_fifos,
+                                               nullptr,
+                                               EB_FALSE,
+                                               block_ctor,
+                                               &block_size,
+                                               sizeof(block_size),
+                                               0));
+    eb_memory_arena_get_footprint(arena_, &footprint);
+    resource->memory_budget = footprint.allocated_size + 2 * resource->object_size + resource->object_size / 2;
+
+    for (uint32_t i = 0; i < 4; ++i)
+        eb_get_empty_object(producer_fifos[0], &wrappers[i]);
+    EXPECT_EQ(4u, resource->object_count);
+
+    std::thread waiter([&]() { eb_get_empty_object(producer_fifos[0], &waited); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(4u, resource->object_count);
+
+    eb_release_object(wrappers[1]);
+    waiter.join();
+    EXPECT_EQ(wrappers[1], waited);
+    EXPECT_EQ(4u, resource->object_count);
+}
+
+struct PoolHandoffContext {
+    EbFifo *producer_fifo;
+    EbFifo *consumer_fifo;
+    uint32_t item_count;
+    uint64_t consumed_sum;
+    EbHandle done_semaphore;
+};
+
+static void *pool_producer_kernel(void *input_ptr) {
+    PoolHandoffContext *context = (PoolHandoffContext *)input_ptr;
+    for (uint32_t i = 0; i < context->item_count; ++i) {
+        EbObjectWrapper *wrapper;
+        eb_get_empty_object(context->producer_fifo, &wrapper);
+        *(uint64_t *)wrapper->object_ptr = i + 1;
+        eb_post_full_object(wrapper);
+    }
+    return nullptr;
+}
+
+static void *pool_consumer_kernel(void *input_ptr) {
+    PoolHandoffContext *context = (PoolHandoffContext *)input_ptr;
+    for (uint32_t i = 0; i < context->item_count; ++i) {
+        EbObjectWrapper *wrapper;
+        eb_get_full_object(context->consumer_fifo, &wrapper);
+        context->consumed_sum += *(uint64_t *)wrapper->object_ptr;
+        eb_release_object(wrapper);
+    }
+    eb_post_semaphore(context->done_semaphore);
+    return nullptr;
+}
+
+/**
+ * @brief Handoff within a single slot thread pool
+ *
+ * Test strategy:
+ * A producer and a consumer thread share the only run slot of a thread
+ * pool and hand objects over through a pool of 2 objects, so each of them
+ * keeps waiting for the other one.
+ *
+ * Expect result:
+ * Every posted value is consumed, i.e. a thread waiting on a fifo gives
+ * the slot back to the thread it waits for.
+ */
+TEST_F(SystemResourceTest, single_slot_pool_handoff) {
+    const uint32_t object_count = 2;
+    EbFifo **producer_fifos;
+    EbFifo **consumer_fifos;
+    EbThreadPool *pool;
+    EbHandle threads[2];
+    void *(*functions[2])(void *) = {pool_consumer_kernel,
+                                      pool_producer_kernel};
+    PoolHandoffContext context;
+
+    ASSERT_EQ(EB_ErrorNone,
+              eb_system_resource_ctor(&resource_,
+                                      object_count,
+                                      1,
+                                      1,
+                                      &producer_fifos,
+                                      &consumer_fifos,
+                                      EB_TRUE,
+                                      counter_ctor,
+                                      nullptr));
+    ASSERT_EQ(EB_ErrorNone, eb_thread_pool_ctor(&pool, 1));
+    context.producer_fifo = producer_fifos[0];
+    context.consumer_fifo = consumer_fifos[0];
+    context.item_count = 2000;
+    context.consumed_sum = 0;
+    context.done_semaphore = eb_create_semaphore(0, 1);
+    ASSERT_TRUE(context.done_semaphore != nullptr);
+
+    for (int i = 0; i < 2; ++i) {
+        void *(*function)(void *) = functions[i];
+        void *thread_context = &context;
+        ASSERT_EQ(EB_ErrorNone,
+                  eb_thread_pool_bind(pool, &function, &thread_context));
+        threads[i] = eb_create_thread(function, thread_context);
+        ASSERT_TRUE(threads[i] != nullptr);
+    }
+    // The test thread is not a pool thread, this is a plain wait
+    EXPECT_EQ(EB_ErrorNone, eb_block_on_semaphore(context.done_semaphore));
+    EXPECT_EQ((uint64_t)context.item_count * (context.item_count + 1) / 2,
+              context.consumed_sum);
+
+    for (int i = 0; i < 2; ++i)
+        eb_destroy_thread(threads[i]);
+    eb_destroy_semaphore(context.done_semaphore);
+}
+
+}  // namespace
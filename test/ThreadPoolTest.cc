@@ -0,0 +1,254 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file ThreadPoolTest.cc
+ *
+ * @brief Unit test for the encoder thread pool:
+ * - number of pool threads running at once is capped by the slot count
+ * - a pool thread blocked in eb_block_on_semaphore hands its slot over
+ * - so does a pool thread blocked in eb_wait_cond_var
+ *
+ ******************************************************************************/
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+#include "EbMemoryArena.h"
+
+namespace {
+
+class ThreadPoolTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(EB_ErrorNone, eb_memory_arena_ctor(&arena_));
+        eb_memory_arena_set_current(arena_);
+    }
+
+    void TearDown() override {
+        for (EbHandle thread : threads_)
+            eb_destroy_thread(thread);
+        eb_memory_arena_dtor(arena_);
+    }
+
+    void create_pool_thread(EbThreadPool *pool, void *(*function)(void *),
+                            void *context) {
+        ASSERT_EQ(EB_ErrorNone, eb_thread_pool_bind(pool, &function, &context));
+        EbHandle thread = eb_create_thread(function, context);
+        ASSERT_TRUE(thread != nullptr);
+        threads_.push_back(thread);
+    }
+
+    EbMemoryArena *arena_;
+    std::vector<EbHandle> threads_;
+};
+
+struct SlotCapContext {
+    std::atomic<uint32_t> running;
+    std::atomic<uint32_t> max_running;
+    EbHandle done_semaphore;
+};
+
+static void *slot_cap_kernel(void *input_ptr) {
+    SlotCapContext *context = (SlotCapContext *)input_ptr;
+    for (int i = 0; i < 20; ++i) {
+        uint32_t running = ++context->running;
+        uint32_t max_running = context->max_running;
+        while (running > max_running &&
+               !context->max_running.compare_exchange_weak(max_running,
+                                                           running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        --context->running;
+    }
+    eb_post_semaphore(context->done_semaphore);
+    return nullptr;
+}
+
+/**
+ * @brief Slot cap
+ *
+ * Test strategy:
+ * Start more pool threads than the pool has slots. Each thread repeatedly
+ * marks itself running, sleeps and unmarks itself, so without a cap all
+ * of them would be running at some point.
+ *
+ * Expect result:
+ * All threads finish and no more than slot_count of them ever run at once.
+ */
+TEST_F(ThreadPoolTest, slot_cap) {
+    const uint32_t slot_count = 2;
+    const uint32_t thread_count = 6;
+    EbThreadPool *pool;
+    SlotCapContext context;
+
+    ASSERT_EQ(EB_ErrorNone, eb_thread_pool_ctor(&pool, slot_count));
+    context.running = 0;
+    context.max_running = 0;
+    context.done_semaphore = eb_create_semaphore(0, thread_count);
+    ASSERT_TRUE(context.done_semaphore != nullptr);
+
+    for (uint32_t i = 0; i < thread_count; ++i)
+        create_pool_thread(pool, slot_cap_kernel, &context);
+    // The test thread is not a pool thread, this is a plain wait
+    for (uint32_t i = 0; i < thread_count; ++i)
+        eb_block_on_semaphore(context.done_semaphore);
+
+    EXPECT_LE(context.max_running.load(), slot_count);
+    EXPECT_GE(context.max_running.load(), 1u);
+    eb_destroy_semaphore(context.done_semaphore);
+}
+
+struct PingPongContext {
+    EbHandle ping_semaphore;
+    EbHandle pong_semaphore;
+    EbHandle done_semaphore;
+};
+
+static void *ping_kernel(void *input_ptr) {
+    PingPongContext *context = (PingPongContext *)input_ptr;
+    eb_block_on_semaphore(context->ping_semaphore);
+    eb_post_semaphore(context->pong_semaphore);
+    return nullptr;
+}
+
+static void *pong_kernel(void *input_ptr) {
+    PingPongContext *context = (PingPongContext *)input_ptr;
+    eb_post_semaphore(context->ping_semaphore);
+    eb_block_on_semaphore(context->pong_semaphore);
+    eb_post_semaphore(context->done_semaphore);
+    return nullptr;
+}
+
+/**
+ * @brief Slot handover
+ *
+ * Test strategy:
+ * Two pool threads sharing a single slot wait on each other through
+ * semaphores. Whichever starts first blocks while holding the only slot.
+ *
+ * Expect result:
+ * Both threads complete, i.e. the blocked thread gave its slot back.
+ */
+TEST_F(ThreadPoolTest, slot_handover) {
+    EbThreadPool *pool;
+    PingPongContext context;
+
+    ASSERT_EQ(EB_ErrorNone, eb_thread_pool_ctor(&pool, 1));
+    context.ping_semaphore = eb_create_semaphore(0, 1);
+    context.pong_semaphore = eb_create_semaphore(0, 1);
+    context.done_semaphore = eb_create_semaphore(0, 1);
+
+    create_pool_thread(pool, ping_kernel, &context);
+    create_pool_thread(pool, pong_kernel, &context);
+    EXPECT_EQ(EB_ErrorNone, eb_block_on_semaphore(context.done_semaphore));
+
+    eb_destroy_semaphore(context.ping_semaphore);
+    eb_destroy_semaphore(context.pong_semaphore);
+    eb_destroy_semaphore(context.done_semaphore);
+}
+
+struct CounterContext {
+    EbHandle cond_var;
+    volatile uint32_t counter;
+    volatile uint32_t abort_flag;
+    EbBool reached;
+    EbHandle done_semaphore;
+};
+
+static void *counter_wait_kernel(void *input_ptr) {
+    CounterContext *context = (CounterContext *)input_ptr;
+    context->reached = eb_wait_cond_var(context->cond_var, &context->counter,
+                                        3, &context->abort_flag);
+    eb_post_semaphore(context->done_semaphore);
+    return nullptr;
+}
+
+static void *counter_raise_kernel(void *input_ptr) {
+    CounterContext *context = (CounterContext *)input_ptr;
+    for (int i = 0; i < 3; ++i) {
+        eb_atomic_fetch_add_u32(&context->counter, 1);
+        eb_signal_cond_var(context->cond_var);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Condition variable slot handover
+ *
+ * Test strategy:
+ * Two pool threads share a single slot, one waits on a counter the other
+ * raises. The waiter may block while holding the only slot.
+ *
+ * Expect result:
+ * The waiter returns EB_TRUE once the counter reaches its target, i.e. it
+ * gave its slot back while blocked.
+ */
+TEST_F(ThreadPoolTest, cond_var_slot_handover) {
+    EbThreadPool *pool;
+    CounterContext context;
+
+    ASSERT_EQ(EB_ErrorNone, eb_thread_pool_ctor(&pool, 1));
+    context.cond_var = eb_create_cond_var();
+    ASSERT_TRUE(context.cond_var != nullptr);
+    context.counter = 0;
+    context.abort_flag = 0;
+    context.reached = EB_FALSE;
+    context.done_semaphore = eb_create_semaphore(0, 1);
+
+    create_pool_thread(pool, counter_wait_kernel, &context);
+    create_pool_thread(pool, counter_raise_kernel, &context);
+    EXPECT_EQ(EB_ErrorNone, eb_block_on_semaphore(context.done_semaphore));
+    EXPECT_EQ(EB_TRUE, context.reached);
+
+    eb_destroy_cond_var(context.cond_var);
+    eb_destroy_semaphore(context.done_semaphore);
+}
+
+/**
+ * @brief Condition variable abort
+ *
+ * Test strategy:
+ * A thread waits on a counter that is never raised, then the abort flag
+ * is set and the condition variable signaled.
+ *
+ * Expect result:
+ * The waiter returns EB_FALSE.
+ */
+TEST_F(ThreadPoolTest, cond_var_abort) {
+    CounterContext context;
+
+    context.cond_var = eb_create_cond_var();
+    ASSERT_TRUE(context.cond_var != nullptr);
+    context.counter = 0;
+    context.abort_flag = 0;
+    context.reached = EB_TRUE;
+    context.done_semaphore = eb_create_semaphore(0, 1);
+
+    EbHandle thread = eb_create_thread(counter_wait_kernel, &context);
+    ASSERT_TRUE(thread != nullptr);
+    threads_.push_back(thread);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    eb_atomic_store_u32(&context.abort_flag, 1);
+    eb_signal_cond_var(context.cond_var);
+    EXPECT_EQ(EB_ErrorNone, eb_block_on_semaphore(context.done_semaphore));
+    EXPECT_EQ(EB_FALSE, context.reached);
+
+    eb_destroy_cond_var(context.cond_var);
+    eb_destroy_semaphore(context.done_semaphore);
+}
+
+}  // namespace
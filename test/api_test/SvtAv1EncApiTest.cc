@@ -78,6 +78,23 @@ TEST(EncApiTest, check_null_pointer) {
     // EXPECT_EQ(EB_ErrorBadParameter,
     //          eb_svt_enc_set_parameter(context.enc_handle,
     //          nullptr));
+    // setup input buffer callback with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_set_input_buffer_callback(nullptr, nullptr, nullptr));
+    // setup packet buffer callbacks with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_set_packet_buffer_callbacks(
+                  nullptr, nullptr, nullptr, nullptr));
+    // setup first pass statistics with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_set_first_pass_stats(nullptr, nullptr, 0));
+    // setup ladder lead with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_set_ladder_lead(nullptr, nullptr));
+    // setup motion estimation hints callbacks with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_set_me_hints_callbacks(
+                  nullptr, nullptr, nullptr, nullptr));
     // open encoder with null pointer
     EXPECT_EQ(EB_ErrorBadParameter, eb_init_encoder(nullptr));
     // get stream header with null pointer
@@ -88,6 +105,15 @@ TEST(EncApiTest, check_null_pointer) {
     // nullptr)); EXPECT_EQ(EB_ErrorBadParameter, eb_svt_get_packet(nullptr,
     // nullptr, 0)); EXPECT_EQ(EB_ErrorBadParameter, eb_svt_get_recon(nullptr,
     // nullptr)); No return value, just feed nullptr as parameter.
+    // get pipeline stats with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_get_pipeline_stats(nullptr, nullptr));
+    // get first pass statistics with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_get_first_pass_stats(nullptr, nullptr, nullptr));
+    // get memory footprint with null pointer
+    EXPECT_EQ(EB_ErrorBadParameter,
+              eb_svt_enc_get_memory_footprint(nullptr, nullptr));
     // release output buffer with null pointer
     eb_svt_release_out_buffer(nullptr);
     // close encoder with null pointer
@@ -123,11 +123,31 @@ class EncParamTestBase : public ::testing::Test {
             }
         } else if (!param_name_str_.compare("target_bit_rate")) {
             ctxt_.enc_params.rate_control_mode = 1;
+        } else if (!param_name_str_.compare("pass")) {
+            /** the second pass requires rate_control_mode(1) */
+            if (ctxt_.enc_params.pass == 2)
+                ctxt_.enc_params.rate_control_mode = 1;
+        } else if (!param_name_str_.compare("vbv_max_rate")) {
+            /** the VBV requires rate_control_mode(4) */
+            ctxt_.enc_params.rate_control_mode = 4;
+        } else if (!param_name_str_.compare("vbv_buffer_size")) {
+            ctxt_.enc_params.rate_control_mode = 4;
+            ctxt_.enc_params.vbv_max_rate = 1000000;
         } else if (!param_name_str_.compare("injector_frame_rate")) {
             ctxt_.enc_params.speed_control_flag = 1;
         } else if (!param_name_str_.compare("altref_strength") ||
                    !param_name_str_.compare("altref_nframes")) {
             ctxt_.enc_params.enable_altrefs = EB_TRUE;
+        } else if (!param_name_str_.compare("memory_budget")) {
+            ctxt_.enc_params.adaptive_pool_sizing = EB_TRUE;
+        }
+        if (ctxt_.enc_params.rate_control_mode == 1 ||
+            ctxt_.enc_params.pass != 0) {
+            /** rate_control_mode(1) is only supported in the second pass */
+            if (ctxt_.enc_params.rate_control_mode == 1)
+                ctxt_.enc_params.pass = 2;
+            /** two pass encoding requires the number of frames */
+            ctxt_.enc_params.frames_to_be_encoded = 60;
         }
     }
 
@@ -227,6 +247,67 @@ PARAM_TEST(EncParamHierarchicalLvlTest);
 DEFINE_PARAM_TEST_CLASS(EncParamPredStructTest, pred_structure);
 PARAM_TEST(EncParamPredStructTest);
 
+/** Test case for pred_structure with rate_control_mode, Low Delay is only
+ * supported with the rate control modes 0 and 4*/
+class EncParamPredStructRateCtrlTest : public EncParamTestBase {
+  public:
+    EncParamPredStructRateCtrlTest() : EncParamTestBase("pred_structure") {
+    }
+    virtual void run_default_param_check() override {
+        check_pred_structure(EB_PRED_RANDOM_ACCESS, 0, EB_ErrorNone);
+    }
+    virtual void run_valid_param_check() override {
+        const uint32_t rc_modes[] = {0, 1, 2, 3, 4};
+        for (uint32_t rc_mode : rc_modes)
+            check_pred_structure(EB_PRED_RANDOM_ACCESS, rc_mode, EB_ErrorNone);
+        check_pred_structure(EB_PRED_LOW_DELAY_P, 0, EB_ErrorNone);
+        check_pred_structure(EB_PRED_LOW_DELAY_B, 0, EB_ErrorNone);
+        check_pred_structure(EB_PRED_LOW_DELAY_P, 4, EB_ErrorNone);
+        check_pred_structure(EB_PRED_LOW_DELAY_B, 4, EB_ErrorNone);
+    }
+    virtual void run_invalid_param_check() override {
+        const uint32_t rc_modes[] = {1, 2, 3};
+        for (uint32_t rc_mode : rc_modes) {
+            check_pred_structure(
+                EB_PRED_LOW_DELAY_P, rc_mode, EB_ErrorBadParameter);
+            check_pred_structure(
+                EB_PRED_LOW_DELAY_B, rc_mode, EB_ErrorBadParameter);
+        }
+    }
+    virtual void run_special_param_check() override {
+        /*do nothing for special cases*/
+    }
+
+  protected:
+    virtual void SetUp() override {
+        /* skip EncParamTestBase::SetUp() */
+    }
+    virtual void TearDown() override {
+        /* skip EncParamTestBase::TearDown() */
+    }
+    void check_pred_structure(uint8_t pred_structure, uint32_t rc_mode,
+                              EbErrorType expected) {
+        EncParamTestBase::SetUp();
+        ctxt_.enc_params.pred_structure = pred_structure;
+        ctxt_.enc_params.rate_control_mode = rc_mode;
+        if (rc_mode == 1) {
+            /** rate_control_mode(1) requires the second pass */
+            ctxt_.enc_params.pass = 2;
+            ctxt_.enc_params.frames_to_be_encoded = 60;
+        } else if (rc_mode == 2 || rc_mode == 3) {
+            /** rate_control_mode(2/3) requires look ahead of intra period */
+            ctxt_.enc_params.intra_period_length = 31;
+            ctxt_.enc_params.look_ahead_distance = 31;
+        }
+        EXPECT_EQ(expected,
+                  eb_svt_enc_set_parameter(ctxt_.enc_handle, &ctxt_.enc_params))
+        PRINT_2PARAM_FATAL(ctxt_.enc_params.pred_structure,
+                           ctxt_.enc_params.rate_control_mode);
+        EncParamTestBase::TearDown();
+    }
+};
+PARAM_TEST(EncParamPredStructRateCtrlTest);
+
 /** Test case for base_layer_switch_mode*/
 DEFINE_PARAM_TEST_CLASS(EncParamBaseLayerSwitchModeTest,
                         base_layer_switch_mode);
@@ -288,6 +369,10 @@ PARAM_TEST(EncParamEnableQPScaleTest);
 DEFINE_PARAM_TEST_CLASS(EncParamDisableDlfTest, disable_dlf_flag);
 PARAM_TEST(EncParamDisableDlfTest);
 
+/** Test case for enable_fused_loop_filter*/
+DEFINE_PARAM_TEST_CLASS(EncParamFusedLoopFilterTest, enable_fused_loop_filter);
+PARAM_TEST(EncParamFusedLoopFilterTest);
+
 /** Test case for enable_denoise_flag*/
 DEFINE_PARAM_TEST_CLASS(EncParamEnableDenoiseTest, enable_denoise_flag);
 PARAM_TEST(EncParamEnableDenoiseTest);
@@ -353,6 +438,18 @@ PARAM_TEST(EncParamMaxQPAllowTest);
 DEFINE_PARAM_TEST_CLASS(EncParamMinQPAllowTest, min_qp_allowed);
 PARAM_TEST(EncParamMinQPAllowTest);
 
+/** Test case for pass*/
+DEFINE_PARAM_TEST_CLASS(EncParamPassTest, pass);
+PARAM_TEST(EncParamPassTest);
+
+/** Test case for vbv_max_rate*/
+DEFINE_PARAM_TEST_CLASS(EncParamVbvMaxRateTest, vbv_max_rate);
+PARAM_TEST(EncParamVbvMaxRateTest);
+
+/** Test case for vbv_buffer_size*/
+DEFINE_PARAM_TEST_CLASS(EncParamVbvBufferSizeTest, vbv_buffer_size);
+PARAM_TEST(EncParamVbvBufferSizeTest);
+
 /** Test case for high_dynamic_range_input*/
 DEFINE_PARAM_TEST_CLASS(EncParamHighDynamicRangeInputTest,
                         high_dynamic_range_input);
@@ -398,6 +495,22 @@ PARAM_TEST(EncParamLogicalProcessorsTest);
 DEFINE_PARAM_TEST_CLASS(EncParamTargetSocketTest, target_socket);
 PARAM_TEST(EncParamTargetSocketTest);
 
+/** Test case for enable_thread_pool*/
+DEFINE_PARAM_TEST_CLASS(EncParamThreadPoolTest, enable_thread_pool);
+PARAM_TEST(EncParamThreadPoolTest);
+
+/** Test case for numa_node*/
+DEFINE_PARAM_TEST_CLASS(EncParamNumaNodeTest, numa_node);
+PARAM_TEST(EncParamNumaNodeTest);
+
+/** Test case for adaptive_pool_sizing*/
+DEFINE_PARAM_TEST_CLASS(EncParamAdaptivePoolSizingTest, adaptive_pool_sizing);
+PARAM_TEST(EncParamAdaptivePoolSizingTest);
+
+/** Test case for memory_budget*/
+DEFINE_PARAM_TEST_CLASS(EncParamMemoryBudgetTest, memory_budget);
+PARAM_TEST(EncParamMemoryBudgetTest);
+
 /** Test case for recon_enabled*/
 DEFINE_PARAM_TEST_CLASS(EncParamReconEnabledTest, recon_enabled);
 PARAM_TEST(EncParamReconEnabledTest);
@@ -416,6 +529,11 @@ PARAM_TEST(EncParamTileRowsTest);
 DEFINE_PARAM_TEST_CLASS(EncParamScreenContentModeTest, screen_content_mode);
 PARAM_TEST(EncParamScreenContentModeTest);
 
+/** Test case for enable_adaptive_quantization*/
+DEFINE_PARAM_TEST_CLASS(EncParamAdaptiveQuantizationTest,
+                        enable_adaptive_quantization);
+PARAM_TEST(EncParamAdaptiveQuantizationTest);
+
 /** Test case for enable_altrefs*/
 DEFINE_PARAM_TEST_CLASS(EncParamEnableAltRefsTest, enable_altrefs);
 PARAM_TEST(EncParamEnableAltRefsTest);
@@ -0,0 +1,183 @@
+/*
+ * Copyright(c) 2019 Netflix, Inc.
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SvtAv1EncVbvTest.cc
+ *
+ * @brief SVT-AV1 encoder VBV buffer test:
+ * - the packets of a constant rate factor encoding with a VBV buffer set fit
+ *   in the buffer as a decoder fills it
+ *
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "SvtAv1EncApiTest.h"
+
+using namespace svt_av1_test;
+
+namespace {
+
+static const uint32_t width = 176;
+static const uint32_t height = 144;
+static const uint32_t frame_count = 60;
+static const uint32_t fps = 30;
+static const uint32_t crf_qp = 10;
+static const uint32_t vbv_max_rate = 400000;
+static const uint32_t vbv_buffer_size = 400000;
+
+/** fill_picture draws a textured picture scrolling down and right, with
+ * noise changing from a picture to the next */
+static void fill_picture(std::vector<uint8_t> &buffer, uint32_t index) {
+    uint8_t *luma = buffer.data();
+    uint8_t *cb = luma + width * height;
+    uint8_t *cr = cb + width * height / 4;
+    uint32_t seed = 1 + index;
+
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint32_t u = x + 3 * index;
+            const uint32_t v = y + 2 * index;
+            seed = seed * 1103515245 + 12345;
+            luma[y * width + x] = (uint8_t)(32 + ((u * v) & 0x7F) +
+                                            ((seed >> 16) & 0x1F));
+        }
+    }
+    for (uint32_t i = 0; i < width * height / 4; ++i) {
+        seed = seed * 1103515245 + 12345;
+        cb[i] = (uint8_t)(100 + ((seed >> 16) & 0x0F));
+        cr[i] = (uint8_t)(150 - ((seed >> 20) & 0x0F));
+    }
+}
+
+/** encode_packet_bits encodes the pictures in constant rate factor mode and
+ * returns the size in bits of each packet, in decoding order */
+static std::vector<uint32_t> encode_packet_bits(uint32_t max_rate,
+                                                uint32_t buffer_size) {
+    SvtAv1Context context = {0};
+    std::vector<uint8_t> buffer(width * height * 3 / 2);
+    std::vector<uint32_t> bits;
+    EbSvtIOFormat io;
+
+    EXPECT_EQ(
+        EB_ErrorNone,
+        eb_init_handle(&context.enc_handle, &context, &context.enc_params));
+    if (context.enc_handle == nullptr)
+        return bits;
+    context.enc_params.source_width = width;
+    context.enc_params.source_height = height;
+    context.enc_params.enc_mode = 8;
+    context.enc_params.frame_rate = fps;
+    context.enc_params.frames_to_be_encoded = frame_count;
+    context.enc_params.rate_control_mode = 4;
+    context.enc_params.qp = crf_qp;
+    context.enc_params.vbv_max_rate = max_rate;
+    context.enc_params.vbv_buffer_size = buffer_size;
+    EXPECT_EQ(EB_ErrorNone,
+              eb_svt_enc_set_parameter(context.enc_handle, &context.enc_params));
+    EXPECT_EQ(EB_ErrorNone, eb_init_encoder(context.enc_handle));
+
+    memset(&io, 0, sizeof(io));
+    io.luma = buffer.data();
+    io.cb = io.luma + width * height;
+    io.cr = io.cb + width * height / 4;
+    io.y_stride = width;
+    io.cb_stride = width / 2;
+    io.cr_stride = width / 2;
+    for (uint32_t i = 0; i < frame_count; ++i) {
+        EbBufferHeaderType header;
+
+        // The encoder copies the picture before eb_svt_enc_send_picture
+        // returns, the buffer is reused for the next one
+        fill_picture(buffer, i);
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(header);
+        header.p_buffer = (uint8_t *)&io;
+        header.n_filled_len = (uint32_t)buffer.size();
+        header.pts = i;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        EXPECT_EQ(EB_ErrorNone,
+                  eb_svt_enc_send_picture(context.enc_handle, &header));
+    }
+    {
+        EbBufferHeaderType header;
+
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(header);
+        header.flags = EB_BUFFERFLAG_EOS;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        EXPECT_EQ(EB_ErrorNone,
+                  eb_svt_enc_send_picture(context.enc_handle, &header));
+    }
+
+    for (bool eos = false; !eos;) {
+        EbBufferHeaderType *packet;
+
+        if (eb_svt_get_packet(context.enc_handle, &packet, 1) !=
+            EB_ErrorNone)
+            continue;
+        eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        if (packet->n_filled_len)
+            bits.push_back(8 * packet->n_filled_len);
+        eb_svt_release_out_buffer(&packet);
+    }
+
+    EXPECT_EQ(EB_ErrorNone, eb_deinit_encoder(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, eb_deinit_handle(context.enc_handle));
+    return bits;
+}
+
+/** count_underflows replays the buffer of the decoder: it starts 90% full,
+ * each packet is taken out of it, then it fills at max_rate for a picture
+ * duration, up to its size. Returns the number of packets larger than the
+ * buffer fullness when they are taken out. */
+static uint32_t count_underflows(const std::vector<uint32_t> &bits,
+                                 uint32_t max_rate, uint32_t buffer_size) {
+    double fullness = 0.9 * buffer_size;
+    uint32_t underflows = 0;
+
+    for (size_t i = 0; i < bits.size(); ++i) {
+        if (bits[i] > fullness)
+            ++underflows;
+        fullness -= bits[i];
+        fullness += (double)max_rate / fps;
+        if (fullness > buffer_size)
+            fullness = buffer_size;
+    }
+    return underflows;
+}
+
+/** @brief crf_vbv_buffer is an api test case
+ * EncApiTest.crf_vbv_buffer checks the constant rate factor mode keeps the
+ * packets in the VBV buffer
+ *
+ * Test strategy: <br>
+ * Encode noisy pictures at a low QP in constant rate factor mode, first
+ * without a VBV buffer, then with a buffer smaller than the unconstrained
+ * rate needs. Replay the buffer of the decoder over the packets of both. <br>
+ *
+ * Expected result: <br>
+ * The unconstrained packets underflow the buffer, so that the pictures are
+ * hard enough to code for the test to tell something. The packets encoded
+ * with the buffer set never underflow it. <br>
+ *
+ * Test coverage:
+ * rate_control_mode 4 with vbv_max_rate and vbv_buffer_size.
+ */
+TEST(EncApiTest, crf_vbv_buffer) {
+    const std::vector<uint32_t> free_bits = encode_packet_bits(0, 0);
+    ASSERT_FALSE(free_bits.empty());
+    EXPECT_GT(count_underflows(free_bits, vbv_max_rate, vbv_buffer_size), 0u)
+        << "the pictures fit in the buffer without the VBV model";
+
+    const std::vector<uint32_t> vbv_bits =
+        encode_packet_bits(vbv_max_rate, vbv_buffer_size);
+    ASSERT_FALSE(vbv_bits.empty());
+    EXPECT_EQ(0u, count_underflows(vbv_bits, vbv_max_rate, vbv_buffer_size));
+}
+
+}  // namespace
@@ -0,0 +1,161 @@
+/*
+ * Copyright(c) 2019 Netflix, Inc.
+ * SPDX - License - Identifier: BSD - 2 - Clause - Patent
+ */
+
+/******************************************************************************
+ * @file SvtAv1EncZeroCopyTest.cc
+ *
+ * @brief SVT-AV1 encoder zero copy input test:
+ * - the encoder works on the planes of the application, not on a copy
+ * - each picture sent is released exactly once
+ *
+ ******************************************************************************/
+#include <atomic>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "SvtAv1EncApiTest.h"
+
+using namespace svt_av1_test;
+
+namespace {
+
+static const uint32_t width = 176;
+static const uint32_t height = 144;
+static const uint32_t frame_count = 10;
+// Border asked by eb_svt_enc_set_input_buffer_callback, rounded up
+static const uint32_t border = 136;
+static const uint8_t border_fill = 0xA5;
+
+/** ZeroCopyPicture holds the planes of a picture sent to the encoder */
+typedef struct {
+    std::vector<uint8_t> buffer;
+    EbSvtIOFormat io;
+    std::atomic<uint32_t> release_count;
+    std::atomic<bool> padded_at_release;
+} ZeroCopyPicture;
+
+static void release_picture(void *p_app_private, void *priv_data) {
+    ZeroCopyPicture *picture = (ZeroCopyPicture *)p_app_private;
+    (void)priv_data;
+    // The encoder pads the planes in place, the left border of the first
+    // row then repeats its first sample instead of the fill
+    picture->padded_at_release =
+        picture->io.luma[-1] == picture->io.luma[0] &&
+        picture->io.luma[-1] != border_fill;
+    ++picture->release_count;
+}
+
+static void setup_picture(ZeroCopyPicture *picture, uint32_t index) {
+    const uint32_t y_stride = width + 2 * border;
+    const uint32_t c_stride = y_stride / 2;
+    const size_t y_size = (size_t)y_stride * (height + 2 * border);
+    const size_t c_size = (size_t)c_stride * (height / 2 + border);
+
+    picture->buffer.assign(y_size + 2 * c_size, border_fill);
+    memset(&picture->io, 0, sizeof(picture->io));
+    picture->io.luma = picture->buffer.data() + border * y_stride + border;
+    picture->io.cb = picture->buffer.data() + y_size +
+                     border / 2 * c_stride + border / 2;
+    picture->io.cr = picture->io.cb + c_size;
+    picture->io.y_stride = y_stride;
+    picture->io.cb_stride = c_stride;
+    picture->io.cr_stride = c_stride;
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x)
+            picture->io.luma[y * y_stride + x] =
+                (uint8_t)(16 + ((x + y + 4 * index) & 0x7F));
+    }
+    for (uint32_t y = 0; y < height / 2; ++y) {
+        memset(picture->io.cb + y * c_stride, 100 + index, width / 2);
+        memset(picture->io.cr + y * c_stride, 150 - index, width / 2);
+    }
+    picture->release_count = 0;
+    picture->padded_at_release = false;
+}
+
+/** @brief zero_copy_input is an api test case
+ * EncApiTest.zero_copy_input checks the zero copy input mode
+ *
+ * Test strategy: <br>
+ * Encode pictures in planes with a filled border, with a release callback
+ * set. At release, check the border of each picture was padded by the
+ * encoder, which only happens if it worked on the planes themselves. <br>
+ *
+ * Expected result: <br>
+ * All the pictures are released exactly once by eb_deinit_encoder, each of
+ * them padded in place. <br>
+ *
+ * Test coverage:
+ * eb_svt_enc_set_input_buffer_callback, eb_svt_enc_send_picture.
+ */
+TEST(EncApiTest, zero_copy_input) {
+    SvtAv1Context context = {0};
+    std::vector<ZeroCopyPicture> pictures(frame_count);
+
+    ASSERT_EQ(
+        EB_ErrorNone,
+        eb_init_handle(&context.enc_handle, &context, &context.enc_params));
+    context.enc_params.source_width = width;
+    context.enc_params.source_height = height;
+    context.enc_params.enc_mode = 8;
+    context.enc_params.frames_to_be_encoded = frame_count;
+    ASSERT_EQ(EB_ErrorNone,
+              eb_svt_enc_set_parameter(context.enc_handle, &context.enc_params));
+    ASSERT_EQ(EB_ErrorNone,
+              eb_svt_enc_set_input_buffer_callback(
+                  context.enc_handle, release_picture, nullptr));
+    ASSERT_EQ(EB_ErrorNone, eb_init_encoder(context.enc_handle));
+
+    for (uint32_t i = 0; i < frame_count; ++i) {
+        EbBufferHeaderType header;
+
+        setup_picture(&pictures[i], i);
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(header);
+        header.p_buffer = (uint8_t *)&pictures[i].io;
+        header.n_filled_len = width * height * 3 / 2;
+        header.p_app_private = &pictures[i];
+        header.pts = i;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        EXPECT_EQ(EB_ErrorNone,
+                  eb_svt_enc_send_picture(context.enc_handle, &header));
+    }
+    {
+        EbBufferHeaderType header;
+
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(header);
+        header.flags = EB_BUFFERFLAG_EOS;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        EXPECT_EQ(EB_ErrorNone,
+                  eb_svt_enc_send_picture(context.enc_handle, &header));
+    }
+
+    for (bool eos = false; !eos;) {
+        EbBufferHeaderType *packet;
+
+        if (eb_svt_get_packet(context.enc_handle, &packet, 1) !=
+            EB_ErrorNone)
+            continue;
+        eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        eb_svt_release_out_buffer(&packet);
+    }
+
+    // The last references are released at deinit at the latest
+    EXPECT_EQ(EB_ErrorNone, eb_deinit_encoder(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, eb_deinit_handle(context.enc_handle));
+
+    for (uint32_t i = 0; i < frame_count; ++i) {
+        EXPECT_EQ(1u, pictures[i].release_count.load())
+            << "picture " << i << " released " << pictures[i].release_count
+            << " times";
+        EXPECT_TRUE(pictures[i].padded_at_release.load())
+            << "picture " << i << " was not padded in place";
+    }
+}
+
+}  // namespace
@@ -477,6 +477,21 @@ static const vector<EbBool> invalid_disable_dlf_flag = {
     // none
 };
 
+/* Flag to run the CDEF and the Loop Restoration of each SB row right
+ * behind its Deblocking.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_enable_fused_loop_filter = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_enable_fused_loop_filter = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_enable_fused_loop_filter = {
+    // none
+};
+
 /* Denoise the input picture when noise levels are too high
  * Flag to enable the denoising
  *
@@ -627,11 +642,12 @@ static const vector<EbBool> invalid_constrained_intra = {
  *
  * 0 = Constant QP.
  * 1 = Average BitRate.
+ * 4 = Constant rate factor.
  *
  * Default is 0. */
 static const vector<uint32_t> default_rate_control_mode = {0};
-static const vector<uint32_t> valid_rate_control_mode = {0, 1, 2, 3};
-static const vector<uint32_t> invalid_rate_control_mode = {4};
+static const vector<uint32_t> valid_rate_control_mode = {0, 1, 2, 3, 4};
+static const vector<uint32_t> invalid_rate_control_mode = {5};
 
 /* Flag to enable the scene change detection algorithm.
  *
@@ -746,6 +762,61 @@ static const vector<uint32_t> invalid_min_qp_allowed = {
     MAX_QP_VALUE,
 };
 
+/* Two pass encoding, both passes need frames_to_be_encoded and the second
+ * pass needs the rate control mode 1.
+ *
+ * 0 = Single pass.
+ * 1 = First pass.
+ * 2 = Second pass.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_pass = {
+    0,
+};
+static const vector<uint32_t> valid_pass = {
+    0,
+    1,
+    2,
+};
+static const vector<uint32_t> invalid_pass = {
+    3,
+};
+
+/* Rate in bits/second at which the VBV buffer fills, only applicable when
+ * rate control mode is set to 4.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_vbv_max_rate = {
+    0,
+};
+static const vector<uint32_t> valid_vbv_max_rate = {
+    0,
+    1,
+    1000000,
+    7000000,
+    0xFFFFFFFF,
+};
+static const vector<uint32_t> invalid_vbv_max_rate = {
+    // none
+};
+
+/* Size of the VBV buffer in bits, only applicable when vbv_max_rate is set.
+ *
+ * Default is 0, one second of vbv_max_rate. */
+static const vector<uint32_t> default_vbv_buffer_size = {
+    0,
+};
+static const vector<uint32_t> valid_vbv_buffer_size = {
+    0,
+    1,
+    1000000,
+    7000000,
+    0xFFFFFFFF,
+};
+static const vector<uint32_t> invalid_vbv_buffer_size = {
+    // none
+};
+
 // Tresholds
 /* Flag to signal that the input yuv is HDR10 BT2020 using SMPTE ST2048,
  * requires
@@ -953,6 +1024,71 @@ static const vector<int32_t> invalid_target_socket = {
     2,
 };
 
+/* Run the kernel threads of all stages on one pool of run slots sized to the
+ * logical processors in use.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_enable_thread_pool = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_enable_thread_pool = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_enable_thread_pool = {
+    2,
+};
+
+/* NUMA node to bind the threads and the memory of the encoder to, it has to
+ * be a node with logical processors. Cannot be set with target_socket.
+ *
+ * Default is -1. */
+static const vector<int32_t> default_numa_node = {
+    -1,
+};
+static const vector<int32_t> valid_numa_node = {
+    -1,
+#if defined(_WIN32) || defined(__linux__)
+    0,
+#endif
+};
+static const vector<int32_t> invalid_numa_node = {
+    -2,
+    1024,
+};
+
+/* Start the picture buffer pools at the size a single core pipeline needs
+ * and grow them on demand.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_adaptive_pool_sizing = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_adaptive_pool_sizing = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_adaptive_pool_sizing = {
+    2,
+};
+
+/* Memory in MB past which adaptive pool sizing stops growing the pools, 0 is
+ * no bound. Requires adaptive_pool_sizing.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_memory_budget = {
+    0,
+};
+static const vector<uint32_t> valid_memory_budget = {
+    0,
+    1,
+    512,
+    0xFFFFFFFF,
+};
+static const vector<uint32_t> invalid_memory_budget = {
+    // none
+};
+
 // Debug tools
 
 /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -1008,6 +1144,17 @@ static const vector<int32_t> default_screen_content_mode = {2};
 static const vector<int32_t> valid_screen_content_mode = {0, 1, 2};
 static const vector<int32_t> invalid_screen_content_mode = {3};
 
+/* Adaptive quantization within a frame using segmentation.
+ *
+ * 0 = OFF.
+ * 1 = Segments from the variance of the blocks.
+ * 2 = Segments from the temporal dependencies of the look ahead.
+ *
+ * Default is 0. */
+static const vector<uint8_t> default_enable_adaptive_quantization = {0};
+static const vector<uint8_t> valid_enable_adaptive_quantization = {0, 1, 2};
+static const vector<uint8_t> invalid_enable_adaptive_quantization = {3};
+
 /* Variables to control the use of ALT-REF (temporally filtered frames)
  */
 static const vector<EbBool> default_enable_altrefs = {EB_TRUE};
@@ -0,0 +1,1446 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/******************************************************************************
+ * @file KernelBench.cc
+ *
+ * @brief Micro-benchmark of the kernels dispatched through aom_dsp_rtcd.h.
+ *
+ * Every C and SIMD implementation listed in KernelBenchList.h is timed on
+ * the block sizes and bit depths it supports, with the instruction sets the
+ * CPU does not have skipped. One CSV row is printed per measurement:
+ *
+ *   family,kernel,isa,width,height,bitdepth,param,cycles_per_call,
+ *   cycles_per_pixel,speedup_vs_c
+ *
+ * param is the family specific argument of the measurement (transform size,
+ * block size, window, ...), -1 when unused. speedup_vs_c is left empty for
+ * kernels without a C implementation.
+ *
+ * Usage: SvtAv1KernelBench [--filter=<substring>] [--iterations=<n>] [--list]
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+#include "convolve.h"
+#include "EbCdef.h"
+#include "EbRestoration.h"
+#include "EbTransforms.h"
+#include "EbPictureControlSet.h"
+#include "EbUtility.h"
+#include "random.h"
+#include "KernelBenchList.h"
+
+extern "C" EbAsm GetCpuAsmType();
+extern "C" InterpFilterParams av1_get_interp_filter_params_with_block_size(
+    const InterpFilter interp_filter, const int32_t w);
+extern "C" void av1_build_quantizer(AomBitDepth bit_depth, int32_t y_dc_delta_q,
+                                    int32_t u_dc_delta_q, int32_t u_ac_delta_q,
+                                    int32_t v_dc_delta_q, int32_t v_ac_delta_q,
+                                    Quants *const quants, Dequants *const deq);
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+/**************************************
+ * Instruction sets
+ **************************************/
+enum BenchIsa { ISA_C, ISA_SSE2, ISA_SSSE3, ISA_SSE4_1, ISA_AVX2, ISA_COUNT };
+
+const char *const isa_names[ISA_COUNT] = {"c", "sse2", "ssse3", "sse4_1", "avx2"};
+
+// Same assumption as setup_rtcd_internal(): everything up to SSE4.1 is
+// present, AVX2 only when the CPU and the OS support it.
+bool isa_available(BenchIsa isa) {
+    return isa != ISA_AVX2 || GetCpuAsmType() == ASM_AVX2;
+}
+
+/**************************************
+ * Timing
+ **************************************/
+// Cycles each timed batch of calls is calibrated to.
+const uint64_t kTargetCycles = 1 << 20;
+const int kMaxIterations = 1 << 16;
+const int kRepeats = 5;
+
+volatile uint64_t bench_sink;
+
+class BenchTimer {
+  public:
+    explicit BenchTimer(int iterations) : iterations_(iterations) {
+    }
+
+    // Returns the cycles per call of the fastest of kRepeats batches.
+    template <typename Call>
+    double measure(Call call) const {
+        call();  // warm up caches and branch predictors
+        int iterations = iterations_;
+        if (iterations <= 0) {
+            const uint64_t start = __rdtsc();
+            call();
+            const uint64_t once = __rdtsc() - start + 1;
+            iterations = (int)AOMMIN(AOMMAX(kTargetCycles / once, 1), kMaxIterations);
+        }
+        uint64_t best = UINT64_MAX;
+        for (int r = 0; r < kRepeats; ++r) {
+            const uint64_t start = __rdtsc();
+            for (int i = 0; i < iterations; ++i)
+                call();
+            best = AOMMIN(best, __rdtsc() - start);
+        }
+        return (double)best / iterations;
+    }
+
+  private:
+    int iterations_;
+};
+
+/**************************************
+ * Shared input and output buffers
+ **************************************/
+// Planes large enough for a 128x128 block plus the borders read by filters.
+const int kStride = 384;
+const int kBorder = 64;
+const int kPlaneSize = kStride * (MAX_SB_SIZE + 2 * kBorder);
+const int kEdgeSize = 2 * MAX_SB_SIZE + 64;
+const int kEdgeOffset = 32;
+
+struct BenchBuffers {
+    DECLARE_ALIGNED(32, uint8_t, src8[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint8_t, ref8[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint8_t, dst8[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint16_t, src16[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint16_t, ref16[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint16_t, dst16[kPlaneSize]);
+    DECLARE_ALIGNED(32, uint8_t, edge8[2][kEdgeSize]);
+    DECLARE_ALIGNED(32, uint16_t, edge16[2][kEdgeSize]);
+    DECLARE_ALIGNED(32, int16_t, residual[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, int32_t, coeff[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, int32_t, coeff_out[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, TranLow, qcoeff[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, TranLow, dqcoeff[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, ConvBufType, conv_buf[MAX_SB_SQUARE]);
+    DECLARE_ALIGNED(32, int32_t, flt0[RESTORATION_UNITPELS_MAX]);
+    DECLARE_ALIGNED(32, int32_t, flt1[RESTORATION_UNITPELS_MAX]);
+    DECLARE_ALIGNED(32, int32_t, tmpbuf[RESTORATION_TMPBUF_SIZE]);
+    DECLARE_ALIGNED(32, int64_t, stats_m[WIENER_WIN2]);
+    DECLARE_ALIGNED(32, int64_t, stats_h[WIENER_WIN2 * WIENER_WIN2]);
+    DECLARE_ALIGNED(32, float, fft_in[32 * 32]);
+    DECLARE_ALIGNED(32, float, fft_tmp[2 * 32 * 32]);
+    DECLARE_ALIGNED(32, float, fft_out[2 * 32 * 32]);
+    DECLARE_ALIGNED(32, uint8_t, levels[TX_PAD_2D]);
+    DECLARE_ALIGNED(32, int8_t, coeff_contexts[MAX_TX_SQUARE]);
+    DECLARE_ALIGNED(32, uint64_t, cdef_mse[2][MAX_SB_SIZE * TOTAL_STRENGTHS]);
+    Quants quants[2];
+    Dequants dequants[2];
+};
+
+BenchBuffers *buffers;
+
+// Top left sample of the block within a plane.
+template <typename Sample>
+Sample *block(Sample *plane) {
+    return plane + kBorder * kStride + kBorder;
+}
+
+template <typename Sample>
+Sample *edge(Sample *buf) {
+    return buf + kEdgeOffset;
+}
+
+void init_buffers() {
+    SVTRandom rnd8(8, false);
+    SVTRandom rnd10(10, false);
+    SVTRandom rnd_res(9, true);
+    SVTRandom rnd_coeff(11, true);
+
+    buffers = (BenchBuffers *)aom_memalign(32, sizeof(BenchBuffers));
+    memset(buffers, 0, sizeof(*buffers));
+    for (int i = 0; i < kPlaneSize; ++i) {
+        buffers->src8[i] = rnd8.Rand8();
+        buffers->ref8[i] = rnd8.Rand8();
+        buffers->dst8[i] = rnd8.Rand8();
+        buffers->src16[i] = rnd10.Rand16();
+        buffers->ref16[i] = rnd10.Rand16();
+        buffers->dst16[i] = rnd10.Rand16();
+    }
+    for (int e = 0; e < 2; ++e) {
+        for (int i = 0; i < kEdgeSize; ++i) {
+            buffers->edge8[e][i] = rnd8.Rand8();
+            buffers->edge16[e][i] = rnd10.Rand16();
+        }
+    }
+    for (int i = 0; i < MAX_SB_SQUARE; ++i) {
+        buffers->residual[i] = (int16_t)rnd_res.random();
+        buffers->coeff[i] = rnd_coeff.random();
+        buffers->qcoeff[i] = rnd_coeff.random();
+    }
+    for (int i = 0; i < 32 * 32; ++i)
+        buffers->fft_in[i] = (float)rnd_res.random();
+    for (int p = 0; p < 2; ++p)
+        for (int i = 0; i < MAX_SB_SIZE * TOTAL_STRENGTHS; ++i)
+            buffers->cdef_mse[p][i] = (uint64_t)rnd_coeff.random() + 1024;
+    av1_build_quantizer(AOM_BITS_8, 0, 0, 0, 0, 0, &buffers->quants[0], &buffers->dequants[0]);
+    av1_build_quantizer(AOM_BITS_10, 0, 0, 0, 0, 0, &buffers->quants[1], &buffers->dequants[1]);
+}
+
+/**************************************
+ * Kernel families
+ **************************************/
+typedef void (*GenericFunc)(void);
+
+// One measured configuration of a kernel.
+struct BenchConfig {
+    int width;
+    int height;
+    int bd;
+    int param;
+    uint64_t pixels;  // samples processed per call
+};
+
+BenchConfig make_config(int width, int height, int bd, int param = -1,
+                        uint64_t pixels = 0) {
+    BenchConfig cfg = {width, height, bd, param, pixels ? pixels : (uint64_t)width * height};
+    return cfg;
+}
+
+class KernelBench {
+  public:
+    KernelBench(const char *kernel, int width, int height)
+        : kernel_(kernel), width_(width), height_(height) {
+    }
+    virtual ~KernelBench() {
+    }
+    // Default: the block size fixed by the kernel name, at 8 bits.
+    virtual std::vector<BenchConfig> configs() const {
+        return {make_config(width_, height_, 8)};
+    }
+    // Cycles per call of func on cfg.
+    virtual double run(GenericFunc func, const BenchConfig &cfg,
+                       const BenchTimer &timer) const = 0;
+
+  protected:
+    std::string kernel_;
+    int width_;
+    int height_;
+};
+
+template <typename F>
+class TypedBench : public KernelBench {
+  public:
+    typedef F Func;
+    TypedBench(const char *kernel, int width, int height)
+        : KernelBench(kernel, width, height) {
+    }
+    double run(GenericFunc func, const BenchConfig &cfg,
+               const BenchTimer &timer) const override {
+        return run_typed(reinterpret_cast<F>(func), cfg, timer);
+    }
+    virtual double run_typed(F f, const BenchConfig &cfg,
+                             const BenchTimer &timer) const = 0;
+};
+
+std::vector<BenchConfig> tx_size_configs(int bd, int max_size = 64) {
+    std::vector<BenchConfig> configs;
+    for (int tx = TX_4X4; tx < TX_SIZES_ALL; ++tx) {
+        if (tx_size_wide[tx] <= max_size && tx_size_high[tx] <= max_size)
+            configs.push_back(make_config(tx_size_wide[tx], tx_size_high[tx], bd, tx));
+    }
+    return configs;
+}
+
+std::vector<BenchConfig> block_size_configs(int bd) {
+    std::vector<BenchConfig> configs;
+    for (int bs = BLOCK_4X4; bs < BlockSizeS_ALL; ++bs)
+        configs.push_back(make_config(block_size_wide[bs], block_size_high[bs], bd, bs));
+    return configs;
+}
+
+std::vector<BenchConfig> square_configs(int min_size, int max_size, int bd, int param = -1) {
+    std::vector<BenchConfig> configs;
+    for (int size = min_size; size <= max_size; size <<= 1)
+        configs.push_back(make_config(size, size, bd, param));
+    return configs;
+}
+
+TxSize tx_size_of(int width, int height) {
+    for (int tx = TX_4X4; tx < TX_SIZES_ALL; ++tx) {
+        if (tx_size_wide[tx] == width && tx_size_high[tx] == height)
+            return (TxSize)tx;
+    }
+    return TX_INVALID;
+}
+
+bool name_has(const std::string &name, const char *part) {
+    return name.find(part) != std::string::npos;
+}
+
+/**************************************
+ * Intra prediction
+ **************************************/
+typedef void (*IntraLbdFunc)(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                             const uint8_t *left);
+typedef void (*IntraHbdFunc)(uint16_t *dst, ptrdiff_t stride, const uint16_t *above,
+                             const uint16_t *left, int32_t bd);
+
+class IntraLbdBench : public TypedBench<IntraLbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(block(buffers->dst8), kStride, edge(buffers->edge8[0]), edge(buffers->edge8[1]));
+        });
+    }
+};
+
+class IntraHbdBench : public TypedBench<IntraHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 10), make_config(width_, height_, 12)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(block(buffers->dst16), kStride, edge(buffers->edge16[0]),
+              edge(buffers->edge16[1]), cfg.bd);
+        });
+    }
+};
+
+typedef void (*SmoothPredictorAllFunc)(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                       const uint8_t *above, const uint8_t *left);
+
+class SmoothPredictorAllBench : public TypedBench<SmoothPredictorAllFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(block(buffers->dst8), kStride, cfg.width, cfg.height,
+              edge(buffers->edge8[0]), edge(buffers->edge8[1]));
+        });
+    }
+};
+
+// Directional prediction at 45 (zone 1), 135 (zone 2) and 225 (zone 3)
+// degrees, where dr_intra_derivative[] gives a step of 64.
+const int kDrDerivative = 64;
+
+typedef void (*DrZ1LbdFunc)(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                            const uint8_t *above, const uint8_t *left, int32_t upsample_above,
+                            int32_t dx, int32_t dy);
+typedef void (*DrZ2LbdFunc)(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                            const uint8_t *above, const uint8_t *left, int32_t upsample_above,
+                            int32_t upsample_left, int32_t dx, int32_t dy);
+typedef DrZ1LbdFunc DrZ3LbdFunc;
+typedef void (*DrZ1HbdFunc)(uint16_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                            const uint16_t *above, const uint16_t *left, int32_t upsample_above,
+                            int32_t dx, int32_t dy, int32_t bd);
+typedef void (*DrZ2HbdFunc)(uint16_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                            const uint16_t *above, const uint16_t *left, int32_t upsample_above,
+                            int32_t upsample_left, int32_t dx, int32_t dy, int32_t bd);
+typedef DrZ1HbdFunc DrZ3HbdFunc;
+
+template <typename F, int dx, int dy>
+class DrLbdBench : public TypedBench<F> {
+  public:
+    using TypedBench<F>::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8);
+    }
+    double run_typed(F f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] { call(f, cfg); });
+    }
+
+  private:
+    static void call(DrZ1LbdFunc f, const BenchConfig &cfg) {
+        f(block(buffers->dst8), kStride, cfg.width, cfg.height, edge(buffers->edge8[0]),
+          edge(buffers->edge8[1]), 0, dx, dy);
+    }
+    static void call(DrZ2LbdFunc f, const BenchConfig &cfg) {
+        f(block(buffers->dst8), kStride, cfg.width, cfg.height, edge(buffers->edge8[0]),
+          edge(buffers->edge8[1]), 0, 0, dx, dy);
+    }
+};
+
+template <typename F, int dx, int dy>
+class DrHbdBench : public TypedBench<F> {
+  public:
+    using TypedBench<F>::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(10);
+    }
+    double run_typed(F f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] { call(f, cfg); });
+    }
+
+  private:
+    static void call(DrZ1HbdFunc f, const BenchConfig &cfg) {
+        f(block(buffers->dst16), kStride, cfg.width, cfg.height, edge(buffers->edge16[0]),
+          edge(buffers->edge16[1]), 0, dx, dy, cfg.bd);
+    }
+    static void call(DrZ2HbdFunc f, const BenchConfig &cfg) {
+        f(block(buffers->dst16), kStride, cfg.width, cfg.height, edge(buffers->edge16[0]),
+          edge(buffers->edge16[1]), 0, 0, dx, dy, cfg.bd);
+    }
+};
+
+typedef DrLbdBench<DrZ1LbdFunc, kDrDerivative, 1> DrZ1LbdBench;
+typedef DrLbdBench<DrZ2LbdFunc, kDrDerivative, kDrDerivative> DrZ2LbdBench;
+typedef DrLbdBench<DrZ3LbdFunc, 1, kDrDerivative> DrZ3LbdBench;
+typedef DrHbdBench<DrZ1HbdFunc, kDrDerivative, 1> DrZ1HbdBench;
+typedef DrHbdBench<DrZ2HbdFunc, kDrDerivative, kDrDerivative> DrZ2HbdBench;
+typedef DrHbdBench<DrZ3HbdFunc, 1, kDrDerivative> DrZ3HbdBench;
+
+typedef void (*FilterIntraFunc)(uint8_t *dst, ptrdiff_t stride, TxSize tx_size,
+                                const uint8_t *above, const uint8_t *left, int32_t mode);
+
+class FilterIntraBench : public TypedBench<FilterIntraFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8, 32);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(block(buffers->dst8), kStride, (TxSize)cfg.param, edge(buffers->edge8[0]),
+              edge(buffers->edge8[1]), FILTER_PAETH_PRED);
+        });
+    }
+};
+
+// The edge filters run in place, so they work on a scratch copy of the edge.
+typedef void (*IntraEdgeFilterFunc)(uint8_t *p, int32_t sz, int32_t strength);
+typedef void (*IntraEdgeFilterHbdFunc)(uint16_t *p, int32_t sz, int32_t strength);
+typedef void (*IntraEdgeUpsampleFunc)(uint8_t *p, int32_t sz);
+
+std::vector<BenchConfig> edge_configs(const int *sizes, int count, int bd, int param) {
+    std::vector<BenchConfig> configs;
+    for (int i = 0; i < count; ++i)
+        configs.push_back(make_config(sizes[i], 1, bd, param));
+    return configs;
+}
+
+const int kEdgeFilterSizes[] = {17, 33, 65, 129};
+const int kEdgeUpsampleSizes[] = {4, 8, 16};
+const int kEdgeStrength = 3;
+
+class IntraEdgeFilterBench : public TypedBench<IntraEdgeFilterFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return edge_configs(kEdgeFilterSizes, 4, 8, kEdgeStrength);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] { f(edge(buffers->edge8[0]), cfg.width, cfg.param); });
+    }
+};
+
+class IntraEdgeFilterHbdBench : public TypedBench<IntraEdgeFilterHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return edge_configs(kEdgeFilterSizes, 4, 10, kEdgeStrength);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] { f(edge(buffers->edge16[0]), cfg.width, cfg.param); });
+    }
+};
+
+class IntraEdgeUpsampleBench : public TypedBench<IntraEdgeUpsampleFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return edge_configs(kEdgeUpsampleSizes, 3, 8, -1);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            // Upsampling doubles the edge, start again from the same input.
+            memcpy(buffers->edge8[1], buffers->edge8[0], kEdgeOffset + cfg.width);
+            f(edge(buffers->edge8[1]), cfg.width);
+        });
+    }
+};
+
+typedef void (*CflSubtractAverageFunc)(int16_t *pred_buf_q3, int32_t width, int32_t height,
+                                       int32_t round_offset, int32_t num_pel_log2);
+typedef void (*CflPredictLbdFunc)(const int16_t *pred_buf_q3, uint8_t *pred,
+                                  int32_t pred_stride, uint8_t *dst, int32_t dst_stride,
+                                  int32_t alpha_q3, int32_t bit_depth, int32_t width,
+                                  int32_t height);
+typedef void (*CflPredictHbdFunc)(const int16_t *pred_buf_q3, uint16_t *pred,
+                                  int32_t pred_stride, uint16_t *dst, int32_t dst_stride,
+                                  int32_t alpha_q3, int32_t bit_depth, int32_t width,
+                                  int32_t height);
+
+const int kCflAlphaQ3 = 5;
+
+class CflSubtractAverageBench : public TypedBench<CflSubtractAverageFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8, CFL_BUF_LINE);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int num_pel_log2 = get_msb(cfg.width * cfg.height);
+        return t.measure([&] {
+            f(buffers->residual, cfg.width, cfg.height, 1 << (num_pel_log2 - 1), num_pel_log2);
+        });
+    }
+};
+
+class CflPredictLbdBench : public TypedBench<CflPredictLbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8, CFL_BUF_LINE);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        uint8_t *dst = block(buffers->dst8);
+        return t.measure([&] {
+            f(buffers->residual, dst, kStride, dst, kStride, kCflAlphaQ3, cfg.bd, cfg.width,
+              cfg.height);
+        });
+    }
+};
+
+class CflPredictHbdBench : public TypedBench<CflPredictHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(10, CFL_BUF_LINE);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        uint16_t *dst = block(buffers->dst16);
+        return t.measure([&] {
+            f(buffers->residual, dst, kStride, dst, kStride, kCflAlphaQ3, cfg.bd, cfg.width,
+              cfg.height);
+        });
+    }
+};
+
+/**************************************
+ * Distortion
+ **************************************/
+typedef uint32_t (*SadFunc)(const uint8_t *src, int src_stride, const uint8_t *ref,
+                            int ref_stride);
+typedef void (*Sad4dFunc)(const uint8_t *src, int src_stride, const uint8_t *const ref[],
+                          int ref_stride, uint32_t *sad_array);
+typedef uint32_t (*VarianceFunc)(const uint8_t *src, int src_stride, const uint8_t *ref,
+                                 int ref_stride, uint32_t *sse);
+typedef void (*HighbdMseFunc)(const uint8_t *src, int32_t src_stride, const uint8_t *ref,
+                              int32_t ref_stride, uint32_t *sse);
+typedef void (*HighbdVariance64Func)(const uint8_t *a8, int32_t a_stride, const uint8_t *b8,
+                                     int32_t b_stride, int32_t w, int32_t h, uint64_t *sse);
+typedef int64_t (*FrameErrorFunc)(const uint8_t *const ref, int stride, const uint8_t *const dst,
+                                  int p_width, int p_height, int p_stride);
+typedef void (*ResidualFunc)(uint8_t *input, uint32_t input_stride, uint8_t *pred,
+                             uint32_t pred_stride, int16_t *residual, uint32_t residual_stride,
+                             uint32_t area_width, uint32_t area_height);
+
+class SadBench : public TypedBench<SadFunc> {
+  public:
+    using TypedBench::TypedBench;
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        return t.measure([&] {
+            bench_sink += f(block(buffers->src8), kStride, block(buffers->ref8), kStride);
+        });
+    }
+};
+
+class Sad4dBench : public TypedBench<Sad4dFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 8, -1, 4 * width_ * height_)};
+    }
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        uint8_t *ref = block(buffers->ref8);
+        const uint8_t *const refs[4] = {ref, ref + 1, ref + 2, ref + 3};
+        uint32_t sad[4];
+        return t.measure([&] {
+            f(block(buffers->src8), kStride, refs, kStride, sad);
+            bench_sink += sad[0];
+        });
+    }
+};
+
+class VarianceBench : public TypedBench<VarianceFunc> {
+  public:
+    using TypedBench::TypedBench;
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        uint32_t sse;
+        return t.measure([&] {
+            bench_sink += f(block(buffers->src8), kStride, block(buffers->ref8), kStride, &sse);
+        });
+    }
+};
+
+class HighbdMseBench : public TypedBench<HighbdMseFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 10)};
+    }
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        uint32_t sse;
+        return t.measure([&] {
+            f(CONVERT_TO_BYTEPTR(block(buffers->src16)), kStride,
+              CONVERT_TO_BYTEPTR(block(buffers->ref16)), kStride, &sse);
+            bench_sink += sse;
+        });
+    }
+};
+
+class HighbdVariance64Bench : public TypedBench<HighbdVariance64Func> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return block_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        uint64_t sse;
+        return t.measure([&] {
+            f(block(buffers->src8), kStride, block(buffers->ref8), kStride, cfg.width,
+              cfg.height, &sse);
+            bench_sink += sse;
+        });
+    }
+};
+
+class FrameErrorBench : public TypedBench<FrameErrorFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return square_configs(8, MAX_SB_SIZE, 8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            bench_sink += f(block(buffers->ref8), kStride, block(buffers->src8), cfg.width,
+                            cfg.height, kStride);
+        });
+    }
+};
+
+class ResidualBench : public TypedBench<ResidualFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return block_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(block(buffers->src8), kStride, block(buffers->ref8), kStride, buffers->residual,
+              MAX_SB_SIZE, cfg.width, cfg.height);
+        });
+    }
+};
+
+/**************************************
+ * Transforms and quantization
+ **************************************/
+typedef void (*FwdTxfmFunc)(int16_t *input, int32_t *output, uint32_t input_stride,
+                            TxType transform_type, uint8_t bit_depth);
+typedef uint64_t (*HandleTransformFunc)(int32_t *output);
+typedef void (*InvTxfmSquareFunc)(const int32_t *input, uint16_t *output, int32_t stride,
+                                  TxType tx_type, int32_t bd);
+typedef void (*InvTxfmRectFunc)(const int32_t *input, uint16_t *output, int32_t stride,
+                                TxType tx_type, TxSize tx_size, int32_t bd);
+typedef void (*InvTxfmEobFunc)(const int32_t *input, uint16_t *output, int32_t stride,
+                               TxType tx_type, TxSize tx_size, int32_t eob, int32_t bd);
+typedef void (*InvTxfmAddFunc)(const TranLow *dqcoeff, uint8_t *dst, int32_t stride,
+                               const TxfmParam *txfm_param);
+typedef void (*FftFunc)(const float *input, float *temp, float *output);
+
+class FwdTxfmBench : public TypedBench<FwdTxfmFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 8, DCT_DCT), make_config(width_, height_, 10, DCT_DCT)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(buffers->residual, buffers->coeff_out, cfg.width, (TxType)cfg.param,
+              (uint8_t)cfg.bd);
+        });
+    }
+};
+
+class HandleTransformBench : public TypedBench<HandleTransformFunc> {
+  public:
+    using TypedBench::TypedBench;
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        return t.measure([&] { bench_sink += f(buffers->coeff_out); });
+    }
+};
+
+class InvTxfmSquareBench : public TypedBench<InvTxfmSquareFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 8, DCT_DCT), make_config(width_, height_, 10, DCT_DCT)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(buffers->coeff, block(buffers->dst16), kStride, (TxType)cfg.param, cfg.bd);
+        });
+    }
+};
+
+class InvTxfmRectBench : public TypedBench<InvTxfmRectFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 8, DCT_DCT), make_config(width_, height_, 10, DCT_DCT)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const TxSize tx_size = tx_size_of(cfg.width, cfg.height);
+        return t.measure([&] {
+            f(buffers->coeff, block(buffers->dst16), kStride, (TxType)cfg.param, tx_size, cfg.bd);
+        });
+    }
+};
+
+class InvTxfmEobBench : public TypedBench<InvTxfmEobFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(width_, height_, 8, DCT_DCT), make_config(width_, height_, 10, DCT_DCT)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const TxSize tx_size = tx_size_of(cfg.width, cfg.height);
+        const int32_t eob = av1_get_max_eob(tx_size);
+        return t.measure([&] {
+            f(buffers->coeff, block(buffers->dst16), kStride, (TxType)cfg.param, tx_size, eob,
+              cfg.bd);
+        });
+    }
+};
+
+class InvTxfmAddBench : public TypedBench<InvTxfmAddFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        TxfmParam txfm_param;
+        txfm_param.tx_type = DCT_DCT;
+        txfm_param.tx_size = (TxSize)cfg.param;
+        txfm_param.lossless = 0;
+        txfm_param.bd = cfg.bd;
+        txfm_param.is_hbd = 0;
+        txfm_param.tx_set_type = EXT_TX_SET_ALL16;
+        txfm_param.eob = av1_get_max_eob(txfm_param.tx_size);
+        return t.measure([&] {
+            f(buffers->dqcoeff, block(buffers->dst8), kStride, &txfm_param);
+        });
+    }
+};
+
+class FftBench : public TypedBench<FftFunc> {
+  public:
+    using TypedBench::TypedBench;
+    double run_typed(Func f, const BenchConfig &, const BenchTimer &t) const override {
+        return t.measure([&] { f(buffers->fft_in, buffers->fft_tmp, buffers->fft_out); });
+    }
+};
+
+typedef void (*QuantizeBFunc)(const TranLow *coeff_ptr, intptr_t n_coeffs, int32_t skip_block,
+                              const int16_t *zbin_ptr, const int16_t *round_ptr,
+                              const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                              TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                              const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                              const int16_t *scan, const int16_t *iscan);
+typedef void (*QuantizeFpFunc)(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                               const int16_t *zbin_ptr, const int16_t *round_ptr,
+                               const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                               TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                               const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                               const int16_t *scan, const int16_t *iscan);
+
+// The quantizers are measured with a mid range qindex on fully populated
+// blocks, the transform sizes follow the _32x32 / _64x64 kernel suffix.
+const int kQuantQIndex = 128;
+
+std::vector<BenchConfig> quantize_configs(const std::string &kernel) {
+    const int bd = name_has(kernel, "highbd") ? 10 : 8;
+    std::vector<BenchConfig> configs;
+    if (name_has(kernel, "64x64"))
+        configs.push_back(make_config(64, 64, bd, TX_64X64, av1_get_max_eob(TX_64X64)));
+    else if (name_has(kernel, "32x32"))
+        configs.push_back(make_config(32, 32, bd, TX_32X32, av1_get_max_eob(TX_32X32)));
+    else {
+        for (int tx = TX_4X4; tx <= TX_16X16; ++tx)
+            configs.push_back(make_config(tx_size_wide[tx], tx_size_high[tx], bd, tx));
+    }
+    return configs;
+}
+
+class QuantizeBBench : public TypedBench<QuantizeBFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return quantize_configs(kernel_);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const TxSize tx_size = (TxSize)cfg.param;
+        const ScanOrder *const sc = &av1_scan_orders[tx_size][DCT_DCT];
+        const Quants *q = &buffers->quants[cfg.bd > 8];
+        const Dequants *dq = &buffers->dequants[cfg.bd > 8];
+        uint16_t eob;
+        return t.measure([&] {
+            f(buffers->qcoeff, av1_get_max_eob(tx_size), 0, q->y_zbin[kQuantQIndex],
+              q->y_round[kQuantQIndex], q->y_quant[kQuantQIndex],
+              q->y_quant_shift[kQuantQIndex], buffers->dqcoeff, (TranLow *)buffers->coeff_out,
+              dq->y_dequant_QTX[kQuantQIndex], &eob, sc->scan, sc->iscan);
+        });
+    }
+};
+
+class QuantizeFpBench : public TypedBench<QuantizeFpFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return quantize_configs(kernel_);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const TxSize tx_size = (TxSize)cfg.param;
+        const ScanOrder *const sc = &av1_scan_orders[tx_size][DCT_DCT];
+        const Quants *q = &buffers->quants[0];
+        const Dequants *dq = &buffers->dequants[0];
+        uint16_t eob;
+        return t.measure([&] {
+            f(buffers->qcoeff, av1_get_max_eob(tx_size), q->y_zbin[kQuantQIndex],
+              q->y_round_fp[kQuantQIndex], q->y_quant_fp[kQuantQIndex],
+              q->y_quant_shift[kQuantQIndex], buffers->dqcoeff, (TranLow *)buffers->coeff_out,
+              dq->y_dequant_QTX[kQuantQIndex], &eob, sc->scan, sc->iscan);
+        });
+    }
+};
+
+/**************************************
+ * Entropy coding
+ **************************************/
+typedef void (*TxbInitLevelsFunc)(const TranLow *const coeff, const int32_t width,
+                                  const int32_t height, uint8_t *const levels);
+typedef void (*NzMapContextsFunc)(const uint8_t *const levels, const int16_t *const scan,
+                                  const uint16_t eob, const TxSize tx_size,
+                                  const TxClass tx_class, int8_t *const coeff_contexts);
+
+// Coefficients are coded in blocks of at most 32x32.
+int txb_wide(int tx) {
+    return AOMMIN(32, tx_size_wide[tx]);
+}
+
+int txb_high(int tx) {
+    return AOMMIN(32, tx_size_high[tx]);
+}
+
+uint8_t *txb_levels(int width) {
+    return buffers->levels + TX_PAD_TOP * (width + TX_PAD_HOR);
+}
+
+class TxbInitLevelsBench : public TypedBench<TxbInitLevelsFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int width = txb_wide(cfg.param);
+        const int height = txb_high(cfg.param);
+        return t.measure([&] { f(buffers->qcoeff, width, height, txb_levels(width)); });
+    }
+};
+
+class NzMapContextsBench : public TypedBench<NzMapContextsFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return tx_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const TxSize tx_size = (TxSize)cfg.param;
+        const int width = txb_wide(tx_size);
+        const uint16_t eob = (uint16_t)av1_get_max_eob(tx_size);
+        av1_txb_init_levels_c(buffers->qcoeff, width, txb_high(tx_size), txb_levels(width));
+        return t.measure([&] {
+            f(txb_levels(width), av1_scan_orders[tx_size][DCT_DCT].scan, eob, tx_size,
+              TX_CLASS_2D, buffers->coeff_contexts);
+        });
+    }
+};
+
+/**************************************
+ * Inter prediction
+ **************************************/
+typedef void (*ConvolveLbdFunc)(const uint8_t *src, int32_t src_stride, uint8_t *dst,
+                                int32_t dst_stride, int32_t w, int32_t h,
+                                InterpFilterParams *filter_params_x,
+                                InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                const int32_t subpel_y_q4, ConvolveParams *conv_params);
+typedef void (*ConvolveHbdFunc)(const uint16_t *src, int32_t src_stride, uint16_t *dst,
+                                int32_t dst_stride, int32_t w, int32_t h,
+                                const InterpFilterParams *filter_params_x,
+                                const InterpFilterParams *filter_params_y,
+                                const int32_t subpel_x_q4, const int32_t subpel_y_q4,
+                                ConvolveParams *conv_params, int32_t bd);
+typedef void (*WarpAffineFunc)(const int32_t *mat, const uint8_t *ref, int width, int height,
+                               int stride, uint8_t *pred, int p_col, int p_row, int p_width,
+                               int p_height, int p_stride, int subsampling_x,
+                               int subsampling_y, ConvolveParams *conv_params, int16_t alpha,
+                               int16_t beta, int16_t gamma, int16_t delta);
+
+// Half pel positions in the directions the kernel filters, compound kernels
+// average into the second prediction.
+class ConvolveSetup {
+  public:
+    ConvolveSetup(const std::string &kernel, const BenchConfig &cfg) {
+        const bool filter_x = !name_has(kernel, "copy") && !name_has(kernel, "_y");
+        const bool filter_y = !name_has(kernel, "copy") && !name_has(kernel, "_x");
+        subpel_x = filter_x ? 8 : 0;
+        subpel_y = filter_y ? 8 : 0;
+        filter_params_x = av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR,
+                                                                       cfg.width);
+        filter_params_y = av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR,
+                                                                       cfg.height);
+        if (name_has(kernel, "jnt"))
+            conv_params =
+                get_conv_params_no_round(0, 1, 0, buffers->conv_buf, MAX_SB_SIZE, 1, cfg.bd);
+        else
+            conv_params = get_conv_params_no_round(0, 0, 0, NULL, 0, 0, cfg.bd);
+    }
+    int32_t subpel_x;
+    int32_t subpel_y;
+    InterpFilterParams filter_params_x;
+    InterpFilterParams filter_params_y;
+    ConvolveParams conv_params;
+};
+
+class ConvolveLbdBench : public TypedBench<ConvolveLbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return block_size_configs(8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        ConvolveSetup s(kernel_, cfg);
+        return t.measure([&] {
+            f(block(buffers->src8), kStride, block(buffers->dst8), kStride, cfg.width,
+              cfg.height, &s.filter_params_x, &s.filter_params_y, s.subpel_x, s.subpel_y,
+              &s.conv_params);
+        });
+    }
+};
+
+class ConvolveHbdBench : public TypedBench<ConvolveHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        std::vector<BenchConfig> configs = block_size_configs(10);
+        std::vector<BenchConfig> configs12 = block_size_configs(12);
+        configs.insert(configs.end(), configs12.begin(), configs12.end());
+        return configs;
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        ConvolveSetup s(kernel_, cfg);
+        return t.measure([&] {
+            f(block(buffers->src16), kStride, block(buffers->dst16), kStride, cfg.width,
+              cfg.height, &s.filter_params_x, &s.filter_params_y, s.subpel_x, s.subpel_y,
+              &s.conv_params, cfg.bd);
+        });
+    }
+};
+
+// Shear parameter at the precision av1_get_shear_params() keeps.
+int16_t reduce_warp_param(int16_t param) {
+    return (int16_t)(ROUND_POWER_OF_TWO_SIGNED(param, WARP_PARAM_REDUCE_BITS) *
+                     (1 << WARP_PARAM_REDUCE_BITS));
+}
+
+// A mild rotation and zoom that passes the shear validity check.
+class WarpAffineBench : public TypedBench<WarpAffineFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return square_configs(8, 64, 8);
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int32_t one = 1 << WARPEDMODEL_PREC_BITS;
+        const int32_t mat[8] = {0, 0, one + 512, 256, -256, one - 512, 0, 0};
+        const int16_t alpha = (int16_t)(mat[2] - one);
+        const int16_t beta = (int16_t)mat[3];
+        const int16_t gamma = (int16_t)(((int64_t)mat[4] * one) / mat[2]);
+        const int16_t delta =
+            (int16_t)(mat[5] - (((int64_t)mat[3] * mat[4] + (mat[2] / 2)) / mat[2]) - one);
+        ConvolveParams conv_params = get_conv_params(0, 0, 0, cfg.bd);
+        return t.measure([&] {
+            f(mat, block(buffers->ref8), MAX_SB_SIZE, MAX_SB_SIZE, kStride, block(buffers->dst8),
+              0, 0, cfg.width, cfg.height, kStride, 0, 0, &conv_params,
+              reduce_warp_param(alpha), reduce_warp_param(beta), reduce_warp_param(gamma),
+              reduce_warp_param(delta));
+        });
+    }
+};
+
+/**************************************
+ * CDEF
+ **************************************/
+typedef int32_t (*CdefFindDirFunc)(const uint16_t *img, int32_t stride, int32_t *var,
+                                   int32_t coeff_shift);
+typedef void (*CdefFilterBlockFunc)(uint8_t *dst8, uint16_t *dst16, int32_t dstride,
+                                    const uint16_t *in, int32_t pri_strength,
+                                    int32_t sec_strength, int32_t dir, int32_t pri_damping,
+                                    int32_t sec_damping, int32_t bsize, int32_t max,
+                                    int32_t coeff_shift);
+typedef uint64_t (*CdefDistFunc)(const uint16_t *dst, int32_t dstride, const uint16_t *src,
+                                 const cdef_list *dlist, int32_t cdef_count, BlockSize bsize,
+                                 int32_t coeff_shift, int32_t pli);
+typedef void (*CdefCopyRectFunc)(uint16_t *dst, int32_t dstride, const uint8_t *src,
+                                 int32_t sstride, int32_t v, int32_t h);
+typedef uint64_t (*CdefSearchDualFunc)(int *lev0, int *lev1, int nb_strengths,
+                                       uint64_t (**mse)[TOTAL_STRENGTHS], int sb_count,
+                                       int fast, int start_gi, int end_gi);
+
+class CdefFindDirBench : public TypedBench<CdefFindDirFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(8, 8, 8), make_config(8, 8, 10)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        int32_t var;
+        return t.measure([&] {
+            bench_sink += f(block(buffers->src16), kStride, &var, cfg.bd - 8);
+        });
+    }
+};
+
+// Luma 8x8 and the chroma block sizes; 8-bit filters into the frame, the
+// high bit depth search path into a 16-bit buffer.
+class CdefFilterBlockBench : public TypedBench<CdefFilterBlockFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        std::vector<BenchConfig> configs;
+        for (int bd = 8; bd <= 10; bd += 2) {
+            configs.push_back(make_config(8, 8, bd, BLOCK_8X8));
+            configs.push_back(make_config(4, 8, bd, BLOCK_4X8));
+            configs.push_back(make_config(8, 4, bd, BLOCK_8X4));
+            configs.push_back(make_config(4, 4, bd, BLOCK_4X4));
+        }
+        return configs;
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int32_t coeff_shift = cfg.bd - 8;
+        const uint16_t *in = block(buffers->ref16);
+        uint8_t *dst8 = cfg.bd == 8 ? block(buffers->dst8) : NULL;
+        uint16_t *dst16 = cfg.bd == 8 ? NULL : block(buffers->dst16);
+        return t.measure([&] {
+            f(dst8, dst16, kStride, in, 4, 2, 2, 5, 5, cfg.param, (256 << coeff_shift) - 1,
+              coeff_shift);
+        });
+    }
+};
+
+// All the 8x8 (luma) or 4x4 (chroma) blocks of a 64x64 filter block.
+class CdefDistBench : public TypedBench<CdefDistFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(64, 64, 8, BLOCK_8X8), make_config(32, 32, 8, BLOCK_4X4)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int bsize_log2 = cfg.param == BLOCK_8X8 ? 3 : 2;
+        cdef_list dlist[MI_SIZE_64X64 * MI_SIZE_64X64];
+        int32_t count = 0;
+        for (int by = 0; by < cfg.height >> bsize_log2; ++by) {
+            for (int bx = 0; bx < cfg.width >> bsize_log2; ++bx) {
+                dlist[count].by = (uint8_t)by;
+                dlist[count].bx = (uint8_t)bx;
+                dlist[count].skip = 0;
+                ++count;
+            }
+        }
+        const int32_t pli = cfg.param == BLOCK_8X8 ? 0 : 1;
+        return t.measure([&] {
+            bench_sink += f(block(buffers->src16), kStride, buffers->dst16, dlist, count,
+                            (BlockSize)cfg.param, 0, pli);
+        });
+    }
+};
+
+class CdefCopyRectBench : public TypedBench<CdefCopyRectFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(64 + 2 * CDEF_HBORDER, 64 + 2 * CDEF_VBORDER, 8)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(buffers->dst16, CDEF_BSTRIDE, block(buffers->src8), kStride, cfg.height,
+              cfg.width);
+        });
+    }
+};
+
+// Pick the 8th luma/chroma strength pair over the SBs of a 1080p SB row.
+class CdefSearchDualBench : public TypedBench<CdefSearchDualFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(1920, 64, 8, 7)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const int sb_count = cfg.width / 64;
+        int lev0[CDEF_MAX_STRENGTHS] = {0};
+        int lev1[CDEF_MAX_STRENGTHS] = {0};
+        uint64_t(*mse[2])[TOTAL_STRENGTHS] = {(uint64_t(*)[TOTAL_STRENGTHS])buffers->cdef_mse[0],
+                                              (uint64_t(*)[TOTAL_STRENGTHS])buffers->cdef_mse[1]};
+        return t.measure([&] {
+            for (int i = 0; i < cfg.param; ++i)
+                lev0[i] = lev1[i] = 9 * i;
+            bench_sink += f(lev0, lev1, cfg.param, mse, sb_count, 0, 0, TOTAL_STRENGTHS);
+        });
+    }
+};
+
+/**************************************
+ * Loop restoration
+ **************************************/
+typedef void (*WienerConvolveFunc)(const uint8_t *src, ptrdiff_t src_stride, uint8_t *dst,
+                                   ptrdiff_t dst_stride, const int16_t *filter_x,
+                                   int32_t x_step_q4, const int16_t *filter_y,
+                                   int32_t y_step_q4, int32_t w, int32_t h,
+                                   const ConvolveParams *conv_params);
+typedef void (*WienerConvolveHbdFunc)(const uint8_t *src, ptrdiff_t src_stride, uint8_t *dst,
+                                      ptrdiff_t dst_stride, const int16_t *filter_x,
+                                      int32_t x_step_q4, const int16_t *filter_y,
+                                      int32_t y_step_q4, int32_t w, int32_t h,
+                                      const ConvolveParams *conv_params, int32_t bps);
+typedef void (*SelfguidedFunc)(const uint8_t *dgd8, int32_t width, int32_t height,
+                               int32_t dgd_stride, int32_t *flt0, int32_t *flt1,
+                               int32_t flt_stride, int32_t sgr_params_idx, int32_t bit_depth,
+                               int32_t highbd);
+typedef void (*ApplySelfguidedFunc)(const uint8_t *dat, int32_t width, int32_t height,
+                                    int32_t stride, int32_t eps, const int32_t *xqd,
+                                    uint8_t *dst, int32_t dst_stride, int32_t *tmpbuf,
+                                    int32_t bit_depth, int32_t highbd);
+typedef void (*WienerStatsFunc)(int32_t wiener_win, const uint8_t *dgd8, const uint8_t *src8,
+                                int32_t h_start, int32_t h_end, int32_t v_start,
+                                int32_t v_end, int32_t dgd_stride, int32_t src_stride,
+                                int64_t *M, int64_t *H);
+typedef void (*WienerStatsHbdFunc)(int32_t wiener_win, const uint8_t *dgd8,
+                                   const uint8_t *src8, int32_t h_start, int32_t h_end,
+                                   int32_t v_start, int32_t v_end, int32_t dgd_stride,
+                                   int32_t src_stride, int64_t *M, int64_t *H,
+                                   AomBitDepth bit_depth);
+typedef int64_t (*PixelProjErrorFunc)(const uint8_t *src8, int32_t width, int32_t height,
+                                      int32_t src_stride, const uint8_t *dat8,
+                                      int32_t dat_stride, int32_t *flt0, int32_t flt0_stride,
+                                      int32_t *flt1, int32_t flt1_stride, int32_t xq[2],
+                                      const SgrParamsType *params);
+typedef PixelProjErrorFunc PixelProjErrorHbdFunc;
+typedef void (*ProjSubspaceFunc)(const uint8_t *src8, int width, int height, int src_stride,
+                                 const uint8_t *dat8, int dat_stride, int use_highbitdepth,
+                                 int32_t *flt0, int flt0_stride, int32_t *flt1,
+                                 int flt1_stride, int *xq, const SgrParamsType *params);
+
+// Restoration kernels run on a 64x64 processing unit.
+const int kRestUnit = RESTORATION_PROC_UNIT_SIZE;
+const int kFltStride = kRestUnit + 8;
+const int16_t kWienerTaps[8] = {3, -7, 15, -22, 15, -7, 3, 0};
+const int32_t kSgrXqd[2] = {-32, 31};
+
+const uint8_t *rest_src(int bd, uint8_t *plane8, uint16_t *plane16) {
+    return bd == 8 ? block(plane8) : CONVERT_TO_BYTEPTR(block(plane16));
+}
+
+class WienerConvolveBench : public TypedBench<WienerConvolveFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const ConvolveParams conv_params = get_conv_params_wiener(cfg.bd);
+        return t.measure([&] {
+            f(block(buffers->src8), kStride, block(buffers->dst8), kStride, kWienerTaps, 16,
+              kWienerTaps, 16, cfg.width, cfg.height, &conv_params);
+        });
+    }
+};
+
+class WienerConvolveHbdBench : public TypedBench<WienerConvolveHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 10), make_config(kRestUnit, kRestUnit, 12)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const ConvolveParams conv_params = get_conv_params_wiener(cfg.bd);
+        return t.measure([&] {
+            f(CONVERT_TO_BYTEPTR(block(buffers->src16)), kStride,
+              CONVERT_TO_BYTEPTR(block(buffers->dst16)), kStride, kWienerTaps, 16, kWienerTaps,
+              16, cfg.width, cfg.height, &conv_params, cfg.bd);
+        });
+    }
+};
+
+class SelfguidedBench : public TypedBench<SelfguidedFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8, 0), make_config(kRestUnit, kRestUnit, 10, 0)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const uint8_t *dgd = rest_src(cfg.bd, buffers->src8, buffers->src16);
+        return t.measure([&] {
+            f(dgd, cfg.width, cfg.height, kStride, buffers->flt0, buffers->flt1, kFltStride,
+              cfg.param, cfg.bd, cfg.bd > 8);
+        });
+    }
+};
+
+class ApplySelfguidedBench : public TypedBench<ApplySelfguidedFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8, 0), make_config(kRestUnit, kRestUnit, 10, 0)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const uint8_t *dat = rest_src(cfg.bd, buffers->src8, buffers->src16);
+        uint8_t *dst = (uint8_t *)rest_src(cfg.bd, buffers->dst8, buffers->dst16);
+        return t.measure([&] {
+            f(dat, cfg.width, cfg.height, kStride, cfg.param, kSgrXqd, dst, kStride,
+              buffers->tmpbuf, cfg.bd, cfg.bd > 8);
+        });
+    }
+};
+
+class WienerStatsBench : public TypedBench<WienerStatsFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8, WIENER_WIN),
+                make_config(kRestUnit, kRestUnit, 8, WIENER_WIN_CHROMA)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(cfg.param, block(buffers->src8), block(buffers->ref8), 0, cfg.width, 0,
+              cfg.height, kStride, kStride, buffers->stats_m, buffers->stats_h);
+        });
+    }
+};
+
+class WienerStatsHbdBench : public TypedBench<WienerStatsHbdFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 10, WIENER_WIN),
+                make_config(kRestUnit, kRestUnit, 10, WIENER_WIN_CHROMA)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        return t.measure([&] {
+            f(cfg.param, CONVERT_TO_BYTEPTR(block(buffers->src16)),
+              CONVERT_TO_BYTEPTR(block(buffers->ref16)), 0, cfg.width, 0, cfg.height, kStride,
+              kStride, buffers->stats_m, buffers->stats_h, (AomBitDepth)cfg.bd);
+        });
+    }
+};
+
+template <typename F>
+class PixelProjErrorBenchBase : public TypedBench<F> {
+  public:
+    using TypedBench<F>::TypedBench;
+    double run_typed(F f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const uint8_t *src = rest_src(cfg.bd, buffers->src8, buffers->src16);
+        const uint8_t *dat = rest_src(cfg.bd, buffers->ref8, buffers->ref16);
+        int32_t xq[2] = {-16, 24};
+        return t.measure([&] {
+            bench_sink += f(src, cfg.width, cfg.height, kStride, dat, kStride, buffers->flt0,
+                            kFltStride, buffers->flt1, kFltStride, xq, &sgr_params[cfg.param]);
+        });
+    }
+};
+
+class PixelProjErrorBench : public PixelProjErrorBenchBase<PixelProjErrorFunc> {
+  public:
+    using PixelProjErrorBenchBase::PixelProjErrorBenchBase;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8, 0)};
+    }
+};
+
+class PixelProjErrorHbdBench : public PixelProjErrorBenchBase<PixelProjErrorHbdFunc> {
+  public:
+    using PixelProjErrorBenchBase::PixelProjErrorBenchBase;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 10, 0)};
+    }
+};
+
+class ProjSubspaceBench : public TypedBench<ProjSubspaceFunc> {
+  public:
+    using TypedBench::TypedBench;
+    std::vector<BenchConfig> configs() const override {
+        return {make_config(kRestUnit, kRestUnit, 8, 0), make_config(kRestUnit, kRestUnit, 10, 0)};
+    }
+    double run_typed(Func f, const BenchConfig &cfg, const BenchTimer &t) const override {
+        const uint8_t *src = rest_src(cfg.bd, buffers->src8, buffers->src16);
+        const uint8_t *dat = rest_src(cfg.bd, buffers->ref8, buffers->ref16);
+        int xq[2];
+        return t.measure([&] {
+            f(src, cfg.width, cfg.height, kStride, dat, kStride, cfg.bd > 8, buffers->flt0,
+              kFltStride, buffers->flt1, kFltStride, xq, &sgr_params[cfg.param]);
+        });
+    }
+};
+
+/**************************************
+ * Kernel table
+ **************************************/
+struct KernelImpl {
+    BenchIsa isa;
+    GenericFunc func;
+};
+
+struct KernelEntry {
+    std::string family;
+    std::string kernel;
+    std::unique_ptr<KernelBench> bench;
+    std::vector<KernelImpl> impls;
+};
+
+std::vector<KernelEntry> kernels;
+
+// The typed Func parameter makes the compiler check each table entry against
+// the signature the family runner calls it with.
+template <typename Bench>
+void add_kernel(const char *family, const char *kernel, int width, int height, BenchIsa isa,
+                typename Bench::Func func) {
+    if (kernels.empty() || kernels.back().kernel != kernel) {
+        KernelEntry entry;
+        entry.family = family;
+        entry.kernel = kernel;
+        entry.bench.reset(new Bench(kernel, width, height));
+        kernels.push_back(std::move(entry));
+    }
+    KernelImpl impl = {isa, reinterpret_cast<GenericFunc>(func)};
+    kernels.back().impls.push_back(impl);
+}
+
+void build_kernel_table() {
+#define BENCH_KERNEL(family, kernel, width, height, isa, func) \
+    add_kernel<family##Bench>(#family, #kernel, width, height, ISA_##isa, func);
+    BENCH_KERNEL_LIST
+#undef BENCH_KERNEL
+}
+
+// Kernels which call other dispatched kernels (e.g. av1_inv_txfm_add) go
+// through the dispatch pointers, point those to the first listed variant.
+void setup_dispatch() {
+#define BENCH_KERNEL(family, kernel, width, height, isa, func) \
+    if (!kernel)                                               \
+        kernel = func;
+    BENCH_KERNEL_LIST
+#undef BENCH_KERNEL
+}
+
+/**************************************
+ * Main
+ **************************************/
+void print_usage(const char *app) {
+    fprintf(stderr,
+            "Usage: %s [--filter=<substring>] [--iterations=<n>] [--list]\n"
+            "  --filter      only run the kernels whose name contains substring\n"
+            "  --iterations  calls per timed batch, 0 (default) calibrates each kernel\n"
+            "  --list        print the kernels and their implementations and exit\n",
+            app);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    int iterations = 0;
+    bool list = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!strncmp(argv[i], "--filter=", 9))
+            filter = argv[i] + 9;
+        else if (!strncmp(argv[i], "--iterations=", 13))
+            iterations = atoi(argv[i] + 13);
+        else if (!strcmp(argv[i], "--list"))
+            list = true;
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    build_kernel_table();
+    if (list) {
+        for (const KernelEntry &entry : kernels) {
+            printf("%s,%s", entry.family.c_str(), entry.kernel.c_str());
+            for (const KernelImpl &impl : entry.impls)
+                printf(",%s", isa_names[impl.isa]);
+            printf("\n");
+        }
+        return 0;
+    }
+
+    init_buffers();
+    setup_dispatch();
+    const BenchTimer timer(iterations);
+
+    printf("family,kernel,isa,width,height,bitdepth,param,cycles_per_call,cycles_per_pixel,"
+           "speedup_vs_c\n");
+    for (const KernelEntry &entry : kernels) {
+        if (filter && !name_has(entry.kernel, filter))
+            continue;
+        for (const BenchConfig &cfg : entry.bench->configs()) {
+            double c_cycles = 0;
+            for (const KernelImpl &impl : entry.impls) {
+                if (!isa_available(impl.isa))
+                    continue;
+                const double cycles = entry.bench->run(impl.func, cfg, timer);
+                if (impl.isa == ISA_C)
+                    c_cycles = cycles;
+                printf("%s,%s,%s,%d,%d,%d,%d,%.1f,%.4f,",
+                       entry.family.c_str(),
+                       entry.kernel.c_str(),
+                       isa_names[impl.isa],
+                       cfg.width,
+                       cfg.height,
+                       cfg.bd,
+                       cfg.param,
+                       cycles,
+                       cycles / cfg.pixels);
+                if (c_cycles > 0)
+                    printf("%.2f", c_cycles / cycles);
+                printf("\n");
+            }
+            fflush(stdout);
+        }
+    }
+    aom_free(buffers);
+    return 0;
+}
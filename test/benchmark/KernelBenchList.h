@@ -0,0 +1,1157 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+/******************************************************************************
+ * @file KernelBenchList.h
+ *
+ * @brief Table of the kernels benchmarked by SvtAv1KernelBench.
+ *
+ * One BENCH_KERNEL(family, kernel, width, height, isa, function) entry per
+ * implementation that setup_rtcd_internal() in aom_dsp_rtcd.h can install in
+ * a dispatch pointer, listed in the same order. The width and height are the
+ * block size fixed by the kernel name, 0 when the kernel takes the size as an
+ * argument. Keep this table in sync when a kernel is added to the dispatch.
+ *
+ ******************************************************************************/
+#ifndef KernelBenchList_h
+#define KernelBenchList_h
+
+#define BENCH_KERNEL_LIST \
+    BENCH_KERNEL(ApplySelfguided, apply_selfguided_restoration, 0, 0, C, apply_selfguided_restoration_c) \
+    BENCH_KERNEL(ApplySelfguided, apply_selfguided_restoration, 0, 0, AVX2, apply_selfguided_restoration_avx2) \
+    BENCH_KERNEL(WienerConvolve, av1_wiener_convolve_add_src, 0, 0, C, av1_wiener_convolve_add_src_c) \
+    BENCH_KERNEL(WienerConvolve, av1_wiener_convolve_add_src, 0, 0, AVX2, av1_wiener_convolve_add_src_avx2) \
+    BENCH_KERNEL(WienerConvolveHbd, av1_highbd_wiener_convolve_add_src, 0, 0, C, av1_highbd_wiener_convolve_add_src_c) \
+    BENCH_KERNEL(WienerConvolveHbd, av1_highbd_wiener_convolve_add_src, 0, 0, AVX2, av1_highbd_wiener_convolve_add_src_avx2) \
+    BENCH_KERNEL(Selfguided, av1_selfguided_restoration, 0, 0, C, av1_selfguided_restoration_c) \
+    BENCH_KERNEL(Selfguided, av1_selfguided_restoration, 0, 0, AVX2, av1_selfguided_restoration_avx2) \
+    BENCH_KERNEL(CdefFindDir, cdef_find_dir, 0, 0, C, cdef_find_dir_c) \
+    BENCH_KERNEL(CdefFindDir, cdef_find_dir, 0, 0, AVX2, cdef_find_dir_avx2) \
+    BENCH_KERNEL(CdefFilterBlock, cdef_filter_block, 0, 0, C, cdef_filter_block_c) \
+    BENCH_KERNEL(CdefFilterBlock, cdef_filter_block, 0, 0, AVX2, cdef_filter_block_avx2) \
+    BENCH_KERNEL(CdefDist, compute_cdef_dist, 0, 0, C, compute_cdef_dist_c) \
+    BENCH_KERNEL(CdefDist, compute_cdef_dist, 0, 0, AVX2, compute_cdef_dist_avx2) \
+    BENCH_KERNEL(CdefCopyRect, copy_rect8_8bit_to_16bit, 0, 0, C, copy_rect8_8bit_to_16bit_c) \
+    BENCH_KERNEL(CdefCopyRect, copy_rect8_8bit_to_16bit, 0, 0, AVX2, copy_rect8_8bit_to_16bit_avx2) \
+    BENCH_KERNEL(WienerStats, av1_compute_stats, 0, 0, C, av1_compute_stats_c) \
+    BENCH_KERNEL(WienerStats, av1_compute_stats, 0, 0, AVX2, av1_compute_stats_avx2) \
+    BENCH_KERNEL(WienerStatsHbd, av1_compute_stats_highbd, 0, 0, C, av1_compute_stats_highbd_c) \
+    BENCH_KERNEL(WienerStatsHbd, av1_compute_stats_highbd, 0, 0, AVX2, av1_compute_stats_highbd_avx2) \
+    BENCH_KERNEL(PixelProjError, av1_lowbd_pixel_proj_error, 0, 0, C, av1_lowbd_pixel_proj_error_c) \
+    BENCH_KERNEL(PixelProjError, av1_lowbd_pixel_proj_error, 0, 0, AVX2, av1_lowbd_pixel_proj_error_avx2) \
+    BENCH_KERNEL(PixelProjErrorHbd, av1_highbd_pixel_proj_error, 0, 0, C, av1_highbd_pixel_proj_error_c) \
+    BENCH_KERNEL(PixelProjErrorHbd, av1_highbd_pixel_proj_error, 0, 0, AVX2, av1_highbd_pixel_proj_error_avx2) \
+    BENCH_KERNEL(IntraEdgeFilterHbd, av1_filter_intra_edge_high, 0, 0, C, av1_filter_intra_edge_high_c) \
+    BENCH_KERNEL(IntraEdgeFilterHbd, av1_filter_intra_edge_high, 0, 0, SSE4_1, av1_filter_intra_edge_high_sse4_1) \
+    BENCH_KERNEL(FrameError, av1_calc_frame_error, 0, 0, C, av1_calc_frame_error_c) \
+    BENCH_KERNEL(FrameError, av1_calc_frame_error, 0, 0, AVX2, av1_calc_frame_error_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_2d_copy_sr, 0, 0, C, av1_highbd_convolve_2d_copy_sr_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_2d_copy_sr, 0, 0, AVX2, av1_highbd_convolve_2d_copy_sr_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_2d_copy, 0, 0, C, av1_highbd_jnt_convolve_2d_copy_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_2d_copy, 0, 0, AVX2, av1_highbd_jnt_convolve_2d_copy_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_y_sr, 0, 0, C, av1_highbd_convolve_y_sr_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_y_sr, 0, 0, AVX2, av1_highbd_convolve_y_sr_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_2d_sr, 0, 0, C, av1_highbd_convolve_2d_sr_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_2d_sr, 0, 0, AVX2, av1_highbd_convolve_2d_sr_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_2d, 0, 0, C, av1_highbd_jnt_convolve_2d_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_2d, 0, 0, AVX2, av1_highbd_jnt_convolve_2d_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_x, 0, 0, C, av1_highbd_jnt_convolve_x_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_x, 0, 0, AVX2, av1_highbd_jnt_convolve_x_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_y, 0, 0, C, av1_highbd_jnt_convolve_y_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_jnt_convolve_y, 0, 0, AVX2, av1_highbd_jnt_convolve_y_avx2) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_x_sr, 0, 0, C, av1_highbd_convolve_x_sr_c) \
+    BENCH_KERNEL(ConvolveHbd, av1_highbd_convolve_x_sr, 0, 0, AVX2, av1_highbd_convolve_x_sr_avx2) \
+    BENCH_KERNEL(CflSubtractAverage, subtract_average, 0, 0, C, subtract_average_c) \
+    BENCH_KERNEL(CflSubtractAverage, subtract_average, 0, 0, AVX2, subtract_average_avx2) \
+    BENCH_KERNEL(IntraEdgeFilter, av1_filter_intra_edge, 0, 0, C, av1_filter_intra_edge_high_c_old) \
+    BENCH_KERNEL(IntraEdgeFilter, av1_filter_intra_edge, 0, 0, SSE4_1, av1_filter_intra_edge_sse4_1) \
+    BENCH_KERNEL(SmoothPredictorAll, eb_smooth_v_predictor, 0, 0, C, smooth_v_predictor_c) \
+    BENCH_KERNEL(SmoothPredictorAll, eb_smooth_v_predictor, 0, 0, SSSE3, eb_smooth_v_predictor_all_ssse3) \
+    BENCH_KERNEL(SmoothPredictorAll, eb_smooth_h_predictor, 0, 0, C, smooth_h_predictor_c) \
+    BENCH_KERNEL(SmoothPredictorAll, eb_smooth_h_predictor, 0, 0, SSSE3, eb_smooth_h_predictor_all_ssse3) \
+    BENCH_KERNEL(ProjSubspace, get_proj_subspace, 0, 0, C, get_proj_subspace_c) \
+    BENCH_KERNEL(ProjSubspace, get_proj_subspace, 0, 0, AVX2, get_proj_subspace_avx2) \
+    BENCH_KERNEL(CdefSearchDual, search_one_dual, 0, 0, C, search_one_dual_c) \
+    BENCH_KERNEL(CdefSearchDual, search_one_dual, 0, 0, AVX2, search_one_dual_avx2) \
+    BENCH_KERNEL(Variance, aom_mse16x16, 16, 16, C, aom_mse16x16_c) \
+    BENCH_KERNEL(Variance, aom_mse16x16, 16, 16, AVX2, aom_mse16x16_avx2) \
+    BENCH_KERNEL(Variance, aom_variance4x4, 4, 4, C, aom_variance4x4_c) \
+    BENCH_KERNEL(Variance, aom_variance4x4, 4, 4, AVX2, aom_variance4x4_sse2) \
+    BENCH_KERNEL(Variance, aom_variance4x8, 4, 8, C, aom_variance4x8_c) \
+    BENCH_KERNEL(Variance, aom_variance4x8, 4, 8, AVX2, aom_variance4x8_sse2) \
+    BENCH_KERNEL(Variance, aom_variance4x16, 4, 16, C, aom_variance4x16_c) \
+    BENCH_KERNEL(Variance, aom_variance4x16, 4, 16, AVX2, aom_variance4x16_sse2) \
+    BENCH_KERNEL(Variance, aom_variance8x4, 8, 4, C, aom_variance8x4_c) \
+    BENCH_KERNEL(Variance, aom_variance8x4, 8, 4, AVX2, aom_variance8x4_sse2) \
+    BENCH_KERNEL(Variance, aom_variance8x8, 8, 8, C, aom_variance8x8_c) \
+    BENCH_KERNEL(Variance, aom_variance8x8, 8, 8, AVX2, aom_variance8x8_sse2) \
+    BENCH_KERNEL(Variance, aom_variance8x16, 8, 16, C, aom_variance8x16_c) \
+    BENCH_KERNEL(Variance, aom_variance8x16, 8, 16, AVX2, aom_variance8x16_sse2) \
+    BENCH_KERNEL(Variance, aom_variance8x32, 8, 32, C, aom_variance8x32_c) \
+    BENCH_KERNEL(Variance, aom_variance8x32, 8, 32, AVX2, aom_variance8x32_sse2) \
+    BENCH_KERNEL(Variance, aom_variance16x4, 16, 4, C, aom_variance16x4_c) \
+    BENCH_KERNEL(Variance, aom_variance16x4, 16, 4, AVX2, aom_variance16x4_avx2) \
+    BENCH_KERNEL(Variance, aom_variance16x8, 16, 8, C, aom_variance16x8_c) \
+    BENCH_KERNEL(Variance, aom_variance16x8, 16, 8, AVX2, aom_variance16x8_avx2) \
+    BENCH_KERNEL(Variance, aom_variance16x16, 16, 16, C, aom_variance16x16_c) \
+    BENCH_KERNEL(Variance, aom_variance16x16, 16, 16, AVX2, aom_variance16x16_avx2) \
+    BENCH_KERNEL(Variance, aom_variance16x32, 16, 32, C, aom_variance16x32_c) \
+    BENCH_KERNEL(Variance, aom_variance16x32, 16, 32, AVX2, aom_variance16x32_avx2) \
+    BENCH_KERNEL(Variance, aom_variance16x64, 16, 64, C, aom_variance16x64_c) \
+    BENCH_KERNEL(Variance, aom_variance16x64, 16, 64, AVX2, aom_variance16x64_avx2) \
+    BENCH_KERNEL(Variance, aom_variance32x8, 32, 8, C, aom_variance32x8_c) \
+    BENCH_KERNEL(Variance, aom_variance32x8, 32, 8, AVX2, aom_variance32x8_avx2) \
+    BENCH_KERNEL(Variance, aom_variance32x16, 32, 16, C, aom_variance32x16_c) \
+    BENCH_KERNEL(Variance, aom_variance32x16, 32, 16, AVX2, aom_variance32x16_avx2) \
+    BENCH_KERNEL(Variance, aom_variance32x32, 32, 32, C, aom_variance32x32_c) \
+    BENCH_KERNEL(Variance, aom_variance32x32, 32, 32, AVX2, aom_variance32x32_avx2) \
+    BENCH_KERNEL(Variance, aom_variance32x64, 32, 64, C, aom_variance32x64_c) \
+    BENCH_KERNEL(Variance, aom_variance32x64, 32, 64, AVX2, aom_variance32x64_avx2) \
+    BENCH_KERNEL(Variance, aom_variance64x16, 64, 16, C, aom_variance64x16_c) \
+    BENCH_KERNEL(Variance, aom_variance64x16, 64, 16, AVX2, aom_variance64x16_avx2) \
+    BENCH_KERNEL(Variance, aom_variance64x32, 64, 32, C, aom_variance64x32_c) \
+    BENCH_KERNEL(Variance, aom_variance64x32, 64, 32, AVX2, aom_variance64x32_avx2) \
+    BENCH_KERNEL(Variance, aom_variance64x64, 64, 64, C, aom_variance64x64_c) \
+    BENCH_KERNEL(Variance, aom_variance64x64, 64, 64, AVX2, aom_variance64x64_avx2) \
+    BENCH_KERNEL(Variance, aom_variance64x128, 64, 128, C, aom_variance64x128_c) \
+    BENCH_KERNEL(Variance, aom_variance64x128, 64, 128, AVX2, aom_variance64x128_avx2) \
+    BENCH_KERNEL(Variance, aom_variance128x64, 128, 64, C, aom_variance128x64_c) \
+    BENCH_KERNEL(Variance, aom_variance128x64, 128, 64, AVX2, aom_variance128x64_avx2) \
+    BENCH_KERNEL(Variance, aom_variance128x128, 128, 128, C, aom_variance128x128_c) \
+    BENCH_KERNEL(Variance, aom_variance128x128, 128, 128, AVX2, aom_variance128x128_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_2d_copy_sr, 0, 0, C, av1_convolve_2d_copy_sr_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_2d_copy_sr, 0, 0, AVX2, av1_convolve_2d_copy_sr_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_2d_sr, 0, 0, C, av1_convolve_2d_sr_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_2d_sr, 0, 0, AVX2, av1_convolve_2d_sr_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_2d_copy, 0, 0, C, av1_jnt_convolve_2d_copy_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_2d_copy, 0, 0, AVX2, av1_jnt_convolve_2d_copy_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_x_sr, 0, 0, C, av1_convolve_x_sr_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_x_sr, 0, 0, AVX2, av1_convolve_x_sr_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_y_sr, 0, 0, C, av1_convolve_y_sr_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_convolve_y_sr, 0, 0, AVX2, av1_convolve_y_sr_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_x, 0, 0, C, av1_jnt_convolve_x_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_x, 0, 0, AVX2, av1_jnt_convolve_x_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_y, 0, 0, C, av1_jnt_convolve_y_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_y, 0, 0, AVX2, av1_jnt_convolve_y_avx2) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_2d, 0, 0, C, av1_jnt_convolve_2d_c) \
+    BENCH_KERNEL(ConvolveLbd, av1_jnt_convolve_2d, 0, 0, AVX2, av1_jnt_convolve_2d_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b, 0, 0, C, aom_quantize_b_c_II) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b, 0, 0, AVX2, aom_highbd_quantize_b_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b_32x32, 0, 0, C, aom_quantize_b_32x32_c_II) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b_32x32, 0, 0, AVX2, aom_highbd_quantize_b_32x32_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b_32x32, 0, 0, C, aom_highbd_quantize_b_32x32_c) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b_32x32, 0, 0, AVX2, aom_highbd_quantize_b_32x32_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b, 0, 0, C, aom_highbd_quantize_b_c) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b, 0, 0, AVX2, aom_highbd_quantize_b_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b_64x64, 0, 0, C, aom_quantize_b_64x64_c_II) \
+    BENCH_KERNEL(QuantizeB, aom_quantize_b_64x64, 0, 0, AVX2, aom_highbd_quantize_b_64x64_avx2) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b_64x64, 0, 0, C, aom_highbd_quantize_b_64x64_c) \
+    BENCH_KERNEL(QuantizeB, aom_highbd_quantize_b_64x64, 0, 0, AVX2, aom_highbd_quantize_b_64x64_avx2) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_16x16, 16, 16, C, av1_inv_txfm2d_add_16x16_c) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_16x16, 16, 16, AVX2, av1_inv_txfm2d_add_16x16_avx2) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_32x32, 32, 32, C, av1_inv_txfm2d_add_32x32_c) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_32x32, 32, 32, AVX2, av1_inv_txfm2d_add_32x32_avx2) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_4x4, 4, 4, C, av1_inv_txfm2d_add_4x4_c) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_4x4, 4, 4, AVX2, av1_inv_txfm2d_add_4x4_avx2) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_64x64, 64, 64, C, av1_inv_txfm2d_add_64x64_c) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_64x64, 64, 64, SSE4_1, av1_inv_txfm2d_add_64x64_sse4_1) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_8x8, 8, 8, C, av1_inv_txfm2d_add_8x8_c) \
+    BENCH_KERNEL(InvTxfmSquare, av1_inv_txfm2d_add_8x8, 8, 8, AVX2, av1_inv_txfm2d_add_8x8_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_8x16, 8, 16, C, av1_inv_txfm2d_add_8x16_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_8x16, 8, 16, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x8, 16, 8, C, av1_inv_txfm2d_add_16x8_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x8, 16, 8, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x32, 16, 32, C, av1_inv_txfm2d_add_16x32_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x32, 16, 32, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x16, 32, 16, C, av1_inv_txfm2d_add_32x16_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x16, 32, 16, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x8, 32, 8, C, av1_inv_txfm2d_add_32x8_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x8, 32, 8, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_8x32, 8, 32, C, av1_inv_txfm2d_add_8x32_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_8x32, 8, 32, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x64, 32, 64, C, av1_inv_txfm2d_add_32x64_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_32x64, 32, 64, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_64x32, 64, 32, C, av1_inv_txfm2d_add_64x32_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_64x32, 64, 32, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x64, 16, 64, C, av1_inv_txfm2d_add_16x64_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_16x64, 16, 64, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_64x16, 64, 16, C, av1_inv_txfm2d_add_64x16_c) \
+    BENCH_KERNEL(InvTxfmEob, av1_inv_txfm2d_add_64x16, 64, 16, AVX2, av1_highbd_inv_txfm_add_avx2) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_4x8, 4, 8, C, av1_inv_txfm2d_add_4x8_c) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_4x8, 4, 8, SSE4_1, av1_inv_txfm2d_add_4x8_sse4_1) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_8x4, 8, 4, C, av1_inv_txfm2d_add_8x4_c) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_8x4, 8, 4, SSE4_1, av1_inv_txfm2d_add_8x4_sse4_1) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_4x16, 4, 16, C, av1_inv_txfm2d_add_4x16_c) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_4x16, 4, 16, SSE4_1, av1_inv_txfm2d_add_4x16_sse4_1) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_16x4, 16, 4, C, av1_inv_txfm2d_add_16x4_c) \
+    BENCH_KERNEL(InvTxfmRect, av1_inv_txfm2d_add_16x4, 16, 4, SSE4_1, av1_inv_txfm2d_add_16x4_sse4_1) \
+    BENCH_KERNEL(InvTxfmAdd, av1_inv_txfm_add, 0, 0, C, av1_inv_txfm_add_c) \
+    BENCH_KERNEL(InvTxfmAdd, av1_inv_txfm_add, 0, 0, SSSE3, av1_inv_txfm_add_ssse3) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp, 0, 0, C, av1_quantize_fp_c) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp, 0, 0, AVX2, av1_quantize_fp_avx2) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp_32x32, 0, 0, C, av1_quantize_fp_32x32_c) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp_32x32, 0, 0, AVX2, av1_quantize_fp_32x32_avx2) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp_64x64, 0, 0, C, av1_quantize_fp_64x64_c) \
+    BENCH_KERNEL(QuantizeFp, av1_quantize_fp_64x64, 0, 0, AVX2, av1_quantize_fp_64x64_avx2) \
+    BENCH_KERNEL(HighbdVariance64, highbd_variance64, 0, 0, C, highbd_variance64_c) \
+    BENCH_KERNEL(HighbdVariance64, highbd_variance64, 0, 0, AVX2, highbd_variance64_avx2) \
+    BENCH_KERNEL(HighbdMse, aom_highbd_8_mse16x16, 16, 16, SSE2, aom_highbd_8_mse16x16_sse2) \
+    BENCH_KERNEL(IntraEdgeUpsample, av1_upsample_intra_edge, 0, 0, C, av1_upsample_intra_edge_c) \
+    BENCH_KERNEL(IntraEdgeUpsample, av1_upsample_intra_edge, 0, 0, SSE4_1, av1_upsample_intra_edge_sse4_1) \
+    BENCH_KERNEL(WarpAffine, av1_warp_affine, 0, 0, C, av1_warp_affine_c) \
+    BENCH_KERNEL(WarpAffine, av1_warp_affine, 0, 0, AVX2, av1_warp_affine_avx2) \
+    BENCH_KERNEL(FilterIntra, av1_filter_intra_predictor, 0, 0, C, av1_filter_intra_predictor_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x16, 16, 16, C, aom_highbd_smooth_v_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x16, 16, 16, AVX2, aom_highbd_smooth_v_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x32, 16, 32, C, aom_highbd_smooth_v_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x32, 16, 32, AVX2, aom_highbd_smooth_v_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x4, 16, 4, C, aom_highbd_smooth_v_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x4, 16, 4, AVX2, aom_highbd_smooth_v_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x64, 16, 64, C, aom_highbd_smooth_v_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x64, 16, 64, AVX2, aom_highbd_smooth_v_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x8, 16, 8, C, aom_highbd_smooth_v_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_16x8, 16, 8, AVX2, aom_highbd_smooth_v_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_2x2, 2, 2, C, aom_highbd_smooth_v_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x16, 32, 16, C, aom_highbd_smooth_v_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x16, 32, 16, AVX2, aom_highbd_smooth_v_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x32, 32, 32, C, aom_highbd_smooth_v_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x32, 32, 32, AVX2, aom_highbd_smooth_v_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x64, 32, 64, C, aom_highbd_smooth_v_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x64, 32, 64, AVX2, aom_highbd_smooth_v_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x8, 32, 8, C, aom_highbd_smooth_v_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_32x8, 32, 8, AVX2, aom_highbd_smooth_v_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x16, 4, 16, C, aom_highbd_smooth_v_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x16, 4, 16, SSSE3, aom_highbd_smooth_v_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x4, 4, 4, C, aom_highbd_smooth_v_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x4, 4, 4, SSSE3, aom_highbd_smooth_v_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x8, 4, 8, C, aom_highbd_smooth_v_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_4x8, 4, 8, SSSE3, aom_highbd_smooth_v_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x16, 64, 16, C, aom_highbd_smooth_v_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x16, 64, 16, AVX2, aom_highbd_smooth_v_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x32, 64, 32, C, aom_highbd_smooth_v_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x32, 64, 32, AVX2, aom_highbd_smooth_v_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x64, 64, 64, C, aom_highbd_smooth_v_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_64x64, 64, 64, AVX2, aom_highbd_smooth_v_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x16, 8, 16, C, aom_highbd_smooth_v_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x16, 8, 16, AVX2, aom_highbd_smooth_v_predictor_8x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x32, 8, 32, C, aom_highbd_smooth_v_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x32, 8, 32, AVX2, aom_highbd_smooth_v_predictor_8x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x4, 8, 4, C, aom_highbd_smooth_v_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x4, 8, 4, AVX2, aom_highbd_smooth_v_predictor_8x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x8, 8, 8, C, aom_highbd_smooth_v_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_v_predictor_8x8, 8, 8, AVX2, aom_highbd_smooth_v_predictor_8x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x16, 16, 16, C, aom_highbd_paeth_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x16, 16, 16, AVX2, aom_highbd_paeth_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x32, 16, 32, C, aom_highbd_paeth_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x32, 16, 32, AVX2, aom_highbd_paeth_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x4, 16, 4, C, aom_highbd_paeth_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x4, 16, 4, AVX2, aom_highbd_paeth_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x64, 16, 64, C, aom_highbd_paeth_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x64, 16, 64, AVX2, aom_highbd_paeth_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x8, 16, 8, C, aom_highbd_paeth_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_16x8, 16, 8, AVX2, aom_highbd_paeth_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_2x2, 2, 2, C, aom_highbd_paeth_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_2x2, 2, 2, AVX2, aom_highbd_paeth_predictor_2x2_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x16, 32, 16, C, aom_highbd_paeth_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x16, 32, 16, AVX2, aom_highbd_paeth_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x32, 32, 32, C, aom_highbd_paeth_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x32, 32, 32, AVX2, aom_highbd_paeth_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x64, 32, 64, C, aom_highbd_paeth_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x64, 32, 64, AVX2, aom_highbd_paeth_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x8, 32, 8, C, aom_highbd_paeth_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_32x8, 32, 8, AVX2, aom_highbd_paeth_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x16, 4, 16, C, aom_highbd_paeth_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x16, 4, 16, AVX2, aom_highbd_paeth_predictor_4x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x4, 4, 4, C, aom_highbd_paeth_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x4, 4, 4, AVX2, aom_highbd_paeth_predictor_4x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x8, 4, 8, C, aom_highbd_paeth_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_4x8, 4, 8, AVX2, aom_highbd_paeth_predictor_4x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x16, 64, 16, C, aom_highbd_paeth_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x16, 64, 16, AVX2, aom_highbd_paeth_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x32, 64, 32, C, aom_highbd_paeth_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x32, 64, 32, AVX2, aom_highbd_paeth_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x64, 64, 64, C, aom_highbd_paeth_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_64x64, 64, 64, AVX2, aom_highbd_paeth_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x16, 8, 16, C, aom_highbd_paeth_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x16, 8, 16, AVX2, aom_highbd_paeth_predictor_8x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x32, 8, 32, C, aom_highbd_paeth_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x32, 8, 32, AVX2, aom_highbd_paeth_predictor_8x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x4, 8, 4, C, aom_highbd_paeth_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x4, 8, 4, AVX2, aom_highbd_paeth_predictor_8x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x8, 8, 8, C, aom_highbd_paeth_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_paeth_predictor_8x8, 8, 8, AVX2, aom_highbd_paeth_predictor_8x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x16, 16, 16, C, aom_highbd_v_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x16, 16, 16, AVX2, aom_highbd_v_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x32, 16, 32, C, aom_highbd_v_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x32, 16, 32, AVX2, aom_highbd_v_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x4, 16, 4, C, aom_highbd_v_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x4, 16, 4, AVX2, aom_highbd_v_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x64, 16, 64, C, aom_highbd_v_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x64, 16, 64, AVX2, aom_highbd_v_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x8, 16, 8, C, aom_highbd_v_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_16x8, 16, 8, AVX2, aom_highbd_v_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_2x2, 2, 2, C, aom_highbd_v_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x16, 32, 16, C, aom_highbd_v_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x16, 32, 16, AVX2, aom_highbd_v_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x32, 32, 32, C, aom_highbd_v_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x32, 32, 32, AVX2, aom_highbd_v_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x64, 32, 64, C, aom_highbd_v_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x64, 32, 64, AVX2, aom_highbd_v_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x8, 32, 8, C, aom_highbd_v_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_32x8, 32, 8, AVX2, aom_highbd_v_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x16, 4, 16, C, aom_highbd_v_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x16, 4, 16, SSE2, aom_highbd_v_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x4, 4, 4, C, aom_highbd_v_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x4, 4, 4, SSE2, aom_highbd_v_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x8, 4, 8, C, aom_highbd_v_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_4x8, 4, 8, SSE2, aom_highbd_v_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x16, 64, 16, C, aom_highbd_v_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x16, 64, 16, AVX2, aom_highbd_v_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x32, 64, 32, C, aom_highbd_v_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x32, 64, 32, AVX2, aom_highbd_v_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x32, 8, 32, C, aom_highbd_v_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x32, 8, 32, SSE2, aom_highbd_v_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x64, 64, 64, C, aom_highbd_v_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_64x64, 64, 64, AVX2, aom_highbd_v_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x16, 8, 16, C, aom_highbd_v_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x16, 8, 16, SSE2, aom_highbd_v_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x4, 8, 4, C, aom_highbd_v_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x4, 8, 4, SSE2, aom_highbd_v_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x8, 8, 8, C, aom_highbd_v_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_v_predictor_8x8, 8, 8, SSE2, aom_highbd_v_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x16, 16, 16, C, aom_highbd_smooth_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x16, 16, 16, AVX2, aom_highbd_smooth_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x32, 16, 32, C, aom_highbd_smooth_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x32, 16, 32, AVX2, aom_highbd_smooth_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x4, 16, 4, C, aom_highbd_smooth_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x4, 16, 4, AVX2, aom_highbd_smooth_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x64, 16, 64, C, aom_highbd_smooth_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x64, 16, 64, AVX2, aom_highbd_smooth_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x8, 16, 8, C, aom_highbd_smooth_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_16x8, 16, 8, AVX2, aom_highbd_smooth_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_2x2, 2, 2, C, aom_highbd_smooth_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x16, 32, 16, C, aom_highbd_smooth_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x16, 32, 16, AVX2, aom_highbd_smooth_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x32, 32, 32, C, aom_highbd_smooth_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x32, 32, 32, AVX2, aom_highbd_smooth_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x64, 32, 64, C, aom_highbd_smooth_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x64, 32, 64, AVX2, aom_highbd_smooth_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x8, 32, 8, C, aom_highbd_smooth_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_32x8, 32, 8, AVX2, aom_highbd_smooth_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x16, 4, 16, C, aom_highbd_smooth_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x16, 4, 16, SSSE3, aom_highbd_smooth_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x4, 4, 4, C, aom_highbd_smooth_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x4, 4, 4, SSSE3, aom_highbd_smooth_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x8, 4, 8, C, aom_highbd_smooth_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_4x8, 4, 8, SSSE3, aom_highbd_smooth_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x16, 64, 16, C, aom_highbd_smooth_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x16, 64, 16, AVX2, aom_highbd_smooth_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x32, 64, 32, C, aom_highbd_smooth_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x32, 64, 32, AVX2, aom_highbd_smooth_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x64, 64, 64, C, aom_highbd_smooth_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_64x64, 64, 64, AVX2, aom_highbd_smooth_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x16, 8, 16, C, aom_highbd_smooth_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x16, 8, 16, AVX2, aom_highbd_smooth_predictor_8x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x32, 8, 32, C, aom_highbd_smooth_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x32, 8, 32, AVX2, aom_highbd_smooth_predictor_8x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x4, 8, 4, C, aom_highbd_smooth_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x4, 8, 4, AVX2, aom_highbd_smooth_predictor_8x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x8, 8, 8, C, aom_highbd_smooth_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_predictor_8x8, 8, 8, AVX2, aom_highbd_smooth_predictor_8x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x16, 16, 16, C, aom_highbd_smooth_h_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x16, 16, 16, AVX2, aom_highbd_smooth_h_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x32, 16, 32, C, aom_highbd_smooth_h_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x32, 16, 32, AVX2, aom_highbd_smooth_h_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x4, 16, 4, C, aom_highbd_smooth_h_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x4, 16, 4, AVX2, aom_highbd_smooth_h_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x64, 16, 64, C, aom_highbd_smooth_h_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x64, 16, 64, AVX2, aom_highbd_smooth_h_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x8, 16, 8, C, aom_highbd_smooth_h_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_16x8, 16, 8, AVX2, aom_highbd_smooth_h_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_2x2, 2, 2, C, aom_highbd_smooth_h_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x16, 32, 16, C, aom_highbd_smooth_h_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x16, 32, 16, AVX2, aom_highbd_smooth_h_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x32, 32, 32, C, aom_highbd_smooth_h_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x32, 32, 32, AVX2, aom_highbd_smooth_h_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x64, 32, 64, C, aom_highbd_smooth_h_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x64, 32, 64, AVX2, aom_highbd_smooth_h_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x8, 32, 8, C, aom_highbd_smooth_h_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_32x8, 32, 8, AVX2, aom_highbd_smooth_h_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x16, 4, 16, C, aom_highbd_smooth_h_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x16, 4, 16, SSSE3, aom_highbd_smooth_h_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x4, 4, 4, C, aom_highbd_smooth_h_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x4, 4, 4, SSSE3, aom_highbd_smooth_h_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x8, 4, 8, C, aom_highbd_smooth_h_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_4x8, 4, 8, SSSE3, aom_highbd_smooth_h_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x16, 64, 16, C, aom_highbd_smooth_h_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x16, 64, 16, AVX2, aom_highbd_smooth_h_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x32, 64, 32, C, aom_highbd_smooth_h_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x32, 64, 32, AVX2, aom_highbd_smooth_h_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x64, 64, 64, C, aom_highbd_smooth_h_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_64x64, 64, 64, AVX2, aom_highbd_smooth_h_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x16, 8, 16, C, aom_highbd_smooth_h_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x16, 8, 16, AVX2, aom_highbd_smooth_h_predictor_8x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x32, 8, 32, C, aom_highbd_smooth_h_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x32, 8, 32, AVX2, aom_highbd_smooth_h_predictor_8x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x4, 8, 4, C, aom_highbd_smooth_h_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x4, 8, 4, AVX2, aom_highbd_smooth_h_predictor_8x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x8, 8, 8, C, aom_highbd_smooth_h_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_smooth_h_predictor_8x8, 8, 8, AVX2, aom_highbd_smooth_h_predictor_8x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x16, 16, 16, C, aom_highbd_dc_128_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x16, 16, 16, AVX2, aom_highbd_dc_128_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x32, 16, 32, C, aom_highbd_dc_128_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x32, 16, 32, AVX2, aom_highbd_dc_128_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x4, 16, 4, C, aom_highbd_dc_128_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x4, 16, 4, AVX2, aom_highbd_dc_128_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x64, 16, 64, C, aom_highbd_dc_128_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x64, 16, 64, AVX2, aom_highbd_dc_128_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x8, 16, 8, C, aom_highbd_dc_128_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_16x8, 16, 8, AVX2, aom_highbd_dc_128_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_2x2, 2, 2, C, aom_highbd_dc_128_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x16, 32, 16, C, aom_highbd_dc_128_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x16, 32, 16, AVX2, aom_highbd_dc_128_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x32, 32, 32, C, aom_highbd_dc_128_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x32, 32, 32, AVX2, aom_highbd_dc_128_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x64, 32, 64, C, aom_highbd_dc_128_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x64, 32, 64, AVX2, aom_highbd_dc_128_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x8, 32, 8, C, aom_highbd_dc_128_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_32x8, 32, 8, AVX2, aom_highbd_dc_128_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x16, 4, 16, C, aom_highbd_dc_128_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x16, 4, 16, SSE2, aom_highbd_dc_128_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x4, 4, 4, C, aom_highbd_dc_128_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x4, 4, 4, SSE2, aom_highbd_dc_128_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x8, 4, 8, C, aom_highbd_dc_128_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_4x8, 4, 8, SSE2, aom_highbd_dc_128_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x32, 8, 32, C, aom_highbd_dc_128_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x32, 8, 32, SSE2, aom_highbd_dc_128_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x16, 64, 16, C, aom_highbd_dc_128_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x16, 64, 16, AVX2, aom_highbd_dc_128_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x32, 64, 32, C, aom_highbd_dc_128_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x32, 64, 32, AVX2, aom_highbd_dc_128_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x64, 64, 64, C, aom_highbd_dc_128_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_64x64, 64, 64, AVX2, aom_highbd_dc_128_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x16, 8, 16, C, aom_highbd_dc_128_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x16, 8, 16, SSE2, aom_highbd_dc_128_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x4, 8, 4, C, aom_highbd_dc_128_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x4, 8, 4, SSE2, aom_highbd_dc_128_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x8, 8, 8, C, aom_highbd_dc_128_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_128_predictor_8x8, 8, 8, SSE2, aom_highbd_dc_128_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x16, 16, 16, C, aom_highbd_dc_left_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x16, 16, 16, AVX2, aom_highbd_dc_left_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x32, 16, 32, C, aom_highbd_dc_left_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x32, 16, 32, AVX2, aom_highbd_dc_left_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x4, 16, 4, C, aom_highbd_dc_left_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x4, 16, 4, AVX2, aom_highbd_dc_left_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x64, 16, 64, C, aom_highbd_dc_left_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x64, 16, 64, AVX2, aom_highbd_dc_left_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x8, 16, 8, C, aom_highbd_dc_left_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_16x8, 16, 8, AVX2, aom_highbd_dc_left_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_2x2, 2, 2, C, aom_highbd_dc_left_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x16, 32, 16, C, aom_highbd_dc_left_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x16, 32, 16, AVX2, aom_highbd_dc_left_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x32, 32, 32, C, aom_highbd_dc_left_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x32, 32, 32, AVX2, aom_highbd_dc_left_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x64, 32, 64, C, aom_highbd_dc_left_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x64, 32, 64, AVX2, aom_highbd_dc_left_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x8, 32, 8, C, aom_highbd_dc_left_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_32x8, 32, 8, AVX2, aom_highbd_dc_left_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x16, 4, 16, C, aom_highbd_dc_left_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x16, 4, 16, SSE2, aom_highbd_dc_left_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x4, 4, 4, C, aom_highbd_dc_left_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x4, 4, 4, SSE2, aom_highbd_dc_left_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x8, 4, 8, C, aom_highbd_dc_left_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_4x8, 4, 8, SSE2, aom_highbd_dc_left_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x32, 8, 32, C, aom_highbd_dc_left_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x32, 8, 32, SSE2, aom_highbd_dc_left_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x16, 64, 16, C, aom_highbd_dc_left_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x16, 64, 16, AVX2, aom_highbd_dc_left_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x32, 64, 32, C, aom_highbd_dc_left_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x32, 64, 32, AVX2, aom_highbd_dc_left_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x64, 64, 64, C, aom_highbd_dc_left_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_64x64, 64, 64, AVX2, aom_highbd_dc_left_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x16, 8, 16, C, aom_highbd_dc_left_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x16, 8, 16, SSE2, aom_highbd_dc_left_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x4, 8, 4, C, aom_highbd_dc_left_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x4, 8, 4, SSE2, aom_highbd_dc_left_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x8, 8, 8, C, aom_highbd_dc_left_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_left_predictor_8x8, 8, 8, SSE2, aom_highbd_dc_left_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x16, 16, 16, C, aom_highbd_dc_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x16, 16, 16, AVX2, aom_highbd_dc_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x32, 16, 32, C, aom_highbd_dc_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x32, 16, 32, AVX2, aom_highbd_dc_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x4, 16, 4, C, aom_highbd_dc_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x4, 16, 4, AVX2, aom_highbd_dc_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x64, 16, 64, C, aom_highbd_dc_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x64, 16, 64, AVX2, aom_highbd_dc_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x8, 16, 8, C, aom_highbd_dc_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_16x8, 16, 8, AVX2, aom_highbd_dc_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_2x2, 2, 2, C, aom_highbd_dc_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x16, 32, 16, C, aom_highbd_dc_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x16, 32, 16, AVX2, aom_highbd_dc_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x32, 32, 32, C, aom_highbd_dc_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x32, 32, 32, AVX2, aom_highbd_dc_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x64, 32, 64, C, aom_highbd_dc_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x64, 32, 64, AVX2, aom_highbd_dc_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x8, 32, 8, C, aom_highbd_dc_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_32x8, 32, 8, AVX2, aom_highbd_dc_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x16, 4, 16, C, aom_highbd_dc_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x16, 4, 16, SSE2, aom_highbd_dc_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x4, 4, 4, C, aom_highbd_dc_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x4, 4, 4, SSE2, aom_highbd_dc_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x8, 4, 8, C, aom_highbd_dc_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_4x8, 4, 8, SSE2, aom_highbd_dc_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x16, 64, 16, C, aom_highbd_dc_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x16, 64, 16, AVX2, aom_highbd_dc_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x32, 64, 32, C, aom_highbd_dc_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x32, 64, 32, AVX2, aom_highbd_dc_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x64, 64, 64, C, aom_highbd_dc_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_64x64, 64, 64, AVX2, aom_highbd_dc_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x16, 8, 16, C, aom_highbd_dc_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x16, 8, 16, SSE2, aom_highbd_dc_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x4, 8, 4, C, aom_highbd_dc_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x4, 8, 4, SSE2, aom_highbd_dc_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x8, 8, 8, C, aom_highbd_dc_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x8, 8, 8, SSE2, aom_highbd_dc_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x32, 8, 32, C, aom_highbd_dc_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_predictor_8x32, 8, 32, SSE2, aom_highbd_dc_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x16, 16, 16, C, aom_highbd_dc_top_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x16, 16, 16, AVX2, aom_highbd_dc_top_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x32, 16, 32, C, aom_highbd_dc_top_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x32, 16, 32, AVX2, aom_highbd_dc_top_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x4, 16, 4, C, aom_highbd_dc_top_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x4, 16, 4, AVX2, aom_highbd_dc_top_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x64, 16, 64, C, aom_highbd_dc_top_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x64, 16, 64, AVX2, aom_highbd_dc_top_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x8, 16, 8, C, aom_highbd_dc_top_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_16x8, 16, 8, AVX2, aom_highbd_dc_top_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_2x2, 2, 2, C, aom_highbd_dc_top_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x16, 32, 16, C, aom_highbd_dc_top_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x16, 32, 16, AVX2, aom_highbd_dc_top_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x32, 32, 32, C, aom_highbd_dc_top_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x32, 32, 32, AVX2, aom_highbd_dc_top_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x64, 32, 64, C, aom_highbd_dc_top_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x64, 32, 64, AVX2, aom_highbd_dc_top_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x8, 32, 8, C, aom_highbd_dc_top_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_32x8, 32, 8, AVX2, aom_highbd_dc_top_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x16, 4, 16, C, aom_highbd_dc_top_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x16, 4, 16, SSE2, aom_highbd_dc_top_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x4, 4, 4, C, aom_highbd_dc_top_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x4, 4, 4, SSE2, aom_highbd_dc_top_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x8, 4, 8, C, aom_highbd_dc_top_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_4x8, 4, 8, SSE2, aom_highbd_dc_top_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x16, 64, 16, C, aom_highbd_dc_top_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x16, 64, 16, AVX2, aom_highbd_dc_top_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x32, 64, 32, C, aom_highbd_dc_top_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x32, 64, 32, AVX2, aom_highbd_dc_top_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x64, 64, 64, C, aom_highbd_dc_top_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_64x64, 64, 64, AVX2, aom_highbd_dc_top_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x16, 8, 16, C, aom_highbd_dc_top_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x16, 8, 16, SSE2, aom_highbd_dc_top_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x32, 8, 32, C, aom_highbd_dc_top_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x4, 8, 4, C, aom_highbd_dc_top_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x4, 8, 4, SSE2, aom_highbd_dc_top_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x8, 8, 8, C, aom_highbd_dc_top_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_dc_top_predictor_8x8, 8, 8, SSE2, aom_highbd_dc_top_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x4, 16, 4, C, aom_highbd_h_predictor_16x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x4, 16, 4, AVX2, aom_highbd_h_predictor_16x4_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x64, 16, 64, C, aom_highbd_h_predictor_16x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x64, 16, 64, AVX2, aom_highbd_h_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x8, 16, 8, C, aom_highbd_h_predictor_16x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x8, 16, 8, SSE2, aom_highbd_h_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_2x2, 2, 2, C, aom_highbd_h_predictor_2x2_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x16, 32, 16, C, aom_highbd_h_predictor_32x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x16, 32, 16, SSE2, aom_highbd_h_predictor_32x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x32, 32, 32, C, aom_highbd_h_predictor_32x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x32, 32, 32, SSE2, aom_highbd_h_predictor_32x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x64, 32, 64, C, aom_highbd_h_predictor_32x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x64, 32, 64, AVX2, aom_highbd_h_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x8, 32, 8, C, aom_highbd_h_predictor_32x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_32x8, 32, 8, AVX2, aom_highbd_h_predictor_32x8_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x16, 4, 16, C, aom_highbd_h_predictor_4x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x16, 4, 16, SSE2, aom_highbd_h_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x4, 4, 4, C, aom_highbd_h_predictor_4x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x4, 4, 4, SSE2, aom_highbd_h_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x8, 4, 8, C, aom_highbd_h_predictor_4x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_4x8, 4, 8, SSE2, aom_highbd_h_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x16, 64, 16, C, aom_highbd_h_predictor_64x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x16, 64, 16, AVX2, aom_highbd_h_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x32, 64, 32, C, aom_highbd_h_predictor_64x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x32, 64, 32, AVX2, aom_highbd_h_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x32, 8, 32, C, aom_highbd_h_predictor_8x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x32, 8, 32, SSE2, aom_highbd_h_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x64, 64, 64, C, aom_highbd_h_predictor_64x64_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_64x64, 64, 64, AVX2, aom_highbd_h_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x16, 8, 16, C, aom_highbd_h_predictor_8x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x16, 8, 16, SSE2, aom_highbd_h_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x4, 8, 4, C, aom_highbd_h_predictor_8x4_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x4, 8, 4, SSE2, aom_highbd_h_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x8, 8, 8, C, aom_highbd_h_predictor_8x8_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_8x8, 8, 8, SSE2, aom_highbd_h_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x16, 16, 16, C, aom_highbd_h_predictor_16x16_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x16, 16, 16, SSE2, aom_highbd_h_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x32, 16, 32, C, aom_highbd_h_predictor_16x32_c) \
+    BENCH_KERNEL(IntraHbd, aom_highbd_h_predictor_16x32, 16, 32, SSE2, aom_highbd_h_predictor_16x32_sse2) \
+    BENCH_KERNEL(CflPredictLbd, cfl_predict_lbd, 0, 0, C, cfl_predict_lbd_c) \
+    BENCH_KERNEL(CflPredictLbd, cfl_predict_lbd, 0, 0, AVX2, cfl_predict_lbd_avx2) \
+    BENCH_KERNEL(CflPredictHbd, cfl_predict_hbd, 0, 0, C, cfl_predict_hbd_c) \
+    BENCH_KERNEL(CflPredictHbd, cfl_predict_hbd, 0, 0, AVX2, cfl_predict_hbd_avx2) \
+    BENCH_KERNEL(DrZ1Lbd, av1_dr_prediction_z1, 0, 0, C, av1_dr_prediction_z1_c) \
+    BENCH_KERNEL(DrZ1Lbd, av1_dr_prediction_z1, 0, 0, AVX2, av1_dr_prediction_z1_avx2) \
+    BENCH_KERNEL(DrZ2Lbd, av1_dr_prediction_z2, 0, 0, C, av1_dr_prediction_z2_c) \
+    BENCH_KERNEL(DrZ2Lbd, av1_dr_prediction_z2, 0, 0, AVX2, av1_dr_prediction_z2_avx2) \
+    BENCH_KERNEL(DrZ3Lbd, av1_dr_prediction_z3, 0, 0, C, av1_dr_prediction_z3_c) \
+    BENCH_KERNEL(DrZ3Lbd, av1_dr_prediction_z3, 0, 0, AVX2, av1_dr_prediction_z3_avx2) \
+    BENCH_KERNEL(DrZ1Hbd, av1_highbd_dr_prediction_z1, 0, 0, C, av1_highbd_dr_prediction_z1_c) \
+    BENCH_KERNEL(DrZ1Hbd, av1_highbd_dr_prediction_z1, 0, 0, AVX2, av1_highbd_dr_prediction_z1_avx2) \
+    BENCH_KERNEL(DrZ2Hbd, av1_highbd_dr_prediction_z2, 0, 0, C, av1_highbd_dr_prediction_z2_c) \
+    BENCH_KERNEL(DrZ2Hbd, av1_highbd_dr_prediction_z2, 0, 0, AVX2, av1_highbd_dr_prediction_z2_avx2) \
+    BENCH_KERNEL(DrZ3Hbd, av1_highbd_dr_prediction_z3, 0, 0, C, av1_highbd_dr_prediction_z3_c) \
+    BENCH_KERNEL(DrZ3Hbd, av1_highbd_dr_prediction_z3, 0, 0, AVX2, av1_highbd_dr_prediction_z3_avx2) \
+    BENCH_KERNEL(NzMapContexts, av1_get_nz_map_contexts, 0, 0, SSE2, av1_get_nz_map_contexts_sse2) \
+    BENCH_KERNEL(Residual, ResidualKernel, 0, 0, C, residual_kernel_c) \
+    BENCH_KERNEL(Residual, ResidualKernel, 0, 0, AVX2, ResidualKernel_avx2) \
+    BENCH_KERNEL(TxbInitLevels, av1_txb_init_levels, 0, 0, C, av1_txb_init_levels_c) \
+    BENCH_KERNEL(TxbInitLevels, av1_txb_init_levels, 0, 0, AVX2, av1_txb_init_levels_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x16, 16, 16, C, aom_paeth_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x16, 16, 16, SSSE3, aom_paeth_predictor_16x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x16, 16, 16, AVX2, aom_paeth_predictor_16x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x32, 16, 32, C, aom_paeth_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x32, 16, 32, SSSE3, aom_paeth_predictor_16x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x32, 16, 32, AVX2, aom_paeth_predictor_16x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x4, 16, 4, C, aom_paeth_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x4, 16, 4, SSSE3, aom_paeth_predictor_16x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x64, 16, 64, C, aom_paeth_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x64, 16, 64, SSSE3, aom_paeth_predictor_16x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x64, 16, 64, AVX2, aom_paeth_predictor_16x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x8, 16, 8, C, aom_paeth_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x8, 16, 8, SSSE3, aom_paeth_predictor_16x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_16x8, 16, 8, AVX2, aom_paeth_predictor_16x8_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x16, 32, 16, C, aom_paeth_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x16, 32, 16, SSSE3, aom_paeth_predictor_32x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x16, 32, 16, AVX2, aom_paeth_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x32, 32, 32, C, aom_paeth_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x32, 32, 32, SSSE3, aom_paeth_predictor_32x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x32, 32, 32, AVX2, aom_paeth_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x64, 32, 64, C, aom_paeth_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x64, 32, 64, SSSE3, aom_paeth_predictor_32x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x64, 32, 64, AVX2, aom_paeth_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x8, 32, 8, C, aom_paeth_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_32x8, 32, 8, SSSE3, aom_paeth_predictor_32x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x16, 4, 16, C, aom_paeth_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x16, 4, 16, SSSE3, aom_paeth_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x4, 4, 4, C, aom_paeth_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x4, 4, 4, SSSE3, aom_paeth_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x8, 4, 8, C, aom_paeth_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_4x8, 4, 8, SSSE3, aom_paeth_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x16, 64, 16, C, aom_paeth_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x16, 64, 16, SSSE3, aom_paeth_predictor_64x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x16, 64, 16, AVX2, aom_paeth_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x32, 64, 32, C, aom_paeth_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x32, 64, 32, SSSE3, aom_paeth_predictor_64x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x32, 64, 32, AVX2, aom_paeth_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x64, 64, 64, C, aom_paeth_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x64, 64, 64, SSSE3, aom_paeth_predictor_64x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_64x64, 64, 64, AVX2, aom_paeth_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x16, 8, 16, C, aom_paeth_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x16, 8, 16, SSSE3, aom_paeth_predictor_8x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x32, 8, 32, C, aom_paeth_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x32, 8, 32, SSSE3, aom_paeth_predictor_8x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x4, 8, 4, C, aom_paeth_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x4, 8, 4, SSSE3, aom_paeth_predictor_8x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x8, 8, 8, C, aom_paeth_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_paeth_predictor_8x8, 8, 8, SSSE3, aom_paeth_predictor_8x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x4, 4, 4, C, aom_dc_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x4, 4, 4, SSE2, aom_dc_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x8, 8, 8, C, aom_dc_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x8, 8, 8, SSE2, aom_dc_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x16, 16, 16, C, aom_dc_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x16, 16, 16, SSE2, aom_dc_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x32, 32, 32, C, aom_dc_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x32, 32, 32, AVX2, aom_dc_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x64, 64, 64, C, aom_dc_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x64, 64, 64, AVX2, aom_dc_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x16, 32, 16, C, aom_dc_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x16, 32, 16, AVX2, aom_dc_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x64, 32, 64, C, aom_dc_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x64, 32, 64, AVX2, aom_dc_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x16, 64, 16, C, aom_dc_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x16, 64, 16, AVX2, aom_dc_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x16, 8, 16, C, aom_dc_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x16, 8, 16, SSE2, aom_dc_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x32, 8, 32, C, aom_dc_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x32, 8, 32, SSE2, aom_dc_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x4, 8, 4, C, aom_dc_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_8x4, 8, 4, SSE2, aom_dc_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x32, 64, 32, C, aom_dc_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_64x32, 64, 32, AVX2, aom_dc_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x32, 16, 32, C, aom_dc_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x32, 16, 32, SSE2, aom_dc_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x4, 16, 4, C, aom_dc_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x4, 16, 4, SSE2, aom_dc_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x64, 16, 64, C, aom_dc_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x64, 16, 64, SSE2, aom_dc_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x8, 16, 8, C, aom_dc_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_16x8, 16, 8, SSE2, aom_dc_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x8, 32, 8, C, aom_dc_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_32x8, 32, 8, SSE2, aom_dc_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x16, 4, 16, C, aom_dc_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x16, 4, 16, SSE2, aom_dc_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x8, 4, 8, C, aom_dc_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_predictor_4x8, 4, 8, SSE2, aom_dc_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x4, 4, 4, C, aom_dc_top_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x4, 4, 4, SSE2, aom_dc_top_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x8, 8, 8, C, aom_dc_top_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x8, 8, 8, SSE2, aom_dc_top_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x16, 16, 16, C, aom_dc_top_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x16, 16, 16, SSE2, aom_dc_top_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x32, 32, 32, C, aom_dc_top_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x32, 32, 32, AVX2, aom_dc_top_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x64, 64, 64, C, aom_dc_top_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x64, 64, 64, AVX2, aom_dc_top_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x32, 16, 32, C, aom_dc_top_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x32, 16, 32, SSE2, aom_dc_top_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x4, 16, 4, C, aom_dc_top_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x4, 16, 4, SSE2, aom_dc_top_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x64, 16, 64, C, aom_dc_top_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x64, 16, 64, SSE2, aom_dc_top_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x8, 16, 8, C, aom_dc_top_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_16x8, 16, 8, SSE2, aom_dc_top_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x16, 32, 16, C, aom_dc_top_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x16, 32, 16, AVX2, aom_dc_top_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x64, 32, 64, C, aom_dc_top_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x64, 32, 64, AVX2, aom_dc_top_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x8, 32, 8, C, aom_dc_top_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_32x8, 32, 8, SSE2, aom_dc_top_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x16, 4, 16, C, aom_dc_top_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x16, 4, 16, SSE2, aom_dc_top_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x8, 4, 8, C, aom_dc_top_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_4x8, 4, 8, SSE2, aom_dc_top_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x16, 64, 16, C, aom_dc_top_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x16, 64, 16, AVX2, aom_dc_top_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x32, 64, 32, C, aom_dc_top_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_64x32, 64, 32, AVX2, aom_dc_top_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x16, 8, 16, C, aom_dc_top_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x16, 8, 16, SSE2, aom_dc_top_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x32, 8, 32, C, aom_dc_top_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x32, 8, 32, SSE2, aom_dc_top_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x4, 8, 4, C, aom_dc_top_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_top_predictor_8x4, 8, 4, SSE2, aom_dc_top_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x4, 4, 4, C, aom_dc_left_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x4, 4, 4, SSE2, aom_dc_left_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x8, 8, 8, C, aom_dc_left_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x8, 8, 8, SSE2, aom_dc_left_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x16, 16, 16, C, aom_dc_left_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x16, 16, 16, SSE2, aom_dc_left_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x32, 32, 32, C, aom_dc_left_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x32, 32, 32, AVX2, aom_dc_left_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x64, 64, 64, C, aom_dc_left_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x64, 64, 64, AVX2, aom_dc_left_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x32, 16, 32, C, aom_dc_left_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x32, 16, 32, SSE2, aom_dc_left_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x4, 16, 4, C, aom_dc_left_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x4, 16, 4, SSE2, aom_dc_left_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x64, 16, 64, C, aom_dc_left_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x64, 16, 64, SSE2, aom_dc_left_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x8, 16, 8, C, aom_dc_left_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_16x8, 16, 8, SSE2, aom_dc_left_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x16, 32, 16, C, aom_dc_left_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x16, 32, 16, AVX2, aom_dc_left_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x64, 32, 64, C, aom_dc_left_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x64, 32, 64, AVX2, aom_dc_left_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x16, 64, 16, C, aom_dc_left_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x16, 64, 16, AVX2, aom_dc_left_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x32, 64, 32, C, aom_dc_left_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_64x32, 64, 32, AVX2, aom_dc_left_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x8, 32, 8, C, aom_dc_left_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_32x8, 32, 8, SSE2, aom_dc_left_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x16, 4, 16, C, aom_dc_left_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x16, 4, 16, SSE2, aom_dc_left_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x8, 4, 8, C, aom_dc_left_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_4x8, 4, 8, SSE2, aom_dc_left_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x16, 8, 16, C, aom_dc_left_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x16, 8, 16, SSE2, aom_dc_left_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x32, 8, 32, C, aom_dc_left_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x32, 8, 32, SSE2, aom_dc_left_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x4, 8, 4, C, aom_dc_left_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_left_predictor_8x4, 8, 4, SSE2, aom_dc_left_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x4, 4, 4, C, aom_dc_128_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x4, 4, 4, SSE2, aom_dc_128_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x8, 8, 8, C, aom_dc_128_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x8, 8, 8, SSE2, aom_dc_128_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x16, 16, 16, C, aom_dc_128_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x16, 16, 16, SSE2, aom_dc_128_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x32, 32, 32, C, aom_dc_128_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x32, 32, 32, AVX2, aom_dc_128_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x64, 64, 64, C, aom_dc_128_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x64, 64, 64, AVX2, aom_dc_128_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x32, 16, 32, C, aom_dc_128_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x32, 16, 32, SSE2, aom_dc_128_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x4, 16, 4, C, aom_dc_128_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x4, 16, 4, SSE2, aom_dc_128_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x64, 16, 64, C, aom_dc_128_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x64, 16, 64, SSE2, aom_dc_128_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x8, 16, 8, C, aom_dc_128_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_16x8, 16, 8, SSE2, aom_dc_128_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x16, 32, 16, C, aom_dc_128_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x16, 32, 16, AVX2, aom_dc_128_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x64, 32, 64, C, aom_dc_128_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x64, 32, 64, AVX2, aom_dc_128_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x8, 32, 8, C, aom_dc_128_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_32x8, 32, 8, SSE2, aom_dc_128_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x16, 4, 16, C, aom_dc_128_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x16, 4, 16, SSE2, aom_dc_128_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x8, 4, 8, C, aom_dc_128_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_4x8, 4, 8, SSE2, aom_dc_128_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x16, 64, 16, C, aom_dc_128_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x16, 64, 16, AVX2, aom_dc_128_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x32, 64, 32, C, aom_dc_128_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_64x32, 64, 32, AVX2, aom_dc_128_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x16, 8, 16, C, aom_dc_128_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x16, 8, 16, SSE2, aom_dc_128_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x32, 8, 32, C, aom_dc_128_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x32, 8, 32, SSE2, aom_dc_128_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x4, 8, 4, C, aom_dc_128_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_dc_128_predictor_8x4, 8, 4, SSE2, aom_dc_128_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x32, 16, 32, C, aom_smooth_h_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x32, 16, 32, SSSE3, aom_smooth_h_predictor_16x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x4, 16, 4, C, aom_smooth_h_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x4, 16, 4, SSSE3, aom_smooth_h_predictor_16x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x64, 16, 64, C, aom_smooth_h_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x64, 16, 64, SSSE3, aom_smooth_h_predictor_16x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x8, 16, 8, C, aom_smooth_h_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x8, 16, 8, SSSE3, aom_smooth_h_predictor_16x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x16, 32, 16, C, aom_smooth_h_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x16, 32, 16, SSSE3, aom_smooth_h_predictor_32x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x64, 32, 64, C, aom_smooth_h_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x64, 32, 64, SSSE3, aom_smooth_h_predictor_32x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x8, 32, 8, C, aom_smooth_h_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x8, 32, 8, SSSE3, aom_smooth_h_predictor_32x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x16, 4, 16, C, aom_smooth_h_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x16, 4, 16, SSSE3, aom_smooth_h_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x8, 4, 8, C, aom_smooth_h_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x8, 4, 8, SSSE3, aom_smooth_h_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x16, 64, 16, C, aom_smooth_h_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x16, 64, 16, SSSE3, aom_smooth_h_predictor_64x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x32, 64, 32, C, aom_smooth_h_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x32, 64, 32, SSSE3, aom_smooth_h_predictor_64x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x16, 8, 16, C, aom_smooth_h_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x16, 8, 16, SSSE3, aom_smooth_h_predictor_8x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x32, 8, 32, C, aom_smooth_h_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x32, 8, 32, SSSE3, aom_smooth_h_predictor_8x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x4, 8, 4, C, aom_smooth_h_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x4, 8, 4, SSSE3, aom_smooth_h_predictor_8x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x64, 64, 64, C, aom_smooth_h_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_64x64, 64, 64, SSSE3, aom_smooth_h_predictor_64x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x32, 32, 32, C, aom_smooth_h_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_32x32, 32, 32, SSSE3, aom_smooth_h_predictor_32x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x16, 16, 16, C, aom_smooth_h_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_16x16, 16, 16, SSSE3, aom_smooth_h_predictor_16x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x8, 8, 8, C, aom_smooth_h_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_8x8, 8, 8, SSSE3, aom_smooth_h_predictor_8x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x4, 4, 4, C, aom_smooth_h_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_h_predictor_4x4, 4, 4, SSSE3, aom_smooth_h_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x32, 16, 32, SSSE3, aom_smooth_v_predictor_16x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x4, 16, 4, C, aom_smooth_v_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x4, 16, 4, SSSE3, aom_smooth_v_predictor_16x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x64, 16, 64, C, aom_smooth_v_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x64, 16, 64, SSSE3, aom_smooth_v_predictor_16x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x8, 16, 8, C, aom_smooth_v_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x8, 16, 8, SSSE3, aom_smooth_v_predictor_16x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x16, 32, 16, C, aom_smooth_v_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x16, 32, 16, SSSE3, aom_smooth_v_predictor_32x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x64, 32, 64, C, aom_smooth_v_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x64, 32, 64, SSSE3, aom_smooth_v_predictor_32x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x8, 32, 8, C, aom_smooth_v_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x8, 32, 8, SSSE3, aom_smooth_v_predictor_32x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x16, 4, 16, C, aom_smooth_v_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x16, 4, 16, SSSE3, aom_smooth_v_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x8, 4, 8, C, aom_smooth_v_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x8, 4, 8, SSSE3, aom_smooth_v_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x16, 64, 16, C, aom_smooth_v_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x16, 64, 16, SSSE3, aom_smooth_v_predictor_64x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x32, 64, 32, C, aom_smooth_v_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x32, 64, 32, SSSE3, aom_smooth_v_predictor_64x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x16, 8, 16, C, aom_smooth_v_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x16, 8, 16, SSSE3, aom_smooth_v_predictor_8x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x32, 8, 32, C, aom_smooth_v_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x32, 8, 32, SSSE3, aom_smooth_v_predictor_8x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x4, 8, 4, C, aom_smooth_v_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x4, 8, 4, SSSE3, aom_smooth_v_predictor_8x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x64, 64, 64, C, aom_smooth_v_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_64x64, 64, 64, SSSE3, aom_smooth_v_predictor_64x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x32, 32, 32, C, aom_smooth_v_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_32x32, 32, 32, SSSE3, aom_smooth_v_predictor_32x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x16, 16, 16, C, aom_smooth_v_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_16x16, 16, 16, SSSE3, aom_smooth_v_predictor_16x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x8, 8, 8, C, aom_smooth_v_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_8x8, 8, 8, SSSE3, aom_smooth_v_predictor_8x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x4, 4, 4, C, aom_smooth_v_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_v_predictor_4x4, 4, 4, SSSE3, aom_smooth_v_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x32, 16, 32, C, aom_smooth_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x32, 16, 32, SSSE3, aom_smooth_predictor_16x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x4, 16, 4, C, aom_smooth_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x4, 16, 4, SSSE3, aom_smooth_predictor_16x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x64, 16, 64, C, aom_smooth_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x64, 16, 64, SSSE3, aom_smooth_predictor_16x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x8, 16, 8, C, aom_smooth_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x8, 16, 8, SSSE3, aom_smooth_predictor_16x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x16, 32, 16, C, aom_smooth_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x16, 32, 16, SSSE3, aom_smooth_predictor_32x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x64, 32, 64, C, aom_smooth_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x64, 32, 64, SSSE3, aom_smooth_predictor_32x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x8, 32, 8, C, aom_smooth_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x8, 32, 8, SSSE3, aom_smooth_predictor_32x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x16, 4, 16, C, aom_smooth_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x16, 4, 16, SSSE3, aom_smooth_predictor_4x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x8, 4, 8, C, aom_smooth_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x8, 4, 8, SSSE3, aom_smooth_predictor_4x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x16, 64, 16, C, aom_smooth_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x16, 64, 16, SSSE3, aom_smooth_predictor_64x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x32, 64, 32, C, aom_smooth_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x32, 64, 32, SSSE3, aom_smooth_predictor_64x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x16, 8, 16, C, aom_smooth_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x16, 8, 16, SSSE3, aom_smooth_predictor_8x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x32, 8, 32, C, aom_smooth_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x32, 8, 32, SSSE3, aom_smooth_predictor_8x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x4, 8, 4, C, aom_smooth_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x4, 8, 4, SSSE3, aom_smooth_predictor_8x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x64, 64, 64, C, aom_smooth_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_64x64, 64, 64, SSSE3, aom_smooth_predictor_64x64_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x32, 32, 32, C, aom_smooth_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_32x32, 32, 32, SSSE3, aom_smooth_predictor_32x32_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x16, 16, 16, C, aom_smooth_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_16x16, 16, 16, SSSE3, aom_smooth_predictor_16x16_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x8, 8, 8, C, aom_smooth_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_8x8, 8, 8, SSSE3, aom_smooth_predictor_8x8_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x4, 4, 4, C, aom_smooth_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_smooth_predictor_4x4, 4, 4, SSSE3, aom_smooth_predictor_4x4_ssse3) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x4, 4, 4, C, aom_v_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x4, 4, 4, SSE2, aom_v_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x8, 8, 8, C, aom_v_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x8, 8, 8, SSE2, aom_v_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x16, 16, 16, C, aom_v_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x16, 16, 16, SSE2, aom_v_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x32, 32, 32, C, aom_v_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x32, 32, 32, AVX2, aom_v_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x64, 64, 64, C, aom_v_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x64, 64, 64, AVX2, aom_v_predictor_64x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x32, 16, 32, C, aom_v_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x32, 16, 32, SSE2, aom_v_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x4, 16, 4, C, aom_v_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x4, 16, 4, SSE2, aom_v_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x64, 16, 64, C, aom_v_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x64, 16, 64, SSE2, aom_v_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x8, 16, 8, C, aom_v_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_16x8, 16, 8, SSE2, aom_v_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x16, 32, 16, C, aom_v_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x16, 32, 16, AVX2, aom_v_predictor_32x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x64, 32, 64, C, aom_v_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x64, 32, 64, AVX2, aom_v_predictor_32x64_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x8, 32, 8, C, aom_v_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_32x8, 32, 8, SSE2, aom_v_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x16, 4, 16, C, aom_v_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x16, 4, 16, SSE2, aom_v_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x8, 4, 8, C, aom_v_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_4x8, 4, 8, SSE2, aom_v_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x16, 64, 16, C, aom_v_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x16, 64, 16, AVX2, aom_v_predictor_64x16_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x32, 64, 32, C, aom_v_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_64x32, 64, 32, AVX2, aom_v_predictor_64x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x16, 8, 16, C, aom_v_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x16, 8, 16, SSE2, aom_v_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x32, 8, 32, C, aom_v_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x32, 8, 32, SSE2, aom_v_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x4, 8, 4, C, aom_v_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_v_predictor_8x4, 8, 4, SSE2, aom_v_predictor_8x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x4, 4, 4, C, aom_h_predictor_4x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x4, 4, 4, SSE2, aom_h_predictor_4x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x8, 8, 8, C, aom_h_predictor_8x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x8, 8, 8, SSE2, aom_h_predictor_8x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x16, 16, 16, C, aom_h_predictor_16x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x16, 16, 16, SSE2, aom_h_predictor_16x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x32, 32, 32, C, aom_h_predictor_32x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x32, 32, 32, AVX2, aom_h_predictor_32x32_avx2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x64, 64, 64, C, aom_h_predictor_64x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x64, 64, 64, SSE2, aom_h_predictor_64x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x32, 16, 32, C, aom_h_predictor_16x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x32, 16, 32, SSE2, aom_h_predictor_16x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x4, 16, 4, C, aom_h_predictor_16x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x4, 16, 4, SSE2, aom_h_predictor_16x4_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x64, 16, 64, C, aom_h_predictor_16x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x64, 16, 64, SSE2, aom_h_predictor_16x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x8, 16, 8, C, aom_h_predictor_16x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_16x8, 16, 8, SSE2, aom_h_predictor_16x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x16, 32, 16, C, aom_h_predictor_32x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x16, 32, 16, SSE2, aom_h_predictor_32x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x64, 32, 64, C, aom_h_predictor_32x64_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x64, 32, 64, SSE2, aom_h_predictor_32x64_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x8, 32, 8, C, aom_h_predictor_32x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_32x8, 32, 8, SSE2, aom_h_predictor_32x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x16, 4, 16, C, aom_h_predictor_4x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x16, 4, 16, SSE2, aom_h_predictor_4x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x8, 4, 8, C, aom_h_predictor_4x8_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_4x8, 4, 8, SSE2, aom_h_predictor_4x8_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x16, 64, 16, C, aom_h_predictor_64x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x16, 64, 16, SSE2, aom_h_predictor_64x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x32, 64, 32, C, aom_h_predictor_64x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_64x32, 64, 32, SSE2, aom_h_predictor_64x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x16, 8, 16, C, aom_h_predictor_8x16_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x16, 8, 16, SSE2, aom_h_predictor_8x16_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x32, 8, 32, C, aom_h_predictor_8x32_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x32, 8, 32, SSE2, aom_h_predictor_8x32_sse2) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x4, 8, 4, C, aom_h_predictor_8x4_c) \
+    BENCH_KERNEL(IntraLbd, aom_h_predictor_8x4, 8, 4, SSE2, aom_h_predictor_8x4_sse2) \
+    BENCH_KERNEL(Sad, aom_sad4x4, 4, 4, C, aom_sad4x4_c) \
+    BENCH_KERNEL(Sad, aom_sad4x4, 4, 4, AVX2, aom_sad4x4_avx2) \
+    BENCH_KERNEL(Sad, aom_sad4x16, 4, 16, C, aom_sad4x16_c) \
+    BENCH_KERNEL(Sad, aom_sad4x16, 4, 16, AVX2, aom_sad4x16_avx2) \
+    BENCH_KERNEL(Sad, aom_sad4x8, 4, 8, C, aom_sad4x8_c) \
+    BENCH_KERNEL(Sad, aom_sad4x8, 4, 8, AVX2, aom_sad4x8_avx2) \
+    BENCH_KERNEL(Sad, aom_sad64x128, 64, 128, C, aom_sad64x128_c) \
+    BENCH_KERNEL(Sad, aom_sad64x128, 64, 128, AVX2, aom_sad64x128_avx2) \
+    BENCH_KERNEL(Sad, aom_sad64x16, 64, 16, C, aom_sad64x16_c) \
+    BENCH_KERNEL(Sad, aom_sad64x16, 64, 16, AVX2, aom_sad64x16_avx2) \
+    BENCH_KERNEL(Sad, aom_sad64x32, 64, 32, C, aom_sad64x32_c) \
+    BENCH_KERNEL(Sad, aom_sad64x32, 64, 32, AVX2, aom_sad64x32_avx2) \
+    BENCH_KERNEL(Sad, aom_sad64x64, 64, 64, C, aom_sad64x64_c) \
+    BENCH_KERNEL(Sad, aom_sad64x64, 64, 64, AVX2, aom_sad64x64_avx2) \
+    BENCH_KERNEL(Sad, aom_sad8x16, 8, 16, C, aom_sad8x16_c) \
+    BENCH_KERNEL(Sad, aom_sad8x16, 8, 16, AVX2, aom_sad8x16_avx2) \
+    BENCH_KERNEL(Sad, aom_sad8x32, 8, 32, C, aom_sad8x32_c) \
+    BENCH_KERNEL(Sad, aom_sad8x32, 8, 32, AVX2, aom_sad8x32_avx2) \
+    BENCH_KERNEL(Sad, aom_sad8x8, 8, 8, C, aom_sad8x8_c) \
+    BENCH_KERNEL(Sad, aom_sad8x8, 8, 8, AVX2, aom_sad8x8_avx2) \
+    BENCH_KERNEL(Sad, aom_sad16x4, 16, 4, C, aom_sad16x4_c) \
+    BENCH_KERNEL(Sad, aom_sad16x4, 16, 4, AVX2, aom_sad16x4_avx2) \
+    BENCH_KERNEL(Sad, aom_sad32x8, 32, 8, C, aom_sad32x8_c) \
+    BENCH_KERNEL(Sad, aom_sad32x8, 32, 8, AVX2, aom_sad32x8_avx2) \
+    BENCH_KERNEL(Sad, aom_sad16x64, 16, 64, C, aom_sad16x64_c) \
+    BENCH_KERNEL(Sad, aom_sad16x64, 16, 64, AVX2, aom_sad16x64_avx2) \
+    BENCH_KERNEL(Sad, aom_sad128x128, 128, 128, C, aom_sad128x128_c) \
+    BENCH_KERNEL(Sad, aom_sad128x128, 128, 128, AVX2, aom_sad128x128_avx2) \
+    BENCH_KERNEL(Sad, aom_sad128x64, 128, 64, C, aom_sad128x64_c) \
+    BENCH_KERNEL(Sad, aom_sad128x64, 128, 64, AVX2, aom_sad128x64_avx2) \
+    BENCH_KERNEL(Sad, aom_sad32x16, 32, 16, C, aom_sad32x16_c) \
+    BENCH_KERNEL(Sad, aom_sad32x16, 32, 16, AVX2, aom_sad32x16_avx2) \
+    BENCH_KERNEL(Sad, aom_sad16x32, 16, 32, C, aom_sad16x32_c) \
+    BENCH_KERNEL(Sad, aom_sad16x32, 16, 32, AVX2, aom_sad16x32_avx2) \
+    BENCH_KERNEL(Sad, aom_sad32x64, 32, 64, C, aom_sad32x64_c) \
+    BENCH_KERNEL(Sad, aom_sad32x64, 32, 64, AVX2, aom_sad32x64_avx2) \
+    BENCH_KERNEL(Sad, aom_sad32x32, 32, 32, C, aom_sad32x32_c) \
+    BENCH_KERNEL(Sad, aom_sad32x32, 32, 32, AVX2, aom_sad32x32_avx2) \
+    BENCH_KERNEL(Sad, aom_sad16x16, 16, 16, C, aom_sad16x16_c) \
+    BENCH_KERNEL(Sad, aom_sad16x16, 16, 16, AVX2, aom_sad16x16_avx2) \
+    BENCH_KERNEL(Sad, aom_sad16x8, 16, 8, C, aom_sad16x8_c) \
+    BENCH_KERNEL(Sad, aom_sad16x8, 16, 8, AVX2, aom_sad16x8_avx2) \
+    BENCH_KERNEL(Sad, aom_sad8x4, 8, 4, C, aom_sad8x4_c) \
+    BENCH_KERNEL(Sad, aom_sad8x4, 8, 4, AVX2, aom_sad8x4_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad4x4x4d, 4, 4, C, aom_sad4x4x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad4x4x4d, 4, 4, AVX2, aom_sad4x4x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad4x16x4d, 4, 16, C, aom_sad4x16x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad4x16x4d, 4, 16, AVX2, aom_sad4x16x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad4x8x4d, 4, 8, C, aom_sad4x8x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad4x8x4d, 4, 8, AVX2, aom_sad4x8x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad64x128x4d, 64, 128, C, aom_sad64x128x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad64x128x4d, 64, 128, AVX2, aom_sad64x128x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad64x16x4d, 64, 16, C, aom_sad64x16x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad64x16x4d, 64, 16, AVX2, aom_sad64x16x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad64x32x4d, 64, 32, C, aom_sad64x32x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad64x32x4d, 64, 32, AVX2, aom_sad64x32x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad64x64x4d, 64, 64, C, aom_sad64x64x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad64x64x4d, 64, 64, AVX2, aom_sad64x64x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad8x16x4d, 8, 16, C, aom_sad8x16x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad8x16x4d, 8, 16, AVX2, aom_sad8x16x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad8x32x4d, 8, 32, C, aom_sad8x32x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad8x32x4d, 8, 32, AVX2, aom_sad8x32x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad8x8x4d, 8, 8, C, aom_sad8x8x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad8x8x4d, 8, 8, AVX2, aom_sad8x8x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad16x4x4d, 16, 4, C, aom_sad16x4x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad16x4x4d, 16, 4, AVX2, aom_sad16x4x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad32x8x4d, 32, 8, C, aom_sad32x8x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad32x8x4d, 32, 8, AVX2, aom_sad32x8x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad16x64x4d, 16, 64, C, aom_sad16x64x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad16x64x4d, 16, 64, AVX2, aom_sad16x64x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad128x128x4d, 128, 128, C, aom_sad128x128x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad128x128x4d, 128, 128, AVX2, aom_sad128x128x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad128x64x4d, 128, 64, C, aom_sad128x64x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad128x64x4d, 128, 64, AVX2, aom_sad128x64x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad32x16x4d, 32, 16, C, aom_sad32x16x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad32x16x4d, 32, 16, AVX2, aom_sad32x16x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad16x32x4d, 16, 32, C, aom_sad16x32x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad16x32x4d, 16, 32, AVX2, aom_sad16x32x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad32x64x4d, 32, 64, C, aom_sad32x64x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad32x64x4d, 32, 64, AVX2, aom_sad32x64x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad32x32x4d, 32, 32, C, aom_sad32x32x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad32x32x4d, 32, 32, AVX2, aom_sad32x32x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad16x16x4d, 16, 16, C, aom_sad16x16x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad16x16x4d, 16, 16, AVX2, aom_sad16x16x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad16x8x4d, 16, 8, C, aom_sad16x8x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad16x8x4d, 16, 8, AVX2, aom_sad16x8x4d_avx2) \
+    BENCH_KERNEL(Sad4d, aom_sad8x4x4d, 8, 4, C, aom_sad8x4x4d_c) \
+    BENCH_KERNEL(Sad4d, aom_sad8x4x4d, 8, 4, AVX2, aom_sad8x4x4d_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x8, 16, 8, C, av1_fwd_txfm2d_16x8_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x8, 16, 8, AVX2, av1_fwd_txfm2d_16x8_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x16, 8, 16, C, av1_fwd_txfm2d_8x16_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x16, 8, 16, AVX2, av1_fwd_txfm2d_8x16_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x4, 16, 4, C, av1_fwd_txfm2d_16x4_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x4, 16, 4, AVX2, av1_fwd_txfm2d_16x4_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x16, 4, 16, C, av1_fwd_txfm2d_4x16_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x16, 4, 16, AVX2, av1_fwd_txfm2d_4x16_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x4, 8, 4, C, av1_fwd_txfm2d_8x4_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x4, 8, 4, AVX2, av1_fwd_txfm2d_8x4_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x8, 4, 8, C, av1_fwd_txfm2d_4x8_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x8, 4, 8, AVX2, av1_fwd_txfm2d_4x8_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x16, 32, 16, C, av1_fwd_txfm2d_32x16_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x16, 32, 16, AVX2, av1_fwd_txfm2d_32x16_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x8, 32, 8, C, av1_fwd_txfm2d_32x8_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x8, 32, 8, AVX2, av1_fwd_txfm2d_32x8_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x32, 8, 32, C, av1_fwd_txfm2d_8x32_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x32, 8, 32, AVX2, av1_fwd_txfm2d_8x32_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x32, 16, 32, C, av1_fwd_txfm2d_16x32_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x32, 16, 32, AVX2, av1_fwd_txfm2d_16x32_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x64, 32, 64, C, av1_fwd_txfm2d_32x64_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x64, 32, 64, AVX2, av1_fwd_txfm2d_32x64_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x32, 64, 32, C, av1_fwd_txfm2d_64x32_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x32, 64, 32, AVX2, av1_fwd_txfm2d_64x32_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x64, 16, 64, C, av1_fwd_txfm2d_16x64_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x64, 16, 64, AVX2, av1_fwd_txfm2d_16x64_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x16, 64, 16, C, av1_fwd_txfm2d_64x16_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x16, 64, 16, AVX2, av1_fwd_txfm2d_64x16_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x64, 64, 64, C, Av1TransformTwoD_64x64_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_64x64, 64, 64, AVX2, av1_fwd_txfm2d_64x64_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x32, 32, 32, C, Av1TransformTwoD_32x32_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_32x32, 32, 32, AVX2, av1_fwd_txfm2d_32x32_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x16, 16, 16, C, Av1TransformTwoD_16x16_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_16x16, 16, 16, AVX2, av1_fwd_txfm2d_16x16_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x8, 8, 8, C, Av1TransformTwoD_8x8_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_8x8, 8, 8, AVX2, av1_fwd_txfm2d_8x8_avx2) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x4, 4, 4, C, Av1TransformTwoD_4x4_c) \
+    BENCH_KERNEL(FwdTxfm, av1_fwd_txfm2d_4x4, 4, 4, SSE4_1, av1_fwd_txfm2d_4x4_sse4_1) \
+    BENCH_KERNEL(HandleTransform, HandleTransform16x64, 16, 64, C, HandleTransform16x64_c) \
+    BENCH_KERNEL(HandleTransform, HandleTransform16x64, 16, 64, AVX2, HandleTransform16x64_avx2) \
+    BENCH_KERNEL(HandleTransform, HandleTransform32x64, 32, 64, C, HandleTransform32x64_c) \
+    BENCH_KERNEL(HandleTransform, HandleTransform32x64, 32, 64, AVX2, HandleTransform32x64_avx2) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x16, 64, 16, C, HandleTransform64x16_c) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x16, 64, 16, AVX2, HandleTransform64x16_avx2) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x32, 64, 32, C, HandleTransform64x32_c) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x32, 64, 32, AVX2, HandleTransform64x32_avx2) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x64, 64, 64, C, HandleTransform64x64_c) \
+    BENCH_KERNEL(HandleTransform, HandleTransform64x64, 64, 64, AVX2, HandleTransform64x64_avx2) \
+    BENCH_KERNEL(Fft, aom_fft2x2_float, 2, 2, C, aom_fft2x2_float_c) \
+    BENCH_KERNEL(Fft, aom_fft4x4_float, 4, 4, C, aom_fft4x4_float_c) \
+    BENCH_KERNEL(Fft, aom_fft4x4_float, 4, 4, SSE2, aom_fft4x4_float_sse2) \
+    BENCH_KERNEL(Fft, aom_fft16x16_float, 16, 16, C, aom_fft16x16_float_c) \
+    BENCH_KERNEL(Fft, aom_fft16x16_float, 16, 16, AVX2, aom_fft16x16_float_avx2) \
+    BENCH_KERNEL(Fft, aom_fft32x32_float, 32, 32, C, aom_fft32x32_float_c) \
+    BENCH_KERNEL(Fft, aom_fft32x32_float, 32, 32, AVX2, aom_fft32x32_float_avx2) \
+    BENCH_KERNEL(Fft, aom_fft8x8_float, 8, 8, C, aom_fft8x8_float_c) \
+    BENCH_KERNEL(Fft, aom_fft8x8_float, 8, 8, AVX2, aom_fft8x8_float_avx2) \
+    BENCH_KERNEL(Fft, aom_ifft16x16_float, 16, 16, AVX2, aom_ifft16x16_float_avx2) \
+    BENCH_KERNEL(Fft, aom_ifft32x32_float, 32, 32, AVX2, aom_ifft32x32_float_avx2) \
+    BENCH_KERNEL(Fft, aom_ifft8x8_float, 8, 8, AVX2, aom_ifft8x8_float_avx2) \
+    BENCH_KERNEL(Fft, aom_ifft2x2_float, 2, 2, C, aom_ifft2x2_float_c) \
+    BENCH_KERNEL(Fft, aom_ifft4x4_float, 4, 4, SSE2, aom_ifft4x4_float_sse2)
+
+#endif // KernelBenchList_h
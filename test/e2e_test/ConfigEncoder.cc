@@ -45,3 +45,15 @@ int copy_enc_param(EbSvtAv1EncConfiguration *dst_enc_config, void *config_ptr) {
            sizeof(EbSvtAv1EncConfiguration));
     return 0;
 }
+
+EbErrorType verify_enc_config(void *config_ptr) {
+    EbConfig *config = (EbConfig *)config_ptr;
+    // The frames come from the video source of the test, not from an input
+    // file of the config
+    FILE *input_file = config->input_file;
+    if (input_file == NULL)
+        config->input_file = stdin;
+    EbErrorType return_error = VerifySettings(config, 0);
+    config->input_file = input_file;
+    return return_error;
+}
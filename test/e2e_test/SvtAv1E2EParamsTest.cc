@@ -209,3 +209,38 @@ TEST_P(CodingOptionTest, CheckEncOptionsUsingBitstream) {
 INSTANTIATE_TEST_CASE_P(SvtAv1, CodingOptionTest,
                         ::testing::ValuesIn(default_enc_settings),
                         GetSettingName);
+
+/** Test vectors of the ReadAhead option of the app, which the encoder
+ * configuration does not carry */
+static const std::vector<string> valid_read_ahead = {"0", "1", "8", "60"};
+static const std::vector<string> invalid_read_ahead = {"-1", "-60"};
+
+/** verify the app settings with the given options over the defaults */
+static EbErrorType verify_app_setting(const map<string, string> &setting) {
+    void *enc_config = create_enc_config();
+    for (auto &x : setting)
+        set_enc_config(enc_config, x.first.c_str(), x.second.c_str());
+    EbErrorType return_error = verify_enc_config(enc_config);
+    release_enc_config(enc_config);
+    return return_error;
+}
+
+TEST(AppConfigTest, CheckReadAhead) {
+    EXPECT_EQ(EB_ErrorNone, verify_app_setting({}));
+    for (auto &value : valid_read_ahead)
+        EXPECT_EQ(EB_ErrorNone, verify_app_setting({{"ReadAhead", value}}))
+            << "ReadAhead: " << value;
+    for (auto &value : invalid_read_ahead)
+        EXPECT_EQ(EB_ErrorBadParameter,
+                  verify_app_setting({{"ReadAhead", value}}))
+            << "ReadAhead: " << value;
+    /** read ahead is not supported with buffered input */
+    EXPECT_EQ(EB_ErrorNone,
+              verify_app_setting({{"FrameToBeEncoded", "20"},
+                                  {"BufferedInput", "10"},
+                                  {"ReadAhead", "0"}}));
+    EXPECT_EQ(EB_ErrorBadParameter,
+              verify_app_setting({{"FrameToBeEncoded", "20"},
+                                  {"BufferedInput", "10"},
+                                  {"ReadAhead", "8"}}));
+}
@@ -117,6 +117,23 @@ static const std::vector<EncTestSetting> default_enc_settings = {
     {"TileTest3", {{"TileCol", "1"}, {"TileRow", "1"}}, default_test_vectors},
     {"ScreenToolTest1", {{"ScreenContentMode", "0"}}, default_test_vectors},
     {"ConstrainIntraTest1", {{"ConstrainedIntra", "1"}}, default_test_vectors},
+
+    // test the CRF mode, with and without the VBV buffer model
+    {"CrfTest1",
+     {{"RateControlMode", "4"}, {"QP", "35"}, {"IntraPeriod", "31"}},
+     long_test_vectors},
+    {"CrfTest2",
+     {{"RateControlMode", "4"}, {"QP", "35"}, {"IntraPeriod", "63"}},
+     long_test_vectors},
+    {"CrfTest3",
+     {{"RateControlMode", "4"}, {"QP", "35"}, {"IntraPeriod", "-1"}},
+     long_test_vectors},
+    {"CrfVbvTest1",
+     {{"RateControlMode", "4"},
+      {"QP", "20"},
+      {"VbvMaxRate", "500000"},
+      {"VbvBufferSize", "250000"}},
+     long_test_vectors},
 };
 
 INSTANTIATE_TEST_CASE_P(SvtAv1, ConformanceDeathTest,